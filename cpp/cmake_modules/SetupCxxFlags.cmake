@@ -20,6 +20,9 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 CHECK_CXX_COMPILER_FLAG("-msse3" CXX_SUPPORTS_SSE3)
+# Only used for kernels selected at runtime with CpuInfo
+CHECK_CXX_COMPILER_FLAG("-msse4.1" CXX_SUPPORTS_SSE4_1)
+CHECK_CXX_COMPILER_FLAG("-mavx2" CXX_SUPPORTS_AVX2)
 # power compiler flags
 CHECK_CXX_COMPILER_FLAG("-maltivec" CXX_SUPPORTS_ALTIVEC)
 
@@ -521,7 +521,7 @@ if(ARROW_BUILD_BENCHMARKS)
   endif()
 endif()
 
-if (ARROW_IPC)
+if (ARROW_IPC OR ARROW_JSON)
   # RapidJSON, header only dependency
   if("${RAPIDJSON_HOME}" STREQUAL "")
     ExternalProject_Add(rapidjson_ep
@@ -547,7 +547,9 @@ if (ARROW_IPC)
   if(RAPIDJSON_VENDORED)
     add_dependencies(arrow_dependencies rapidjson_ep)
   endif()
+endif()
 
+if (ARROW_IPC)
   ## Flatbuffers
   if("${FLATBUFFERS_HOME}" STREQUAL "")
     set(FLATBUFFERS_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/flatbuffers_ep-prefix/src/flatbuffers_ep-install")
@@ -19,6 +19,8 @@
 #include <cstdlib>
 #include <memory>
 #include <numeric>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -26,9 +28,11 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/concatenate.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
@@ -200,6 +204,59 @@ TEST_F(TestArray, NullArraySliceNullCount) {
   ASSERT_EQ(6, null_arr_sliced->null_count());
 }
 
+TEST_F(TestArray, ArraySpan) {
+  vector<uint8_t> valid_bytes = {1, 0, 1, 1, 0, 1, 0, 0, 0};
+
+  std::shared_ptr<Array> array;
+  ASSERT_OK(MakeArrayFromValidBytes(valid_bytes, pool_, &array));
+  array = array->Slice(1);
+
+  ArraySpan span(*array->data());
+  ASSERT_EQ(array->data().get(), span.data);
+  ASSERT_EQ(1, span.offset);
+  ASSERT_EQ(8, span.length);
+  ASSERT_EQ(5, span.GetNullCount());
+
+  // Offsets are relative and lengths truncated, as with Array::Slice
+  ArraySpan slice = span.Slice(2, 4).Slice(1, 10);
+  ASSERT_EQ(4, slice.offset);
+  ASSERT_EQ(3, slice.length);
+  ASSERT_EQ(2, slice.GetNullCount());
+  ASSERT_TRUE(slice.type()->Equals(*array->type()));
+
+  for (int64_t offset = 0; offset <= span.length; ++offset) {
+    auto expected = array->Slice(offset, 3);
+    auto actual = span.Slice(offset, 3);
+    ASSERT_EQ(expected->null_count(), actual.GetNullCount());
+    ASSERT_EQ(expected->offset(), actual.offset);
+    AssertArraysEqual(*expected, *actual.ToArray());
+    AssertArraysEqual(*expected,
+                      *ArraySpan(*array->data(), offset, 3).ToArray());
+  }
+  ASSERT_EQ(0, span.Slice(8).GetNullCount());
+
+  // Null arrays have no bitmap
+  auto null_arr = std::make_shared<NullArray>(10);
+  ASSERT_EQ(6, ArraySpan(*null_arr->data()).Slice(3, 6).GetNullCount());
+  ASSERT_EQ(6, ArraySpan(*null_arr->data()).Slice(3, 6).ToArray()->null_count());
+}
+
+TEST_F(TestArray, AppendArraySpan) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>({true, false, true, true, true},
+                                           {"a", "", "bc", "def", "g"}, &array);
+  ArraySpan span = ArraySpan(*array->data()).Slice(1);
+
+  StringBuilder builder;
+  ASSERT_OK(builder.AppendArraySpan(span.Slice(1, 2)));
+  ASSERT_OK(builder.AppendArraySpan(span.Slice(0, 1)));
+  std::shared_ptr<Array> result, expected;
+  ASSERT_OK(builder.Finish(&result));
+  ArrayFromVector<StringType, std::string>({true, true, false}, {"bc", "def", ""},
+                                           &expected);
+  AssertArraysEqual(*expected, *result);
+}
+
 TEST_F(TestArray, TestIsNullIsValid) {
   // clang-format off
   vector<uint8_t> null_bitmap = {1, 0, 1, 1, 0, 1, 0, 0,
@@ -268,6 +325,69 @@ TEST_F(TestArray, BuildLargeInMemoryArray) {
 
 TEST_F(TestArray, TestCopy) {}
 
+// Ranges of 300 slots with nulls, compared against a copy at another offset
+// so that the null bitmaps are not aligned
+TEST_F(TestArray, RangeEqualsUnaligned) {
+  const int64_t length = 300;
+  std::vector<bool> is_valid;
+  random_is_valid(length, 0.1, &is_valid);
+  // Blocks of 64 slots without nulls
+  std::fill(is_valid.begin() + 64, is_valid.begin() + 192, true);
+
+  std::vector<int32_t> ints(length);
+  std::iota(ints.begin(), ints.end(), 0);
+  std::vector<double> doubles(ints.begin(), ints.end());
+  std::vector<bool> bools;
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < length; ++i) {
+    bools.push_back(i % 3 == 0);
+    strings.push_back(std::string(static_cast<size_t>(i % 5), 'a' + i % 26));
+  }
+
+  std::vector<std::shared_ptr<Array>> arrays(4);
+  ArrayFromVector<Int32Type, int32_t>(is_valid, ints, &arrays[0]);
+  ArrayFromVector<DoubleType, double>(is_valid, doubles, &arrays[1]);
+  ArrayFromVector<BooleanType, bool>(is_valid, bools, &arrays[2]);
+  ArrayFromVector<StringType, std::string>(is_valid, strings, &arrays[3]);
+
+  ListBuilder list_builder(pool_, std::make_shared<Int32Builder>(pool_));
+  auto& list_values = static_cast<Int32Builder&>(*list_builder.value_builder());
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid[i]) {
+      ASSERT_OK(list_builder.Append());
+      for (int32_t j = 0; j < i % 3; ++j) {
+        ASSERT_OK(list_values.Append(static_cast<int32_t>(i) + j));
+      }
+    } else {
+      ASSERT_OK(list_builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> list;
+  ASSERT_OK(list_builder.Finish(&list));
+  arrays.push_back(list);
+
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(GetBitmapFromVector(is_valid, &null_bitmap));
+  arrays.push_back(std::make_shared<StructArray>(
+      struct_({field("a", int32()), field("b", utf8())}), length,
+      std::vector<std::shared_ptr<Array>>{arrays[0], arrays[3]}, null_bitmap));
+
+  for (const auto& array : arrays) {
+    std::shared_ptr<Array> copy;
+    ASSERT_OK(Concatenate({array->Slice(5)}, pool_, &copy));
+    for (const auto& range : std::vector<std::pair<int64_t, int64_t>>{
+             {5, 300}, {5, 69}, {70, 200}, {133, 134}, {150, 150}}) {
+      EXPECT_TRUE(array->RangeEquals(range.first, range.second, range.first - 5, copy))
+          << array->type()->ToString() << " " << range.first;
+      EXPECT_TRUE(copy->RangeEquals(range.first - 5, range.second - 5, range.first,
+                                    array));
+    }
+    // Values shifted by one slot
+    EXPECT_FALSE(array->RangeEquals(64, 192, 60, copy)) << array->type()->ToString();
+    EXPECT_FALSE(array->RangeEquals(5, 299, 1, copy)) << array->type()->ToString();
+  }
+}
+
 // ----------------------------------------------------------------------
 // Primitive type tests
 
@@ -1297,6 +1417,19 @@ TEST_F(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
   }
 }
 
+TEST_F(TestStringBuilder, TestAppendPackedValues) {
+  std::shared_ptr<Array> source;
+  ArrayFromVector<StringType, string>({true, false, true, true}, {"ab", "", "cde", "f"},
+                                      &source);
+  const auto& strings = checked_cast<const StringArray&>(*source);
+
+  ASSERT_OK(builder_->AppendValues(strings.value_data()->data(),
+                                   strings.raw_value_offsets(), strings.length(),
+                                   std::vector<uint8_t>({1, 0, 1, 1}).data()));
+  Done();
+  AssertArraysEqual(*source, *result_);
+}
+
 TEST_F(TestStringBuilder, TestZeroLength) {
   // All buffers are null
   Done();
@@ -1531,6 +1664,129 @@ TEST_F(TestBinaryBuilder, TestZeroLength) {
   Done();
 }
 
+TEST_F(TestBinaryBuilder, TestUnsafeAppend) {
+  vector<string> strings = {"", "bb", "a", "", "ccc"};
+  vector<uint8_t> is_valid = {1, 1, 1, 0, 1};
+
+  ASSERT_OK(builder_->Reserve(strings.size()));
+  ASSERT_OK(builder_->ReserveData(6));
+  const int64_t data_capacity = builder_->value_data_capacity();
+  for (size_t i = 0; i < strings.size(); ++i) {
+    if (is_valid[i]) {
+      builder_->UnsafeAppend(strings[i]);
+    } else {
+      builder_->UnsafeAppendNull();
+    }
+  }
+  ASSERT_EQ(data_capacity, builder_->value_data_capacity());
+  Done();
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<BinaryType, string>(vector<bool>(is_valid.begin(), is_valid.end()),
+                                      strings, &expected);
+  AssertArraysEqual(*expected, *result_);
+}
+
+TEST_F(TestBinaryBuilder, TestAppendPackedValues) {
+  const string data = "xxaabbbcdddd";
+  // The block starts at a non-zero offset and its null spans no bytes
+  const vector<int32_t> offsets = {2, 4, 7, 8, 8, 12};
+  const vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+  ASSERT_OK(builder_->Append("z"));
+  ASSERT_OK(builder_->AppendValues(raw_data, offsets.data(), 5, valid_bytes.data()));
+  ASSERT_OK(builder_->AppendValues(raw_data, offsets.data() + 1, 2));
+  ASSERT_OK(builder_->AppendValues(raw_data, offsets.data(), 0));
+  Done();
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<BinaryType, string>(
+      {true, true, true, true, false, true, true, true},
+      {"z", "aa", "bbb", "c", "", "dddd", "bbb", "c"}, &expected);
+  AssertArraysEqual(*expected, *result_);
+}
+
+// ----------------------------------------------------------------------
+// ChunkedArrayBuilder tests
+
+TEST(TestChunkedArrayBuilder, ByteThreshold) {
+  // At most 10 bytes per chunk
+  ChunkedArrayBuilder chunked_builder(std::make_shared<StringBuilder>(), 100, 10);
+  auto builder = checked_cast<StringBuilder*>(chunked_builder.builder());
+
+  const std::vector<std::string> values = {"abcd", "efgh", "ij", "klmnopqrstuv", "w"};
+  for (const auto& value : values) {
+    ASSERT_OK(chunked_builder.Reserve(1, value.size()));
+    ASSERT_OK(builder->Append(value));
+  }
+  ASSERT_OK(chunked_builder.Reserve(1));
+  ASSERT_OK(builder->AppendNull());
+  ASSERT_EQ(2, chunked_builder.num_chunks());
+  ASSERT_EQ(6, chunked_builder.length());
+
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(chunked_builder.Finish(&result));
+  ASSERT_EQ(3, result->num_chunks());
+  ASSERT_EQ(6, result->length());
+  ASSERT_EQ(1, result->null_count());
+
+  // The value over the threshold gets a chunk of its own
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<StringType, std::string>({"abcd", "efgh", "ij"}, &expected);
+  AssertArraysEqual(*expected, *result->chunk(0));
+  ArrayFromVector<StringType, std::string>({"klmnopqrstuv"}, &expected);
+  AssertArraysEqual(*expected, *result->chunk(1));
+  ArrayFromVector<StringType, std::string>({true, false}, {"w", ""}, &expected);
+  AssertArraysEqual(*expected, *result->chunk(2));
+
+  // The builder can be reused
+  ASSERT_OK(chunked_builder.Reserve(1, 1));
+  ASSERT_OK(builder->Append("x"));
+  ASSERT_OK(chunked_builder.Finish(&result));
+  ASSERT_EQ(1, result->num_chunks());
+  ASSERT_EQ(1, result->length());
+}
+
+TEST(TestChunkedArrayBuilder, RowThreshold) {
+  ChunkedArrayBuilder chunked_builder(std::make_shared<Int32Builder>(), 4);
+  auto builder = checked_cast<Int32Builder*>(chunked_builder.builder());
+
+  const std::vector<int32_t> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_OK(chunked_builder.Reserve(3));
+  ASSERT_OK(builder->AppendValues(values.data(), 3));
+  for (size_t i = 3; i < values.size(); ++i) {
+    ASSERT_OK(chunked_builder.Reserve(1));
+    ASSERT_OK(builder->Append(values[i]));
+  }
+  // Finishing early does not leave empty chunks
+  ASSERT_OK(chunked_builder.FinishChunk());
+  ASSERT_OK(chunked_builder.FinishChunk());
+
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(chunked_builder.Finish(&result));
+  ASSERT_EQ(3, result->num_chunks());
+  std::vector<int64_t> lengths;
+  for (const auto& chunk : result->chunks()) {
+    lengths.push_back(chunk->length());
+  }
+  ASSERT_EQ(std::vector<int64_t>({4, 4, 2}), lengths);
+
+  std::shared_ptr<Array> expected, actual;
+  ArrayFromVector<Int32Type, int32_t>(values, &expected);
+  ASSERT_OK(Concatenate(result->chunks(), default_memory_pool(), &actual));
+  AssertArraysEqual(*expected, *actual);
+}
+
+TEST(TestChunkedArrayBuilder, Empty) {
+  ChunkedArrayBuilder chunked_builder(std::make_shared<BinaryBuilder>());
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(chunked_builder.Finish(&result));
+  ASSERT_EQ(1, result->num_chunks());
+  ASSERT_EQ(0, result->length());
+  ASSERT_TRUE(result->type()->Equals(*binary()));
+}
+
 // ----------------------------------------------------------------------
 // Slice tests
 
@@ -2329,6 +2585,114 @@ TYPED_TEST(TestDictionaryBuilder, DoubleDeltaDictionary) {
   ASSERT_TRUE(expected_delta2.Equals(result_delta2));
 }
 
+TYPED_TEST(TestDictionaryBuilder, InsertMemoValues) {
+  using Scalar = typename TypeParam::c_type;
+  // The dictionary already sent for a field
+  NumericBuilder<TypeParam> memo_builder;
+  ASSERT_OK(memo_builder.Append(static_cast<Scalar>(1)));
+  ASSERT_OK(memo_builder.Append(static_cast<Scalar>(2)));
+  std::shared_ptr<Array> memo;
+  ASSERT_OK(memo_builder.Finish(&memo));
+
+  DictionaryBuilder<TypeParam> builder(default_memory_pool());
+  ASSERT_OK(builder.InsertMemoValues(*memo));
+  ASSERT_TRUE(builder.is_building_delta());
+  ASSERT_OK(builder.Append(static_cast<Scalar>(2)));
+  ASSERT_OK(builder.Append(static_cast<Scalar>(3)));
+  ASSERT_OK(builder.Append(static_cast<Scalar>(1)));
+  std::shared_ptr<Array> result;
+  FinishAndCheckPadding(&builder, &result);
+
+  // Only the new entry is emitted, and indices refer to the whole dictionary
+  NumericBuilder<TypeParam> dict_builder;
+  ASSERT_OK(dict_builder.Append(static_cast<Scalar>(3)));
+  std::shared_ptr<Array> dict_array;
+  ASSERT_OK(dict_builder.Finish(&dict_array));
+  auto dtype = std::make_shared<DictionaryType>(int8(), dict_array);
+  std::shared_ptr<Array> int_array;
+  ArrayFromVector<Int8Type, int8_t>({1, 2, 0}, &int_array);
+
+  DictionaryArray expected(dtype, int_array);
+  ASSERT_TRUE(expected.Equals(result));
+
+  // Only an empty builder can be seeded
+  ASSERT_RAISES(Invalid, builder.InsertMemoValues(*memo));
+}
+
+TYPED_TEST(TestDictionaryBuilder, InsertMemoValuesInvalid) {
+  using Scalar = typename TypeParam::c_type;
+  std::shared_ptr<Array> memo;
+  DictionaryBuilder<TypeParam> builder(default_memory_pool());
+
+  ArrayFromVector<TypeParam, Scalar>({true, false}, {1, 2}, &memo);
+  ASSERT_RAISES(Invalid, builder.InsertMemoValues(*memo));
+
+  ArrayFromVector<TypeParam, Scalar>({1, 1}, &memo);
+  DictionaryBuilder<TypeParam> other_builder(default_memory_pool());
+  ASSERT_RAISES(Invalid, other_builder.InsertMemoValues(*memo));
+}
+
+TYPED_TEST(TestDictionaryBuilder, DoubleTableSizeInDelta) {
+  using Scalar = typename TypeParam::c_type;
+  // Skip this test for (u)int8
+  if (sizeof(Scalar) > 1) {
+    DictionaryBuilder<TypeParam> builder(default_memory_pool());
+    NumericBuilder<TypeParam> memo_builder;
+    for (int64_t i = 0; i < 2000; i++) {
+      ASSERT_OK(memo_builder.Append(static_cast<Scalar>(i)));
+    }
+    std::shared_ptr<Array> memo;
+    ASSERT_OK(memo_builder.Finish(&memo));
+    ASSERT_OK(builder.InsertMemoValues(*memo));
+
+    // The hash table grows while it holds entries of both the memo and the
+    // delta, which are looked up again afterwards
+    NumericBuilder<TypeParam> dict_builder;
+    Int16Builder int_builder;
+    for (int64_t i = 2000; i < 4000; i++) {
+      ASSERT_OK(builder.Append(static_cast<Scalar>(i)));
+      ASSERT_OK(dict_builder.Append(static_cast<Scalar>(i)));
+      ASSERT_OK(int_builder.Append(static_cast<int16_t>(i)));
+    }
+    for (int64_t i = 0; i < 4000; i++) {
+      ASSERT_OK(builder.Append(static_cast<Scalar>(i)));
+      ASSERT_OK(int_builder.Append(static_cast<int16_t>(i)));
+    }
+
+    std::shared_ptr<Array> result;
+    FinishAndCheckPadding(&builder, &result);
+
+    std::shared_ptr<Array> dict_array;
+    ASSERT_OK(dict_builder.Finish(&dict_array));
+    auto dtype = std::make_shared<DictionaryType>(int16(), dict_array);
+    std::shared_ptr<Array> int_array;
+    ASSERT_OK(int_builder.Finish(&int_array));
+
+    DictionaryArray expected(dtype, int_array);
+    ASSERT_TRUE(expected.Equals(result));
+  }
+}
+
+TEST(TestStringDictionaryBuilder, InsertMemoValues) {
+  std::shared_ptr<Array> memo;
+  ArrayFromVector<StringType, std::string>({"foo", "bar"}, &memo);
+
+  StringDictionaryBuilder builder(default_memory_pool());
+  ASSERT_OK(builder.InsertMemoValues(*memo));
+  ASSERT_OK(builder.Append("baz"));
+  ASSERT_OK(builder.Append("foo"));
+  ASSERT_OK(builder.Append("baz"));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+
+  std::shared_ptr<Array> dict_array, int_array;
+  ArrayFromVector<StringType, std::string>({"baz"}, &dict_array);
+  ArrayFromVector<Int8Type, int8_t>({2, 0, 2}, &int_array);
+  DictionaryArray expected(std::make_shared<DictionaryType>(int8(), dict_array),
+                           int_array);
+  ASSERT_TRUE(expected.Equals(result));
+}
+
 TEST(TestStringDictionaryBuilder, Basic) {
   // Build the dictionary Array
   StringDictionaryBuilder builder(default_memory_pool());
@@ -3020,6 +3384,119 @@ TEST_F(TestListArray, TestZeroLength) {
   ASSERT_OK(ValidateArray(*result_));
 }
 
+// ----------------------------------------------------------------------
+// Large binary, string and list tests
+
+TEST(TestLargeStringArray, Basics) {
+  LargeStringBuilder builder;
+  const std::vector<std::string> values = {"", "foo", "barbaz", "", "qux"};
+  const std::vector<uint8_t> valid_bytes = {1, 1, 0, 1, 1};
+  ASSERT_OK(builder.AppendValues(values, valid_bytes.data()));
+  ASSERT_OK(builder.Append("quux"));
+  ASSERT_OK(builder.AppendNull());
+
+  int64_t length;
+  ASSERT_EQ(0, memcmp(builder.GetValue(1, &length), "foo", 3));
+  ASSERT_EQ(3, length);
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_TRUE(out->type()->Equals(*large_utf8()));
+  ASSERT_EQ(7, out->length());
+  ASSERT_EQ(2, out->null_count());
+
+  const auto& array = checked_cast<const LargeStringArray&>(*out);
+  ASSERT_EQ(std::vector<int64_t>({0, 0, 3, 3, 3, 6, 10, 10}),
+            std::vector<int64_t>(array.raw_value_offsets(),
+                                 array.raw_value_offsets() + 8));
+  ASSERT_EQ("foo", array.GetString(1));
+  ASSERT_EQ("qux", array.GetString(4));
+  ASSERT_EQ("quux", array.GetString(5));
+  ASSERT_EQ(3, array.value_length(4));
+
+  // Equality, with slices
+  LargeStringBuilder builder2;
+  ASSERT_OK(builder2.Append("qux"));
+  ASSERT_OK(builder2.Append("quux"));
+  std::shared_ptr<Array> other;
+  ASSERT_OK(builder2.Finish(&other));
+  ASSERT_TRUE(out->Slice(4, 2)->Equals(other));
+  ASSERT_TRUE(out->RangeEquals(4, 6, 0, other));
+  ASSERT_FALSE(out->RangeEquals(3, 5, 0, other));
+
+  // Large and 32-bit offset arrays are never equal
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>({"qux", "quux"}, &strings);
+  ASSERT_FALSE(strings->Equals(other));
+}
+
+TEST(TestLargeBinaryArray, AppendArraySlice) {
+  std::shared_ptr<Array> source;
+  LargeBinaryBuilder source_builder;
+  ASSERT_OK(source_builder.AppendValues({"a", "bc", "", "def", "gh"}, nullptr));
+  ASSERT_OK(source_builder.Finish(&source));
+  ASSERT_TRUE(source->type()->Equals(*large_binary()));
+
+  LargeBinaryBuilder builder;
+  ASSERT_OK(builder.Append("z"));
+  ASSERT_OK(builder.AppendArraySlice(*source->data(), 1, 3));
+  ASSERT_OK(builder.AppendArraySlice(*source->Slice(4)->data(), 0, 1));
+  std::shared_ptr<Array> out, expected;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(builder.AppendValues({"z", "bc", "", "def", "gh"}, nullptr));
+  ASSERT_OK(builder.Finish(&expected));
+  AssertArraysEqual(*expected, *out);
+}
+
+TEST(TestLargeListArray, Basics) {
+  std::unique_ptr<ArrayBuilder> tmp;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), large_list(int8()), &tmp));
+  auto& builder = checked_cast<LargeListBuilder&>(*tmp);
+  auto& values = checked_cast<Int8Builder&>(*builder.value_builder());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(values.Append(1));
+  ASSERT_OK(values.Append(2));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(values.Append(3));
+
+  std::shared_ptr<Array> out;
+  FinishAndCheckPadding(&builder, &out);
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_EQ("large_list<item: int8>", out->type()->ToString());
+  const auto& array = checked_cast<const LargeListArray&>(*out);
+  ASSERT_EQ(4, array.length());
+  ASSERT_EQ(1, array.null_count());
+  ASSERT_EQ(2, array.value_length(0));
+  ASSERT_EQ(0, array.value_length(2));
+  ASSERT_EQ(2, array.value_offset(3));
+
+  // From offsets
+  std::shared_ptr<Array> offsets, result;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true, true, true}, {0, 2, 2, 2, 3},
+                                      &offsets);
+  ASSERT_OK(LargeListArray::FromArrays(*offsets, *array.values(), default_memory_pool(),
+                                       &result));
+  AssertArraysEqual(*out, *result);
+  ASSERT_TRUE(out->Slice(1)->Equals(result->Slice(1)));
+  ASSERT_FALSE(out->RangeEquals(0, 1, 3, result));
+
+  // Offsets must be int64
+  std::shared_ptr<Array> int32_offsets;
+  ArrayFromVector<Int32Type, int32_t>({0, 2}, &int32_offsets);
+  ASSERT_RAISES(Invalid, LargeListArray::FromArrays(*int32_offsets, *array.values(),
+                                                    default_memory_pool(), &result));
+
+  // Copying slices
+  LargeListBuilder builder2(default_memory_pool(), std::make_shared<Int8Builder>());
+  ASSERT_OK(builder2.AppendArraySlice(*out->data(), 2, 2));
+  ASSERT_OK(builder2.Finish(&result));
+  ASSERT_OK(ValidateArray(*result));
+  AssertArraysEqual(*out->Slice(2), *result);
+}
+
 // ----------------------------------------------------------------------
 // DictionaryArray tests
 
@@ -3722,6 +4199,159 @@ TEST_P(DecimalTest, WithNulls) {
 
 INSTANTIATE_TEST_CASE_P(DecimalTest, DecimalTest, ::testing::Range(1, 38));
 
+// ----------------------------------------------------------------------
+// Appending array slices to builders
+
+class TestAppendArraySlice : public TestBuilder {
+ protected:
+  static constexpr int64_t kLength = 300;
+
+  std::vector<bool> IsValid() {
+    std::vector<bool> is_valid;
+    random_is_valid(kLength, 0.2, &is_valid);
+    return is_valid;
+  }
+
+  template <typename TYPE, typename C_TYPE>
+  std::shared_ptr<Array> MakeNumeric() {
+    std::vector<C_TYPE> values;
+    randint<int32_t, C_TYPE>(kLength, 0, 100, &values);
+    std::shared_ptr<Array> array;
+    ArrayFromVector<TYPE, C_TYPE>(IsValid(), values, &array);
+    return array;
+  }
+
+  std::shared_ptr<Array> MakeStrings() {
+    std::vector<std::string> values;
+    for (int64_t i = 0; i < kLength; ++i) {
+      values.push_back(std::string(static_cast<size_t>(i % 7), 'a' + i % 26));
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<StringType, std::string>(IsValid(), values, &array);
+    return array;
+  }
+
+  // Append ranges of a slice of the array at various bit alignments to a
+  // builder and check that each lands at its position in the result
+  void CheckAppendArraySlice(const std::shared_ptr<Array>& full_array) {
+    const auto array = full_array->Slice(5);
+    const std::vector<std::pair<int64_t, int64_t>> ranges = {
+        {0, 0}, {3, 70}, {73, 1}, {0, 130}, {5, 0}, {131, 150}};
+
+    std::unique_ptr<ArrayBuilder> builder;
+    ASSERT_OK(MakeBuilder(pool_, array->type(), &builder));
+    for (const auto& range : ranges) {
+      ASSERT_OK(builder->AppendArraySlice(*array->data(), range.first, range.second));
+    }
+    std::shared_ptr<Array> result;
+    ASSERT_OK(builder->Finish(&result));
+    ASSERT_OK(ValidateArray(*result));
+
+    int64_t position = 0;
+    int64_t null_count = 0;
+    for (const auto& range : ranges) {
+      auto slice = array->Slice(range.first, range.second);
+      ASSERT_TRUE(result->RangeEquals(position, position + range.second, 0, slice))
+          << "slice at " << position << " of " << result->ToString();
+      position += range.second;
+      null_count += slice->null_count();
+    }
+    ASSERT_EQ(position, result->length());
+    ASSERT_EQ(null_count, result->null_count());
+  }
+};
+
+constexpr int64_t TestAppendArraySlice::kLength;
+
+TEST_F(TestAppendArraySlice, Null) {
+  CheckAppendArraySlice(std::make_shared<NullArray>(kLength));
+}
+
+TEST_F(TestAppendArraySlice, Primitives) {
+  std::vector<bool> values = IsValid();
+  std::shared_ptr<Array> booleans;
+  ArrayFromVector<BooleanType, bool>(IsValid(), values, &booleans);
+  CheckAppendArraySlice(booleans);
+  CheckAppendArraySlice(MakeNumeric<Int8Type, int8_t>());
+  CheckAppendArraySlice(MakeNumeric<UInt16Type, uint16_t>());
+  CheckAppendArraySlice(MakeNumeric<Int64Type, int64_t>());
+  CheckAppendArraySlice(MakeNumeric<DoubleType, double>());
+
+  // Without nulls
+  std::vector<int32_t> ints;
+  randint<int32_t>(kLength, 0, 100, &ints);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>(ints, &array);
+  CheckAppendArraySlice(array);
+}
+
+TEST_F(TestAppendArraySlice, Binary) {
+  CheckAppendArraySlice(MakeStrings());
+
+  FixedSizeBinaryBuilder builder(fixed_size_binary(3));
+  const std::vector<bool> is_valid = IsValid();
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (is_valid[i]) {
+      const std::string value = std::to_string(100 + i % 900);
+      ASSERT_OK(builder.Append(value.data()));
+    } else {
+      ASSERT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  CheckAppendArraySlice(array);
+}
+
+TEST_F(TestAppendArraySlice, Nested) {
+  ListBuilder list_builder(pool_, std::make_shared<StringBuilder>(pool_));
+  auto& values = static_cast<StringBuilder&>(*list_builder.value_builder());
+  const std::vector<bool> is_valid = IsValid();
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (is_valid[i]) {
+      ASSERT_OK(list_builder.Append());
+      for (int64_t j = 0; j < i % 4; ++j) {
+        ASSERT_OK(values.Append(std::to_string(i + j)));
+      }
+    } else {
+      ASSERT_OK(list_builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> list;
+  ASSERT_OK(list_builder.Finish(&list));
+  CheckAppendArraySlice(list);
+
+  auto type = struct_({field("a", int16()), field("b", list->type())});
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(GetBitmapFromVector(IsValid(), &null_bitmap));
+  auto ints = MakeNumeric<Int16Type, int16_t>();
+  auto array = std::make_shared<StructArray>(
+      type, kLength, std::vector<std::shared_ptr<Array>>{ints, list}, null_bitmap,
+      kUnknownNullCount);
+  CheckAppendArraySlice(array);
+}
+
+TEST_F(TestAppendArraySlice, Dictionary) {
+  auto strings = MakeStrings();
+  StringDictionaryBuilder builder(pool_);
+  ASSERT_OK(builder.AppendArraySlice(*strings->data(), 10, 100));
+  ASSERT_OK(builder.AppendArraySlice(*strings->data(), 0, 0));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+
+  StringDictionaryBuilder expected_builder(pool_);
+  ASSERT_OK(expected_builder.AppendArray(*strings->Slice(10, 100)));
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(expected_builder.Finish(&expected));
+  AssertArraysEqual(*expected, *result);
+}
+
+TEST_F(TestAppendArraySlice, NotImplemented) {
+  auto ints = MakeNumeric<Int64Type, int64_t>();
+  AdaptiveIntBuilder builder(pool_);
+  ASSERT_RAISES(NotImplemented, builder.AppendArraySlice(*ints->data(), 0, 10));
+}
+
 // ----------------------------------------------------------------------
 // Test rechunking
 
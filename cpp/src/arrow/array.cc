@@ -70,6 +70,53 @@ std::shared_ptr<ArrayData> ArrayData::Make(const std::shared_ptr<DataType>& type
   return std::make_shared<ArrayData>(type, length, null_count, offset);
 }
 
+// ----------------------------------------------------------------------
+// ArraySpan
+
+ArraySpan::ArraySpan(const ArrayData& data, int64_t offset, int64_t length)
+    : data(&data) {
+  DCHECK_LE(offset, data.length);
+  this->offset = data.offset + offset;
+  this->length = std::min(data.length - offset, length);
+}
+
+ArraySpan ArraySpan::Slice(int64_t offset, int64_t length) const {
+  DCHECK_LE(offset, this->length);
+  ArraySpan out;
+  out.data = data;
+  out.offset = this->offset + offset;
+  out.length = std::min(this->length - offset, length);
+  return out;
+}
+
+int64_t ArraySpan::GetNullCount() const {
+  if (data->null_count == 0 || length == 0) {
+    return 0;
+  }
+  if (data->type->id() == Type::NA) {
+    return length;
+  }
+  if (data->null_count > 0 && offset == data->offset && length == data->length) {
+    return data->null_count;
+  }
+  if (!data->buffers[0]) {
+    return 0;
+  }
+  return length - CountSetBits(data->buffers[0]->data(), offset, length);
+}
+
+std::shared_ptr<ArrayData> ArraySpan::ToArrayData() const {
+  auto out = data->Copy();
+  if (offset != data->offset || length != data->length) {
+    out->offset = offset;
+    out->length = length;
+    out->null_count = data->null_count != 0 ? kUnknownNullCount : 0;
+  }
+  return out;
+}
+
+std::shared_ptr<Array> ArraySpan::ToArray() const { return MakeArray(ToArrayData()); }
+
 // ----------------------------------------------------------------------
 // Base array class
 
@@ -197,26 +244,37 @@ ListArray::ListArray(const std::shared_ptr<DataType>& type, int64_t length,
   SetData(internal_data);
 }
 
-Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
-                             std::shared_ptr<Array>* out) {
+namespace {
+
+// Construct a list array of the given type from offsets and values
+template <typename ListArrayType, typename OffsetArrowType>
+Status ListArrayFromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                           std::shared_ptr<Array>* out) {
+  using TypeClass = typename ListArrayType::TypeClass;
+  using offset_type = typename TypeClass::offset_type;
+  using OffsetArrayType = typename TypeTraits<OffsetArrowType>::ArrayType;
+
   if (offsets.length() == 0) {
     return Status::Invalid("List offsets must have non-zero length");
   }
 
-  if (offsets.type_id() != Type::INT32) {
-    return Status::Invalid("List offsets must be signed int32");
+  if (offsets.type_id() != OffsetArrowType::type_id) {
+    std::stringstream ss;
+    ss << "List offsets must be signed " << OffsetArrowType().ToString();
+    return Status::Invalid(ss.str());
   }
 
   BufferVector buffers = {};
 
-  const auto& typed_offsets = checked_cast<const Int32Array&>(offsets);
+  const auto& typed_offsets = checked_cast<const OffsetArrayType&>(offsets);
 
   const int64_t num_offsets = offsets.length();
 
   if (offsets.null_count() > 0) {
     std::shared_ptr<Buffer> clean_offsets, clean_valid_bits;
 
-    RETURN_NOT_OK(AllocateBuffer(pool, num_offsets * sizeof(int32_t), &clean_offsets));
+    RETURN_NOT_OK(
+        AllocateBuffer(pool, num_offsets * sizeof(offset_type), &clean_offsets));
 
     // Copy valid bits, zero out the bit for the final offset
     RETURN_NOT_OK(offsets.null_bitmap()->Copy(0, BitUtil::BytesForBits(num_offsets - 1),
@@ -224,12 +282,13 @@ Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPo
     BitUtil::ClearBit(clean_valid_bits->mutable_data(), num_offsets);
     buffers.emplace_back(std::move(clean_valid_bits));
 
-    const int32_t* raw_offsets = typed_offsets.raw_values();
-    auto clean_raw_offsets = reinterpret_cast<int32_t*>(clean_offsets->mutable_data());
+    const offset_type* raw_offsets = typed_offsets.raw_values();
+    auto clean_raw_offsets =
+        reinterpret_cast<offset_type*>(clean_offsets->mutable_data());
 
     // Must work backwards so we can tell how many values were in the last non-null value
     DCHECK(offsets.IsValid(num_offsets - 1));
-    int32_t current_offset = raw_offsets[num_offsets - 1];
+    offset_type current_offset = raw_offsets[num_offsets - 1];
     for (int64_t i = num_offsets - 1; i >= 0; --i) {
       if (offsets.IsValid(i)) {
         current_offset = raw_offsets[i];
@@ -243,15 +302,22 @@ Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPo
     buffers.emplace_back(typed_offsets.values());
   }
 
-  auto list_type = list(values.type());
+  auto list_type = std::make_shared<TypeClass>(values.type());
   auto internal_data = ArrayData::Make(list_type, num_offsets - 1, std::move(buffers),
                                        offsets.null_count(), offsets.offset());
   internal_data->child_data.push_back(values.data());
 
-  *out = std::make_shared<ListArray>(internal_data);
+  *out = std::make_shared<ListArrayType>(internal_data);
   return Status::OK();
 }
 
+}  // namespace
+
+Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                             std::shared_ptr<Array>* out) {
+  return ListArrayFromArrays<ListArray, Int32Type>(offsets, values, pool, out);
+}
+
 void ListArray::SetData(const std::shared_ptr<ArrayData>& data) {
   this->Array::SetData(data);
   DCHECK_EQ(data->buffers.size(), 2);
@@ -271,6 +337,49 @@ std::shared_ptr<DataType> ListArray::value_type() const {
 
 std::shared_ptr<Array> ListArray::values() const { return values_; }
 
+// ----------------------------------------------------------------------
+// LargeListArray
+
+LargeListArray::LargeListArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_LIST);
+  SetData(data);
+}
+
+LargeListArray::LargeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                               const std::shared_ptr<Buffer>& value_offsets,
+                               const std::shared_ptr<Array>& values,
+                               const std::shared_ptr<Buffer>& null_bitmap,
+                               int64_t null_count, int64_t offset) {
+  auto internal_data =
+      ArrayData::Make(type, length, {null_bitmap, value_offsets}, null_count, offset);
+  internal_data->child_data.emplace_back(values->data());
+  SetData(internal_data);
+}
+
+Status LargeListArray::FromArrays(const Array& offsets, const Array& values,
+                                  MemoryPool* pool, std::shared_ptr<Array>* out) {
+  return ListArrayFromArrays<LargeListArray, Int64Type>(offsets, values, pool, out);
+}
+
+void LargeListArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  DCHECK_EQ(data->buffers.size(), 2);
+
+  auto value_offsets = data->buffers[1];
+  raw_value_offsets_ = value_offsets == nullptr
+                           ? nullptr
+                           : reinterpret_cast<const int64_t*>(value_offsets->data());
+
+  DCHECK_EQ(data_->child_data.size(), 1);
+  values_ = MakeArray(data_->child_data[0]);
+}
+
+std::shared_ptr<DataType> LargeListArray::value_type() const {
+  return checked_cast<const LargeListType&>(*type()).value_type();
+}
+
+std::shared_ptr<Array> LargeListArray::values() const { return values_; }
+
 // ----------------------------------------------------------------------
 // String and binary
 
@@ -317,6 +426,55 @@ StringArray::StringArray(int64_t length, const std::shared_ptr<Buffer>& value_of
                          int64_t offset)
     : BinaryArray(utf8(), length, value_offsets, data, null_bitmap, null_count, offset) {}
 
+// ----------------------------------------------------------------------
+// Large string and binary
+
+LargeBinaryArray::LargeBinaryArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_BINARY);
+  SetData(data);
+}
+
+void LargeBinaryArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->buffers.size(), 3);
+  auto value_offsets = data->buffers[1];
+  auto value_data = data->buffers[2];
+  this->Array::SetData(data);
+  raw_data_ = value_data == nullptr ? nullptr : value_data->data();
+  raw_value_offsets_ = value_offsets == nullptr
+                           ? nullptr
+                           : reinterpret_cast<const int64_t*>(value_offsets->data());
+}
+
+LargeBinaryArray::LargeBinaryArray(int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset)
+    : LargeBinaryArray(large_binary(), length, value_offsets, data, null_bitmap,
+                       null_count, offset) {}
+
+LargeBinaryArray::LargeBinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset) {
+  SetData(ArrayData::Make(type, length, {null_bitmap, value_offsets, data}, null_count,
+                          offset));
+}
+
+LargeStringArray::LargeStringArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_STRING);
+  SetData(data);
+}
+
+LargeStringArray::LargeStringArray(int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset)
+    : LargeBinaryArray(large_utf8(), length, value_offsets, data, null_bitmap,
+                       null_count, offset) {}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -691,7 +849,21 @@ struct ValidateVisitor {
     return Status::OK();
   }
 
-  Status Visit(const ListArray& array) {
+  Status Visit(const LargeBinaryArray& array) {
+    if (array.data()->buffers.size() != 3) {
+      return Status::Invalid("number of buffers was != 3");
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ListArray& array) { return ValidateList(array); }
+
+  Status Visit(const LargeListArray& array) { return ValidateList(array); }
+
+  template <typename ListArrayType>
+  Status ValidateList(const ListArrayType& array) {
+    using offset_type = typename ListArrayType::TypeClass::offset_type;
+
     if (array.length() < 0) {
       return Status::Invalid("Length was negative");
     }
@@ -700,7 +872,7 @@ struct ValidateVisitor {
     if (array.length() && !value_offsets) {
       return Status::Invalid("value_offsets_ was null");
     }
-    if (value_offsets->size() / static_cast<int>(sizeof(int32_t)) < array.length()) {
+    if (value_offsets->size() / static_cast<int>(sizeof(offset_type)) < array.length()) {
       std::stringstream ss;
       ss << "offset buffer size (bytes): " << value_offsets->size()
          << " isn't large enough for length: " << array.length();
@@ -711,7 +883,7 @@ struct ValidateVisitor {
       return Status::Invalid("values was null");
     }
 
-    const int32_t last_offset = array.value_offset(array.length());
+    const offset_type last_offset = array.value_offset(array.length());
     if (array.values()->length() != last_offset) {
       std::stringstream ss;
       ss << "Final offset invariant not equal to values length: " << last_offset
@@ -726,12 +898,12 @@ struct ValidateVisitor {
       return Status::Invalid(ss.str());
     }
 
-    int32_t prev_offset = array.value_offset(0);
+    offset_type prev_offset = array.value_offset(0);
     if (prev_offset != 0) {
       return Status::Invalid("The first offset wasn't zero");
     }
     for (int64_t i = 1; i <= array.length(); ++i) {
-      int32_t current_offset = array.value_offset(i);
+      offset_type current_offset = array.value_offset(i);
       if (array.IsNull(i - 1) && current_offset != prev_offset) {
         std::stringstream ss;
         ss << "Offset invariant failure at: " << i
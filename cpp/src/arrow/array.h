@@ -183,6 +183,53 @@ struct ARROW_EXPORT ArrayData {
 ARROW_EXPORT
 std::shared_ptr<Array> MakeArray(const std::shared_ptr<ArrayData>& data);
 
+/// \brief A non-owning view of a range of slots of ArrayData
+///
+/// Slicing an Array copies its ArrayData, with the vectors of buffers and
+/// children, and boxes it again. An ArraySpan only points at the data it was
+/// taken from, so creating and narrowing spans never allocates. The viewed
+/// ArrayData must outlive the span.
+struct ARROW_EXPORT ArraySpan {
+  ArraySpan() : data(NULLPTR), offset(0), length(0) {}
+
+  /// \brief View all slots of the data
+  explicit ArraySpan(const ArrayData& data)
+      : data(&data), offset(data.offset), length(data.length) {}
+
+  /// \brief View a range of slots of the data
+  ///
+  /// \param[in] data the data to view
+  /// \param[in] offset the first slot, relative to the data offset
+  /// \param[in] length the number of slots, truncated to the end of the data
+  ArraySpan(const ArrayData& data, int64_t offset, int64_t length);
+
+  /// \brief Narrow the view, offset being relative to the start of the span
+  ArraySpan Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Narrow the view from offset to the end of the span
+  ArraySpan Slice(int64_t offset) const { return Slice(offset, length - offset); }
+
+  const std::shared_ptr<DataType>& type() const { return data->type; }
+
+  /// \brief Number of null slots in the view
+  ///
+  /// Known without counting when the span covers all of the data or the data
+  /// has no nulls, otherwise counted from the validity bitmap.
+  int64_t GetNullCount() const;
+
+  /// \brief Copy the view into an owning ArrayData, as Array::Slice would
+  std::shared_ptr<ArrayData> ToArrayData() const;
+
+  /// \brief Box the view as an Array, as Array::Slice would
+  std::shared_ptr<Array> ToArray() const;
+
+  const ArrayData* data;
+  // The first viewed slot into the physical buffers, including data->offset,
+  // in the same units as ArrayData::offset
+  int64_t offset;
+  int64_t length;
+};
+
 // ----------------------------------------------------------------------
 // User array accessor types
 
@@ -470,6 +517,52 @@ class ARROW_EXPORT ListArray : public Array {
   std::shared_ptr<Array> values_;
 };
 
+/// \brief Like ListArray, with 64-bit offsets into the child values
+class ARROW_EXPORT LargeListArray : public Array {
+ public:
+  using TypeClass = LargeListType;
+
+  explicit LargeListArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                 const std::shared_ptr<Buffer>& value_offsets,
+                 const std::shared_ptr<Array>& values,
+                 const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                 int64_t null_count = 0, int64_t offset = 0);
+
+  /// \brief Construct LargeListArray from array of offsets and child value
+  /// array
+  ///
+  /// As ListArray::FromArrays, with offsets of int64 type
+  static Status FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                           std::shared_ptr<Array>* out);
+
+  /// \brief Return array object containing the list's values
+  std::shared_ptr<Array> values() const;
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
+
+  std::shared_ptr<DataType> value_type() const;
+
+  /// Return pointer to raw value offsets accounting for any slice offset
+  const int64_t* raw_value_offsets() const { return raw_value_offsets_ + data_->offset; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return raw_value_offsets_[i + data_->offset]; }
+  int64_t value_length(int64_t i) const {
+    i += data_->offset;
+    return raw_value_offsets_[i + 1] - raw_value_offsets_[i];
+  }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+  const int64_t* raw_value_offsets_;
+
+ private:
+  std::shared_ptr<Array> values_;
+};
+
 // ----------------------------------------------------------------------
 // Binary and String
 
@@ -560,6 +653,85 @@ class ARROW_EXPORT StringArray : public BinaryArray {
   }
 };
 
+/// \brief Like BinaryArray, with 64-bit offsets into the value data
+class ARROW_EXPORT LargeBinaryArray : public FlatArray {
+ public:
+  using TypeClass = LargeBinaryType;
+
+  explicit LargeBinaryArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeBinaryArray(int64_t length, const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+
+  // Return the pointer to the given elements bytes
+  const uint8_t* GetValue(int64_t i, int64_t* out_length) const {
+    // Account for base offset
+    i += data_->offset;
+
+    const int64_t pos = raw_value_offsets_[i];
+    *out_length = raw_value_offsets_[i + 1] - pos;
+    return raw_data_ + pos;
+  }
+
+  /// \brief Get binary value as a std::string
+  ///
+  /// \param i the value index
+  /// \return the value copied into a std::string
+  std::string GetString(int64_t i) const {
+    int64_t length = 0;
+    const uint8_t* bytes = GetValue(i, &length);
+    return std::string(reinterpret_cast<const char*>(bytes), static_cast<size_t>(length));
+  }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_data() const { return data_->buffers[2]; }
+
+  const int64_t* raw_value_offsets() const { return raw_value_offsets_ + data_->offset; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return raw_value_offsets_[i + data_->offset]; }
+  int64_t value_length(int64_t i) const {
+    i += data_->offset;
+    return raw_value_offsets_[i + 1] - raw_value_offsets_[i];
+  }
+
+ protected:
+  // For subclasses
+  LargeBinaryArray() {}
+
+  /// Protected method for constructors
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  // Constructor that allows sub-classes/builders to propagate there logical type up the
+  // class hierarchy.
+  LargeBinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
+                   const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+
+  const int64_t* raw_value_offsets_;
+  const uint8_t* raw_data_;
+};
+
+/// \brief Like StringArray, with 64-bit offsets into the value data
+class ARROW_EXPORT LargeStringArray : public LargeBinaryArray {
+ public:
+  using TypeClass = LargeStringType;
+
+  explicit LargeStringArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeStringArray(int64_t length, const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+};
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
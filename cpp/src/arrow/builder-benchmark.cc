@@ -17,6 +17,11 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/test-util.h"
@@ -152,6 +157,74 @@ static void BM_BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * iterations * value.size());
 }
 
+// As BM_BuildBinaryArray, with the builder sized up front
+static void BM_BuildBinaryArrayUnsafe(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+
+  std::string value = "1234567890";
+  while (state.KeepRunning()) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(iterations));
+    ABORT_NOT_OK(builder.ReserveData(iterations * value.size()));
+    for (int64_t i = 0; i < iterations; i++) {
+      builder.UnsafeAppend(value);
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+// As BM_BuildBinaryArrayUnsafe, appending blocks of 1024 packed values at once
+static void BM_BuildBinaryArrayPacked(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  const int64_t block_length = 1024;
+
+  std::string value = "1234567890";
+  std::string data;
+  std::vector<int32_t> offsets;
+  for (int64_t i = 0; i < block_length; i++) {
+    offsets.push_back(static_cast<int32_t>(data.size()));
+    data += value;
+  }
+  offsets.push_back(static_cast<int32_t>(data.size()));
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+  while (state.KeepRunning()) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(iterations));
+    ABORT_NOT_OK(builder.ReserveData(iterations * value.size()));
+    for (int64_t i = 0; i < iterations; i += block_length) {
+      ABORT_NOT_OK(builder.AppendValues(raw_data, offsets.data(), block_length));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+// A text column of 512MB in values of 1KB, built with 32-bit or 64-bit offsets
+template <typename BuilderType>
+static void BM_BuildTextColumn(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t value_size = 1024;
+  const int64_t num_values = int64_t(1) << 19;
+
+  const std::string value(static_cast<size_t>(value_size), 'x');
+  while (state.KeepRunning()) {
+    BuilderType builder;
+    ABORT_NOT_OK(builder.Reserve(num_values));
+    ABORT_NOT_OK(builder.ReserveData(num_values * value_size));
+    for (int64_t i = 0; i < num_values; i++) {
+      ABORT_NOT_OK(builder.Append(value));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * num_values * value_size);
+}
+
 static void BM_BuildFixedSizeBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   const int64_t iterations = 1 << 20;
@@ -171,6 +244,98 @@ static void BM_BuildFixedSizeBinaryArray(
   state.SetBytesProcessed(state.iterations() * iterations * width);
 }
 
+// 1M values with 10% nulls, copied to a builder 1000 slots at a time
+constexpr int64_t kSliceSourceSize = 1 << 20;
+constexpr int64_t kSliceLength = 1000;
+
+static std::shared_ptr<Array> MakeSliceSource(bool strings) {
+  std::vector<bool> is_valid;
+  random_is_valid(kSliceSourceSize, 0.1, &is_valid);
+  std::vector<int64_t> values;
+  randint<int64_t>(kSliceSourceSize, 0, 1000000, &values);
+  std::shared_ptr<Array> array;
+  if (strings) {
+    std::vector<std::string> string_values;
+    for (int64_t value : values) {
+      string_values.push_back(std::to_string(value));
+    }
+    ArrayFromVector<StringType, std::string>(is_valid, string_values, &array);
+  } else {
+    ArrayFromVector<Int64Type, int64_t>(is_valid, values, &array);
+  }
+  return array;
+}
+
+static void BM_AppendArraySliceInt64(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto source = MakeSliceSource(false);
+  while (state.KeepRunning()) {
+    Int64Builder builder;
+    for (int64_t i = 0; i < kSliceSourceSize; i += kSliceLength) {
+      ABORT_NOT_OK(builder.AppendArraySlice(
+          *source->data(), i, std::min(kSliceLength, kSliceSourceSize - i)));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * kSliceSourceSize);
+}
+
+static void BM_AppendElementsInt64(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto source = MakeSliceSource(false);
+  const auto& values = static_cast<const Int64Array&>(*source);
+  while (state.KeepRunning()) {
+    Int64Builder builder;
+    for (int64_t i = 0; i < kSliceSourceSize; i++) {
+      if (values.IsNull(i)) {
+        ABORT_NOT_OK(builder.AppendNull());
+      } else {
+        ABORT_NOT_OK(builder.Append(values.Value(i)));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * kSliceSourceSize);
+}
+
+static void BM_AppendArraySliceString(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto source = MakeSliceSource(true);
+  while (state.KeepRunning()) {
+    StringBuilder builder;
+    for (int64_t i = 0; i < kSliceSourceSize; i += kSliceLength) {
+      ABORT_NOT_OK(builder.AppendArraySlice(
+          *source->data(), i, std::min(kSliceLength, kSliceSourceSize - i)));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * kSliceSourceSize);
+}
+
+static void BM_AppendElementsString(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto source = MakeSliceSource(true);
+  const auto& values = static_cast<const StringArray&>(*source);
+  while (state.KeepRunning()) {
+    StringBuilder builder;
+    for (int64_t i = 0; i < kSliceSourceSize; i++) {
+      if (values.IsNull(i)) {
+        ABORT_NOT_OK(builder.AppendNull());
+      } else {
+        int32_t length;
+        const uint8_t* value = values.GetValue(i, &length);
+        ABORT_NOT_OK(builder.Append(value, length));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * kSliceSourceSize);
+}
+
 BENCHMARK(BM_BuildPrimitiveArrayNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildVectorNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
@@ -183,6 +348,19 @@ BENCHMARK(BM_BuildAdaptiveIntNoNullsScalarAppend)
 BENCHMARK(BM_BuildAdaptiveUIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_BuildBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayUnsafe)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayPacked)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildFixedSizeBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_BuildTextColumn, StringBuilder)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_BuildTextColumn, LargeStringBuilder)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_AppendArraySliceInt64)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AppendElementsInt64)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AppendArraySliceString)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AppendElementsString)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 }  // namespace arrow
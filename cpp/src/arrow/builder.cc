@@ -29,6 +29,7 @@
 #include "arrow/buffer.h"
 #include "arrow/compare.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -157,6 +158,30 @@ void ArrayBuilder::UnsafeAppendToBitmap(const std::vector<bool>& is_valid) {
   UnsafeAppendToBitmap(is_valid.begin(), is_valid.end());
 }
 
+Status ArrayBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                      int64_t length) {
+  std::stringstream ss;
+  ss << "Cannot append array slices to a builder of type " << type_->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+Status ArrayBuilder::AppendArraySpan(const ArraySpan& span) {
+  return AppendArraySlice(*span.data, span.offset - span.data->offset, span.length);
+}
+
+void ArrayBuilder::UnsafeAppendToBitmap(const ArrayData& array, int64_t offset,
+                                        int64_t length) {
+  const std::shared_ptr<Buffer>& bitmap = array.buffers[0];
+  if (bitmap == nullptr || array.null_count == 0) {
+    UnsafeSetNotNull(length);
+    return;
+  }
+  const int64_t bit_offset = array.offset + offset;
+  CopyBitmap(bitmap->data(), bit_offset, length, null_bitmap_data_, length_);
+  null_count_ += length - CountSetBits(bitmap->data(), bit_offset, length);
+  length_ += length;
+}
+
 void ArrayBuilder::UnsafeSetNotNull(int64_t length) {
   const int64_t new_length = length + length_;
 
@@ -283,6 +308,23 @@ Status PrimitiveBuilder<T>::Append(const std::vector<value_type>& values) {
   return AppendValues(values);
 }
 
+template <typename T>
+Status PrimitiveBuilder<T>::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                             int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(Reserve(length));
+  const auto values =
+      reinterpret_cast<const value_type*>(array.buffers[1]->data()) + array.offset;
+  memcpy(raw_data_ + length_, values + offset,
+         static_cast<size_t>(TypeTraits<T>::bytes_required(length)));
+
+  // this updates the length_
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
 template <typename T>
 Status PrimitiveBuilder<T>::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(TrimBuffer(BitUtil::BytesForBits(length_), null_bitmap_.get()));
@@ -720,6 +762,20 @@ Status BooleanBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   return Status::OK();
 }
 
+Status BooleanBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                        int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(Reserve(length));
+  CopyBitmap(array.buffers[1]->data(), array.offset + offset, length, raw_data_,
+             length_);
+
+  // this updates length_
+  ArrayBuilder::UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
 Status BooleanBuilder::AppendValues(const uint8_t* values, int64_t length,
                                     const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
@@ -1057,7 +1113,8 @@ Status DictionaryBuilder<T>::Append(const Scalar& value) {
     hash_slots_[j] = index;
     RETURN_NOT_OK(AppendDictionary(value));
 
-    if (ARROW_PREDICT_FALSE(static_cast<int32_t>(dict_builder_.length()) >
+    // Entries from before the last Finish call are still in the hash table
+    if (ARROW_PREDICT_FALSE(dict_builder_.length() + entry_id_offset_ >
                             hash_table_load_threshold_)) {
       RETURN_NOT_OK(DoubleTableSize());
     }
@@ -1075,6 +1132,22 @@ Status DictionaryBuilder<T>::AppendNull() {
 
 Status DictionaryBuilder<NullType>::AppendNull() { return values_builder_.AppendNull(); }
 
+template <typename T>
+Status DictionaryBuilder<T>::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                              int64_t length) {
+  // Each value is hashed on its own, so slicing costs nothing in comparison
+  auto values = MakeArray(std::make_shared<ArrayData>(array));
+  return AppendArray(*values->Slice(offset, length));
+}
+
+Status DictionaryBuilder<NullType>::AppendArraySlice(const ArrayData& array,
+                                                     int64_t offset, int64_t length) {
+  for (int64_t i = 0; i < length; i++) {
+    RETURN_NOT_OK(AppendNull());
+  }
+  return Status::OK();
+}
+
 template <typename T>
 Status DictionaryBuilder<T>::AppendArray(const Array& array) {
   const auto& numeric_array = checked_cast<const NumericArray<T>&>(array);
@@ -1112,10 +1185,39 @@ Status DictionaryBuilder<FixedSizeBinaryType>::AppendArray(const Array& array) {
   return Status::OK();
 }
 
+template <typename T>
+Status DictionaryBuilder<T>::InsertMemoValues(const Array& values) {
+  if (values_builder_.length() > 0 ||
+      (capacity_ > 0 && (entry_id_offset_ > 0 || dict_builder_.length() > 0))) {
+    return Status::Invalid("Memo values can only be inserted into an empty builder");
+  }
+  if (values.null_count() > 0) {
+    return Status::Invalid("Memo values cannot contain nulls");
+  }
+  RETURN_NOT_OK(AppendArray(values));
+  if (dict_builder_.length() != values.length()) {
+    return Status::Invalid("Memo values must be distinct");
+  }
+
+  // Drop the indices, and keep the entries as if a Finish call had emitted them
+  values_builder_.Reset();
+  std::shared_ptr<Array> dictionary;
+  entry_id_offset_ += dict_builder_.length();
+  RETURN_NOT_OK(dict_builder_.Finish(&dictionary));
+  RETURN_NOT_OK(
+      DictionaryHashHelper<T>::AppendArray(overflow_dict_builder_, *dictionary));
+  dict_builder_.Reset();
+  return Status::OK();
+}
+
 template <typename T>
 Status DictionaryBuilder<T>::DoubleTableSize() {
-#define INNER_LOOP \
-  int64_t j = HashValue(GetDictionaryValue(dict_builder_, index)) & new_mod_bitmask
+#define INNER_LOOP                                                              \
+  const Scalar value =                                                          \
+      index >= entry_id_offset_                                                 \
+          ? GetDictionaryValue(dict_builder_, index - entry_id_offset_)         \
+          : GetDictionaryValue(overflow_dict_builder_, index);                  \
+  int64_t j = HashValue(value) & new_mod_bitmask
 
   DOUBLE_TABLE_SIZE(, INNER_LOOP);
 
@@ -1241,6 +1343,34 @@ Status ListBuilder::Append(const int32_t* offsets, int64_t length,
   return AppendValues(offsets, length, valid_bytes);
 }
 
+Status ListBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                     int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  const int32_t* offsets =
+      reinterpret_cast<const int32_t*>(array.buffers[1]->data()) + array.offset + offset;
+  const int64_t num_values = value_builder_->length();
+  const int64_t values_length = offsets[length] - offsets[0];
+  if (ARROW_PREDICT_FALSE(num_values + values_length > kListMaximumElements)) {
+    std::stringstream ss;
+    ss << "ListArray cannot contain more then INT32_MAX - 1 child elements,"
+       << " have " << num_values + values_length;
+    return Status::CapacityError(ss.str());
+  }
+  RETURN_NOT_OK(value_builder_->AppendArraySlice(*array.child_data[0], offsets[0],
+                                                 values_length));
+
+  // Also makes room for the offsets
+  RETURN_NOT_OK(Reserve(length));
+  const int32_t delta = static_cast<int32_t>(num_values - offsets[0]);
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(offsets[i] + delta);
+  }
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
 Status ListBuilder::AppendNextOffset() {
   int64_t num_values = value_builder_->length();
   if (ARROW_PREDICT_FALSE(num_values > kListMaximumElements)) {
@@ -1301,6 +1431,90 @@ ArrayBuilder* ListBuilder::value_builder() const {
   return value_builder_.get();
 }
 
+// ----------------------------------------------------------------------
+// LargeListBuilder
+
+LargeListBuilder::LargeListBuilder(MemoryPool* pool,
+                                   std::shared_ptr<ArrayBuilder> const& value_builder,
+                                   const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type ? type
+                        : std::static_pointer_cast<DataType>(
+                              std::make_shared<LargeListType>(value_builder->type())),
+                   pool),
+      offsets_builder_(pool),
+      value_builder_(value_builder) {}
+
+Status LargeListBuilder::AppendValues(const int64_t* offsets, int64_t length,
+                                      const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  offsets_builder_.UnsafeAppend(offsets, length);
+  return Status::OK();
+}
+
+Status LargeListBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                          int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  const int64_t* offsets =
+      reinterpret_cast<const int64_t*>(array.buffers[1]->data()) + array.offset + offset;
+  const int64_t num_values = value_builder_->length();
+  RETURN_NOT_OK(value_builder_->AppendArraySlice(*array.child_data[0], offsets[0],
+                                                 offsets[length] - offsets[0]));
+
+  // Also makes room for the offsets
+  RETURN_NOT_OK(Reserve(length));
+  const int64_t delta = num_values - offsets[0];
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(offsets[i] + delta);
+  }
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
+Status LargeListBuilder::AppendNextOffset() {
+  return offsets_builder_.Append(value_builder_->length());
+}
+
+Status LargeListBuilder::Append(bool is_valid) {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(is_valid);
+  return AppendNextOffset();
+}
+
+Status LargeListBuilder::Resize(int64_t capacity) {
+  // one more then requested for offsets
+  RETURN_NOT_OK(offsets_builder_.Resize((capacity + 1) * sizeof(int64_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status LargeListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(AppendNextOffset());
+
+  // Offset padding zeroed by BufferBuilder
+  std::shared_ptr<Buffer> offsets;
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+
+  if (value_builder_->length() == 0) {
+    // Try to make sure we get a non-null values buffer (ARROW-2744)
+    RETURN_NOT_OK(value_builder_->Resize(0));
+  }
+  std::shared_ptr<ArrayData> items;
+  RETURN_NOT_OK(value_builder_->FinishInternal(&items));
+
+  *out = ArrayData::Make(type_, length_, {null_bitmap_, offsets}, null_count_);
+  (*out)->child_data.emplace_back(std::move(items));
+  Reset();
+  return Status::OK();
+}
+
+void LargeListBuilder::Reset() {
+  ArrayBuilder::Reset();
+  offsets_builder_.Reset();
+  value_builder_->Reset();
+}
+
 // ----------------------------------------------------------------------
 // String and binary
 
@@ -1327,32 +1541,59 @@ Status BinaryBuilder::ReserveData(int64_t elements) {
   return Status::OK();
 }
 
-Status BinaryBuilder::AppendNextOffset() {
-  const int64_t num_bytes = value_data_builder_.length();
-  if (ARROW_PREDICT_FALSE(num_bytes > kBinaryMemoryLimit)) {
-    std::stringstream ss;
-    ss << "BinaryArray cannot contain more than " << kBinaryMemoryLimit << " bytes, have "
-       << num_bytes;
-    return Status::CapacityError(ss.str());
+Status BinaryBuilder::AppendPacked(const uint8_t* data, const int32_t* offsets,
+                                   int64_t length) {
+  const int64_t num_bytes = value_data_length();
+  const int64_t data_length = offsets[length] - offsets[0];
+  if (ARROW_PREDICT_FALSE(num_bytes + data_length > kBinaryMemoryLimit)) {
+    return AppendOverflow(num_bytes + data_length);
   }
-  return offsets_builder_.Append(static_cast<int32_t>(num_bytes));
+  // Also makes room for the offsets
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(value_data_builder_.Append(data + offsets[0], data_length));
+
+  const int32_t delta = static_cast<int32_t>(num_bytes - offsets[0]);
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(offsets[i] + delta);
+  }
+  return Status::OK();
 }
 
-Status BinaryBuilder::Append(const uint8_t* value, int32_t length) {
-  RETURN_NOT_OK(Reserve(1));
-  RETURN_NOT_OK(AppendNextOffset());
-  RETURN_NOT_OK(value_data_builder_.Append(value, length));
+Status BinaryBuilder::AppendValues(const uint8_t* data, const int32_t* offsets,
+                                   int64_t length, const uint8_t* valid_bytes) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(AppendPacked(data, offsets, length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
 
-  UnsafeAppendToBitmap(true);
+Status BinaryBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                       int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  const int32_t* offsets =
+      reinterpret_cast<const int32_t*>(array.buffers[1]->data()) + array.offset + offset;
+  RETURN_NOT_OK(AppendPacked(array.buffers[2]->data(), offsets, length));
+  UnsafeAppendToBitmap(array, offset, length);
   return Status::OK();
 }
 
-Status BinaryBuilder::AppendNull() {
-  RETURN_NOT_OK(AppendNextOffset());
-  RETURN_NOT_OK(Reserve(1));
+Status BinaryBuilder::AppendOverflow(int64_t num_bytes) const {
+  std::stringstream ss;
+  ss << "BinaryArray cannot contain more than " << kBinaryMemoryLimit << " bytes, have "
+     << num_bytes;
+  return Status::CapacityError(ss.str());
+}
 
-  UnsafeAppendToBitmap(false);
-  return Status::OK();
+Status BinaryBuilder::AppendNextOffset() {
+  const int64_t num_bytes = value_data_builder_.length();
+  if (ARROW_PREDICT_FALSE(num_bytes > kBinaryMemoryLimit)) {
+    return AppendOverflow(num_bytes);
+  }
+  return offsets_builder_.Append(static_cast<int32_t>(num_bytes));
 }
 
 Status BinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
@@ -1394,23 +1635,23 @@ Status StringBuilder::AppendValues(const std::vector<std::string>& values,
   std::size_t total_length = std::accumulate(
       values.begin(), values.end(), 0ULL,
       [](uint64_t sum, const std::string& str) { return sum + str.size(); });
+  // Also makes room for the offsets
   RETURN_NOT_OK(Reserve(values.size()));
-  RETURN_NOT_OK(value_data_builder_.Reserve(total_length));
-  RETURN_NOT_OK(offsets_builder_.Reserve(values.size()));
+  RETURN_NOT_OK(ReserveData(total_length));
 
   if (valid_bytes) {
     for (std::size_t i = 0; i < values.size(); ++i) {
-      RETURN_NOT_OK(AppendNextOffset());
+      UnsafeAppendNextOffset();
       if (valid_bytes[i]) {
-        RETURN_NOT_OK(value_data_builder_.Append(
-            reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size()));
+        value_data_builder_.UnsafeAppend(
+            reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size());
       }
     }
   } else {
     for (std::size_t i = 0; i < values.size(); ++i) {
-      RETURN_NOT_OK(AppendNextOffset());
-      RETURN_NOT_OK(value_data_builder_.Append(
-          reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size()));
+      UnsafeAppendNextOffset();
+      value_data_builder_.UnsafeAppend(
+          reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size());
     }
   }
 
@@ -1437,18 +1678,18 @@ Status StringBuilder::AppendValues(const char** values, int64_t length,
       have_null_value = true;
     }
   }
+  // Also makes room for the offsets
   RETURN_NOT_OK(Reserve(length));
-  RETURN_NOT_OK(value_data_builder_.Reserve(total_length));
-  RETURN_NOT_OK(offsets_builder_.Reserve(length));
+  RETURN_NOT_OK(ReserveData(total_length));
 
   if (valid_bytes) {
     int64_t valid_bytes_offset = 0;
     for (int64_t i = 0; i < length; ++i) {
-      RETURN_NOT_OK(AppendNextOffset());
+      UnsafeAppendNextOffset();
       if (valid_bytes[i]) {
         if (values[i]) {
-          RETURN_NOT_OK(value_data_builder_.Append(
-              reinterpret_cast<const uint8_t*>(values[i]), value_lengths[i]));
+          value_data_builder_.UnsafeAppend(
+              reinterpret_cast<const uint8_t*>(values[i]), value_lengths[i]);
         } else {
           UnsafeAppendToBitmap(valid_bytes + valid_bytes_offset, i - valid_bytes_offset);
           UnsafeAppendToBitmap(false);
@@ -1461,19 +1702,19 @@ Status StringBuilder::AppendValues(const char** values, int64_t length,
     if (have_null_value) {
       std::vector<uint8_t> valid_vector(length, 0);
       for (int64_t i = 0; i < length; ++i) {
-        RETURN_NOT_OK(AppendNextOffset());
+        UnsafeAppendNextOffset();
         if (values[i]) {
-          RETURN_NOT_OK(value_data_builder_.Append(
-              reinterpret_cast<const uint8_t*>(values[i]), value_lengths[i]));
+          value_data_builder_.UnsafeAppend(
+              reinterpret_cast<const uint8_t*>(values[i]), value_lengths[i]);
           valid_vector[i] = 1;
         }
       }
       UnsafeAppendToBitmap(valid_vector.data(), length);
     } else {
       for (int64_t i = 0; i < length; ++i) {
-        RETURN_NOT_OK(AppendNextOffset());
-        RETURN_NOT_OK(value_data_builder_.Append(
-            reinterpret_cast<const uint8_t*>(values[i]), value_lengths[i]));
+        UnsafeAppendNextOffset();
+        value_data_builder_.UnsafeAppend(
+            reinterpret_cast<const uint8_t*>(values[i]), value_lengths[i]);
       }
       UnsafeAppendToBitmap(nullptr, length);
     }
@@ -1486,6 +1727,127 @@ Status StringBuilder::Append(const char** values, int64_t length,
   return AppendValues(values, length, valid_bytes);
 }
 
+// ----------------------------------------------------------------------
+// Large string and binary
+
+LargeBinaryBuilder::LargeBinaryBuilder(const std::shared_ptr<DataType>& type,
+                                       MemoryPool* pool)
+    : ArrayBuilder(type, pool), offsets_builder_(pool), value_data_builder_(pool) {}
+
+LargeBinaryBuilder::LargeBinaryBuilder(MemoryPool* pool)
+    : LargeBinaryBuilder(large_binary(), pool) {}
+
+Status LargeBinaryBuilder::Resize(int64_t capacity) {
+  // one more then requested for offsets
+  RETURN_NOT_OK(offsets_builder_.Resize((capacity + 1) * sizeof(int64_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status LargeBinaryBuilder::ReserveData(int64_t elements) {
+  if (value_data_length() + elements > value_data_capacity()) {
+    RETURN_NOT_OK(value_data_builder_.Reserve(elements));
+  }
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                            int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  const int64_t* offsets =
+      reinterpret_cast<const int64_t*>(array.buffers[1]->data()) + array.offset + offset;
+  const int64_t num_bytes = value_data_length();
+  // Also makes room for the offsets
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(value_data_builder_.Append(array.buffers[2]->data() + offsets[0],
+                                           offsets[length] - offsets[0]));
+
+  const int64_t delta = num_bytes - offsets[0];
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(offsets[i] + delta);
+  }
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::Append(const uint8_t* value, int64_t length) {
+  RETURN_NOT_OK(Reserve(1));
+  RETURN_NOT_OK(AppendNextOffset());
+  RETURN_NOT_OK(value_data_builder_.Append(value, length));
+
+  UnsafeAppendToBitmap(true);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::AppendNull() {
+  RETURN_NOT_OK(AppendNextOffset());
+  RETURN_NOT_OK(Reserve(1));
+
+  UnsafeAppendToBitmap(false);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::AppendValues(const std::vector<std::string>& values,
+                                        const uint8_t* valid_bytes) {
+  int64_t total_length = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (valid_bytes == NULLPTR || valid_bytes[i]) {
+      total_length += static_cast<int64_t>(values[i].size());
+    }
+  }
+  const auto length = static_cast<int64_t>(values.size());
+  // Also makes room for the offsets
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(total_length));
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    offsets_builder_.UnsafeAppend(value_data_builder_.length());
+    if (valid_bytes == NULLPTR || valid_bytes[i]) {
+      value_data_builder_.UnsafeAppend(
+          reinterpret_cast<const uint8_t*>(values[i].data()),
+          static_cast<int64_t>(values[i].size()));
+    }
+  }
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  // Write final offset (values length)
+  RETURN_NOT_OK(AppendNextOffset());
+
+  // These buffers' padding zeroed by BufferBuilder
+  std::shared_ptr<Buffer> offsets, value_data;
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+  RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
+
+  *out = ArrayData::Make(type_, length_, {null_bitmap_, offsets, value_data}, null_count_,
+                         0);
+  Reset();
+  return Status::OK();
+}
+
+void LargeBinaryBuilder::Reset() {
+  ArrayBuilder::Reset();
+  offsets_builder_.Reset();
+  value_data_builder_.Reset();
+}
+
+const uint8_t* LargeBinaryBuilder::GetValue(int64_t i, int64_t* out_length) const {
+  const int64_t* offsets = offsets_builder_.data();
+  const int64_t offset = offsets[i];
+  if (i == (length_ - 1)) {
+    *out_length = value_data_builder_.length() - offset;
+  } else {
+    *out_length = offsets[i + 1] - offset;
+  }
+  return value_data_builder_.data() + offset;
+}
+
+LargeStringBuilder::LargeStringBuilder(MemoryPool* pool)
+    : LargeBinaryBuilder(large_utf8(), pool) {}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -1507,6 +1869,19 @@ Status FixedSizeBinaryBuilder::Append(const uint8_t* data, int64_t length,
   return AppendValues(data, length, valid_bytes);
 }
 
+Status FixedSizeBinaryBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                                int64_t length) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(byte_builder_.Append(
+      array.buffers[1]->data() + (array.offset + offset) * byte_width_,
+      length * byte_width_));
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
+
 Status FixedSizeBinaryBuilder::Append(const std::string& value) {
   return Append(reinterpret_cast<const uint8_t*>(value.c_str()));
 }
@@ -1556,6 +1931,18 @@ void StructBuilder::Reset() {
     field_builder->Reset();
   }
 }
+
+Status StructBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                       int64_t length) {
+  // Children are not sliced along with the struct, so they start at its offset
+  for (size_t i = 0; i < field_builders_.size(); ++i) {
+    RETURN_NOT_OK(field_builders_[i]->AppendArraySlice(*array.child_data[i],
+                                                       array.offset + offset, length));
+  }
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array, offset, length);
+  return Status::OK();
+}
 Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(TrimBuffer(BitUtil::BytesForBits(length_), null_bitmap_.get()));
   *out = ArrayData::Make(type_, length_, {null_bitmap_}, null_count_);
@@ -1574,6 +1961,59 @@ Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// ChunkedArrayBuilder
+
+ChunkedArrayBuilder::ChunkedArrayBuilder(const std::shared_ptr<ArrayBuilder>& builder,
+                                         int64_t max_chunk_length,
+                                         int64_t max_chunk_data_length)
+    : builder_(builder),
+      max_chunk_length_(max_chunk_length),
+      max_chunk_data_length_(max_chunk_data_length),
+      chunk_data_length_(0),
+      chunks_length_(0) {
+  DCHECK_GT(max_chunk_length, 0);
+  DCHECK_GT(max_chunk_data_length, 0);
+}
+
+Status ChunkedArrayBuilder::Reserve(int64_t length, int64_t data_length) {
+  DCHECK_GE(length, 0);
+  DCHECK_GE(data_length, 0);
+  if (ARROW_PREDICT_FALSE(builder_->length() + length > max_chunk_length_ ||
+                          chunk_data_length_ + data_length > max_chunk_data_length_)) {
+    RETURN_NOT_OK(FinishChunk());
+  }
+  chunk_data_length_ += data_length;
+  return builder_->Reserve(length);
+}
+
+Status ChunkedArrayBuilder::FinishChunk() {
+  if (builder_->length() == 0) {
+    return Status::OK();
+  }
+  std::shared_ptr<Array> chunk;
+  RETURN_NOT_OK(builder_->Finish(&chunk));
+  chunks_length_ += chunk->length();
+  chunks_.push_back(std::move(chunk));
+  chunk_data_length_ = 0;
+  return Status::OK();
+}
+
+Status ChunkedArrayBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
+  if (chunks_.empty() || builder_->length() > 0) {
+    // Always emit at least one chunk, so that the result has the type of a
+    // builder that was given no values
+    std::shared_ptr<Array> chunk;
+    RETURN_NOT_OK(builder_->Finish(&chunk));
+    chunks_.push_back(std::move(chunk));
+  }
+  *out = std::make_shared<ChunkedArray>(chunks_);
+  chunks_.clear();
+  chunks_length_ = 0;
+  chunk_data_length_ = 0;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Helper functions
 
@@ -1612,6 +2052,8 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       BUILDER_CASE(DOUBLE, DoubleBuilder);
       BUILDER_CASE(STRING, StringBuilder);
       BUILDER_CASE(BINARY, BinaryBuilder);
+      BUILDER_CASE(LARGE_STRING, LargeStringBuilder);
+      BUILDER_CASE(LARGE_BINARY, LargeBinaryBuilder);
       BUILDER_CASE(FIXED_SIZE_BINARY, FixedSizeBinaryBuilder);
       BUILDER_CASE(DECIMAL, Decimal128Builder);
     case Type::LIST: {
@@ -1623,6 +2065,15 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       return Status::OK();
     }
 
+    case Type::LARGE_LIST: {
+      std::unique_ptr<ArrayBuilder> value_builder;
+      std::shared_ptr<DataType> value_type =
+          checked_cast<const LargeListType&>(*type).value_type();
+      RETURN_NOT_OK(MakeBuilder(pool, value_type, &value_builder));
+      out->reset(new LargeListBuilder(pool, std::move(value_builder)));
+      return Status::OK();
+    }
+
     case Type::STRUCT: {
       const std::vector<std::shared_ptr<Field>>& fields = type->children();
       std::vector<std::shared_ptr<ArrayBuilder>> values_builder;
@@ -40,6 +40,7 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
 class Decimal128;
 
 constexpr int64_t kBinaryMemoryLimit = std::numeric_limits<int32_t>::max() - 1;
@@ -91,6 +92,23 @@ class ARROW_EXPORT ArrayBuilder {
   /// Set the next length bits to not null (i.e. valid).
   Status SetNotNull(int64_t length);
 
+  /// \brief Append a range of slots of an existing array
+  ///
+  /// Values are copied in bulk rather than one at a time: fixed-width values
+  /// with memcpy, bitmaps a word at a time and offsets rebased in one pass.
+  /// Nested builders append the matching ranges of the child data to their
+  /// child builders.
+  ///
+  /// \param[in] array the array data to append from, of the builder's type
+  /// \param[in] offset the first slot to append, relative to the array offset
+  /// \param[in] length the number of slots to append
+  /// \return Status
+  virtual Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                                  int64_t length);
+
+  /// \brief Append the slots viewed by a span, see AppendArraySlice
+  Status AppendArraySpan(const ArraySpan& span);
+
   /// \brief Ensure that enough memory has been allocated to fit the indicated
   /// number of total elements in the builder, including any that have already
   /// been appended. Does not account for reallocations that may be due to
@@ -203,6 +221,10 @@ class ARROW_EXPORT ArrayBuilder {
 
   void UnsafeAppendToBitmap(const std::vector<bool>& is_valid);
 
+  // Append the validity bits of length slots of array, starting at slot
+  // offset, a word at a time
+  void UnsafeAppendToBitmap(const ArrayData& array, int64_t offset, int64_t length);
+
   // Set the next length bits to not null (i.e. valid).
   void UnsafeSetNotNull(int64_t length);
 
@@ -221,6 +243,13 @@ class ARROW_EXPORT NullBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    null_count_ += length;
+    length_ += length;
+    return Status::OK();
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 };
 
@@ -368,6 +397,9 @@ class ARROW_EXPORT PrimitiveBuilder : public ArrayBuilder {
   ARROW_DEPRECATED("Use AppendValues instead")
   Status Append(const std::vector<value_type>& values);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
   void Reset() override;
 
@@ -681,6 +713,16 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
   /// Scalar append
   Status Append(const bool val) {
     RETURN_NOT_OK(Reserve(1));
+    UnsafeAppend(val);
+    return Status::OK();
+  }
+
+  /// Append a single scalar under the assumption that the underlying Buffer is
+  /// large enough.
+  ///
+  /// This method does not capacity-check; make sure to call Reserve
+  /// beforehand.
+  void UnsafeAppend(const bool val) {
     BitUtil::SetBit(null_bitmap_data_, length_);
     if (val) {
       BitUtil::SetBit(raw_data_, length_);
@@ -688,7 +730,6 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
       BitUtil::ClearBit(raw_data_, length_);
     }
     ++length_;
-    return Status::OK();
   }
 
   Status Append(const uint8_t val) { return Append(val != 0); }
@@ -823,6 +864,8 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
   void Reset() override;
   Status Resize(int64_t capacity) override;
@@ -857,6 +900,8 @@ class ARROW_EXPORT ListBuilder : public ArrayBuilder {
 
   Status Resize(int64_t capacity) override;
   void Reset() override;
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// \brief Vector append
@@ -888,6 +933,46 @@ class ARROW_EXPORT ListBuilder : public ArrayBuilder {
   Status AppendNextOffset();
 };
 
+/// \class LargeListBuilder
+/// \brief Builder class for lists with 64-bit offsets
+///
+/// Used as ListBuilder, for lists with more than 2^31 - 1 child values in
+/// total.
+class ARROW_EXPORT LargeListBuilder : public ArrayBuilder {
+ public:
+  LargeListBuilder(MemoryPool* pool, std::shared_ptr<ArrayBuilder> const& value_builder,
+                   const std::shared_ptr<DataType>& type = NULLPTR);
+
+  Status Resize(int64_t capacity) override;
+  void Reset() override;
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \brief Vector append
+  ///
+  /// If passed, valid_bytes is of equal length to values, and any zero byte
+  /// will be considered as a null for that slot
+  Status AppendValues(const int64_t* offsets, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Start a new variable-length list slot
+  ///
+  /// This function should be called before beginning to append elements to the
+  /// value builder
+  Status Append(bool is_valid = true);
+
+  Status AppendNull() { return Append(false); }
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+ protected:
+  TypedBufferBuilder<int64_t> offsets_builder_;
+  std::shared_ptr<ArrayBuilder> value_builder_;
+
+  Status AppendNextOffset();
+};
+
 // ----------------------------------------------------------------------
 // Binary and String
 
@@ -899,7 +984,16 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
 
   BinaryBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool);
 
-  Status Append(const uint8_t* value, int32_t length);
+  Status Append(const uint8_t* value, int32_t length) {
+    if (ARROW_PREDICT_FALSE(value_data_length() + length > kBinaryMemoryLimit)) {
+      return AppendOverflow(value_data_length() + length);
+    }
+    RETURN_NOT_OK(Reserve(1));
+    UnsafeAppendNextOffset();
+    RETURN_NOT_OK(value_data_builder_.Append(value, length));
+    UnsafeAppendToBitmap(true);
+    return Status::OK();
+  }
 
   Status Append(const char* value, int32_t length) {
     return Append(reinterpret_cast<const uint8_t*>(value), length);
@@ -909,7 +1003,52 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
     return Append(value.c_str(), static_cast<int32_t>(value.size()));
   }
 
-  Status AppendNull();
+  Status AppendNull() {
+    RETURN_NOT_OK(Reserve(1));
+    UnsafeAppendNextOffset();
+    UnsafeAppendToBitmap(false);
+    return Status::OK();
+  }
+
+  /// \brief Append a value without checking capacity
+  ///
+  /// Room for the value must have been made beforehand with Reserve, for the
+  /// slot, and ReserveData, for its bytes.
+  void UnsafeAppend(const uint8_t* value, int32_t length) {
+    UnsafeAppendNextOffset();
+    value_data_builder_.UnsafeAppend(value, length);
+    UnsafeAppendToBitmap(true);
+  }
+
+  void UnsafeAppend(const char* value, int32_t length) {
+    UnsafeAppend(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  void UnsafeAppend(const std::string& value) {
+    UnsafeAppend(value.c_str(), static_cast<int32_t>(value.size()));
+  }
+
+  /// \brief Append a null without checking capacity. Room for the slot must
+  /// have been made beforehand with Reserve.
+  void UnsafeAppendNull() {
+    UnsafeAppendNextOffset();
+    UnsafeAppendToBitmap(false);
+  }
+
+  /// \brief Append a block of values already laid out as in a BinaryArray
+  ///
+  /// The value data is copied at once and the offsets are rebased in a
+  /// single pass.
+  ///
+  /// \param[in] data the value data
+  /// \param[in] offsets length + 1 offsets into data, value i spanning
+  /// offsets[i] to offsets[i + 1]
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const uint8_t* data, const int32_t* offsets, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
 
   void Reset() override;
   Status Resize(int64_t capacity) override;
@@ -918,6 +1057,8 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
   /// number of bytes to the value data buffer without additional allocations
   Status ReserveData(int64_t elements);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// \return size of values buffer so far
@@ -935,6 +1076,18 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
   TypedBufferBuilder<uint8_t> value_data_builder_;
 
   Status AppendNextOffset();
+
+  // Resize reserves one offset per slot plus the final one, and the value
+  // data never exceeds kBinaryMemoryLimit, so the offset fits
+  void UnsafeAppendNextOffset() {
+    offsets_builder_.UnsafeAppend(static_cast<int32_t>(value_data_builder_.length()));
+  }
+
+  // Append the offsets and data of a packed block of values, making room for
+  // the slots. The caller appends their validity.
+  Status AppendPacked(const uint8_t* data, const int32_t* offsets, int64_t length);
+
+  Status AppendOverflow(int64_t num_bytes) const;
 };
 
 /// \class StringBuilder
@@ -945,6 +1098,7 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
   explicit StringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
 
   using BinaryBuilder::Append;
+  using BinaryBuilder::AppendValues;
   using BinaryBuilder::Reset;
 
   /// \brief Append a sequence of strings in one shot.
@@ -977,6 +1131,75 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
                 const uint8_t* valid_bytes = NULLPTR);
 };
 
+/// \class LargeBinaryBuilder
+/// \brief Builder class for variable-length binary data with 64-bit offsets
+///
+/// Used as BinaryBuilder, for arrays with more than 2^31 - 1 bytes of data.
+class ARROW_EXPORT LargeBinaryBuilder : public ArrayBuilder {
+ public:
+  explicit LargeBinaryBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  LargeBinaryBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+  Status Append(const uint8_t* value, int64_t length);
+
+  Status Append(const char* value, int64_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(const std::string& value) {
+    return Append(value.c_str(), static_cast<int64_t>(value.size()));
+  }
+
+  Status AppendNull();
+
+  /// \brief Append a sequence of strings in one shot.
+  ///
+  /// \param[in] values a vector of strings
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const std::vector<std::string>& values,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  void Reset() override;
+  Status Resize(int64_t capacity) override;
+
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of bytes to the value data buffer without additional allocations
+  Status ReserveData(int64_t elements);
+
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \return size of values buffer so far
+  int64_t value_data_length() const { return value_data_builder_.length(); }
+  /// \return capacity of values buffer
+  int64_t value_data_capacity() const { return value_data_builder_.capacity(); }
+
+  /// Temporary access to a value.
+  ///
+  /// This pointer becomes invalid on the next modifying operation.
+  const uint8_t* GetValue(int64_t i, int64_t* out_length) const;
+
+ protected:
+  TypedBufferBuilder<int64_t> offsets_builder_;
+  TypedBufferBuilder<uint8_t> value_data_builder_;
+
+  Status AppendNextOffset() {
+    return offsets_builder_.Append(value_data_builder_.length());
+  }
+};
+
+/// \class LargeStringBuilder
+/// \brief Builder class for UTF8 strings with 64-bit offsets
+class ARROW_EXPORT LargeStringBuilder : public LargeBinaryBuilder {
+ public:
+  using LargeBinaryBuilder::LargeBinaryBuilder;
+  explicit LargeStringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+};
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
@@ -1012,6 +1235,8 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
 
   void Reset() override;
   Status Resize(int64_t capacity) override;
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// \return size of values buffer so far
@@ -1058,6 +1283,8 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
   StructBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
                 std::vector<std::shared_ptr<ArrayBuilder>>&& field_builders);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// Null bitmap is of equal length to every child field, and any zero byte
@@ -1159,6 +1386,20 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   /// \brief Append a whole dense array to the builder
   Status AppendArray(const Array& array);
 
+  /// \brief Append a range of a dense array to the builder
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
+  /// \brief Seed the hash table with the entries of an existing dictionary
+  ///
+  /// The entries keep their positions in `values` as indices, but they are
+  /// not emitted again: the builder is put in delta building mode, so the
+  /// next Finish call only returns the entries added after them. This lets a
+  /// producer continue a dictionary already sent, e.g. over an IPC stream,
+  /// without rebuilding its hash table. The builder must be empty, and
+  /// `values` must be distinct and non-null.
+  Status InsertMemoValues(const Array& values);
+
   void Reset() override;
   Status Resize(int64_t capacity) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
@@ -1217,6 +1458,10 @@ class ARROW_EXPORT DictionaryBuilder<NullType> : public ArrayBuilder {
   /// \brief Append a whole dense array to the builder
   Status AppendArray(const Array& array);
 
+  /// \brief Append a range of a dense array to the builder
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   Status Resize(int64_t capacity) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
@@ -1265,6 +1510,65 @@ class ARROW_EXPORT StringDictionaryBuilder : public DictionaryBuilder<StringType
   }
 };
 
+// ----------------------------------------------------------------------
+// ChunkedArrayBuilder
+
+/// \brief Builder of a ChunkedArray that finishes its current chunk and
+/// starts a new one when the chunk reaches a row or byte threshold
+///
+/// Values are appended with the wrapped builder. Before appending, call
+/// Reserve with the number of slots and the bytes of variable-size data
+/// about to be added; if they would take the current chunk past either
+/// threshold, the chunk is finished first. With the default thresholds a
+/// BinaryBuilder never fails with CapacityError, so inputs of any size can
+/// be built with bounded memory per chunk.
+class ARROW_EXPORT ChunkedArrayBuilder {
+ public:
+  /// \param[in] builder the builder to append values with
+  /// \param[in] max_chunk_length the maximum number of slots in a chunk
+  /// \param[in] max_chunk_data_length the maximum bytes of variable-size
+  /// data in a chunk, as declared to Reserve
+  explicit ChunkedArrayBuilder(const std::shared_ptr<ArrayBuilder>& builder,
+                               int64_t max_chunk_length = kListMaximumElements,
+                               int64_t max_chunk_data_length = kBinaryMemoryLimit);
+
+  /// \brief The builder to append the values of the current chunk with
+  ArrayBuilder* builder() const { return builder_.get(); }
+
+  /// \brief Make room for appending values to the current chunk
+  ///
+  /// Finishes the current chunk first if it is not empty and the values
+  /// would exceed a threshold. A chunk holding no values yet takes them
+  /// regardless, so a single value larger than the threshold gets a chunk
+  /// of its own.
+  ///
+  /// \param[in] length the number of slots to be appended
+  /// \param[in] data_length the bytes of variable-size data to be appended
+  /// \return Status
+  Status Reserve(int64_t length, int64_t data_length = 0);
+
+  /// \brief Finish the current chunk now, if it holds any values
+  Status FinishChunk();
+
+  /// \brief Finish the last chunk and return all of them. A builder with no
+  /// values gives a single empty chunk. Resets the builder.
+  Status Finish(std::shared_ptr<ChunkedArray>* out);
+
+  /// \brief The number of chunks finished so far
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+
+  /// \brief The number of slots appended across all chunks
+  int64_t length() const { return chunks_length_ + builder_->length(); }
+
+ private:
+  std::shared_ptr<ArrayBuilder> builder_;
+  int64_t max_chunk_length_;
+  int64_t max_chunk_data_length_;
+  int64_t chunk_data_length_;
+  int64_t chunks_length_;
+  std::vector<std::shared_ptr<Array>> chunks_;
+};
+
 // ----------------------------------------------------------------------
 // Helper functions
 
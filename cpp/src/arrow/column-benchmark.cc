@@ -19,6 +19,7 @@
 
 #include "arrow/array.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/test-util.h"
 
@@ -34,6 +35,22 @@ Status MakePrimitive(int64_t length, int64_t null_count, std::shared_ptr<Array>*
   *out = std::make_shared<ArrayType>(length, data, null_bitmap, null_count);
   return Status::OK();
 }
+
+// A batch of 1000 int32 columns, to be cut into windows of state.range(0) rows
+constexpr int kWideBatchColumns = 1000;
+constexpr int64_t kWideBatchRows = 1 << 16;
+
+std::shared_ptr<RecordBatch> MakeWideBatch() {
+  std::vector<std::shared_ptr<Field>> fields;
+  ArrayVector columns;
+  for (int i = 0; i < kWideBatchColumns; ++i) {
+    std::shared_ptr<Array> array;
+    ABORT_NOT_OK(MakePrimitive<Int32Array>(kWideBatchRows, 10, &array));
+    fields.push_back(field("c" + std::to_string(i), int32()));
+    columns.push_back(array);
+  }
+  return RecordBatch::Make(schema(fields), kWideBatchRows, columns);
+}
 }  // anonymous namespace
 
 static void BM_BuildInt32ColumnByChunk(
@@ -52,6 +69,41 @@ static void BM_BuildInt32ColumnByChunk(
   }
 }
 
+static void BM_SliceRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const auto batch = MakeWideBatch();
+  const int64_t window = state.range(0);
+  while (state.KeepRunning()) {
+    for (int64_t offset = 0; offset < kWideBatchRows; offset += window) {
+      auto slice = batch->Slice(offset, window);
+      for (int i = 0; i < kWideBatchColumns; ++i) {
+        benchmark::DoNotOptimize(slice->column_data(i)->offset);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (kWideBatchRows / window) *
+                          kWideBatchColumns);
+}
+
+static void BM_ViewRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
+  const auto batch = MakeWideBatch();
+  const int64_t window = state.range(0);
+  while (state.KeepRunning()) {
+    const BatchView batch_view(*batch);
+    for (int64_t offset = 0; offset < kWideBatchRows; offset += window) {
+      BatchView view = batch_view.Slice(offset, window);
+      for (int i = 0; i < kWideBatchColumns; ++i) {
+        benchmark::DoNotOptimize(view.column(i).offset);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (kWideBatchRows / window) *
+                          kWideBatchColumns);
+}
+
 BENCHMARK(BM_BuildInt32ColumnByChunk)->Range(5, 50000);
 
+// Items are sliced columns
+BENCHMARK(BM_SliceRecordBatch)->Arg(1024)->Arg(8192)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ViewRecordBatch)->Arg(1024)->Arg(8192)->Unit(benchmark::kMicrosecond);
+
 }  // namespace arrow
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/concatenate.h"
+#include "arrow/content_hash.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+
+static constexpr int64_t kLength = 1 << 20;
+
+// Integers or strings, with nulls in the given per mille of slots
+static std::shared_ptr<Array> MakeArray(bool strings, int64_t null_per_mille) {
+  std::vector<bool> is_valid;
+  random_is_valid(kLength, static_cast<double>(null_per_mille) / 1000, &is_valid);
+  std::vector<int64_t> values;
+  randint<int64_t>(kLength, 0, 1000000, &values);
+  std::shared_ptr<Array> array;
+  if (strings) {
+    std::vector<std::string> strs;
+    for (int64_t value : values) {
+      strs.push_back(std::to_string(value));
+    }
+    ArrayFromVector<StringType, std::string>(is_valid, strs, &array);
+  } else {
+    ArrayFromVector<Int64Type, int64_t>(is_valid, values, &array);
+  }
+  return array;
+}
+
+static void BM_RangeEquals(benchmark::State& state) {  // NOLINT non-const reference
+  auto array = MakeArray(state.range(0) != 0, state.range(1));
+  // A copy at another offset, for the bitmaps not to be aligned
+  std::shared_ptr<Array> copy;
+  ABORT_NOT_OK(Concatenate({array->Slice(3)}, default_memory_pool(), &copy));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(array->RangeEquals(3, kLength, 0, copy));
+  }
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+static void BM_HashArray(benchmark::State& state) {  // NOLINT non-const reference
+  auto array = MakeArray(state.range(0) != 0, state.range(1));
+
+  while (state.KeepRunning()) {
+    uint64_t hash;
+    ABORT_NOT_OK(HashArray(*array, &hash));
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+static void BM_HashTable(benchmark::State& state) {  // NOLINT non-const reference
+  // 8 columns of 8 chunks
+  auto array = MakeArray(false, 10);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Column>> columns;
+  for (int i = 0; i < 8; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    ArrayVector chunks;
+    for (int64_t j = 0; j < 8; ++j) {
+      chunks.push_back(array->Slice(j * kLength / 8, kLength / 8));
+    }
+    columns.push_back(std::make_shared<Column>(fields.back(), chunks));
+  }
+  auto table = Table::Make(schema(fields), columns);
+
+  while (state.KeepRunning()) {
+    uint64_t hash;
+    ABORT_NOT_OK(HashTable(*table, state.range(0) != 0, &hash));
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(state.iterations() * kLength * 8);
+}
+
+// First argument: integers (0) or strings (1); second: nulls per mille
+BENCHMARK(BM_RangeEquals)
+    ->Args({0, 0})
+    ->Args({0, 10})
+    ->Args({0, 500})
+    ->Args({1, 0})
+    ->Args({1, 10})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_HashArray)
+    ->Args({0, 0})
+    ->Args({0, 10})
+    ->Args({0, 500})
+    ->Args({1, 0})
+    ->Args({1, 10})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// Argument: without or with threads
+BENCHMARK(BM_HashTable)->Arg(0)->Arg(1)->MinTime(1.0)->UseRealTime();
+
+}  // namespace arrow
@@ -50,100 +50,157 @@ class RangeEqualsVisitor {
         right_start_idx_(right_start_idx),
         result_(false) {}
 
+  // Whether the null bitmaps of the compared ranges are equal
+  bool CompareValidity(const Array& left) const {
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    const uint8_t* left_bitmap =
+        left.null_count() != 0 ? left.null_bitmap_data() : nullptr;
+    const uint8_t* right_bitmap =
+        right_.null_count() != 0 ? right_.null_bitmap_data() : nullptr;
+    const int64_t left_offset = left.offset() + left_start_idx_;
+    const int64_t right_offset = right_.offset() + right_start_idx_;
+    if (left_bitmap != nullptr && right_bitmap != nullptr) {
+      return BitmapEquals(left_bitmap, left_offset, right_bitmap, right_offset, length);
+    } else if (left_bitmap != nullptr) {
+      return CountSetBits(left_bitmap, left_offset, length) == length;
+    } else if (right_bitmap != nullptr) {
+      return CountSetBits(right_bitmap, right_offset, length) == length;
+    }
+    return true;
+  }
+
+  // Check the null bitmaps of the ranges, then call
+  // `compare_run(left_index, right_index, length)` on each run of valid
+  // slots within blocks of 64 slots. Null slots are skipped.
+  template <typename CompareRun>
+  bool CompareValidRuns(const Array& left, CompareRun&& compare_run) const {
+    if (!CompareValidity(left)) {
+      return false;
+    }
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    const uint8_t* bitmap = left.null_count() != 0 ? left.null_bitmap_data() : nullptr;
+    if (bitmap == nullptr) {
+      return length == 0 || compare_run(left_start_idx_, right_start_idx_, length);
+    }
+    const int64_t bitmap_offset = left.offset() + left_start_idx_;
+    BitBlockCounter counter(bitmap, bitmap_offset, length);
+    for (int64_t position = 0; position < length;) {
+      const BitBlockCount block = counter.NextWord();
+      if (block.AllSet()) {
+        if (!compare_run(left_start_idx_ + position, right_start_idx_ + position,
+                         block.length)) {
+          return false;
+        }
+      } else if (!block.NoneSet()) {
+        // Runs of set bits in the word, found by counting trailing zeros
+        uint64_t word = ReadBitmapWord(bitmap, bitmap_offset + position, block.length);
+        while (word != 0) {
+          const int start = BitUtil::CountTrailingZeros(word);
+          const int end = start + BitUtil::CountTrailingZeros(~(word >> start));
+          if (!compare_run(left_start_idx_ + position + start,
+                           right_start_idx_ + position + start, end - start)) {
+            return false;
+          }
+          word = end < 64 ? word & (~static_cast<uint64_t>(0) << end) : 0;
+        }
+      }
+      position += block.length;
+    }
+    return true;
+  }
+
+  // Values of fixed width, from slot 0 of each array, compared bytewise
+  bool CompareFixedWidth(const Array& left, const uint8_t* left_values,
+                         const uint8_t* right_values, int64_t byte_width) const {
+    return CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+      return std::memcmp(left_values + i * byte_width, right_values + o_i * byte_width,
+                         static_cast<size_t>(length * byte_width)) == 0;
+    });
+  }
+
+  // The values of a primitive array from its slot 0, if it has any
+  static const uint8_t* RawValues(const PrimitiveArray& array, int64_t byte_width) {
+    return array.values() ? array.values()->data() + array.offset() * byte_width
+                          : nullptr;
+  }
+
+  // Floating point values are compared by value, not bitwise
   template <typename ArrayType>
   inline Status CompareValues(const ArrayType& left) {
     const auto& right = checked_cast<const ArrayType&>(right_);
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i) ||
-          (!is_null && left.Value(i) != right.Value(o_i))) {
-        result_ = false;
-        return Status::OK();
+    result_ = CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+      for (int64_t j = 0; j < length; ++j) {
+        if (left.Value(i + j) != right.Value(o_i + j)) {
+          return false;
+        }
       }
-    }
-    result_ = true;
+      return true;
+    });
     return Status::OK();
   }
 
-  bool CompareBinaryRange(const BinaryArray& left) const {
-    const auto& right = checked_cast<const BinaryArray&>(right_);
+  // Whether the value offsets of runs of slots are equal relative to the
+  // start of the runs
+  template <typename OffsetType>
+  static bool CompareOffsets(const OffsetType* left_offsets,
+                             const OffsetType* right_offsets, int64_t length) {
+    const OffsetType left_start = left_offsets[0];
+    const OffsetType right_start = right_offsets[0];
+    bool equal = true;
+    for (int64_t j = 1; j <= length; ++j) {
+      equal &= left_offsets[j] - left_start == right_offsets[j] - right_start;
+    }
+    return equal;
+  }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
-        return false;
-      }
+  template <typename ArrayType>
+  bool CompareBinaryRange(const ArrayType& left) const {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = checked_cast<const ArrayType&>(right_);
+    const offset_type* left_offsets = left.raw_value_offsets();
+    const offset_type* right_offsets = right.raw_value_offsets();
 
-      if (end_offset - begin_offset > 0 &&
-          std::memcmp(left.value_data()->data() + begin_offset,
-                      right.value_data()->data() + right_begin_offset,
-                      static_cast<size_t>(end_offset - begin_offset))) {
+    // The values of a run of valid slots are contiguous: one memcmp each
+    return CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+      if (!CompareOffsets(left_offsets + i, right_offsets + o_i, length)) {
         return false;
       }
-    }
-    return true;
+      const offset_type num_bytes = left_offsets[i + length] - left_offsets[i];
+      return num_bytes == 0 ||
+             std::memcmp(left.value_data()->data() + left_offsets[i],
+                         right.value_data()->data() + right_offsets[o_i],
+                         static_cast<size_t>(num_bytes)) == 0;
+    });
   }
 
-  bool CompareLists(const ListArray& left) {
-    const auto& right = checked_cast<const ListArray&>(right_);
+  template <typename ArrayType>
+  bool CompareLists(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = checked_cast<const ArrayType&>(right_);
 
     const std::shared_ptr<Array>& left_values = left.values();
     const std::shared_ptr<Array>& right_values = right.values();
+    const offset_type* left_offsets = left.raw_value_offsets();
+    const offset_type* right_offsets = right.raw_value_offsets();
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
-        return false;
-      }
-      if (!left_values->RangeEquals(begin_offset, end_offset, right_begin_offset,
-                                    right_values)) {
-        return false;
-      }
-    }
-    return true;
+    return CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+      return CompareOffsets(left_offsets + i, right_offsets + o_i, length) &&
+             left_values->RangeEquals(left_offsets[i], left_offsets[i + length],
+                                      right_offsets[o_i], right_values);
+    });
   }
 
   bool CompareStructs(const StructArray& left) {
     const auto& right = checked_cast<const StructArray&>(right_);
-    bool equal_fields = true;
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      if (left.IsNull(i) != right.IsNull(o_i)) {
-        return false;
-      }
-      if (left.IsNull(i)) continue;
+    return CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
       for (int j = 0; j < left.num_fields(); ++j) {
-        // TODO: really we should be comparing stretches of non-null data rather
-        // than looking at one value at a time.
-        equal_fields = left.field(j)->RangeEquals(i, i + 1, o_i, right.field(j));
-        if (!equal_fields) {
+        if (!left.field(j)->RangeEquals(i, i + length, o_i, right.field(j))) {
           return false;
         }
       }
-    }
-    return true;
+      return true;
+    });
   }
 
   bool CompareUnions(const UnionArray& left) const {
@@ -213,37 +270,15 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeBinaryArray& left) {
+    result_ = CompareBinaryRange(left);
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryArray& left) {
     const auto& right = checked_cast<const FixedSizeBinaryArray&>(right_);
-
-    int32_t width = left.byte_width();
-
-    const uint8_t* left_data = nullptr;
-    const uint8_t* right_data = nullptr;
-
-    if (left.values()) {
-      left_data = left.raw_values();
-    }
-
-    if (right.values()) {
-      right_data = right.raw_values();
-    }
-
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    result_ = CompareFixedWidth(left, left.raw_values(), right.raw_values(),
+                                left.byte_width());
     return Status::OK();
   }
 
@@ -257,10 +292,31 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const BooleanArray& left) {
+    const auto& right = checked_cast<const BooleanArray&>(right_);
+    const uint8_t* left_values = left.values()->data();
+    const uint8_t* right_values = right.values()->data();
+    result_ = CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+      return BitmapEquals(left_values, left.offset() + i, right_values,
+                          right.offset() + o_i, length);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const FloatArray& left) { return CompareValues(left); }
+
+  Status Visit(const DoubleArray& left) { return CompareValues(left); }
+
+  // Integers and temporal types are equal when bitwise equal
   template <typename T>
   typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value, Status>::type Visit(
       const T& left) {
-    return CompareValues<T>(left);
+    const auto& right = checked_cast<const PrimitiveArray&>(right_);
+    const auto& type = checked_cast<const FixedWidthType&>(*left.type());
+    const int64_t byte_width = type.bit_width() / CHAR_BIT;
+    result_ = CompareFixedWidth(left, RawValues(left, byte_width),
+                                RawValues(right, byte_width), byte_width);
+    return Status::OK();
   }
 
   Status Visit(const ListArray& left) {
@@ -268,6 +324,11 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeListArray& left) {
+    result_ = CompareLists(left);
+    return Status::OK();
+  }
+
   Status Visit(const StructArray& left) {
     result_ = CompareStructs(left);
     return Status::OK();
@@ -316,17 +377,28 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
   }
 
   if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
+    // The null bitmaps are already known to be equal: compare the values of
+    // blocks all valid at once, and skip blocks all null
+    internal::BitBlockCounter counter(left.null_bitmap_data(), left.offset(),
+                                      left.length());
+    for (int64_t position = 0; position < left.length();) {
+      const internal::BitBlockCount block = counter.NextWord();
+      if (block.AllSet()) {
+        if (memcmp(left_data, right_data, block.length * byte_width) != 0) {
+          return false;
+        }
+      } else if (!block.NoneSet()) {
+        for (int64_t i = 0; i < block.length; ++i) {
+          if (left.IsValid(position + i) &&
+              memcmp(left_data + i * byte_width, right_data + i * byte_width,
+                     byte_width) != 0) {
+            return false;
+          }
+        }
       }
-      left_data += byte_width;
-      right_data += byte_width;
+      left_data += block.length * byte_width;
+      right_data += block.length * byte_width;
+      position += block.length;
     }
     return true;
   } else {
@@ -353,12 +425,26 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
       const uint8_t* left_data = left.values()->data();
       const uint8_t* right_data = right.values()->data();
 
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
-                                   BitUtil::GetBit(right_data, i + right.offset())) {
-          result_ = false;
-          return Status::OK();
+      internal::BitBlockCounter counter(left.null_bitmap_data(), left.offset(),
+                                        left.length());
+      for (int64_t position = 0; position < left.length();) {
+        const internal::BitBlockCount block = counter.NextWord();
+        if (block.AllSet()) {
+          if (!BitmapEquals(left_data, left.offset() + position, right_data,
+                            right.offset() + position, block.length)) {
+            result_ = false;
+            return Status::OK();
+          }
+        } else if (!block.NoneSet()) {
+          for (int64_t i = position; i < position + block.length; ++i) {
+            if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
+                                       BitUtil::GetBit(right_data, i + right.offset())) {
+              result_ = false;
+              return Status::OK();
+            }
+          }
         }
+        position += block.length;
       }
       result_ = true;
     } else {
@@ -379,18 +465,20 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
 
   template <typename ArrayType>
   bool ValueOffsetsEqual(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
     const auto& right = checked_cast<const ArrayType&>(right_);
 
     if (left.offset() == 0 && right.offset() == 0) {
       return left.value_offsets()->Equals(*right.value_offsets(),
-                                          (left.length() + 1) * sizeof(int32_t));
+                                          (left.length() + 1) * sizeof(offset_type));
     } else {
       // One of the arrays is sliced; logic is more complicated because the
       // value offsets are not both 0-based
       auto left_offsets =
-          reinterpret_cast<const int32_t*>(left.value_offsets()->data()) + left.offset();
+          reinterpret_cast<const offset_type*>(left.value_offsets()->data()) +
+          left.offset();
       auto right_offsets =
-          reinterpret_cast<const int32_t*>(right.value_offsets()->data()) +
+          reinterpret_cast<const offset_type*>(right.value_offsets()->data()) +
           right.offset();
 
       for (int64_t i = 0; i < left.length() + 1; ++i) {
@@ -402,10 +490,12 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     }
   }
 
-  bool CompareBinary(const BinaryArray& left) {
-    const auto& right = checked_cast<const BinaryArray&>(right_);
+  template <typename ArrayType>
+  bool CompareBinary(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = checked_cast<const ArrayType&>(right_);
 
-    bool equal_offsets = ValueOffsetsEqual<BinaryArray>(left);
+    bool equal_offsets = ValueOffsetsEqual<ArrayType>(left);
     if (!equal_offsets) {
       return false;
     }
@@ -423,8 +513,8 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     if (left.null_count() == 0) {
       // Fast path for null count 0, single memcmp
       if (left.offset() == 0 && right.offset() == 0) {
-        return std::memcmp(left_data, right_data,
-                           left.raw_value_offsets()[left.length()]) == 0;
+        const auto total_bytes = left.raw_value_offsets()[left.length()];
+        return std::memcmp(left_data, right_data, static_cast<size_t>(total_bytes)) == 0;
       } else {
         const int64_t total_bytes =
             left.value_offset(left.length()) - left.value_offset(0);
@@ -434,8 +524,8 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
       }
     } else {
       // ARROW-537: Only compare data in non-null slots
-      const int32_t* left_offsets = left.raw_value_offsets();
-      const int32_t* right_offsets = right.raw_value_offsets();
+      const offset_type* left_offsets = left.raw_value_offsets();
+      const offset_type* right_offsets = right.raw_value_offsets();
       for (int64_t i = 0; i < left.length(); ++i) {
         if (left.IsNull(i)) {
           continue;
@@ -454,17 +544,27 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     return Status::OK();
   }
 
-  Status Visit(const ListArray& left) {
-    const auto& right = checked_cast<const ListArray&>(right_);
-    bool equal_offsets = ValueOffsetsEqual<ListArray>(left);
+  Status Visit(const LargeBinaryArray& left) {
+    result_ = CompareBinary(left);
+    return Status::OK();
+  }
+
+  Status Visit(const ListArray& left) { return CompareListValues(left); }
+
+  Status Visit(const LargeListArray& left) { return CompareListValues(left); }
+
+  template <typename ArrayType>
+  Status CompareListValues(const ArrayType& left) {
+    const auto& right = checked_cast<const ArrayType&>(right_);
+    bool equal_offsets = ValueOffsetsEqual<ArrayType>(left);
     if (!equal_offsets) {
       result_ = false;
       return Status::OK();
     }
 
-    result_ = left.values()->RangeEquals(
-        left.value_offset(0), left.value_offset(left.length()) - left.value_offset(0),
-        right.value_offset(0), right.values());
+    result_ = left.values()->RangeEquals(left.value_offset(0),
+                                         left.value_offset(left.length()),
+                                         right.value_offset(0), right.values());
     return Status::OK();
   }
 
@@ -497,11 +597,19 @@ inline bool FloatingApproxEquals(const NumericArray<TYPE>& left,
   static constexpr T EPSILON = static_cast<T>(1E-5);
 
   if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (left.IsNull(i)) continue;
-      if (fabs(left_data[i] - right_data[i]) > EPSILON) {
-        return false;
+    internal::BitBlockCounter counter(left.null_bitmap_data(), left.offset(),
+                                      left.length());
+    for (int64_t position = 0; position < left.length();) {
+      const internal::BitBlockCount block = counter.NextWord();
+      if (!block.NoneSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (!block.AllSet() && left.IsNull(i)) continue;
+          if (fabs(left_data[i] - right_data[i]) > EPSILON) {
+            return false;
+          }
+        }
       }
+      position += block.length;
     }
   } else {
     for (int64_t i = 0; i < left.length(); ++i) {
@@ -630,6 +738,8 @@ class TypeEqualsVisitor {
 
   Status Visit(const ListType& left) { return VisitChildren(left); }
 
+  Status Visit(const LargeListType& left) { return VisitChildren(left); }
+
   Status Visit(const StructType& left) { return VisitChildren(left); }
 
   Status Visit(const UnionType& left) {
@@ -19,9 +19,13 @@
 #define ARROW_COMPUTE_API_H
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
 #include "arrow/compute/kernel.h"
 
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/hash.h"
 
 #endif  // ARROW_COMPUTE_API_H
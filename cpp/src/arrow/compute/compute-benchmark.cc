@@ -17,13 +17,21 @@
 
 #include "benchmark/benchmark.h"
 
+#include <string>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
 #include "arrow/test-util.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/hash.h"
 
 namespace arrow {
@@ -227,5 +235,297 @@ BENCHMARK(BM_UniqueUInt8WithNulls)
     ->Unit(benchmark::kMicrosecond)
     ->UseRealTime();
 
+template <typename Type>
+static void MakeRandomArray(int64_t length, double null_percent,
+                            std::shared_ptr<Array>* out) {
+  using T = typename Type::c_type;
+  std::vector<int64_t> draws;
+  randint<int64_t>(length, 0, 100, &draws);
+  std::vector<T> values(draws.begin(), draws.end());
+  if (null_percent > 0) {
+    std::vector<bool> is_valid;
+    random_is_valid(length, null_percent, &is_valid);
+    ArrayFromVector<Type, T>(is_valid, values, out);
+  } else {
+    ArrayFromVector<Type, T>(values, out);
+  }
+}
+
+static void BM_CompareArrayArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> left, right;
+  MakeRandomArray<Int64Type>(length, null_percent, &left);
+  MakeRandomArray<Int64Type>(length, null_percent, &right);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(left), Datum(right), CompareOptions(LESS), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t) * 2);
+}
+
+static void BM_CompareArrayScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> left;
+  MakeRandomArray<Int64Type>(length, null_percent, &left);
+  auto right = std::make_shared<Int64Scalar>(50);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(left), Datum(right), CompareOptions(LESS), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t));
+}
+
+static void BM_AddArrayArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> left, right;
+  MakeRandomArray<DoubleType>(length, null_percent, &left);
+  MakeRandomArray<DoubleType>(length, null_percent, &right);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Add(&ctx, Datum(left), Datum(right), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(double) * 2);
+}
+
+static void BM_MultiplyArrayScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> left;
+  MakeRandomArray<Int32Type>(length, null_percent, &left);
+  auto right = std::make_shared<Int32Scalar>(3);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Multiply(&ctx, Datum(left), Datum(right), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int32_t));
+}
+
+// Low-cardinality string column, as plain strings and dictionary-encoded
+static void MakeLowCardinalityStrings(int64_t length, double null_percent,
+                                      std::shared_ptr<Array>* dense,
+                                      std::shared_ptr<Array>* encoded) {
+  std::shared_ptr<Array> draws;
+  MakeRandomArray<Int64Type>(length, null_percent, &draws);
+  const auto& draw_values = static_cast<const Int64Array&>(*draws);
+  StringBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    if (draw_values.IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(builder.Append("category-" + std::to_string(draw_values.Value(i))));
+    }
+  }
+  ABORT_NOT_OK(builder.Finish(dense));
+
+  FunctionContext ctx;
+  Datum out;
+  ABORT_NOT_OK(DictionaryEncode(&ctx, Datum(*dense), &out));
+  *encoded = out.make_array();
+}
+
+static void BM_CompareStringScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> dense, encoded;
+  MakeLowCardinalityStrings(length, null_percent, &dense, &encoded);
+  const std::string value = "category-50";
+  auto right = std::make_shared<StringScalar>(std::make_shared<Buffer>(value));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(dense), Datum(right), CompareOptions(EQUAL), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void BM_CompareDictionaryScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> dense, encoded;
+  MakeLowCardinalityStrings(length, null_percent, &dense, &encoded);
+  const std::string value = "category-50";
+  auto right = std::make_shared<StringScalar>(std::make_shared<Buffer>(value));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(
+        Compare(&ctx, Datum(encoded), Datum(right), CompareOptions(EQUAL), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void BM_IsInDictionary(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  std::shared_ptr<Array> dense, encoded;
+  MakeLowCardinalityStrings(length, null_percent, &dense, &encoded);
+  std::shared_ptr<Array> value_set;
+  ArrayFromVector<StringType, std::string>({"category-5", "category-50", "category-500"},
+                                           &value_set);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(IsIn(&ctx, Datum(encoded), Datum(value_set), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+// (a + b) * 2 > c over int32 columns
+static std::shared_ptr<RecordBatch> MakePredicateBatch(int64_t length,
+                                                       double null_percent) {
+  std::shared_ptr<Array> a, b, c;
+  MakeRandomArray<Int32Type>(length, null_percent, &a);
+  MakeRandomArray<Int32Type>(length, null_percent, &b);
+  MakeRandomArray<Int32Type>(length, null_percent, &c);
+  auto schema = ::arrow::schema(
+      {field("a", int32()), field("b", int32()), field("c", int32())});
+  return RecordBatch::Make(schema, length, {a, b, c});
+}
+
+static void BM_KernelPredicate(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  auto batch = MakePredicateBatch(length, null_percent);
+  auto two = std::make_shared<Int32Scalar>(2);
+  CompareOptions options(GREATER);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum sum, product, out;
+    ABORT_NOT_OK(Add(&ctx, Datum(batch->column(0)), Datum(batch->column(1)), &sum));
+    ABORT_NOT_OK(Multiply(&ctx, sum, Datum(two), &product));
+    ABORT_NOT_OK(Compare(&ctx, product, Datum(batch->column(2)), options, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int32_t) * 3);
+}
+
+static void BM_ExprPredicate(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  const double null_percent = static_cast<double>(state.range(1)) / 100;
+  auto batch = MakePredicateBatch(length, null_percent);
+
+  auto sum = MakeCallExpr(ExprOp::ADD, MakeFieldExpr("a"), MakeFieldExpr("b"));
+  auto product = MakeCallExpr(ExprOp::MULTIPLY, sum,
+                              MakeLiteralExpr(std::make_shared<Int32Scalar>(2)));
+  auto predicate = MakeCallExpr(ExprOp::GREATER, product, MakeFieldExpr("c"));
+
+  EvaluatorOptions options = EvaluatorOptions::Defaults();
+  options.fuse_operators = state.range(2) != 0;
+  std::unique_ptr<ExprEvaluator> evaluator;
+  ABORT_NOT_OK(ExprEvaluator::Make(predicate, batch->schema(), options, &evaluator));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(evaluator->Evaluate(&ctx, *batch, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int32_t) * 3);
+}
+
+constexpr int kElementwiseBenchmarkLength = 1 << 22;
+
+#define ADD_ELEMENTWISE_ARGS(WHAT)             \
+  WHAT->Args({kElementwiseBenchmarkLength, 0}) \
+      ->Args({kElementwiseBenchmarkLength, 5}) \
+      ->MinTime(1.0)                           \
+      ->Unit(benchmark::kMicrosecond)          \
+      ->UseRealTime()
+
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_CompareArrayArray));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_CompareArrayScalar));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_AddArrayArray));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_MultiplyArrayScalar));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_CompareStringScalar));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_CompareDictionaryScalar));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_IsInDictionary));
+ADD_ELEMENTWISE_ARGS(BENCHMARK(BM_KernelPredicate));
+
+// Third argument: whether operators are fused
+BENCHMARK(BM_ExprPredicate)
+    ->Args({kElementwiseBenchmarkLength, 0, 0})
+    ->Args({kElementwiseBenchmarkLength, 0, 1})
+    ->Args({kElementwiseBenchmarkLength, 5, 0})
+    ->Args({kElementwiseBenchmarkLength, 5, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Chunked inputs with a varying degree of parallelism, given as first argument
+static std::shared_ptr<ChunkedArray> MakeChunkedInt64(int num_chunks,
+                                                      int64_t chunk_length) {
+  ArrayVector chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    std::shared_ptr<Array> chunk;
+    MakeRandomArray<Int64Type>(chunk_length, 0.05, &chunk);
+    chunks.push_back(chunk);
+  }
+  return std::make_shared<ChunkedArray>(chunks);
+}
+
+constexpr int kChunkedBenchmarkChunks = 16;
+constexpr int64_t kChunkedBenchmarkChunkLength = 1 << 18;
+
+static void BM_CastChunked(benchmark::State& state) {  // NOLINT non-const reference
+  auto values = MakeChunkedInt64(kChunkedBenchmarkChunks, kChunkedBenchmarkChunkLength);
+  CastOptions options;
+
+  FunctionContext ctx;
+  ctx.set_parallelism(static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, Datum(values), float64(), options, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * values->length() * sizeof(int64_t));
+}
+
+static void BM_DictEncodeChunked(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto values = MakeChunkedInt64(kChunkedBenchmarkChunks, kChunkedBenchmarkChunkLength);
+
+  FunctionContext ctx;
+  ctx.set_parallelism(static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(DictionaryEncode(&ctx, Datum(values), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * values->length() * sizeof(int64_t));
+}
+
+BENCHMARK(BM_CastChunked)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_DictEncodeChunked)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
 }  // namespace compute
 }  // namespace arrow
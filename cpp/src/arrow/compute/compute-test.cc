@@ -32,6 +32,8 @@
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/pretty_print.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
@@ -39,9 +41,12 @@
 #include "arrow/type_traits.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/hash.h"
 #include "arrow/compute/kernels/util-internal.h"
 
@@ -636,7 +641,7 @@ TEST_F(TestCast, UnsupportedTarget) {
   ArrayFromVector<Int32Type, int32_t>(int32(), is_valid, v1, &arr);
 
   shared_ptr<Array> result;
-  ASSERT_RAISES(NotImplemented, Cast(&this->ctx_, *arr, utf8(), {}, &result));
+  ASSERT_RAISES(NotImplemented, Cast(&this->ctx_, *arr, binary(), {}, &result));
 }
 
 TEST_F(TestCast, DateTimeZeroCopy) {
@@ -889,6 +894,148 @@ TEST_F(TestCast, StringToNumberErrors) {
   CheckFails<StringType, std::string>(utf8(), {"z"}, is_valid, float32(), options);
 }
 
+TEST_F(TestCast, StringToTimestamp) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+
+  vector<std::string> strings = {"1970-01-01", "xxx", "2018-11-13 17:11:10",
+                                 "2018-11-13T17:11:10Z", "1900-02-28T12:34:56+01:00"};
+  vector<int64_t> e_second = {0, 0, 1542129070, 1542129070, -2203935904LL};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), strings, is_valid, timestamp(TimeUnit::SECOND), e_second, options);
+
+  strings = {"1970-01-01 00:00:00.001", "xxx", "2018-11-13 17:11:10.123",
+             "1969-12-31T23:59:59.9Z", "2000-02-29T00:00"};
+  vector<int64_t> e_milli = {1, 0, 1542129070123LL, -100, 951782400000LL};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), strings, is_valid, timestamp(TimeUnit::MILLI), e_milli, options);
+
+  strings = {"1970-01-01T00:00:00.000000001", "xxx", "2018-11-13T17:11:10.123456789",
+             "2262-04-11T23:47:16.854775807", "1677-09-21T00:12:43.145224192"};
+  vector<int64_t> e_nano = {1, 0, 1542129070123456789LL, 9223372036854775807LL,
+                            -9223372036854775807LL - 1};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), strings, is_valid, timestamp(TimeUnit::NANO), e_nano, options);
+}
+
+TEST_F(TestCast, StringToTimestampErrors) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true};
+
+  auto ts_second = timestamp(TimeUnit::SECOND);
+  auto ts_nano = timestamp(TimeUnit::NANO);
+  for (const char* s :
+       {"", "2018-11-13 ", "2018-13-01", "2018-02-29", "2018-11-13T24:00:00",
+        "2018-11-13T17:11:1", "2018-11-13 17:11:10+", "2018/11/13", "2018-11-13Z"}) {
+    CheckFails<StringType, std::string>(utf8(), {s}, is_valid, ts_second, options);
+  }
+  // Fraction not representable in the target unit
+  CheckFails<StringType, std::string>(utf8(), {"2018-11-13 17:11:10.5"}, is_valid,
+                                      ts_second, options);
+  // Out of range
+  CheckFails<StringType, std::string>(utf8(), {"2262-04-12"}, is_valid, ts_nano,
+                                      options);
+}
+
+TEST_F(TestCast, StringToDate32) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true};
+  vector<std::string> strings = {"1970-01-01", "xxx", "2000-02-29", "1899-12-31"};
+  vector<int32_t> e = {0, 0, 11016, -25568};
+  CheckCase<StringType, std::string, Date32Type, int32_t>(utf8(), strings, is_valid,
+                                                          date32(), e, options);
+
+  is_valid = {true};
+  CheckFails<StringType, std::string>(utf8(), {"1970-01-01 00:00:00"}, is_valid,
+                                      date32(), options);
+  CheckFails<StringType, std::string>(utf8(), {"2001-02-29"}, is_valid, date32(),
+                                      options);
+}
+
+TEST_F(TestCast, NumberToString) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+
+  vector<int8_t> v_int8 = {0, 1, -128, 127, -5};
+  vector<std::string> e_int8 = {"0", "", "-128", "127", "-5"};
+  CheckCase<Int8Type, int8_t, StringType, std::string>(int8(), v_int8, is_valid, utf8(),
+                                                       e_int8, options);
+
+  vector<uint64_t> v_uint64 = {0, 1, 18446744073709551615ULL, 100, 99};
+  vector<std::string> e_uint64 = {"0", "", "18446744073709551615", "100", "99"};
+  CheckCase<UInt64Type, uint64_t, StringType, std::string>(uint64(), v_uint64, is_valid,
+                                                           utf8(), e_uint64, options);
+
+  vector<int64_t> v_int64 = {0, 1, -9223372036854775807LL - 1, 1234567890123LL, -10};
+  vector<std::string> e_int64 = {"0", "", "-9223372036854775808", "1234567890123",
+                                 "-10"};
+  CheckCase<Int64Type, int64_t, StringType, std::string>(int64(), v_int64, is_valid,
+                                                         utf8(), e_int64, options);
+
+  vector<double> v_double = {0.1, 1.5, -2.5e-8, 1e100, 0.30000000000000004};
+  vector<std::string> e_double = {"0.1", "", "-2.5e-08", "1e+100",
+                                  "0.30000000000000004"};
+  CheckCase<DoubleType, double, StringType, std::string>(float64(), v_double, is_valid,
+                                                         utf8(), e_double, options);
+
+  vector<float> v_float = {0.1f, 1.5f, 3.4028235e38f, -7.0f, 16777216.0f};
+  vector<std::string> e_float = {"0.1", "", "3.40282347e+38", "-7", "16777216"};
+  CheckCase<FloatType, float, StringType, std::string>(float32(), v_float, is_valid,
+                                                       utf8(), e_float, options);
+
+  vector<bool> v_bool = {true, false, false, true, false};
+  vector<std::string> e_bool = {"true", "", "false", "true", "false"};
+  CheckCase<BooleanType, bool, StringType, std::string>(boolean(), v_bool, is_valid,
+                                                        utf8(), e_bool, options);
+}
+
+TEST_F(TestCast, TemporalToString) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true};
+
+  vector<int32_t> v_date = {0, 1, 11016, -719529};
+  vector<std::string> e_date = {"1970-01-01", "", "2000-02-29", "-0001-12-31"};
+  CheckCase<Date32Type, int32_t, StringType, std::string>(date32(), v_date, is_valid,
+                                                          utf8(), e_date, options);
+
+  vector<int64_t> v_ts = {0, 1, 1542129070, -1};
+  vector<std::string> e_second = {"1970-01-01 00:00:00", "", "2018-11-13 17:11:10",
+                                  "1969-12-31 23:59:59"};
+  CheckCase<TimestampType, int64_t, StringType, std::string>(
+      timestamp(TimeUnit::SECOND), v_ts, is_valid, utf8(), e_second, options);
+
+  vector<std::string> e_micro = {"1970-01-01 00:00:00.000000", "",
+                                 "1970-01-01 00:25:42.129070",
+                                 "1969-12-31 23:59:59.999999"};
+  CheckCase<TimestampType, int64_t, StringType, std::string>(
+      timestamp(TimeUnit::MICRO), v_ts, is_valid, utf8(), e_micro, options);
+
+  // Round trip through the parser
+  vector<int64_t> v_nano = {-9223372036854775807LL - 1, 0, -1, 9223372036854775807LL};
+  shared_ptr<Array> timestamps, strings, round_trip;
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::NANO), is_valid, v_nano,
+                                          &timestamps);
+  ASSERT_OK(Cast(&ctx_, *timestamps, utf8(), options, &strings));
+  ASSERT_OK(Cast(&ctx_, *strings, timestamp(TimeUnit::NANO), options, &round_trip));
+  ASSERT_ARRAYS_EQUAL(*timestamps, *round_trip);
+}
+
+TEST_F(TestCast, NullToString) {
+  CastOptions options;
+
+  auto input = std::make_shared<NullArray>(3);
+  shared_ptr<Array> result;
+  ASSERT_OK(Cast(&ctx_, *input, utf8(), options, &result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_EQ(3, result->null_count());
+  ASSERT_EQ(0, static_cast<const StringArray&>(*result).value_offset(3));
+}
+
 template <typename TestType>
 class TestDictionaryCast : public TestCast {};
 
@@ -944,6 +1091,30 @@ TEST_F(TestCast, DictToNonDictNoNulls) {
   ASSERT_ARRAYS_EQUAL(*e2, *chunks[1]);
 }
 
+TEST_F(TestCast, DictToOtherValueType) {
+  // Cast through the dictionary, then unpack against the casted dictionary
+  auto dict = _MakeArray<Int32Type, int32_t>(int32(), {10, -2, 7}, {});
+  auto dict_type = dictionary(int8(), dict);
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 1, 1, 2, 0, 0},
+                                              {true, true, false, true, true, true});
+  auto dict_array = std::make_shared<DictionaryArray>(dict_type, indices);
+
+  shared_ptr<Array> result;
+  ASSERT_OK(Cast(&this->ctx_, *dict_array, utf8(), CastOptions(), &result));
+  auto expected = _MakeArray<StringType, std::string>(
+      utf8(), {"10", "-2", "", "7", "10", "10"}, {true, true, false, true, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+
+  ASSERT_OK(Cast(&this->ctx_, *dict_array->Slice(1), float64(), CastOptions(), &result));
+  auto expected_double = _MakeArray<DoubleType, double>(
+      float64(), {-2, 0, 7, 10, 10}, {true, false, true, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected_double, *result);
+
+  // Unsupported value casts are reported as such
+  ASSERT_RAISES(NotImplemented,
+                Cast(&this->ctx_, *dict_array, binary(), CastOptions(), &result));
+}
+
 /*TYPED_TEST(TestDictionaryCast, Reverse) {
   CastOptions options;
   shared_ptr<Array> plain_array =
@@ -996,6 +1167,65 @@ TEST_F(TestCast, ListToList) {
                   options);
 }
 
+TEST_F(TestCast, ListToLargeList) {
+  CastOptions options;
+
+  // Offsets not starting at zero: the values are sliced
+  std::shared_ptr<Array> offsets, values, list_array;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true, true}, {2, 3, 5, 5, 8},
+                                      &offsets);
+  ArrayFromVector<Int32Type, int32_t>({0, 1, 2, 3, 4, 5, 6, 7, 8}, &values);
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, pool_, &list_array));
+
+  std::shared_ptr<Array> large_offsets, large_values, large_list_array;
+  ArrayFromVector<Int64Type, int64_t>({true, true, false, true, true}, {0, 1, 3, 3, 6},
+                                      &large_offsets);
+  ArrayFromVector<Int64Type, int64_t>({2, 3, 4, 5, 6, 7}, &large_values);
+  ASSERT_OK(LargeListArray::FromArrays(*large_offsets, *large_values, pool_,
+                                       &large_list_array));
+
+  CheckPass(*list_array, *large_list_array, large_list_array->type(), options);
+
+  std::shared_ptr<Array> narrow_offsets, narrow_list_array;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true, true}, {0, 1, 3, 3, 6},
+                                      &narrow_offsets);
+  ASSERT_OK(ListArray::FromArrays(*narrow_offsets, *large_values, pool_,
+                                  &narrow_list_array));
+  CheckPass(*large_list_array, *narrow_list_array, narrow_list_array->type(), options);
+  CheckPass(*large_list_array, *large_list_array, large_list_array->type(), options);
+}
+
+TEST_F(TestCast, StringToLargeString) {
+  CastOptions options;
+  vector<bool> is_valid = {true, false, true, true, true};
+  vector<std::string> strings = {"Hi", "", "", "Ol\xc3\xa1 mundo", "World"};
+
+  CheckCase<StringType, std::string, LargeStringType, std::string>(
+      utf8(), strings, is_valid, large_utf8(), strings, options);
+  CheckCase<LargeStringType, std::string, StringType, std::string>(
+      large_utf8(), strings, is_valid, utf8(), strings, options);
+  CheckCase<BinaryType, std::string, LargeBinaryType, std::string>(
+      binary(), strings, is_valid, large_binary(), strings, options);
+  CheckCase<LargeBinaryType, std::string, BinaryType, std::string>(
+      large_binary(), strings, is_valid, binary(), strings, options);
+
+  // The character data is shared with the input
+  shared_ptr<Array> input, result;
+  ArrayFromVector<StringType, std::string>(utf8(), is_valid, strings, &input);
+  ASSERT_OK(Cast(&ctx_, *input, large_utf8(), options, &result));
+  ASSERT_EQ(input->data()->buffers[2]->data(), result->data()->buffers[2]->data());
+
+  // Narrowing fails when the offsets do not fit
+  std::shared_ptr<Buffer> large_offsets;
+  ASSERT_OK(CopyBufferFromVector(std::vector<int64_t>{0, int64_t(1) << 31},
+                                       pool_, &large_offsets));
+  LargeStringArray too_large(1, large_offsets, input->data()->buffers[2]);
+  ASSERT_RAISES(Invalid, Cast(&ctx_, too_large, utf8(), options, &result));
+
+  // No casts between binary and large strings
+  ASSERT_RAISES(NotImplemented, Cast(&ctx_, *input, large_binary(), options, &result));
+}
+
 // ----------------------------------------------------------------------
 // Dictionary tests
 
@@ -1061,8 +1291,8 @@ TYPED_TEST(TestHashKernelPrimitive, DictEncode) {
 
 TYPED_TEST(TestHashKernelPrimitive, PrimitiveResizeTable) {
   using T = typename TypeParam::c_type;
-  // Skip this test for (u)int8
-  if (sizeof(Scalar) == 1) {
+  // Skip this test for types too narrow to hold kTotalValues distinct values
+  if (sizeof(T) < 4) {
     return;
   }
 
@@ -1287,6 +1517,227 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   ASSERT_TRUE(encoded_out.chunked_array()->Equals(*dict_carr));
 }
 
+TEST_F(TestHashKernel, UniqueDictionary) {
+  auto dict = _MakeArray<StringType, std::string>(utf8(), {"foo", "bar", "baz"}, {});
+  auto dict_type = dictionary(int16(), dict);
+  auto i1 = _MakeArray<Int16Type, int16_t>(int16(), {2, 0, 2, 0}, {});
+  auto i2 = _MakeArray<Int16Type, int16_t>(int16(), {0, 2, 2}, {});
+  ArrayVector chunks = {std::make_shared<DictionaryArray>(dict_type, i1),
+                        std::make_shared<DictionaryArray>(dict_type, i2)};
+
+  // Only the indices are hashed, the dictionary is shared
+  shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, Datum(std::make_shared<ChunkedArray>(chunks)), &result));
+  auto expected = std::make_shared<DictionaryArray>(
+      dict_type, _MakeArray<Int16Type, int16_t>(int16(), {2, 0}, {}));
+  ASSERT_ARRAYS_EQUAL(*expected, *result);
+}
+
+TEST_F(TestHashKernel, IsIn) {
+  auto values = _MakeArray<Int64Type, int64_t>(
+      int64(), {1, 5, 3, 7, 5, 2, 9, 5, 0, 6},
+      {true, true, false, true, true, true, true, true, true, true});
+  auto value_set =
+      _MakeArray<Int64Type, int64_t>(int64(), {5, 0, 9, 4}, {true, true, true, false});
+
+  Datum result;
+  ASSERT_OK(IsIn(&this->ctx_, Datum(values), Datum(value_set), &result));
+  ASSERT_EQ(Datum::ARRAY, result.kind());
+  auto expected = _MakeArray<BooleanType, bool>(
+      boolean(), {false, true, false, false, true, false, true, true, true, false},
+      {true, true, false, true, true, true, true, true, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *result.make_array());
+
+  // Chunked values, with a slice
+  ArrayVector chunks = {values->Slice(0, 4), values->Slice(4)};
+  ASSERT_OK(IsIn(&this->ctx_, Datum(std::make_shared<ChunkedArray>(chunks)),
+                 Datum(value_set), &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+  ArrayVector expected_chunks = {expected->Slice(0, 4), expected->Slice(4)};
+  ASSERT_TRUE(result.chunked_array()->Equals(ChunkedArray(expected_chunks)));
+
+  // Strings
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "bb", "", "c"}, {});
+  auto string_set = _MakeArray<StringType, std::string>(utf8(), {"c", ""}, {});
+  ASSERT_OK(IsIn(&this->ctx_, Datum(strings), Datum(string_set), &result));
+  auto expected_strings =
+      _MakeArray<BooleanType, bool>(boolean(), {false, false, true, true}, {});
+  ASSERT_ARRAYS_EQUAL(*expected_strings, *result.make_array());
+
+  ASSERT_RAISES(TypeError, IsIn(&this->ctx_, Datum(values), Datum(strings), &result));
+}
+
+TEST_F(TestHashKernel, IsInDistinctValues) {
+  // Every value is distinct; only the small value set should be hashed
+  const int64_t length = 100000;
+  std::vector<int64_t> raw_values(length);
+  std::iota(raw_values.begin(), raw_values.end(), 0);
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int64Type, int64_t>(raw_values, &values);
+  auto value_set = _MakeArray<Int64Type, int64_t>(int64(), {3, length - 2, -1}, {});
+
+  ProxyMemoryPool pool(default_memory_pool());
+  FunctionContext ctx(&pool);
+  Datum result;
+  ASSERT_OK(IsIn(&ctx, Datum(values), Datum(value_set), &result));
+  ASSERT_LT(pool.max_memory(), length);
+
+  auto result_array = result.make_array();
+  const auto& bools = static_cast<const BooleanArray&>(*result_array);
+  ASSERT_EQ(length, bools.length());
+  ASSERT_EQ(0, bools.null_count());
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_EQ(i == 3 || i == length - 2, bools.Value(i));
+  }
+}
+
+TEST_F(TestHashKernel, IsInDictionary) {
+  auto dict = _MakeArray<StringType, std::string>(utf8(), {"foo", "bar", "baz"},
+                                                  {true, true, false});
+  auto dict_type = dictionary(int8(), dict);
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 1, 2, 1, 0, 0},
+                                              {true, true, true, false, true, true});
+  auto dict_array = std::make_shared<DictionaryArray>(dict_type, indices);
+  auto value_set = _MakeArray<StringType, std::string>(utf8(), {"foo", "quux"}, {});
+
+  // Null where either the index or the dictionary entry is null
+  Datum result;
+  ASSERT_OK(IsIn(&this->ctx_, Datum(dict_array), Datum(value_set), &result));
+  auto expected = _MakeArray<BooleanType, bool>(
+      boolean(), {true, false, false, false, true, true},
+      {true, true, false, false, true, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *result.make_array());
+
+  // Chunked input
+  ArrayVector chunks = {dict_array->Slice(0, 2), dict_array->Slice(2)};
+  ASSERT_OK(IsIn(&this->ctx_, Datum(std::make_shared<ChunkedArray>(chunks)),
+                 Datum(value_set), &result));
+  ArrayVector expected_chunks = {expected->Slice(0, 2), expected->Slice(2)};
+  ASSERT_TRUE(result.chunked_array()->Equals(ChunkedArray(expected_chunks)));
+}
+
+TEST_F(TestHashKernel, DictionaryUnify) {
+  auto type = utf8();
+  auto dict1 = _MakeArray<StringType, std::string>(type, {"foo", "bar"}, {});
+  auto dict2 = _MakeArray<StringType, std::string>(type, {"baz", "foo", "quux"}, {});
+  auto a1 = std::make_shared<DictionaryArray>(
+      dictionary(int32(), dict1),
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 1, 1}, {true, true, false, true}));
+  auto a2 = std::make_shared<DictionaryArray>(
+      dictionary(int16(), dict2),
+      _MakeArray<Int16Type, int16_t>(int16(), {2, 1, 0}, {}));
+
+  shared_ptr<ChunkedArray> result;
+  ASSERT_OK(DictionaryUnify(&this->ctx_, {a1, a2->Slice(1)}, &result));
+
+  // The merged dictionary is small enough for int8 indices
+  auto merged =
+      _MakeArray<StringType, std::string>(type, {"foo", "bar", "baz", "quux"}, {});
+  auto out_type = dictionary(int8(), merged);
+  ArrayVector expected_chunks = {
+      std::make_shared<DictionaryArray>(
+          out_type,
+          _MakeArray<Int8Type, int8_t>(int8(), {1, 0, 0, 1}, {true, true, false, true})),
+      std::make_shared<DictionaryArray>(
+          out_type, _MakeArray<Int8Type, int8_t>(int8(), {0, 2}, {}))};
+  ASSERT_TRUE(result->type()->Equals(*out_type));
+  ASSERT_TRUE(result->Equals(ChunkedArray(expected_chunks)));
+
+  // Arrays already sharing a dictionary are passed through
+  ASSERT_OK(DictionaryUnify(&this->ctx_, {a1, a1}, &result));
+  ASSERT_EQ(a1.get(), result->chunk(1).get());
+
+  ASSERT_RAISES(Invalid, DictionaryUnify(&this->ctx_, {}, &result));
+  ASSERT_RAISES(TypeError, DictionaryUnify(&this->ctx_, {a1, dict2}, &result));
+}
+
+// ----------------------------------------------------------------------
+// Parallel invocation over chunks
+
+class TestParallelInvoke : public ComputeFixture, public TestBase {
+ public:
+  // Strings drawn from a small set, with nulls, in several chunks of
+  // different lengths
+  std::shared_ptr<ChunkedArray> MakeStringChunks(int num_chunks) {
+    ArrayVector chunks;
+    for (int i = 0; i < num_chunks; ++i) {
+      vector<std::string> values;
+      vector<bool> is_valid;
+      for (int j = 0; j < 50 + i * 7; ++j) {
+        values.push_back("value" + std::to_string((i * 13 + j * 7) % (20 + i)));
+        is_valid.push_back((i + j) % 9 != 0);
+      }
+      chunks.push_back(_MakeArray<StringType, std::string>(utf8(), values, is_valid));
+    }
+    return std::make_shared<ChunkedArray>(chunks);
+  }
+};
+
+TEST_F(TestParallelInvoke, Cast) {
+  ArrayVector chunks;
+  for (int i = 0; i < 20; ++i) {
+    vector<int32_t> values(100 + i);
+    std::iota(values.begin(), values.end(), i * 1000);
+    chunks.push_back(_MakeArray<Int32Type, int32_t>(int32(), values, {}));
+  }
+  auto input = std::make_shared<ChunkedArray>(chunks);
+
+  Datum serial, parallel;
+  ASSERT_OK(Cast(&this->ctx_, Datum(input), float64(), CastOptions(), &serial));
+  this->ctx_.set_parallelism(4);
+  ASSERT_OK(Cast(&this->ctx_, Datum(input), float64(), CastOptions(), &parallel));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, parallel.kind());
+  ASSERT_EQ(20, parallel.chunked_array()->num_chunks());
+  ASSERT_TRUE(parallel.chunked_array()->Equals(*serial.chunked_array()));
+
+  // An error in one chunk is reported
+  vector<int64_t> overflow = {1, 2, int64_t(1) << 40};
+  chunks.push_back(_MakeArray<Int64Type, int64_t>(int64(), overflow, {}));
+  ArrayVector long_chunks;
+  for (const auto& chunk : chunks) {
+    std::shared_ptr<Array> casted;
+    if (chunk->type()->Equals(int64())) {
+      long_chunks.push_back(chunk);
+    } else {
+      ASSERT_OK(Cast(&this->ctx_, *chunk, int64(), CastOptions(), &casted));
+      long_chunks.push_back(casted);
+    }
+  }
+  Datum result;
+  auto long_input = std::make_shared<ChunkedArray>(long_chunks);
+  ASSERT_RAISES(Invalid,
+                Cast(&this->ctx_, Datum(long_input), int32(), CastOptions(), &result));
+}
+
+TEST_F(TestParallelInvoke, HashKernels) {
+  auto input = MakeStringChunks(16);
+
+  shared_ptr<Array> serial_unique, parallel_unique;
+  Datum serial_encoded, parallel_encoded;
+  ASSERT_OK(Unique(&this->ctx_, Datum(input), &serial_unique));
+  ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(input), &serial_encoded));
+
+  for (int parallelism : {2, 3, 0}) {
+    this->ctx_.set_parallelism(parallelism);
+    ASSERT_OK(Unique(&this->ctx_, Datum(input), &parallel_unique));
+    ASSERT_ARRAYS_EQUAL(*serial_unique, *parallel_unique);
+
+    ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(input), &parallel_encoded));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, parallel_encoded.kind());
+    ASSERT_TRUE(
+        parallel_encoded.chunked_array()->Equals(*serial_encoded.chunked_array()));
+  }
+
+  // All-null chunks contribute nothing to the dictionary
+  auto nulls = std::make_shared<ChunkedArray>(
+      ArrayVector{std::make_shared<NullArray>(3), std::make_shared<NullArray>(2)});
+  this->ctx_.set_parallelism(2);
+  ASSERT_OK(Unique(&this->ctx_, Datum(nulls), &parallel_unique));
+  ASSERT_EQ(0, parallel_unique->length());
+  ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(nulls), &parallel_encoded));
+  ASSERT_EQ(5, parallel_encoded.chunked_array()->null_count());
+}
+
 using BinaryKernelFunc =
     std::function<Status(FunctionContext*, const Datum&, const Datum&, Datum* out)>;
 
@@ -1403,6 +1854,568 @@ TEST_F(TestBooleanKernel, Xor) {
   TestBinaryKernel(Xor, values1, values2, values3, values3_nulls);
 }
 
+// ----------------------------------------------------------------------
+// Comparison kernels
+
+template <typename Type>
+class TestCompareKernel : public ComputeFixture, public TestBase {
+ public:
+  using T = typename Type::c_type;
+
+  std::shared_ptr<Array> MakeValues(const vector<int>& values,
+                                    const vector<bool>& is_valid) {
+    vector<T> typed_values;
+    for (int v : values) {
+      typed_values.push_back(static_cast<T>(v));
+    }
+    return _MakeArray<Type, T>(TypeTraits<Type>::type_singleton(), typed_values,
+                               is_valid);
+  }
+
+  void CheckCompare(const Datum& left, const Datum& right, CompareOperator op,
+                    const std::shared_ptr<Array>& expected) {
+    Datum result;
+    ASSERT_OK(Compare(&this->ctx_, left, right, CompareOptions(op), &result));
+    ASSERT_EQ(Datum::ARRAY, result.kind());
+    ASSERT_ARRAYS_EQUAL(*expected, *result.make_array());
+  }
+};
+
+typedef ::testing::Types<UInt8Type, Int8Type, UInt16Type, Int16Type, UInt32Type,
+                         Int32Type, UInt64Type, Int64Type, FloatType, DoubleType,
+                         Date32Type, Date64Type>
+    CompareTypes;
+
+TYPED_TEST_CASE(TestCompareKernel, CompareTypes);
+
+TYPED_TEST(TestCompareKernel, ArrayArray) {
+  // Longer than one bitmap byte to exercise the tail loop
+  vector<int> left = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  vector<int> right = {1, 3, 2, 4, 6, 5, 7, 9, 8, 10, 12};
+  vector<bool> left_valid = {true, true, true, false, true, true,
+                             true, true, true, true, false};
+  vector<bool> right_valid = {true, false, true, true, true, true,
+                              true, true, true, true, true};
+  vector<bool> out_valid = {true, false, true, false, true, true,
+                            true, true, true, true, false};
+
+  auto a = this->MakeValues(left, left_valid);
+  auto b = this->MakeValues(right, right_valid);
+
+  auto expected = [&](std::function<bool(int, int)> fn) {
+    vector<bool> values;
+    for (size_t i = 0; i < left.size(); ++i) {
+      values.push_back(out_valid[i] && fn(left[i], right[i]));
+    }
+    return _MakeArray<BooleanType, bool>(boolean(), values, out_valid);
+  };
+
+  this->CheckCompare(Datum(a), Datum(b), EQUAL,
+                     expected([](int l, int r) { return l == r; }));
+  this->CheckCompare(Datum(a), Datum(b), NOT_EQUAL,
+                     expected([](int l, int r) { return l != r; }));
+  this->CheckCompare(Datum(a), Datum(b), GREATER,
+                     expected([](int l, int r) { return l > r; }));
+  this->CheckCompare(Datum(a), Datum(b), GREATER_EQUAL,
+                     expected([](int l, int r) { return l >= r; }));
+  this->CheckCompare(Datum(a), Datum(b), LESS,
+                     expected([](int l, int r) { return l < r; }));
+  this->CheckCompare(Datum(a), Datum(b), LESS_EQUAL,
+                     expected([](int l, int r) { return l <= r; }));
+
+  // Sliced inputs
+  auto sliced_expected = expected([](int l, int r) { return l < r; })->Slice(3);
+  this->CheckCompare(Datum(a->Slice(3)), Datum(b->Slice(3)), LESS, sliced_expected);
+}
+
+TYPED_TEST(TestCompareKernel, ArrayScalar) {
+  using T = typename TypeParam::c_type;
+  using ScalarType = NumericScalar<TypeParam>;
+
+  vector<int> values = {1, 5, 3, 7, 5, 2, 9, 5, 0, 6};
+  vector<bool> is_valid = {true, true, false, true, true, true, true, true, true, false};
+  auto a = this->MakeValues(values, is_valid);
+  auto five = std::make_shared<ScalarType>(static_cast<T>(5));
+
+  vector<bool> greater, less;
+  for (size_t i = 0; i < values.size(); ++i) {
+    greater.push_back(is_valid[i] && values[i] > 5);
+    less.push_back(is_valid[i] && values[i] < 5);
+  }
+  auto expected_greater = _MakeArray<BooleanType, bool>(boolean(), greater, is_valid);
+  auto expected_less = _MakeArray<BooleanType, bool>(boolean(), less, is_valid);
+
+  this->CheckCompare(Datum(a), Datum(five), GREATER, expected_greater);
+  // Scalar on the left-hand side
+  this->CheckCompare(Datum(five), Datum(a), LESS, expected_greater);
+  this->CheckCompare(Datum(five), Datum(a), GREATER, expected_less);
+
+  // Null scalar yields all nulls
+  auto null_scalar = std::make_shared<ScalarType>(static_cast<T>(5), false);
+  Datum result;
+  ASSERT_OK(
+      Compare(&this->ctx_, Datum(a), Datum(null_scalar), CompareOptions(EQUAL), &result));
+  ASSERT_EQ(a->length(), result.make_array()->null_count());
+
+  // ChunkedArray against scalar
+  std::vector<std::shared_ptr<Array>> chunks = {a, a->Slice(2)};
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+  ASSERT_OK(Compare(&this->ctx_, Datum(chunked), Datum(five), CompareOptions(GREATER),
+                    &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+  std::vector<std::shared_ptr<Array>> expected_chunks = {expected_greater,
+                                                         expected_greater->Slice(2)};
+  ASSERT_TRUE(result.chunked_array()->Equals(ChunkedArray(expected_chunks)));
+}
+
+TEST(TestCompareKernelErrors, TypeMismatch) {
+  FunctionContext ctx;
+  std::shared_ptr<Array> ints, doubles, ts_milli, ts_second;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &ints);
+  ArrayFromVector<DoubleType, double>({1, 2, 3}, &doubles);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), {1, 2, 3},
+                                          &ts_milli);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND), {1, 2, 3},
+                                          &ts_second);
+
+  Datum result;
+  CompareOptions options(EQUAL);
+  ASSERT_RAISES(TypeError, Compare(&ctx, Datum(ints), Datum(doubles), options, &result));
+  ASSERT_RAISES(TypeError,
+                Compare(&ctx, Datum(ts_milli), Datum(ts_second), options, &result));
+  ASSERT_OK(Compare(&ctx, Datum(ts_milli), Datum(ts_milli), options, &result));
+
+  // Two scalars are not supported
+  auto scalar = std::make_shared<Int32Scalar>(1);
+  ASSERT_RAISES(Invalid, Compare(&ctx, Datum(scalar), Datum(scalar), options, &result));
+}
+
+TEST(TestCompareKernelBinary, Strings) {
+  FunctionContext ctx;
+  auto left = _MakeArray<StringType, std::string>(
+      utf8(), {"", "a", "ab", "b", "abc", "x", "zz"},
+      {true, true, true, true, true, false, true});
+  auto right = _MakeArray<StringType, std::string>(
+      utf8(), {"", "ab", "a", "b", "abd", "x", "z"}, {});
+
+  Datum result;
+  ASSERT_OK(Compare(&ctx, Datum(left), Datum(right), CompareOptions(LESS), &result));
+  auto expected_less = _MakeArray<BooleanType, bool>(
+      boolean(), {false, true, false, false, true, false, false},
+      {true, true, true, true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected_less, *result.make_array());
+
+  ASSERT_OK(Compare(&ctx, Datum(left), Datum(right), CompareOptions(EQUAL), &result));
+  auto expected_equal = _MakeArray<BooleanType, bool>(
+      boolean(), {true, false, false, true, false, false, false},
+      {true, true, true, true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected_equal, *result.make_array());
+
+  const std::string scalar_value = "ab";
+  auto scalar = std::make_shared<StringScalar>(std::make_shared<Buffer>(scalar_value));
+  ASSERT_OK(Compare(&ctx, Datum(left), Datum(scalar), CompareOptions(GREATER_EQUAL),
+                    &result));
+  auto expected_ge = _MakeArray<BooleanType, bool>(
+      boolean(), {false, false, true, true, true, false, true},
+      {true, true, true, true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected_ge, *result.make_array());
+}
+
+TEST(TestCompareKernelDictionary, AgainstScalar) {
+  FunctionContext ctx;
+  auto dict = _MakeArray<StringType, std::string>(utf8(), {"b", "a", "c", "d"}, {});
+  auto dict_type = dictionary(int16(), dict);
+  auto i1 = _MakeArray<Int16Type, int16_t>(int16(), {0, 1, 2, 3, 0, 2, 1, 1, 2},
+                                           {true, true, true, true, false, true, true,
+                                            true, true});
+  auto i2 = _MakeArray<Int16Type, int16_t>(int16(), {2, 2, 0}, {});
+  ArrayVector chunks = {std::make_shared<DictionaryArray>(dict_type, i1),
+                        std::make_shared<DictionaryArray>(dict_type, i2)->Slice(1)};
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+  shared_ptr<Array> decoded;
+  const std::string scalar_value = "b";
+  auto scalar = std::make_shared<StringScalar>(std::make_shared<Buffer>(scalar_value));
+  for (CompareOperator op :
+       {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+    for (const auto& chunk : chunks) {
+      // Same answer as on the decoded values
+      Datum result, expected;
+      ASSERT_OK(Compare(&ctx, Datum(chunk), Datum(scalar), CompareOptions(op), &result));
+      ASSERT_OK(Cast(&ctx, *chunk, utf8(), CastOptions(), &decoded));
+      ASSERT_OK(
+          Compare(&ctx, Datum(decoded), Datum(scalar), CompareOptions(op), &expected));
+      ASSERT_ARRAYS_EQUAL(*expected.make_array(), *result.make_array());
+
+      ASSERT_OK(Compare(&ctx, Datum(scalar), Datum(chunk), CompareOptions(op), &result));
+      ASSERT_OK(
+          Compare(&ctx, Datum(scalar), Datum(decoded), CompareOptions(op), &expected));
+      ASSERT_ARRAYS_EQUAL(*expected.make_array(), *result.make_array());
+    }
+  }
+
+  Datum result;
+  ASSERT_OK(Compare(&ctx, Datum(chunked), Datum(scalar), CompareOptions(EQUAL), &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+  ASSERT_EQ(2, result.chunked_array()->num_chunks());
+  ASSERT_EQ(chunked->length(), result.chunked_array()->length());
+
+  // Dictionary against dictionary and mismatched scalars are rejected
+  ASSERT_RAISES(NotImplemented, Compare(&ctx, Datum(chunks[0]), Datum(chunks[0]),
+                                        CompareOptions(EQUAL), &result));
+  auto int_scalar = std::make_shared<Int32Scalar>(1);
+  ASSERT_RAISES(TypeError, Compare(&ctx, Datum(chunks[0]), Datum(int_scalar),
+                                   CompareOptions(EQUAL), &result));
+}
+
+// ----------------------------------------------------------------------
+// Arithmetic kernels
+
+class TestArithmeticKernel : public ComputeFixture, public TestBase {
+ public:
+  template <typename Type, typename T = typename Type::c_type>
+  void CheckArithmetic(ArithmeticOperator op, const Datum& left, const Datum& right,
+                       const vector<T>& expected_values,
+                       const vector<bool>& expected_valid) {
+    Datum result;
+    ASSERT_OK(Arithmetic(&this->ctx_, op, left, right, &result));
+    ASSERT_EQ(Datum::ARRAY, result.kind());
+    auto expected = _MakeArray<Type, T>(TypeTraits<Type>::type_singleton(),
+                                        expected_values, expected_valid);
+    ASSERT_ARRAYS_EQUAL(*expected, *result.make_array());
+  }
+};
+
+TEST_F(TestArithmeticKernel, Int32ArrayArray) {
+  vector<bool> valid = {true, true, false, true, true};
+  auto a = _MakeArray<Int32Type, int32_t>(int32(), {10, -4, 7, 9, 100}, valid);
+  auto b = _MakeArray<Int32Type, int32_t>(int32(), {3, 2, 0, -3, 7}, {});
+
+  CheckArithmetic<Int32Type>(ADD, Datum(a), Datum(b), {13, -2, 7, 6, 107}, valid);
+  CheckArithmetic<Int32Type>(SUBTRACT, Datum(a), Datum(b), {7, -6, 7, 12, 93}, valid);
+  CheckArithmetic<Int32Type>(MULTIPLY, Datum(a), Datum(b), {30, -8, 0, -27, 700},
+                             valid);
+  // Division by zero in a null slot is ignored
+  CheckArithmetic<Int32Type>(DIVIDE, Datum(a), Datum(b), {3, -2, 0, -3, 14}, valid);
+
+  // Division by zero in a valid slot is an error
+  auto zero = _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 1, 0, 1}, {});
+  Datum result;
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, Datum(a), Datum(zero), &result));
+}
+
+TEST_F(TestArithmeticKernel, IntegerOverflowWraps) {
+  auto a = _MakeArray<Int8Type, int8_t>(int8(), {127, -128, -128}, {});
+  auto b = _MakeArray<Int8Type, int8_t>(int8(), {1, -1, -1}, {});
+  CheckArithmetic<Int8Type>(ADD, Datum(a), Datum(b), {-128, 127, 127}, {});
+  CheckArithmetic<Int8Type>(DIVIDE, Datum(a), Datum(b), {127, -128, -128}, {});
+
+  auto c = _MakeArray<UInt8Type, uint8_t>(uint8(), {0, 200}, {});
+  auto d = _MakeArray<UInt8Type, uint8_t>(uint8(), {1, 100}, {});
+  CheckArithmetic<UInt8Type>(SUBTRACT, Datum(c), Datum(d), {255, 100}, {});
+  CheckArithmetic<UInt8Type>(MULTIPLY, Datum(c), Datum(d), {0, 32}, {});
+}
+
+TEST_F(TestArithmeticKernel, DoubleArrayScalar) {
+  vector<bool> valid = {true, false, true, true};
+  auto a = _MakeArray<DoubleType, double>(float64(), {1.5, 2, -3, 0}, valid);
+  auto two = std::make_shared<DoubleScalar>(2.0);
+
+  CheckArithmetic<DoubleType>(MULTIPLY, Datum(a), Datum(two), {3, 0, -6, 0}, valid);
+  CheckArithmetic<DoubleType>(SUBTRACT, Datum(two), Datum(a), {0.5, 0, 5, 2}, valid);
+  CheckArithmetic<DoubleType>(DIVIDE, Datum(a), Datum(two), {0.75, 0, -1.5, 0}, valid);
+
+  auto null_scalar = std::make_shared<DoubleScalar>(2.0, false);
+  CheckArithmetic<DoubleType>(ADD, Datum(a), Datum(null_scalar), {0, 0, 0, 0},
+                              {false, false, false, false});
+}
+
+TEST_F(TestArithmeticKernel, ChunkedArray) {
+  auto a = _MakeArray<Int64Type, int64_t>(int64(), {1, 2, 3, 4}, {});
+  auto b = _MakeArray<Int64Type, int64_t>(int64(), {10, 20, 30, 40}, {});
+  std::vector<std::shared_ptr<Array>> left_chunks = {a, a->Slice(1)};
+  std::vector<std::shared_ptr<Array>> right_chunks = {b->Slice(0, 2), b->Slice(2),
+                                                      b->Slice(1)};
+  auto left = std::make_shared<ChunkedArray>(left_chunks);
+  auto right = std::make_shared<ChunkedArray>(right_chunks);
+
+  Datum result;
+  ASSERT_OK(Add(&this->ctx_, Datum(left), Datum(right), &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+
+  auto expected_values =
+      _MakeArray<Int64Type, int64_t>(int64(), {11, 22, 33, 44, 22, 33, 44}, {});
+  std::vector<std::shared_ptr<Array>> expected_chunks = {expected_values};
+  ASSERT_TRUE(result.chunked_array()->Equals(ChunkedArray(expected_chunks)));
+}
+
+TEST_F(TestArithmeticKernel, Errors) {
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {});
+  auto longs = _MakeArray<Int64Type, int64_t>(int64(), {1, 2}, {});
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "b"}, {});
+
+  Datum result;
+  ASSERT_RAISES(TypeError, Add(&this->ctx_, Datum(ints), Datum(longs), &result));
+  ASSERT_RAISES(NotImplemented,
+                Add(&this->ctx_, Datum(strings), Datum(strings), &result));
+}
+
+// ----------------------------------------------------------------------
+// Expression evaluation
+
+class TestExprEvaluator : public ComputeFixture, public TestBase {
+ public:
+  void SetUp() override {
+    schema_ = ::arrow::schema(
+        {field("a", int32()), field("b", int32()), field("c", int32()),
+         field("d", float64()), field("s", utf8()), field("flag", boolean())});
+
+    // Long enough to span several slices with a small arena
+    const int64_t length = 1000;
+    for (int64_t i = 0; i < length; ++i) {
+      a_.push_back(static_cast<int32_t>(i % 17) - 8);
+      b_.push_back(static_cast<int32_t>(i % 5));
+      c_.push_back(static_cast<int32_t>(i % 23) - 3);
+      d_.push_back(static_cast<double>(i) / 4);
+      s_.push_back(std::to_string(i));
+      flag_.push_back(i % 3 == 0);
+      a_valid_.push_back(i % 7 != 3);
+      d_valid_.push_back(i % 11 != 5);
+    }
+
+    std::vector<std::shared_ptr<Array>> columns = {
+        _MakeArray<Int32Type, int32_t>(int32(), a_, a_valid_),
+        _MakeArray<Int32Type, int32_t>(int32(), b_, {}),
+        _MakeArray<Int32Type, int32_t>(int32(), c_, {}),
+        _MakeArray<DoubleType, double>(float64(), d_, d_valid_),
+        _MakeArray<StringType, std::string>(utf8(), s_, a_valid_),
+        _MakeArray<BooleanType, bool>(boolean(), flag_, {})};
+    batch_ = RecordBatch::Make(schema_, length, columns);
+  }
+
+  // (a + b) * 2 > c AND d IS NOT NULL
+  std::shared_ptr<Expr> Predicate() {
+    auto sum = MakeCallExpr(ExprOp::ADD, MakeFieldExpr("a"), MakeFieldExpr("b"));
+    auto product = MakeCallExpr(ExprOp::MULTIPLY, sum,
+                                MakeLiteralExpr(std::make_shared<Int32Scalar>(2)));
+    auto compare = MakeCallExpr(ExprOp::GREATER, product, MakeFieldExpr("c"));
+    auto d_valid = MakeCallExpr(ExprOp::IS_VALID, MakeFieldExpr("d"));
+    return MakeCallExpr(ExprOp::AND, compare, d_valid);
+  }
+
+  bool PredicateValue(size_t i) const {
+    return (a_[i] + b_[i]) * 2 > c_[i] && static_cast<bool>(d_valid_[i]);
+  }
+
+  std::shared_ptr<Array> Evaluate(const std::shared_ptr<Expr>& expr,
+                                  const EvaluatorOptions& options) {
+    std::unique_ptr<ExprEvaluator> evaluator;
+    std::shared_ptr<Array> result;
+    EXPECT_OK(ExprEvaluator::Make(expr, schema_, options, &evaluator));
+    EXPECT_OK(evaluator->Evaluate(&this->ctx_, *batch_, &result));
+    return result;
+  }
+
+  std::vector<EvaluatorOptions> AllOptions() {
+    EvaluatorOptions fused = EvaluatorOptions::Defaults();
+    EvaluatorOptions unfused = fused;
+    unfused.fuse_operators = false;
+    EvaluatorOptions small_arena = fused;
+    small_arena.arena_size = 1;
+    return {fused, unfused, small_arena};
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> batch_;
+  vector<int32_t> a_, b_, c_;
+  vector<double> d_;
+  vector<std::string> s_;
+  vector<bool> flag_, a_valid_, d_valid_;
+};
+
+TEST_F(TestExprEvaluator, Predicate) {
+  vector<bool> expected_values;
+  for (size_t i = 0; i < a_.size(); ++i) {
+    expected_values.push_back(PredicateValue(i));
+  }
+  auto expected = _MakeArray<BooleanType, bool>(boolean(), expected_values, a_valid_);
+
+  for (const EvaluatorOptions& options : AllOptions()) {
+    auto result = Evaluate(Predicate(), options);
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+}
+
+TEST_F(TestExprEvaluator, ArithmeticChain) {
+  // 10 - ((a * b) - c) / 3, evaluated over doubles and integers
+  auto a = MakeFieldExpr("a");
+  auto product = MakeCallExpr(ExprOp::MULTIPLY, a, MakeFieldExpr("b"));
+  auto diff = MakeCallExpr(ExprOp::SUBTRACT, product, MakeFieldExpr("c"));
+  auto quotient = MakeCallExpr(ExprOp::DIVIDE, diff,
+                               MakeLiteralExpr(std::make_shared<Int32Scalar>(3)));
+  auto expr = MakeCallExpr(ExprOp::SUBTRACT,
+                           MakeLiteralExpr(std::make_shared<Int32Scalar>(10)), quotient);
+
+  vector<int32_t> expected_values;
+  for (size_t i = 0; i < a_.size(); ++i) {
+    expected_values.push_back(a_valid_[i] ? 10 - (a_[i] * b_[i] - c_[i]) / 3 : 0);
+  }
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), expected_values, a_valid_);
+
+  for (const EvaluatorOptions& options : AllOptions()) {
+    auto result = Evaluate(expr, options);
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+
+  auto half = MakeCallExpr(ExprOp::MULTIPLY, MakeFieldExpr("d"),
+                           MakeLiteralExpr(std::make_shared<DoubleScalar>(0.5)));
+  vector<double> expected_doubles;
+  for (size_t i = 0; i < d_.size(); ++i) {
+    expected_doubles.push_back(d_valid_[i] ? d_[i] * 0.5 : 0);
+  }
+  auto expected_half = _MakeArray<DoubleType, double>(float64(), expected_doubles,
+                                                      d_valid_);
+  for (const EvaluatorOptions& options : AllOptions()) {
+    auto result = Evaluate(half, options);
+    ASSERT_ARRAYS_EQUAL(*expected_half, *result);
+  }
+}
+
+TEST_F(TestExprEvaluator, LogicalAndNullChecks) {
+  auto flag = MakeFieldExpr("flag");
+  auto expr = MakeCallExpr(
+      ExprOp::OR, MakeCallExpr(ExprOp::NOT, flag),
+      MakeCallExpr(ExprOp::IS_NULL, MakeFieldExpr("a")));
+
+  vector<bool> expected_values;
+  for (size_t i = 0; i < flag_.size(); ++i) {
+    expected_values.push_back(!flag_[i] || !a_valid_[i]);
+  }
+  auto expected = _MakeArray<BooleanType, bool>(boolean(), expected_values, {});
+  for (const EvaluatorOptions& options : AllOptions()) {
+    auto result = Evaluate(expr, options);
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+
+  // A null literal makes every result null
+  auto null_flag = MakeLiteralExpr(std::make_shared<BooleanScalar>(false, false));
+  auto result = Evaluate(MakeCallExpr(ExprOp::AND, flag, null_flag),
+                         EvaluatorOptions::Defaults());
+  ASSERT_EQ(result->length(), result->null_count());
+}
+
+TEST_F(TestExprEvaluator, Filter) {
+  std::unique_ptr<ExprEvaluator> evaluator;
+  EvaluatorOptions options = EvaluatorOptions::Defaults();
+  options.arena_size = 1;
+  ASSERT_OK(ExprEvaluator::Make(Predicate(), schema_, options, &evaluator));
+  ASSERT_EQ(64, evaluator->slice_length());
+
+  std::shared_ptr<RecordBatch> filtered;
+  ASSERT_OK(evaluator->Filter(&this->ctx_, *batch_, &filtered));
+
+  vector<int32_t> a, c;
+  vector<std::string> s;
+  vector<bool> flag, a_valid;
+  for (size_t i = 0; i < a_.size(); ++i) {
+    // Rows where the predicate is null are dropped
+    if (a_valid_[i] && PredicateValue(i)) {
+      a.push_back(a_[i]);
+      c.push_back(c_[i]);
+      s.push_back(s_[i]);
+      flag.push_back(flag_[i]);
+    }
+  }
+  ASSERT_EQ(static_cast<int64_t>(a.size()), filtered->num_rows());
+  auto expected_a = _MakeArray<Int32Type, int32_t>(int32(), a, {});
+  auto expected_c = _MakeArray<Int32Type, int32_t>(int32(), c, {});
+  auto expected_s = _MakeArray<StringType, std::string>(utf8(), s, {});
+  auto expected_flag = _MakeArray<BooleanType, bool>(boolean(), flag, {});
+  ASSERT_ARRAYS_EQUAL(*expected_a, *filtered->column(0));
+  ASSERT_ARRAYS_EQUAL(*expected_c, *filtered->column(2));
+  ASSERT_ARRAYS_EQUAL(*expected_s, *filtered->column(4));
+  ASSERT_ARRAYS_EQUAL(*expected_flag, *filtered->column(5));
+
+  // Filtering a sliced batch
+  auto sliced = batch_->Slice(10, 100);
+  ASSERT_OK(evaluator->Filter(&this->ctx_, *sliced, &filtered));
+  int64_t expected_rows = 0;
+  for (size_t i = 10; i < 110; ++i) {
+    expected_rows += a_valid_[i] && PredicateValue(i);
+  }
+  ASSERT_EQ(expected_rows, filtered->num_rows());
+
+  // Non-boolean predicates are rejected
+  ASSERT_OK(ExprEvaluator::Make(MakeFieldExpr("a"), schema_, &evaluator));
+  ASSERT_RAISES(TypeError, evaluator->Filter(&this->ctx_, *batch_, &filtered));
+}
+
+TEST_F(TestExprEvaluator, RecordBatchReader) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch_, batch_->Slice(300)}, &table));
+
+  std::unique_ptr<ExprEvaluator> evaluator;
+  ASSERT_OK(ExprEvaluator::Make(Predicate(), schema_, &evaluator));
+
+  TableBatchReader reader(*table);
+  reader.set_chunksize(128);
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(evaluator->Evaluate(&this->ctx_, &reader, &result));
+  ASSERT_EQ(table->num_rows(), result->length());
+
+  std::shared_ptr<Array> whole;
+  ASSERT_OK(evaluator->Evaluate(&this->ctx_, *batch_, &whole));
+  ASSERT_TRUE(result->Equals(ChunkedArray({whole, whole->Slice(300)})));
+
+  TableBatchReader filter_reader(*table);
+  filter_reader.set_chunksize(128);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(evaluator->Filter(&this->ctx_, &filter_reader, &batches));
+  int64_t rows = 0;
+  for (const auto& batch : batches) {
+    ASSERT_GT(batch->num_rows(), 0);
+    rows += batch->num_rows();
+  }
+  int64_t expected_rows = 0;
+  for (size_t i = 0; i < a_.size(); ++i) {
+    const int64_t matches = a_valid_[i] && PredicateValue(i);
+    expected_rows += matches * (i >= 300 ? 2 : 1);
+  }
+  ASSERT_EQ(expected_rows, rows);
+}
+
+TEST_F(TestExprEvaluator, Errors) {
+  std::unique_ptr<ExprEvaluator> evaluator;
+  auto a = MakeFieldExpr("a");
+
+  ASSERT_RAISES(Invalid, ExprEvaluator::Make(MakeFieldExpr("zzz"), schema_, &evaluator));
+  ASSERT_RAISES(NotImplemented,
+                ExprEvaluator::Make(MakeFieldExpr("s"), schema_, &evaluator));
+  auto mixed_types = MakeCallExpr(ExprOp::ADD, a, MakeFieldExpr("d"));
+  ASSERT_RAISES(TypeError, ExprEvaluator::Make(mixed_types, schema_, &evaluator));
+  auto not_boolean = MakeCallExpr(ExprOp::AND, a, a);
+  ASSERT_RAISES(TypeError, ExprEvaluator::Make(not_boolean, schema_, &evaluator));
+  auto wrong_arity = MakeCallExpr(ExprOp::ADD, a);
+  ASSERT_RAISES(Invalid, ExprEvaluator::Make(wrong_arity, schema_, &evaluator));
+
+  // Integer division by zero in a valid slot
+  auto zero = MakeLiteralExpr(std::make_shared<Int32Scalar>(0));
+  ASSERT_OK(ExprEvaluator::Make(MakeCallExpr(ExprOp::DIVIDE, MakeFieldExpr("b"), zero),
+                                schema_, &evaluator));
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, evaluator->Evaluate(&this->ctx_, *batch_, &result));
+
+  // Batch not matching the schema
+  ASSERT_OK(ExprEvaluator::Make(MakeFieldExpr("d"), schema_, &evaluator));
+  auto other = RecordBatch::Make(::arrow::schema({field("a", int32())}), 1000,
+                                 {batch_->column(0)});
+  ASSERT_RAISES(Invalid, evaluator->Evaluate(&this->ctx_, *other, &result));
+
+  ASSERT_EQ("and(greater(multiply(add(a, b), int32(2)), c), is_valid(d))",
+            Predicate()->ToString());
+}
+
 class TestInvokeBinaryKernel : public ComputeFixture, public TestBase {};
 
 class DummyBinaryKernel : public BinaryKernel {
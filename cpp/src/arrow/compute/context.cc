@@ -21,11 +21,12 @@
 
 #include "arrow/buffer.h"
 #include "arrow/util/cpu-info.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace compute {
 
-FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool) {
+FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool), parallelism_(1) {
   if (!::arrow::CpuInfo::initialized()) {
     ::arrow::CpuInfo::Init();
   }
@@ -33,6 +34,13 @@ FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool) {
 
 MemoryPool* FunctionContext::memory_pool() const { return pool_; }
 
+int FunctionContext::parallelism() const {
+  if (parallelism_ < 1) {
+    return ::arrow::GetCpuThreadPoolCapacity();
+  }
+  return parallelism_;
+}
+
 Status FunctionContext::Allocate(const int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return AllocateBuffer(pool_, nbytes, out);
 }
@@ -60,9 +60,21 @@ class ARROW_EXPORT FunctionContext {
   /// \brief Return the current status of the context
   const Status& status() const { return status_; }
 
+  /// \brief Set the maximum number of chunks processed concurrently
+  ///
+  /// When greater than 1, kernels invoked on a ChunkedArray process its
+  /// chunks in parallel on the global CPU thread pool. Output chunks are
+  /// returned in input order. The default is 1 (serial execution); a value
+  /// of 0 uses the capacity of the CPU thread pool.
+  void set_parallelism(int parallelism) { parallelism_ = parallelism; }
+
+  /// \brief Return the maximum number of chunks processed concurrently
+  int parallelism() const;
+
  private:
   Status status_;
   MemoryPool* pool_;
+  int parallelism_;
 };
 
 }  // namespace compute
@@ -0,0 +1,1305 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/expression.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/elementwise-internal.h"
+#include "arrow/compute/kernels/util-internal.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Expression nodes
+
+namespace {
+
+const char* OpName(ExprOp::type op) {
+  switch (op) {
+    case ExprOp::ADD:
+      return "add";
+    case ExprOp::SUBTRACT:
+      return "subtract";
+    case ExprOp::MULTIPLY:
+      return "multiply";
+    case ExprOp::DIVIDE:
+      return "divide";
+    case ExprOp::EQUAL:
+      return "equal";
+    case ExprOp::NOT_EQUAL:
+      return "not_equal";
+    case ExprOp::GREATER:
+      return "greater";
+    case ExprOp::GREATER_EQUAL:
+      return "greater_equal";
+    case ExprOp::LESS:
+      return "less";
+    case ExprOp::LESS_EQUAL:
+      return "less_equal";
+    case ExprOp::AND:
+      return "and";
+    case ExprOp::OR:
+      return "or";
+    case ExprOp::NOT:
+      return "not";
+    case ExprOp::IS_NULL:
+      return "is_null";
+    case ExprOp::IS_VALID:
+      return "is_valid";
+  }
+  return "unknown";
+}
+
+bool IsArithmetic(ExprOp::type op) {
+  return op == ExprOp::ADD || op == ExprOp::SUBTRACT || op == ExprOp::MULTIPLY ||
+         op == ExprOp::DIVIDE;
+}
+
+bool IsComparison(ExprOp::type op) {
+  return op == ExprOp::EQUAL || op == ExprOp::NOT_EQUAL || op == ExprOp::GREATER ||
+         op == ExprOp::GREATER_EQUAL || op == ExprOp::LESS || op == ExprOp::LESS_EQUAL;
+}
+
+bool IsArithmeticCall(const Expr& expr) {
+  return expr.kind() == Expr::CALL &&
+         IsArithmetic(checked_cast<const CallExpr&>(expr).op());
+}
+
+// The comparison giving the same result with its operands swapped
+ExprOp::type FlipComparison(ExprOp::type op) {
+  switch (op) {
+    case ExprOp::GREATER:
+      return ExprOp::LESS;
+    case ExprOp::GREATER_EQUAL:
+      return ExprOp::LESS_EQUAL;
+    case ExprOp::LESS:
+      return ExprOp::GREATER;
+    case ExprOp::LESS_EQUAL:
+      return ExprOp::GREATER_EQUAL;
+    default:
+      return op;
+  }
+}
+
+}  // namespace
+
+// Types which may be held by evaluator registers, besides boolean
+#define VALUE_TYPE_CASES(ACTION) \
+  ACTION(UInt8Type);             \
+  ACTION(Int8Type);              \
+  ACTION(UInt16Type);            \
+  ACTION(Int16Type);             \
+  ACTION(UInt32Type);            \
+  ACTION(Int32Type);             \
+  ACTION(UInt64Type);            \
+  ACTION(Int64Type);             \
+  ACTION(FloatType);             \
+  ACTION(DoubleType);            \
+  ACTION(Date32Type);            \
+  ACTION(Date64Type);            \
+  ACTION(Time32Type);            \
+  ACTION(Time64Type);            \
+  ACTION(TimestampType)
+
+std::string FieldExpr::ToString() const { return name_; }
+
+std::string LiteralExpr::ToString() const {
+  std::stringstream ss;
+  ss << value_->type->ToString() << "(";
+  if (!value_->is_valid) {
+    ss << "null";
+  } else {
+#define LITERAL_TO_STRING_CASE(ArrowType)                                \
+  case ArrowType::type_id:                                               \
+    ss << +checked_cast<const NumericScalar<ArrowType>&>(*value_).value; \
+    break
+
+    switch (value_->type->id()) {
+      case Type::BOOL:
+        ss << (checked_cast<const BooleanScalar&>(*value_).value ? "true" : "false");
+        break;
+      VALUE_TYPE_CASES(LITERAL_TO_STRING_CASE);
+      default:
+        ss << "...";
+        break;
+    }
+
+#undef LITERAL_TO_STRING_CASE
+  }
+  ss << ")";
+  return ss.str();
+}
+
+std::string CallExpr::ToString() const {
+  std::stringstream ss;
+  ss << OpName(op_) << "(";
+  for (size_t i = 0; i < args_.size(); ++i) {
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << args_[i]->ToString();
+  }
+  ss << ")";
+  return ss.str();
+}
+
+std::shared_ptr<Expr> MakeFieldExpr(const std::string& name) {
+  return std::make_shared<FieldExpr>(name);
+}
+
+std::shared_ptr<Expr> MakeLiteralExpr(const std::shared_ptr<Scalar>& value) {
+  return std::make_shared<LiteralExpr>(value);
+}
+
+std::shared_ptr<Expr> MakeCallExpr(ExprOp::type op, const std::shared_ptr<Expr>& arg) {
+  return std::make_shared<CallExpr>(op, std::vector<std::shared_ptr<Expr>>{arg});
+}
+
+std::shared_ptr<Expr> MakeCallExpr(ExprOp::type op, const std::shared_ptr<Expr>& left,
+                                   const std::shared_ptr<Expr>& right) {
+  return std::make_shared<CallExpr>(op, std::vector<std::shared_ptr<Expr>>{left, right});
+}
+
+// ----------------------------------------------------------------------
+// Evaluation
+
+EvaluatorOptions EvaluatorOptions::Defaults() {
+  EvaluatorOptions options;
+  options.arena_size = 256 * 1024;
+  options.fuse_operators = true;
+  return options;
+}
+
+namespace {
+
+// Slices are a multiple of this many rows, so that they start on a byte
+// boundary of the output bitmaps
+constexpr int64_t kSliceGranularity = 64;
+
+// Number of rows a fused operator chain processes at once. The accumulator for
+// a block stays in L1 cache while every step of the chain is applied to it.
+constexpr int64_t kBlockLength = 256;
+
+// Registers hold the values of one slice of rows. Boolean values and validity
+// are stored as one byte per row, so that the operator loops stay simple and
+// vectorizable; bitmaps are only produced when writing out the final result.
+struct Register {
+  std::shared_ptr<DataType> type;
+  int value_width;
+
+  // Values and validity for the current slice. valid is null when all values
+  // in the slice are valid.
+  const uint8_t* values;
+  const uint8_t* valid;
+
+  // Indices of the arena slots backing this register, or -1
+  int value_slot;
+  int valid_slot;
+  uint8_t* value_storage;
+  uint8_t* valid_storage;
+
+  // Whether the storage is released once the register has been consumed
+  bool temporary;
+};
+
+bool IsValueType(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+    case Type::UINT8:
+    case Type::INT8:
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsNumericType(const DataType& type) {
+  return is_integer(type.id()) || is_floating(type.id());
+}
+
+int ValueWidth(const DataType& type) {
+  if (type.id() == Type::BOOL) {
+    return 1;
+  }
+  return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+}
+
+// Write the intersection of the operands' validity to storage and return it,
+// or return null if all operands are entirely valid
+const uint8_t* CombineValidity(const std::vector<const Register*>& operands,
+                               int64_t length, uint8_t* storage) {
+  bool any_nulls = false;
+  for (const Register* operand : operands) {
+    if (operand->valid == nullptr) {
+      continue;
+    }
+    if (!any_nulls) {
+      memcpy(storage, operand->valid, static_cast<size_t>(length));
+      any_nulls = true;
+    } else {
+      const uint8_t* valid = operand->valid;
+      for (int64_t i = 0; i < length; ++i) {
+        storage[i] &= valid[i];
+      }
+    }
+  }
+  return any_nulls ? storage : nullptr;
+}
+
+// Expand length bits of a bitmap to one byte (0 or 1) per bit
+void UnpackBits(const uint8_t* bitmap, int64_t offset, int64_t length, uint8_t* out) {
+  int64_t i = 0;
+  for (; i < length && (offset + i) % 8 != 0; ++i) {
+    out[i] = BitUtil::GetBit(bitmap, offset + i);
+  }
+  const uint8_t* bytes = bitmap + (offset + i) / 8;
+  for (; i + 8 <= length; i += 8) {
+    const uint8_t byte = *bytes++;
+    for (int j = 0; j < 8; ++j) {
+      out[i + j] = (byte >> j) & 1;
+    }
+  }
+  for (; i < length; ++i) {
+    out[i] = BitUtil::GetBit(bitmap, offset + i);
+  }
+}
+
+class Instruction {
+ public:
+  virtual ~Instruction() = default;
+
+  /// Compute the output register for the first length rows of the slice
+  virtual Status Run(int64_t length) = 0;
+};
+
+// ----------------------------------------------------------------------
+// Arithmetic chains
+//
+// A chain starts from a base operand, applies a sequence of arithmetic steps
+// each taking one further operand, and optionally ends with a comparison.
+// Unfused evaluation compiles every operator to a chain of a single step.
+
+struct ChainStep {
+  ExprOp::type op;
+  const Register* operand;
+  // Whether the operand is the left-hand side of the operator
+  bool operand_left;
+};
+
+template <typename Op, typename T>
+void ApplyStep(const T* operand, bool operand_left, int64_t length, T* acc) {
+  if (operand_left) {
+    for (int64_t i = 0; i < length; ++i) {
+      acc[i] = Op::Call(operand[i], acc[i]);
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      acc[i] = Op::Call(acc[i], operand[i]);
+    }
+  }
+}
+
+template <typename T, typename Enable = void>
+struct DivideStep {
+  static Status Apply(const T* operand, bool operand_left, const uint8_t* valid,
+                      int64_t length, T* acc) {
+    ApplyStep<DivideOp>(operand, operand_left, length, acc);
+    return Status::OK();
+  }
+};
+
+// Integer division must check for zero divisors in non-null slots, and skip
+// the division in null slots
+template <typename T>
+struct DivideStep<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  static Status Apply(const T* operand, bool operand_left, const uint8_t* valid,
+                      int64_t length, T* acc) {
+    const T* dividend = operand_left ? operand : acc;
+    const T* divisor = operand_left ? acc : operand;
+    for (int64_t i = 0; i < length; ++i) {
+      if (ARROW_PREDICT_FALSE(divisor[i] == 0) && (valid == nullptr || valid[i])) {
+        return Status::Invalid("Integer division by zero");
+      }
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      acc[i] = divisor[i] == 0 ? 0 : DivideOp::Call(dividend[i], divisor[i]);
+    }
+    return Status::OK();
+  }
+};
+
+template <CompareOperator Op, typename T>
+void ApplyComparison(const T* acc, const T* operand, bool operand_left, int64_t length,
+                     uint8_t* out) {
+  if (operand_left) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Comparator<Op>::Compare(operand[i], acc[i]);
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Comparator<Op>::Compare(acc[i], operand[i]);
+    }
+  }
+}
+
+template <typename T>
+class ChainInstruction : public Instruction {
+ public:
+  ChainInstruction(const Register* base, const std::vector<ChainStep>& steps,
+                   const ChainStep* comparison, Register* out)
+      : base_(base), steps_(steps), has_comparison_(comparison != nullptr), out_(out) {
+    operands_.push_back(base);
+    for (const ChainStep& step : steps) {
+      operands_.push_back(step.operand);
+    }
+    if (has_comparison_) {
+      comparison_ = *comparison;
+      operands_.push_back(comparison->operand);
+    }
+  }
+
+  Status Run(int64_t length) override {
+    out_->values = out_->value_storage;
+    out_->valid = CombineValidity(operands_, length, out_->valid_storage);
+
+    T acc[kBlockLength];
+    for (int64_t offset = 0; offset < length; offset += kBlockLength) {
+      const int64_t block_length = std::min(kBlockLength, length - offset);
+      const uint8_t* valid = out_->valid == nullptr ? nullptr : out_->valid + offset;
+
+      memcpy(acc, Values(base_) + offset, static_cast<size_t>(block_length) * sizeof(T));
+      for (const ChainStep& step : steps_) {
+        RETURN_NOT_OK(Apply(step, offset, block_length, valid, acc));
+      }
+
+      if (has_comparison_) {
+        Compare(acc, offset, block_length);
+      } else {
+        memcpy(out_->value_storage + offset * sizeof(T), acc,
+               static_cast<size_t>(block_length) * sizeof(T));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  static const T* Values(const Register* reg) {
+    return reinterpret_cast<const T*>(reg->values);
+  }
+
+  Status Apply(const ChainStep& step, int64_t offset, int64_t length,
+               const uint8_t* valid, T* acc) {
+    const T* operand = Values(step.operand) + offset;
+    switch (step.op) {
+      case ExprOp::ADD:
+        ApplyStep<AddOp>(operand, step.operand_left, length, acc);
+        break;
+      case ExprOp::SUBTRACT:
+        ApplyStep<SubtractOp>(operand, step.operand_left, length, acc);
+        break;
+      case ExprOp::MULTIPLY:
+        ApplyStep<MultiplyOp>(operand, step.operand_left, length, acc);
+        break;
+      case ExprOp::DIVIDE:
+        return DivideStep<T>::Apply(operand, step.operand_left, valid, length, acc);
+      default:
+        DCHECK(false) << "Not an arithmetic operator";
+        break;
+    }
+    return Status::OK();
+  }
+
+  void Compare(const T* acc, int64_t offset, int64_t length) {
+    const T* operand = Values(comparison_.operand) + offset;
+    const bool left = comparison_.operand_left;
+    uint8_t* out = out_->value_storage + offset;
+    switch (comparison_.op) {
+      case ExprOp::EQUAL:
+        ApplyComparison<EQUAL>(acc, operand, left, length, out);
+        break;
+      case ExprOp::NOT_EQUAL:
+        ApplyComparison<NOT_EQUAL>(acc, operand, left, length, out);
+        break;
+      case ExprOp::GREATER:
+        ApplyComparison<GREATER>(acc, operand, left, length, out);
+        break;
+      case ExprOp::GREATER_EQUAL:
+        ApplyComparison<GREATER_EQUAL>(acc, operand, left, length, out);
+        break;
+      case ExprOp::LESS:
+        ApplyComparison<LESS>(acc, operand, left, length, out);
+        break;
+      case ExprOp::LESS_EQUAL:
+        ApplyComparison<LESS_EQUAL>(acc, operand, left, length, out);
+        break;
+      default:
+        DCHECK(false) << "Not a comparison operator";
+        break;
+    }
+  }
+
+  const Register* base_;
+  std::vector<ChainStep> steps_;
+  bool has_comparison_;
+  ChainStep comparison_;
+  std::vector<const Register*> operands_;
+  Register* out_;
+};
+
+// ----------------------------------------------------------------------
+// Boolean operators
+
+class LogicalInstruction : public Instruction {
+ public:
+  LogicalInstruction(ExprOp::type op, const Register* left, const Register* right,
+                     Register* out)
+      : op_(op), left_(left), right_(right), out_(out) {}
+
+  Status Run(int64_t length) override {
+    out_->values = out_->value_storage;
+    out_->valid = CombineValidity({left_, right_}, length, out_->valid_storage);
+
+    const uint8_t* left = left_->values;
+    const uint8_t* right = right_->values;
+    uint8_t* out = out_->value_storage;
+    if (op_ == ExprOp::AND) {
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = left[i] & right[i];
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = left[i] | right[i];
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  ExprOp::type op_;
+  const Register* left_;
+  const Register* right_;
+  Register* out_;
+};
+
+class NotInstruction : public Instruction {
+ public:
+  NotInstruction(const Register* arg, Register* out) : arg_(arg), out_(out) {}
+
+  Status Run(int64_t length) override {
+    out_->values = out_->value_storage;
+    out_->valid = CombineValidity({arg_}, length, out_->valid_storage);
+
+    const uint8_t* values = arg_->values;
+    uint8_t* out = out_->value_storage;
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = values[i] ^ 1;
+    }
+    return Status::OK();
+  }
+
+ private:
+  const Register* arg_;
+  Register* out_;
+};
+
+class NullCheckInstruction : public Instruction {
+ public:
+  NullCheckInstruction(bool is_valid, const Register* arg, Register* out)
+      : is_valid_(is_valid), arg_(arg), out_(out) {}
+
+  Status Run(int64_t length) override {
+    out_->values = out_->value_storage;
+    out_->valid = nullptr;
+
+    const uint8_t* valid = arg_->valid;
+    uint8_t* out = out_->value_storage;
+    if (valid == nullptr) {
+      memset(out, is_valid_ ? 1 : 0, static_cast<size_t>(length));
+    } else if (is_valid_) {
+      memcpy(out, valid, static_cast<size_t>(length));
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = valid[i] ^ 1;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  bool is_valid_;
+  const Register* arg_;
+  Register* out_;
+};
+
+// ----------------------------------------------------------------------
+// Gathering selected rows
+
+template <typename T>
+void GatherValues(const uint8_t* values, const int64_t* indices, int64_t length,
+                  uint8_t* out) {
+  const T* in = reinterpret_cast<const T*>(values);
+  T* out_values = reinterpret_cast<T*>(out);
+  for (int64_t i = 0; i < length; ++i) {
+    out_values[i] = in[indices[i]];
+  }
+}
+
+Status GatherRows(FunctionContext* ctx, const Array& array, const int64_t* indices,
+                  int64_t length, std::shared_ptr<ArrayData>* out) {
+  const ArrayData& input = *array.data();
+  const DataType& type = *input.type;
+  if (type.id() == Type::NA) {
+    *out = ArrayData::Make(input.type, length, {nullptr}, length);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+  if (array.null_count() != 0) {
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &null_bitmap));
+    const uint8_t* in_bitmap = input.buffers[0]->data();
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(null_bitmap->mutable_data(), 0, length, [&]() {
+      const bool is_set = BitUtil::GetBit(in_bitmap, input.offset + indices[i++]);
+      null_count += !is_set;
+      return is_set;
+    });
+  }
+
+  if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    const int32_t* in_offsets = GetValues<int32_t>(input, 1);
+    const uint8_t* in_data = input.buffers[2] ? input.buffers[2]->data() : nullptr;
+
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(int32_t), &offsets));
+    int32_t* out_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t j = indices[i];
+      out_offsets[i + 1] = out_offsets[i] + (in_offsets[j + 1] - in_offsets[j]);
+    }
+
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(ctx->Allocate(out_offsets[length], &data));
+    uint8_t* out_data = data->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t j = indices[i];
+      memcpy(out_data + out_offsets[i], in_data + in_offsets[j],
+             static_cast<size_t>(out_offsets[i + 1] - out_offsets[i]));
+    }
+    *out = ArrayData::Make(input.type, length, {null_bitmap, offsets, data}, null_count);
+    return Status::OK();
+  }
+
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == nullptr) {
+    std::stringstream ss;
+    ss << "Filtering columns of type " << type.ToString() << " is not supported";
+    return Status::NotImplemented(ss.str());
+  }
+
+  std::shared_ptr<Buffer> values;
+  const int bit_width = fixed_width->bit_width();
+  if (bit_width == 1) {
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &values));
+    const uint8_t* in_bits = input.buffers[1]->data();
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(values->mutable_data(), 0, length, [&]() {
+      return BitUtil::GetBit(in_bits, input.offset + indices[i++]);
+    });
+  } else {
+    const int byte_width = bit_width / 8;
+    RETURN_NOT_OK(ctx->Allocate(length * byte_width, &values));
+    const uint8_t* in = input.buffers[1]->data() + input.offset * byte_width;
+    uint8_t* out_values = values->mutable_data();
+    switch (byte_width) {
+      case 1:
+        GatherValues<uint8_t>(in, indices, length, out_values);
+        break;
+      case 2:
+        GatherValues<uint16_t>(in, indices, length, out_values);
+        break;
+      case 4:
+        GatherValues<uint32_t>(in, indices, length, out_values);
+        break;
+      case 8:
+        GatherValues<uint64_t>(in, indices, length, out_values);
+        break;
+      default:
+        for (int64_t i = 0; i < length; ++i) {
+          memcpy(out_values + i * byte_width, in + indices[i] * byte_width,
+                 static_cast<size_t>(byte_width));
+        }
+        break;
+    }
+  }
+  *out = ArrayData::Make(input.type, length, {null_bitmap, values}, null_count);
+  return Status::OK();
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExprEvaluator implementation
+
+class ExprEvaluator::Impl {
+ public:
+  Impl(const std::shared_ptr<Schema>& schema, const EvaluatorOptions& options)
+      : schema_(schema), options_(options), result_(nullptr), slice_length_(0) {}
+
+  Status Compile(const Expr& expr) {
+    RETURN_NOT_OK(CompileExpr(expr, &result_));
+
+    // Size slices so that every arena slot fits in the configured budget
+    int64_t bytes_per_row = 0;
+    for (Slot& slot : slots_) {
+      slot.row_offset = bytes_per_row;
+      bytes_per_row += slot.width;
+    }
+    slice_length_ = options_.arena_size / std::max<int64_t>(bytes_per_row, 1);
+    slice_length_ -= slice_length_ % kSliceGranularity;
+    slice_length_ = std::max(slice_length_, kSliceGranularity);
+    arena_size_ = slice_length_ * bytes_per_row;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const { return result_->type; }
+
+  int64_t slice_length() const { return slice_length_; }
+
+  Status Evaluate(FunctionContext* ctx, const RecordBatch& batch,
+                  std::shared_ptr<Array>* out) {
+    RETURN_NOT_OK(Prepare(ctx, batch));
+
+    const int64_t length = batch.num_rows();
+    const std::shared_ptr<DataType>& type = result_->type;
+    const bool is_boolean = type->id() == Type::BOOL;
+    const int width = result_->value_width;
+
+    std::shared_ptr<Buffer> values;
+    std::shared_ptr<Buffer> null_bitmap;
+    RETURN_NOT_OK(ctx->Allocate(
+        is_boolean ? BitUtil::BytesForBits(length) : length * width, &values));
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &null_bitmap));
+    uint8_t* out_values = values->mutable_data();
+    uint8_t* out_bitmap = null_bitmap->mutable_data();
+
+    int64_t null_count = 0;
+    for (int64_t offset = 0; offset < length; offset += slice_length_) {
+      const int64_t slice_length = std::min(slice_length_, length - offset);
+      RETURN_NOT_OK(RunSlice(offset, slice_length));
+
+      const uint8_t* result_values = result_->values;
+      if (is_boolean) {
+        internal::GenerateBitsUnrolled(out_values, offset, slice_length,
+                                       [&]() { return *result_values++ != 0; });
+      } else {
+        memcpy(out_values + offset * width, result_values,
+               static_cast<size_t>(slice_length * width));
+      }
+
+      const uint8_t* valid = result_->valid;
+      if (valid == nullptr) {
+        memset(out_bitmap + offset / 8, 0xFF,
+               static_cast<size_t>(BitUtil::BytesForBits(slice_length)));
+      } else {
+        internal::GenerateBitsUnrolled(out_bitmap, offset, slice_length, [&]() {
+          const bool is_valid = *valid++ != 0;
+          null_count += !is_valid;
+          return is_valid;
+        });
+      }
+    }
+
+    if (null_count == 0) {
+      null_bitmap = nullptr;
+    }
+    *out = MakeArray(ArrayData::Make(type, length, {null_bitmap, values}, null_count));
+    return Status::OK();
+  }
+
+  Status Filter(FunctionContext* ctx, const RecordBatch& batch,
+                std::shared_ptr<RecordBatch>* out) {
+    if (result_->type->id() != Type::BOOL) {
+      std::stringstream ss;
+      ss << "Filter predicate must be boolean, got " << result_->type->ToString();
+      return Status::TypeError(ss.str());
+    }
+    RETURN_NOT_OK(Prepare(ctx, batch));
+
+    const int64_t length = batch.num_rows();
+    std::shared_ptr<Buffer> selection;
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(int64_t), &selection));
+    int64_t* indices = reinterpret_cast<int64_t*>(selection->mutable_data());
+
+    int64_t selected = 0;
+    for (int64_t offset = 0; offset < length; offset += slice_length_) {
+      const int64_t slice_length = std::min(slice_length_, length - offset);
+      RETURN_NOT_OK(RunSlice(offset, slice_length));
+
+      const uint8_t* values = result_->values;
+      const uint8_t* valid = result_->valid;
+      for (int64_t i = 0; i < slice_length; ++i) {
+        // Branch-free append of the row index
+        indices[selected] = offset + i;
+        selected += values[i] & (valid == nullptr ? 1 : valid[i]);
+      }
+    }
+
+    if (selected == length) {
+      *out = batch.Slice(0);
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<ArrayData>> columns(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      RETURN_NOT_OK(GatherRows(ctx, *batch.column(i), indices, selected,
+                               &columns[i]));
+    }
+    *out = RecordBatch::Make(batch.schema(), selected, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  struct Slot {
+    int width;
+    int64_t row_offset;
+  };
+
+  struct FieldBinding {
+    int column;
+    Register* reg;
+  };
+
+  struct LiteralBinding {
+    std::shared_ptr<Scalar> value;
+    Register* reg;
+  };
+
+  // ----------------------------------------------------------------------
+  // Compilation
+
+  // Fields and literals are filled before the program runs, so they are given
+  // slots of their own. Intermediates may reuse the slots of dead ones.
+  int NewSlot(int width) {
+    slots_.push_back(Slot{width, 0});
+    return static_cast<int>(slots_.size()) - 1;
+  }
+
+  int ReuseOrNewSlot(int width) {
+    auto it = free_slots_.find(width);
+    if (it != free_slots_.end() && !it->second.empty()) {
+      const int slot = it->second.back();
+      it->second.pop_back();
+      return slot;
+    }
+    return NewSlot(width);
+  }
+
+  Register* NewRegister(const std::shared_ptr<DataType>& type, bool temporary) {
+    std::unique_ptr<Register> reg(new Register());
+    reg->type = type;
+    reg->value_width = ValueWidth(*type);
+    reg->values = nullptr;
+    reg->valid = nullptr;
+    reg->value_slot = -1;
+    reg->valid_slot = -1;
+    reg->value_storage = nullptr;
+    reg->valid_storage = nullptr;
+    reg->temporary = temporary;
+    registers_.push_back(std::move(reg));
+    return registers_.back().get();
+  }
+
+  // A register computed by an instruction, with storage for values and validity
+  Register* NewTemporary(const std::shared_ptr<DataType>& type) {
+    Register* reg = NewRegister(type, true);
+    reg->value_slot = ReuseOrNewSlot(reg->value_width);
+    reg->valid_slot = ReuseOrNewSlot(1);
+    return reg;
+  }
+
+  // Return the storage of a consumed intermediate to the arena
+  void Release(const Register* reg) {
+    if (reg->temporary) {
+      free_slots_[slots_[reg->value_slot].width].push_back(reg->value_slot);
+      free_slots_[1].push_back(reg->valid_slot);
+    }
+  }
+
+  Status CompileExpr(const Expr& expr, Register** out) {
+    switch (expr.kind()) {
+      case Expr::FIELD:
+        return CompileField(checked_cast<const FieldExpr&>(expr), out);
+      case Expr::LITERAL:
+        return CompileLiteral(checked_cast<const LiteralExpr&>(expr), out);
+      case Expr::CALL:
+        return CompileCall(checked_cast<const CallExpr&>(expr), out);
+    }
+    return Status::Invalid("Unknown expression kind");
+  }
+
+  Status CompileField(const FieldExpr& expr, Register** out) {
+    const int64_t column = schema_->GetFieldIndex(expr.name());
+    if (column < 0) {
+      std::stringstream ss;
+      ss << "No field named '" << expr.name() << "' in schema";
+      return Status::Invalid(ss.str());
+    }
+    for (const FieldBinding& binding : fields_) {
+      if (binding.column == column) {
+        *out = binding.reg;
+        return Status::OK();
+      }
+    }
+
+    std::shared_ptr<DataType> type = schema_->field(static_cast<int>(column))->type();
+    if (!IsValueType(*type)) {
+      std::stringstream ss;
+      ss << "Field '" << expr.name() << "' has unsupported type " << type->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+
+    Register* reg = NewRegister(type, false);
+    if (type->id() == Type::BOOL) {
+      // Bits are unpacked to bytes for every slice
+      reg->value_slot = NewSlot(1);
+    }
+    reg->valid_slot = NewSlot(1);
+    fields_.push_back(FieldBinding{static_cast<int>(column), reg});
+    *out = reg;
+    return Status::OK();
+  }
+
+  Status CompileLiteral(const LiteralExpr& expr, Register** out) {
+    const std::shared_ptr<Scalar>& value = expr.value();
+    if (value == nullptr) {
+      return Status::Invalid("Literal expression has no value");
+    }
+    if (!IsValueType(*value->type)) {
+      std::stringstream ss;
+      ss << "Literal has unsupported type " << value->type->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+
+    // Literals are broadcast once into their own slots when the arena is
+    // allocated, so operators never need a separate scalar code path
+    Register* reg = NewRegister(value->type, false);
+    reg->value_slot = NewSlot(reg->value_width);
+    if (!value->is_valid) {
+      reg->valid_slot = NewSlot(1);
+    }
+    literals_.push_back(LiteralBinding{value, reg});
+    *out = reg;
+    return Status::OK();
+  }
+
+  Status CompileCall(const CallExpr& expr, Register** out) {
+    const ExprOp::type op = expr.op();
+    const size_t arity =
+        (op == ExprOp::NOT || op == ExprOp::IS_NULL || op == ExprOp::IS_VALID) ? 1 : 2;
+    if (expr.args().size() != arity) {
+      std::stringstream ss;
+      ss << OpName(op) << " takes " << arity << " argument(s), got "
+         << expr.args().size();
+      return Status::Invalid(ss.str());
+    }
+    for (const auto& arg : expr.args()) {
+      if (arg == nullptr) {
+        std::stringstream ss;
+        ss << "Null argument to " << OpName(op);
+        return Status::Invalid(ss.str());
+      }
+    }
+
+    if (IsArithmetic(op) || IsComparison(op)) {
+      return CompileChain(expr, out);
+    }
+
+    std::vector<Register*> args;
+    for (const auto& arg : expr.args()) {
+      Register* reg;
+      RETURN_NOT_OK(CompileExpr(*arg, &reg));
+      args.push_back(reg);
+    }
+
+    if (op == ExprOp::IS_NULL || op == ExprOp::IS_VALID) {
+      *out = NewTemporary(boolean());
+      program_.emplace_back(
+          new NullCheckInstruction(op == ExprOp::IS_VALID, args[0], *out));
+    } else {
+      for (const Register* arg : args) {
+        if (arg->type->id() != Type::BOOL) {
+          std::stringstream ss;
+          ss << "Arguments to " << OpName(op) << " must be boolean, got "
+             << arg->type->ToString();
+          return Status::TypeError(ss.str());
+        }
+      }
+      *out = NewTemporary(boolean());
+      if (op == ExprOp::NOT) {
+        program_.emplace_back(new NotInstruction(args[0], *out));
+      } else {
+        program_.emplace_back(new LogicalInstruction(op, args[0], args[1], *out));
+      }
+    }
+
+    for (const Register* arg : args) {
+      Release(arg);
+    }
+    return Status::OK();
+  }
+
+  // Compile an arithmetic or comparison call. With fusion enabled, nested
+  // arithmetic along the left spine of the tree (after moving arithmetic
+  // operands of commutative operators and comparisons to the left) is folded
+  // into the same chain.
+  Status CompileChain(const CallExpr& expr, Register** out) {
+    struct PendingStep {
+      ExprOp::type op;
+      const Expr* operand;
+      bool operand_left;
+    };
+
+    const bool fuse = options_.fuse_operators;
+    const Expr* node = &expr;
+    bool has_comparison = false;
+    PendingStep comparison = {expr.op(), nullptr, false};
+
+    if (IsComparison(expr.op())) {
+      const Expr* left = expr.args()[0].get();
+      const Expr* right = expr.args()[1].get();
+      ExprOp::type op = expr.op();
+      if (fuse && !IsArithmeticCall(*left) && IsArithmeticCall(*right)) {
+        std::swap(left, right);
+        op = FlipComparison(op);
+      }
+      has_comparison = true;
+      comparison = {op, right, false};
+      node = left;
+    }
+
+    std::vector<PendingStep> pending;
+    // Without fusion, an arithmetic call is a chain of one step and a comparison
+    // is a chain of none
+    while (IsArithmeticCall(*node) && (fuse || (!has_comparison && pending.empty()))) {
+      const auto& call = checked_cast<const CallExpr&>(*node);
+      const Expr* left = call.args()[0].get();
+      const Expr* right = call.args()[1].get();
+      const bool commutative =
+          call.op() == ExprOp::ADD || call.op() == ExprOp::MULTIPLY;
+      if (fuse && commutative && !IsArithmeticCall(*left) && IsArithmeticCall(*right)) {
+        std::swap(left, right);
+      }
+      pending.push_back({call.op(), right, false});
+      node = left;
+    }
+    std::reverse(pending.begin(), pending.end());
+
+    Register* base;
+    RETURN_NOT_OK(CompileExpr(*node, &base));
+    const std::shared_ptr<DataType>& type = base->type;
+
+    std::vector<ChainStep> steps;
+    std::vector<const Register*> consumed = {base};
+    for (const PendingStep& step : pending) {
+      Register* operand;
+      RETURN_NOT_OK(CompileExpr(*step.operand, &operand));
+      RETURN_NOT_OK(CheckOperands(step.op, *type, *operand->type));
+      steps.push_back(ChainStep{step.op, operand, step.operand_left});
+      consumed.push_back(operand);
+    }
+
+    ChainStep final_comparison = {comparison.op, nullptr, false};
+    if (has_comparison) {
+      Register* operand;
+      RETURN_NOT_OK(CompileExpr(*comparison.operand, &operand));
+      RETURN_NOT_OK(CheckOperands(comparison.op, *type, *operand->type));
+      final_comparison.operand = operand;
+      consumed.push_back(operand);
+    }
+
+    *out = NewTemporary(has_comparison ? boolean() : type);
+    const ChainStep* comparison_step = has_comparison ? &final_comparison : nullptr;
+
+#define CHAIN_INSTRUCTION_CASE(ArrowType)                                   \
+  case ArrowType::type_id:                                                  \
+    program_.emplace_back(new ChainInstruction<typename ArrowType::c_type>( \
+        base, steps, comparison_step, *out));                               \
+    break
+
+    switch (type->id()) {
+      VALUE_TYPE_CASES(CHAIN_INSTRUCTION_CASE);
+      default:
+        DCHECK(false) << "Operand types were not checked";
+        break;
+    }
+
+#undef CHAIN_INSTRUCTION_CASE
+
+    for (const Register* reg : consumed) {
+      Release(reg);
+    }
+    return Status::OK();
+  }
+
+  Status CheckOperands(ExprOp::type op, const DataType& left, const DataType& right) {
+    if (!left.Equals(right)) {
+      std::stringstream ss;
+      ss << "Arguments to " << OpName(op) << " must have the same type, got "
+         << left.ToString() << " and " << right.ToString();
+      return Status::TypeError(ss.str());
+    }
+    const bool supported = IsArithmetic(op) ? IsNumericType(left)
+                                            : left.id() != Type::BOOL;
+    if (!supported) {
+      std::stringstream ss;
+      ss << OpName(op) << " is not implemented for " << left.ToString();
+      return Status::NotImplemented(ss.str());
+    }
+    return Status::OK();
+  }
+
+  // ----------------------------------------------------------------------
+  // Execution
+
+  Status Prepare(FunctionContext* ctx, const RecordBatch& batch) {
+    for (const FieldBinding& binding : fields_) {
+      if (binding.column >= batch.num_columns() ||
+          !batch.column(binding.column)->type()->Equals(*binding.reg->type)) {
+        return Status::Invalid("Record batch does not match the evaluator's schema");
+      }
+    }
+    columns_.clear();
+    for (const FieldBinding& binding : fields_) {
+      columns_.push_back(batch.column_data(binding.column));
+    }
+    if (arena_ == nullptr) {
+      RETURN_NOT_OK(AllocateArena(ctx));
+    }
+    return Status::OK();
+  }
+
+  Status AllocateArena(FunctionContext* ctx) {
+    RETURN_NOT_OK(ctx->Allocate(arena_size_, &arena_));
+    uint8_t* base = arena_->mutable_data();
+    for (const auto& reg : registers_) {
+      if (reg->value_slot >= 0) {
+        reg->value_storage = base + slots_[reg->value_slot].row_offset * slice_length_;
+      }
+      if (reg->valid_slot >= 0) {
+        reg->valid_storage = base + slots_[reg->valid_slot].row_offset * slice_length_;
+      }
+    }
+    for (const LiteralBinding& literal : literals_) {
+      FillLiteral(*literal.value, literal.reg);
+    }
+    return Status::OK();
+  }
+
+  void FillLiteral(const Scalar& value, Register* reg) {
+    const size_t length = static_cast<size_t>(slice_length_);
+    reg->values = reg->value_storage;
+    if (value.is_valid) {
+      reg->valid = nullptr;
+    } else {
+      memset(reg->valid_storage, 0, length);
+      reg->valid = reg->valid_storage;
+    }
+
+#define FILL_LITERAL_CASE(ArrowType)                                        \
+  case ArrowType::type_id: {                                                \
+    using T = typename ArrowType::c_type;                                   \
+    const T v = checked_cast<const NumericScalar<ArrowType>&>(value).value; \
+    std::fill_n(reinterpret_cast<T*>(reg->value_storage), length, v);       \
+  } break
+
+    switch (value.type->id()) {
+      case Type::BOOL:
+        memset(reg->value_storage, checked_cast<const BooleanScalar&>(value).value,
+               length);
+        break;
+      VALUE_TYPE_CASES(FILL_LITERAL_CASE);
+      default:
+        DCHECK(false) << "Literal type was not checked";
+        break;
+    }
+
+#undef FILL_LITERAL_CASE
+  }
+
+  Status RunSlice(int64_t offset, int64_t length) {
+    for (size_t i = 0; i < fields_.size(); ++i) {
+      const ArrayData& column = *columns_[i];
+      Register* reg = fields_[i].reg;
+      const int64_t start = column.offset + offset;
+
+      if (reg->type->id() == Type::BOOL) {
+        UnpackBits(column.buffers[1]->data(), start, length, reg->value_storage);
+        reg->values = reg->value_storage;
+      } else {
+        reg->values = column.buffers[1]->data() + start * reg->value_width;
+      }
+
+      if (column.null_count != 0 && column.buffers[0] != nullptr) {
+        UnpackBits(column.buffers[0]->data(), start, length, reg->valid_storage);
+        reg->valid = reg->valid_storage;
+      } else {
+        reg->valid = nullptr;
+      }
+    }
+
+    for (const auto& instruction : program_) {
+      RETURN_NOT_OK(instruction->Run(length));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  EvaluatorOptions options_;
+
+  std::vector<std::unique_ptr<Register>> registers_;
+  std::vector<std::unique_ptr<Instruction>> program_;
+  std::vector<FieldBinding> fields_;
+  std::vector<LiteralBinding> literals_;
+  Register* result_;
+
+  std::vector<Slot> slots_;
+  std::map<int, std::vector<int>> free_slots_;
+  int64_t slice_length_;
+  int64_t arena_size_;
+  std::shared_ptr<Buffer> arena_;
+
+  // Input columns of the current batch, parallel to fields_
+  std::vector<std::shared_ptr<ArrayData>> columns_;
+};
+
+#undef VALUE_TYPE_CASES
+
+ExprEvaluator::ExprEvaluator(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+ExprEvaluator::~ExprEvaluator() {}
+
+Status ExprEvaluator::Make(const std::shared_ptr<Expr>& expr,
+                           const std::shared_ptr<Schema>& schema,
+                           const EvaluatorOptions& options,
+                           std::unique_ptr<ExprEvaluator>* out) {
+  if (expr == nullptr) {
+    return Status::Invalid("Expression must not be null");
+  }
+  if (options.arena_size <= 0) {
+    return Status::Invalid("Evaluator arena size must be positive");
+  }
+  std::unique_ptr<Impl> impl(new Impl(schema, options));
+  RETURN_NOT_OK(impl->Compile(*expr));
+  out->reset(new ExprEvaluator(std::move(impl)));
+  return Status::OK();
+}
+
+Status ExprEvaluator::Make(const std::shared_ptr<Expr>& expr,
+                           const std::shared_ptr<Schema>& schema,
+                           std::unique_ptr<ExprEvaluator>* out) {
+  return Make(expr, schema, EvaluatorOptions::Defaults(), out);
+}
+
+std::shared_ptr<DataType> ExprEvaluator::out_type() const { return impl_->out_type(); }
+
+int64_t ExprEvaluator::slice_length() const { return impl_->slice_length(); }
+
+Status ExprEvaluator::Evaluate(FunctionContext* ctx, const RecordBatch& batch,
+                               std::shared_ptr<Array>* out) {
+  return impl_->Evaluate(ctx, batch, out);
+}
+
+Status ExprEvaluator::Evaluate(FunctionContext* ctx, RecordBatchReader* reader,
+                               std::shared_ptr<ChunkedArray>* out) {
+  ArrayVector chunks;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    std::shared_ptr<Array> chunk;
+    RETURN_NOT_OK(impl_->Evaluate(ctx, *batch, &chunk));
+    chunks.push_back(chunk);
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, impl_->out_type());
+  return Status::OK();
+}
+
+Status ExprEvaluator::Filter(FunctionContext* ctx, const RecordBatch& batch,
+                             std::shared_ptr<RecordBatch>* out) {
+  return impl_->Filter(ctx, batch, out);
+}
+
+Status ExprEvaluator::Filter(FunctionContext* ctx, RecordBatchReader* reader,
+                             std::vector<std::shared_ptr<RecordBatch>>* out) {
+  out->clear();
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    std::shared_ptr<RecordBatch> filtered;
+    RETURN_NOT_OK(impl_->Filter(ctx, *batch, &filtered));
+    if (filtered->num_rows() > 0) {
+      out->push_back(filtered);
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
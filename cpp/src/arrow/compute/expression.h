@@ -0,0 +1,227 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_EXPRESSION_H
+#define ARROW_COMPUTE_EXPRESSION_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class ChunkedArray;
+class RecordBatch;
+class RecordBatchReader;
+struct Scalar;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Operators which may appear in a CallExpr
+struct ExprOp {
+  enum type {
+    // Arithmetic on two numeric operands of the same type
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    // Comparison of two numeric or temporal operands of the same type
+    EQUAL,
+    NOT_EQUAL,
+    GREATER,
+    GREATER_EQUAL,
+    LESS,
+    LESS_EQUAL,
+    // Logical operators on boolean operands
+    AND,
+    OR,
+    NOT,
+    // Null checks, valid for any supported operand type
+    IS_NULL,
+    IS_VALID
+  };
+};
+
+/// \brief Base class for nodes of an expression tree
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+class ARROW_EXPORT Expr {
+ public:
+  enum Kind { FIELD, LITERAL, CALL };
+
+  virtual ~Expr() = default;
+
+  Kind kind() const { return kind_; }
+
+  virtual std::string ToString() const = 0;
+
+ protected:
+  explicit Expr(Kind kind) : kind_(kind) {}
+
+  Kind kind_;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Expr);
+};
+
+/// \brief Reference to a column of the input, by name
+class ARROW_EXPORT FieldExpr : public Expr {
+ public:
+  explicit FieldExpr(const std::string& name) : Expr(FIELD), name_(name) {}
+
+  const std::string& name() const { return name_; }
+
+  std::string ToString() const override;
+
+ private:
+  std::string name_;
+};
+
+/// \brief Constant value broadcast to every row
+class ARROW_EXPORT LiteralExpr : public Expr {
+ public:
+  explicit LiteralExpr(const std::shared_ptr<Scalar>& value)
+      : Expr(LITERAL), value_(value) {}
+
+  const std::shared_ptr<Scalar>& value() const { return value_; }
+
+  std::string ToString() const override;
+
+ private:
+  std::shared_ptr<Scalar> value_;
+};
+
+/// \brief Application of an operator to one or two argument expressions
+class ARROW_EXPORT CallExpr : public Expr {
+ public:
+  CallExpr(ExprOp::type op, const std::vector<std::shared_ptr<Expr>>& args)
+      : Expr(CALL), op_(op), args_(args) {}
+
+  ExprOp::type op() const { return op_; }
+
+  const std::vector<std::shared_ptr<Expr>>& args() const { return args_; }
+
+  std::string ToString() const override;
+
+ private:
+  ExprOp::type op_;
+  std::vector<std::shared_ptr<Expr>> args_;
+};
+
+ARROW_EXPORT
+std::shared_ptr<Expr> MakeFieldExpr(const std::string& name);
+
+ARROW_EXPORT
+std::shared_ptr<Expr> MakeLiteralExpr(const std::shared_ptr<Scalar>& value);
+
+ARROW_EXPORT
+std::shared_ptr<Expr> MakeCallExpr(ExprOp::type op, const std::shared_ptr<Expr>& arg);
+
+ARROW_EXPORT
+std::shared_ptr<Expr> MakeCallExpr(ExprOp::type op, const std::shared_ptr<Expr>& left,
+                                   const std::shared_ptr<Expr>& right);
+
+/// \brief Options controlling how an ExprEvaluator runs
+struct ARROW_EXPORT EvaluatorOptions {
+  static EvaluatorOptions Defaults();
+
+  /// Bytes of scratch memory for the intermediate results of one slice of
+  /// rows. The default is sized to stay resident in a typical L2 cache.
+  int64_t arena_size;
+
+  /// Whether chains of arithmetic, optionally ending in a comparison, are
+  /// evaluated in a single pass instead of one pass per operator
+  bool fuse_operators;
+};
+
+/// \brief Evaluate an expression tree over record batches
+///
+/// The expression is type-checked and compiled once against a schema. Each
+/// batch is then processed in slices short enough that the intermediate
+/// results of a slice fit in a fixed arena, which is reused for every slice
+/// and every batch; only the final result is allocated per batch.
+///
+/// Nulls propagate through every operator except IS_NULL and IS_VALID, whose
+/// results are never null. Operands of binary operators must have the same
+/// type; no implicit casts are performed.
+///
+/// An evaluator owns its arena, so it must not be used from several threads
+/// at once.
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+class ARROW_EXPORT ExprEvaluator {
+ public:
+  ~ExprEvaluator();
+
+  /// \brief Compile an expression against the given input schema
+  static Status Make(const std::shared_ptr<Expr>& expr,
+                     const std::shared_ptr<Schema>& schema,
+                     const EvaluatorOptions& options,
+                     std::unique_ptr<ExprEvaluator>* out);
+
+  static Status Make(const std::shared_ptr<Expr>& expr,
+                     const std::shared_ptr<Schema>& schema,
+                     std::unique_ptr<ExprEvaluator>* out);
+
+  /// \brief The type of the evaluated expression
+  std::shared_ptr<DataType> out_type() const;
+
+  /// \brief The number of rows processed at once, derived from the arena size
+  int64_t slice_length() const;
+
+  /// \brief Evaluate the expression over every row of a batch
+  Status Evaluate(FunctionContext* ctx, const RecordBatch& batch,
+                  std::shared_ptr<Array>* out);
+
+  /// \brief Evaluate the expression over every batch of a stream, yielding
+  /// one chunk per batch
+  Status Evaluate(FunctionContext* ctx, RecordBatchReader* reader,
+                  std::shared_ptr<ChunkedArray>* out);
+
+  /// \brief Select the rows of a batch for which a boolean expression is true
+  ///
+  /// The predicate is never materialized as a boolean array; matching row
+  /// indices are collected slice by slice and the columns are gathered once.
+  /// Rows where the predicate is null are dropped.
+  Status Filter(FunctionContext* ctx, const RecordBatch& batch,
+                std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Filter every batch of a stream, skipping batches with no matches
+  Status Filter(FunctionContext* ctx, RecordBatchReader* reader,
+                std::vector<std::shared_ptr<RecordBatch>>* out);
+
+ private:
+  class Impl;
+  explicit ExprEvaluator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_EXPRESSION_H
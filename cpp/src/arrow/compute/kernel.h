@@ -23,6 +23,7 @@
 
 #include "arrow/array.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/variant.h"
@@ -40,13 +41,6 @@ class ARROW_EXPORT OpKernel {
   virtual ~OpKernel() = default;
 };
 
-/// \brief Placeholder for Scalar values until we implement these
-struct ARROW_EXPORT Scalar {
-  ~Scalar() {}
-
-  ARROW_DISALLOW_COPY_AND_ASSIGN(Scalar);
-};
-
 /// \class Datum
 /// \brief Variant type for various Arrow C++ data structures
 struct ARROW_EXPORT Datum {
@@ -99,6 +93,10 @@ struct ARROW_EXPORT Datum {
     }
   }
 
+  std::shared_ptr<Scalar> scalar() const {
+    return util::get<std::shared_ptr<Scalar>>(this->value);
+  }
+
   std::shared_ptr<ArrayData> array() const {
     return util::get<std::shared_ptr<ArrayData>>(this->value);
   }
@@ -119,6 +117,8 @@ struct ARROW_EXPORT Datum {
     return this->kind() == Datum::ARRAY || this->kind() == Datum::CHUNKED_ARRAY;
   }
 
+  bool is_scalar() const { return this->kind() == Datum::SCALAR; }
+
   /// \brief The value type of the variant, if any
   ///
   /// \return nullptr if no type
@@ -127,6 +127,8 @@ struct ARROW_EXPORT Datum {
       return util::get<std::shared_ptr<ArrayData>>(this->value)->type;
     } else if (this->kind() == Datum::CHUNKED_ARRAY) {
       return util::get<std::shared_ptr<ChunkedArray>>(this->value)->type();
+    } else if (this->kind() == Datum::SCALAR) {
+      return util::get<std::shared_ptr<Scalar>>(this->value)->type;
     }
     return NULLPTR;
   }
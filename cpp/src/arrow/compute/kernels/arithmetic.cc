@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/elementwise-internal.h"
+#include "arrow/compute/kernels/util-internal.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename Op, typename T, typename Enable = void>
+struct ArithmeticLoop {
+  template <typename Left, typename Right>
+  static Status Run(const Left& left, const Right& right, const uint8_t* valid_bits,
+                    int64_t length, T* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Op::Call(left[i], right[i]);
+    }
+    return Status::OK();
+  }
+};
+
+// Integer division must check for zero divisors in non-null slots
+template <typename T>
+struct ArithmeticLoop<DivideOp, T,
+                      typename std::enable_if<std::is_integral<T>::value>::type> {
+  template <typename Left, typename Right>
+  static Status Run(const Left& left, const Right& right, const uint8_t* valid_bits,
+                    int64_t length, T* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      const T divisor = right[i];
+      if (ARROW_PREDICT_FALSE(divisor == 0)) {
+        if (valid_bits == nullptr || BitUtil::GetBit(valid_bits, i)) {
+          return Status::Invalid("Integer division by zero");
+        }
+        out[i] = 0;
+      } else {
+        out[i] = DivideOp::Call(left[i], divisor);
+      }
+    }
+    return Status::OK();
+  }
+};
+
+template <typename ArrowType, typename Op>
+class ArithmeticKernel : public BinaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+  using Loop = ArithmeticLoop<Op, T>;
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    const bool scalar_left = left.kind() == Datum::SCALAR;
+    const ArrayData& values = scalar_left ? *right.array() : *left.array();
+    const int64_t length = values.length;
+
+    auto result =
+        ArrayData::Make(values.type, length, std::vector<std::shared_ptr<Buffer>>(2));
+    if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, *left.array(), *right.array(),
+                                           result.get()));
+    } else {
+      const Scalar& scalar = scalar_left ? *left.scalar() : *right.scalar();
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, values, scalar, result.get()));
+    }
+
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(ctx->Allocate(length * static_cast<int64_t>(sizeof(T)), &data));
+    T* out_values = reinterpret_cast<T*>(data->mutable_data());
+    result->buffers[1] = data;
+
+    const uint8_t* valid_bits =
+        result->buffers[0] != nullptr ? result->buffers[0]->data() : nullptr;
+
+    if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+      RETURN_NOT_OK(Loop::Run(ArrayOperand<T>(*left.array()),
+                              ArrayOperand<T>(*right.array()), valid_bits, length,
+                              out_values));
+    } else if (result->null_count == length) {
+      // Null scalar, all slots are null
+      memset(out_values, 0, static_cast<size_t>(data->size()));
+    } else if (scalar_left) {
+      RETURN_NOT_OK(Loop::Run(ScalarOperand<T>(ScalarValue(*left.scalar())),
+                              ArrayOperand<T>(values), valid_bits, length, out_values));
+    } else {
+      RETURN_NOT_OK(Loop::Run(ArrayOperand<T>(values),
+                              ScalarOperand<T>(ScalarValue(*right.scalar())),
+                              valid_bits, length, out_values));
+    }
+
+    out->value = result;
+    return Status::OK();
+  }
+
+ private:
+  static T ScalarValue(const Scalar& scalar) {
+    return checked_cast<const NumericScalar<ArrowType>&>(scalar).value;
+  }
+};
+
+template <typename ArrowType>
+std::unique_ptr<BinaryKernel> MakeArithmeticKernel(ArithmeticOperator op) {
+  switch (op) {
+    case ADD:
+      return std::unique_ptr<BinaryKernel>(new ArithmeticKernel<ArrowType, AddOp>());
+    case SUBTRACT:
+      return std::unique_ptr<BinaryKernel>(
+          new ArithmeticKernel<ArrowType, SubtractOp>());
+    case MULTIPLY:
+      return std::unique_ptr<BinaryKernel>(
+          new ArithmeticKernel<ArrowType, MultiplyOp>());
+    case DIVIDE:
+      return std::unique_ptr<BinaryKernel>(new ArithmeticKernel<ArrowType, DivideOp>());
+  }
+  return nullptr;
+}
+
+#define ARITHMETIC_KERNEL_CASE(ArrowType)          \
+  case ArrowType::type_id:                         \
+    *kernel = MakeArithmeticKernel<ArrowType>(op); \
+    break
+
+Status GetArithmeticKernel(const DataType& type, ArithmeticOperator op,
+                           std::unique_ptr<BinaryKernel>* kernel) {
+  switch (type.id()) {
+    ARITHMETIC_KERNEL_CASE(UInt8Type);
+    ARITHMETIC_KERNEL_CASE(Int8Type);
+    ARITHMETIC_KERNEL_CASE(UInt16Type);
+    ARITHMETIC_KERNEL_CASE(Int16Type);
+    ARITHMETIC_KERNEL_CASE(UInt32Type);
+    ARITHMETIC_KERNEL_CASE(Int32Type);
+    ARITHMETIC_KERNEL_CASE(UInt64Type);
+    ARITHMETIC_KERNEL_CASE(Int64Type);
+    ARITHMETIC_KERNEL_CASE(FloatType);
+    ARITHMETIC_KERNEL_CASE(DoubleType);
+    default:
+      break;
+  }
+  if (*kernel == nullptr) {
+    std::stringstream ss;
+    ss << "No arithmetic implemented for " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+#undef ARITHMETIC_KERNEL_CASE
+
+Status Arithmetic(FunctionContext* ctx, ArithmeticOperator op, const Datum& left,
+                  const Datum& right, Datum* out) {
+  std::shared_ptr<DataType> left_type = left.type();
+  std::shared_ptr<DataType> right_type = right.type();
+  if (left_type == nullptr || right_type == nullptr) {
+    return Status::Invalid("Arithmetic operands must be arrays or scalars");
+  }
+  if (!left_type->Equals(*right_type)) {
+    std::stringstream ss;
+    ss << "Arithmetic operands must have the same type, got " << left_type->ToString()
+       << " and " << right_type->ToString();
+    return Status::TypeError(ss.str());
+  }
+
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(GetArithmeticKernel(*left_type, op, &kernel));
+  return detail::InvokeBinaryKernel(ctx, kernel.get(), left, right, out);
+}
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  return Arithmetic(ctx, ADD, left, right, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                Datum* out) {
+  return Arithmetic(ctx, SUBTRACT, left, right, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                Datum* out) {
+  return Arithmetic(ctx, MULTIPLY, left, right, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  return Arithmetic(ctx, DIVIDE, left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
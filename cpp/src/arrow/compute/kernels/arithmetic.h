@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+#define ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+#include "arrow/compute/kernel.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+
+class FunctionContext;
+
+enum ArithmeticOperator {
+  ADD,
+  SUBTRACT,
+  MULTIPLY,
+  DIVIDE,
+};
+
+/// \brief Return a kernel applying an arithmetic operator to two operands of
+/// the given numeric type
+/// \param[in] type the type of both operands and of the result
+/// \param[in] op the arithmetic operator
+/// \param[out] kernel the resulting kernel
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetArithmeticKernel(const DataType& type, ArithmeticOperator op,
+                           std::unique_ptr<BinaryKernel>* kernel);
+
+/// \brief Element-wise arithmetic on two numeric datums of the same type
+///
+/// Either operand may be a scalar, which is broadcast against every element of
+/// the other operand. Integer arithmetic wraps around on overflow, and integer
+/// division by zero in a non-null slot is an error.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] op the arithmetic operator
+/// \param[in] left left operand (array or scalar)
+/// \param[in] right right operand (array or scalar)
+/// \param[out] out resulting datum, null wherever one of the operands is null
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Arithmetic(FunctionContext* context, ArithmeticOperator op, const Datum& left,
+                  const Datum& right, Datum* out);
+
+/// \brief Element-wise sum of two numeric datums
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Add(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
+
+/// \brief Element-wise difference of two numeric datums
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Subtract(FunctionContext* context, const Datum& left, const Datum& right,
+                Datum* out);
+
+/// \brief Element-wise product of two numeric datums
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Multiply(FunctionContext* context, const Datum& left, const Datum& right,
+                Datum* out);
+
+/// \brief Element-wise quotient of two numeric datums
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Divide(FunctionContext* context, const Datum& left, const Datum& right,
+              Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ARITHMETIC_H
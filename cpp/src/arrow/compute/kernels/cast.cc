@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/cast.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -36,6 +37,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parsing.h"
@@ -225,30 +227,34 @@ struct CastFunctor<O, I,
       constexpr in_type kMin = static_cast<in_type>(std::numeric_limits<out_type>::min());
 
       // Null count may be -1 if the input array had been sliced
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  (*in_data > kMax || *in_data < kMin))) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+      const uint8_t* valid_bits =
+          input.null_count != 0 && input.buffers[0] ? input.buffers[0]->data() : nullptr;
+
+      // Check the values of each block of 64 without branching, only
+      // testing validity bits in blocks mixing valid and null values
+      internal::BitBlockCounter counter(valid_bits, in_offset, input.length);
+      bool out_of_bounds = false;
+      for (int64_t position = 0; position < input.length;) {
+        const internal::BitBlockCount block = counter.NextWord();
+        if (block.AllSet()) {
+          for (int64_t i = position; i < position + block.length; ++i) {
+            out_of_bounds |= (in_data[i] > kMax) | (in_data[i] < kMin);
           }
-          *out_data++ = static_cast<out_type>(*in_data++);
-          is_valid_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(*in_data > kMax || *in_data < kMin)) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+        } else if (!block.NoneSet()) {
+          for (int64_t i = position; i < position + block.length; ++i) {
+            out_of_bounds |= BitUtil::GetBit(valid_bits, in_offset + i) &&
+                             (in_data[i] > kMax || in_data[i] < kMin);
           }
-          *out_data++ = static_cast<out_type>(*in_data++);
         }
+        position += block.length;
       }
-    } else {
-      for (int64_t i = 0; i < input.length; ++i) {
-        *out_data++ = static_cast<out_type>(*in_data++);
+      if (ARROW_PREDICT_FALSE(out_of_bounds)) {
+        ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
       }
     }
+    for (int64_t i = 0; i < input.length; ++i) {
+      *out_data++ = static_cast<out_type>(*in_data++);
+    }
   }
 };
 
@@ -298,25 +304,25 @@ void ShiftTime(FunctionContext* ctx, const CastOptions& options, const bool is_m
      << " would lose data: " << VAL;                                                    \
   ctx->SetStatus(Status::Invalid(ss.str()));
 
-      if (input.null_count != 0) {
-        internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                          input.length);
-        for (int64_t i = 0; i < input.length; i++) {
+      const uint8_t* valid_bits =
+          input.null_count != 0 && input.buffers[0] ? input.buffers[0]->data() : nullptr;
+      internal::BitBlockCounter counter(valid_bits, input.offset, input.length);
+      for (int64_t position = 0; position < input.length;) {
+        const internal::BitBlockCount block = counter.NextWord();
+        const int64_t end = position + block.length;
+        for (int64_t i = position; i < end; i++) {
           out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (bit_reader.IsSet() && (out_data[i] * factor != in_data[i])) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
-          }
-          bit_reader.Next();
         }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (out_data[i] * factor != in_data[i]) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
+        if (!block.NoneSet()) {
+          for (int64_t i = position; i < end; i++) {
+            if ((block.AllSet() || BitUtil::GetBit(valid_bits, input.offset + i)) &&
+                out_data[i] * factor != in_data[i]) {
+              RAISE_INVALID_CAST(in_data[i]);
+              return;
+            }
           }
         }
+        position = end;
       }
 
 #undef RAISE_INVALID_CAST
@@ -392,31 +398,23 @@ struct CastFunctor<Date64Type, TimestampType> {
     // Ensure that intraday milliseconds have been zeroed out
     auto out_data = GetMutableValues<int64_t>(output, 1);
 
-    if (input.null_count != 0) {
-      internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                        input.length);
-
-      for (int64_t i = 0; i < input.length; ++i) {
+    const uint8_t* valid_bits =
+        input.null_count != 0 && input.buffers[0] ? input.buffers[0]->data() : nullptr;
+    internal::BitBlockCounter counter(valid_bits, input.offset, input.length);
+    bool truncated = false;
+    for (int64_t position = 0; position < input.length;) {
+      const internal::BitBlockCount block = counter.NextWord();
+      for (int64_t i = position; i < position + block.length; ++i) {
         const int64_t remainder = out_data[i] % kMillisecondsInDay;
-        if (ARROW_PREDICT_FALSE(!options.allow_time_truncate && bit_reader.IsSet() &&
-                                remainder > 0)) {
-          ctx->SetStatus(
-              Status::Invalid("Timestamp value had non-zero intraday milliseconds"));
-          break;
-        }
-        out_data[i] -= remainder;
-        bit_reader.Next();
-      }
-    } else {
-      for (int64_t i = 0; i < input.length; ++i) {
-        const int64_t remainder = out_data[i] % kMillisecondsInDay;
-        if (ARROW_PREDICT_FALSE(!options.allow_time_truncate && remainder > 0)) {
-          ctx->SetStatus(
-              Status::Invalid("Timestamp value had non-zero intraday milliseconds"));
-          break;
-        }
+        truncated |= remainder > 0 && (block.AllSet() ||
+                                       BitUtil::GetBit(valid_bits, input.offset + i));
         out_data[i] -= remainder;
       }
+      position += block.length;
+    }
+    if (ARROW_PREDICT_FALSE(truncated && !options.allow_time_truncate)) {
+      ctx->SetStatus(
+          Status::Invalid("Timestamp value had non-zero intraday milliseconds"));
     }
   }
 };
@@ -470,6 +468,68 @@ struct CastFunctor<Date32Type, Date64Type> {
   }
 };
 
+// ----------------------------------------------------------------------
+// Between 32-bit and 64-bit offsets
+
+// Convert the offsets of a binary or list array to another width, rebased
+// to start at zero. The range of the values of the array is returned, so
+// that they can be sliced rather than copied.
+template <typename OutOffsetType, typename InOffsetType>
+Status CastOffsets(FunctionContext* ctx, const ArrayData& input,
+                   std::shared_ptr<Buffer>* out, int64_t* values_offset,
+                   int64_t* values_length) {
+  const InOffsetType* in_offsets = GetValues<InOffsetType>(input, 1);
+  const InOffsetType first = in_offsets[0];
+  const int64_t length = static_cast<int64_t>(in_offsets[input.length]) - first;
+  if (ARROW_PREDICT_FALSE(length > std::numeric_limits<OutOffsetType>::max())) {
+    std::stringstream ss;
+    ss << "Array with " << length << " values is too large for "
+       << sizeof(OutOffsetType) * 8 << "-bit offsets";
+    return Status::Invalid(ss.str());
+  }
+  RETURN_NOT_OK(ctx->Allocate((input.length + 1) * sizeof(OutOffsetType), out));
+  auto out_offsets = reinterpret_cast<OutOffsetType*>((*out)->mutable_data());
+  for (int64_t i = 0; i <= input.length; ++i) {
+    out_offsets[i] = static_cast<OutOffsetType>(in_offsets[i] - first);
+  }
+  *values_offset = first;
+  *values_length = length;
+  return Status::OK();
+}
+
+// Binary data is shared with the input, only the offsets are converted
+template <typename O, typename I>
+struct BinaryOffsetsCastFunctor {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_offset_type = typename O::offset_type;
+    using in_offset_type = typename I::offset_type;
+
+    std::shared_ptr<Buffer> offsets;
+    int64_t data_offset, data_length;
+    FUNC_RETURN_NOT_OK((CastOffsets<out_offset_type, in_offset_type>(
+        ctx, input, &offsets, &data_offset, &data_length)));
+    output->buffers.push_back(offsets);
+    output->buffers.push_back(SliceBuffer(input.buffers[2], data_offset, data_length));
+  }
+};
+
+template <>
+struct CastFunctor<LargeBinaryType, BinaryType>
+    : public BinaryOffsetsCastFunctor<LargeBinaryType, BinaryType> {};
+
+template <>
+struct CastFunctor<BinaryType, LargeBinaryType>
+    : public BinaryOffsetsCastFunctor<BinaryType, LargeBinaryType> {};
+
+template <>
+struct CastFunctor<LargeStringType, StringType>
+    : public BinaryOffsetsCastFunctor<LargeStringType, StringType> {};
+
+template <>
+struct CastFunctor<StringType, LargeStringType>
+    : public BinaryOffsetsCastFunctor<StringType, LargeStringType> {};
+
 // ----------------------------------------------------------------------
 // List to List
 
@@ -483,7 +543,8 @@ class ListCastKernel : public UnaryKernel {
     DCHECK_EQ(Datum::ARRAY, input.kind());
 
     const ArrayData& in_data = *input.array();
-    DCHECK_EQ(Type::LIST, in_data.type->id());
+    const Type::type in_type_id = in_data.type->id();
+    DCHECK(in_type_id == Type::LIST || in_type_id == Type::LARGE_LIST);
     ArrayData* result;
 
     if (in_data.offset != 0) {
@@ -497,11 +558,27 @@ class ListCastKernel : public UnaryKernel {
 
     result = out->array().get();
 
-    // Copy buffers from parent
-    result->buffers = in_data.buffers;
+    std::shared_ptr<ArrayData> values = in_data.child_data[0];
+    if (out_type_->id() == in_type_id) {
+      // Copy buffers from parent
+      result->buffers = in_data.buffers;
+    } else {
+      // Convert the offsets, and slice the values they point to
+      std::shared_ptr<Buffer> offsets;
+      int64_t values_offset, values_length;
+      if (in_type_id == Type::LIST) {
+        RETURN_NOT_OK((CastOffsets<int64_t, int32_t>(ctx, in_data, &offsets,
+                                                     &values_offset, &values_length)));
+      } else {
+        RETURN_NOT_OK((CastOffsets<int32_t, int64_t>(ctx, in_data, &offsets,
+                                                     &values_offset, &values_length)));
+      }
+      result->buffers = {in_data.buffers[0], offsets};
+      values = MakeArray(values)->Slice(values_offset, values_length)->data();
+    }
 
     Datum casted_child;
-    RETURN_NOT_OK(child_caster_->Call(ctx, Datum(in_data.child_data[0]), &casted_child));
+    RETURN_NOT_OK(child_caster_->Call(ctx, Datum(values), &casted_child));
     result->child_data.push_back(casted_child.array());
 
     RETURN_IF_ERROR(ctx);
@@ -513,6 +590,36 @@ class ListCastKernel : public UnaryKernel {
   std::shared_ptr<DataType> out_type_;
 };
 
+// Cast a dictionary array to a type other than its value type: the
+// dictionary is cast once, then the indices are unpacked against the result,
+// so that each distinct value is converted only once
+class DictionaryValuesCastKernel : public UnaryKernel {
+ public:
+  DictionaryValuesCastKernel(std::unique_ptr<UnaryKernel> values_caster,
+                             std::unique_ptr<UnaryKernel> unpacker)
+      : values_caster_(std::move(values_caster)), unpacker_(std::move(unpacker)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const ArrayData& in_data = *input.array();
+    const auto& type = checked_cast<const DictionaryType&>(*in_data.type);
+
+    Datum casted_dictionary;
+    RETURN_NOT_OK(
+        values_caster_->Call(ctx, Datum(type.dictionary()->data()), &casted_dictionary));
+
+    std::shared_ptr<ArrayData> recoded = in_data.Copy();
+    recoded->type = ::arrow::dictionary(
+        type.index_type(), MakeArray(casted_dictionary.array()), type.ordered());
+    return unpacker_->Call(ctx, Datum(recoded), out);
+  }
+
+ private:
+  std::unique_ptr<UnaryKernel> values_caster_;
+  std::unique_ptr<UnaryKernel> unpacker_;
+};
+
 // ----------------------------------------------------------------------
 // Dictionary to other things
 
@@ -729,33 +836,57 @@ struct CastFunctor<T, DictionaryType,
 };
 
 // ----------------------------------------------------------------------
-// String to Number
+// String to Number, Timestamp and Date32
+
+template <typename Converter>
+void ParseStringValues(FunctionContext* ctx, const ArrayData& input, ArrayData* output,
+                       Converter* converter) {
+  using out_type = typename Converter::value_type;
+
+  StringArray input_array(input.Copy());
+  auto out_data = GetMutableValues<out_type>(output, 1);
+
+  for (int64_t i = 0; i < input.length; ++i, ++out_data) {
+    if (input_array.IsNull(i)) {
+      continue;
+    }
+
+    int32_t length = -1;
+    auto str = reinterpret_cast<const char*>(input_array.GetValue(i, &length));
+    if (ARROW_PREDICT_FALSE(!(*converter)(str, static_cast<size_t>(length), out_data))) {
+      std::stringstream ss;
+      ss << "Failed to cast String '" << std::string(str, length) << "' into "
+         << output->type->ToString();
+      ctx->SetStatus(Status(StatusCode::Invalid, ss.str()));
+      return;
+    }
+  }
+}
 
 template <typename O>
 struct CastFunctor<O, StringType, enable_if_number<O>> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
-    using out_type = typename O::c_type;
-
-    StringArray input_array(input.Copy());
-    auto out_data = GetMutableValues<out_type>(output, 1);
     internal::StringConverter<O> converter;
+    ParseStringValues(ctx, input, output, &converter);
+  }
+};
 
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
+template <>
+struct CastFunctor<TimestampType, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    internal::StringConverter<TimestampType> converter(output->type);
+    ParseStringValues(ctx, input, output, &converter);
+  }
+};
 
-      int32_t length = -1;
-      auto str = input_array.GetValue(i, &length);
-      if (!converter(reinterpret_cast<const char*>(str), static_cast<size_t>(length),
-                     out_data)) {
-        std::stringstream ss;
-        ss << "Failed to cast String '" << str << "' into " << output->type->ToString();
-        ctx->SetStatus(Status(StatusCode::Invalid, ss.str()));
-        return;
-      }
-    }
+template <>
+struct CastFunctor<Date32Type, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    internal::StringConverter<Date32Type> converter;
+    ParseStringValues(ctx, input, output, &converter);
   }
 };
 
@@ -801,6 +932,113 @@ struct CastFunctor<O, StringType,
   }
 };
 
+// ----------------------------------------------------------------------
+// Number, Boolean and temporal types to String
+//
+// Values are formatted straight into the data buffer of the output, which is
+// grown geometrically so that it never needs more than one reallocation per
+// doubling, then trimmed to size.
+
+template <typename GetValue, typename Formatter>
+void FormatValues(FunctionContext* ctx, const ArrayData& input, GetValue&& get_value,
+                  Formatter* formatter, ArrayData* output) {
+  constexpr int64_t kMaxSize = Formatter::kMaxSize;
+  const int64_t length = input.length;
+
+  std::shared_ptr<Buffer> offsets_buffer;
+  const int64_t offsets_size = (length + 1) * static_cast<int64_t>(sizeof(int32_t));
+  FUNC_RETURN_NOT_OK(ctx->Allocate(offsets_size, &offsets_buffer));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+
+  std::shared_ptr<ResizableBuffer> data_buffer;
+  int64_t capacity = std::min<int64_t>(length * kMaxSize, 1 << 20) + kMaxSize;
+  FUNC_RETURN_NOT_OK(AllocateResizableBuffer(ctx->memory_pool(), capacity, &data_buffer));
+  auto data = reinterpret_cast<char*>(data_buffer->mutable_data());
+
+  const uint8_t* valid_bits =
+      input.null_count != 0 && input.buffers[0] ? input.buffers[0]->data() : nullptr;
+
+  int64_t position = 0;
+  offsets[0] = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (valid_bits == nullptr || BitUtil::GetBit(valid_bits, input.offset + i)) {
+      if (ARROW_PREDICT_FALSE(position + kMaxSize > capacity)) {
+        capacity *= 2;
+        FUNC_RETURN_NOT_OK(data_buffer->Resize(capacity, false));
+        data = reinterpret_cast<char*>(data_buffer->mutable_data());
+      }
+      position += (*formatter)(get_value(i), data + position);
+      if (ARROW_PREDICT_FALSE(position > std::numeric_limits<int32_t>::max())) {
+        ctx->SetStatus(Status::CapacityError("Cast result too large for String array"));
+        return;
+      }
+    }
+    offsets[i + 1] = static_cast<int32_t>(position);
+  }
+  FUNC_RETURN_NOT_OK(data_buffer->Resize(position));
+
+  output->buffers.push_back(offsets_buffer);
+  output->buffers.push_back(data_buffer);
+}
+
+template <typename I>
+struct CastFunctor<StringType, I,
+                   typename std::enable_if<is_number<I>::value ||
+                                           std::is_same<Date32Type, I>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using in_type = typename I::c_type;
+
+    const in_type* values = GetValues<in_type>(input, 1);
+    internal::StringFormatter<I> formatter;
+    FormatValues(ctx, input, [values](int64_t i) { return values[i]; }, &formatter,
+                 output);
+  }
+};
+
+template <>
+struct CastFunctor<StringType, TimestampType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const int64_t* values = GetValues<int64_t>(input, 1);
+    internal::StringFormatter<TimestampType> formatter(input.type);
+    FormatValues(ctx, input, [values](int64_t i) { return values[i]; }, &formatter,
+                 output);
+  }
+};
+
+template <>
+struct CastFunctor<StringType, BooleanType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const uint8_t* bits = input.buffers[1]->data();
+    const int64_t offset = input.offset;
+    internal::StringFormatter<BooleanType> formatter;
+    FormatValues(ctx, input,
+                 [bits, offset](int64_t i) { return BitUtil::GetBit(bits, offset + i); },
+                 &formatter, output);
+  }
+};
+
+template <>
+struct CastFunctor<StringType, NullType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    // All slots are null: offsets are all zero and there is no character data
+    std::shared_ptr<Buffer> offsets_buffer;
+    const int64_t offsets_size =
+        (input.length + 1) * static_cast<int64_t>(sizeof(int32_t));
+    FUNC_RETURN_NOT_OK(ctx->Allocate(offsets_size, &offsets_buffer));
+    memset(offsets_buffer->mutable_data(), 0, static_cast<size_t>(offsets_size));
+
+    std::shared_ptr<Buffer> data_buffer;
+    FUNC_RETURN_NOT_OK(ctx->Allocate(0, &data_buffer));
+
+    output->buffers.push_back(offsets_buffer);
+    output->buffers.push_back(data_buffer);
+  }
+};
+
 // ----------------------------------------------------------------------
 
 typedef std::function<void(FunctionContext*, const CastOptions& options, const ArrayData&,
@@ -912,8 +1150,8 @@ class CastKernel : public UnaryKernel {
 #define CAST_CASE(InType, OutType)                                                      \
   case OutType::type_id:                                                                \
     is_zero_copy = is_zero_copy_cast<OutType, InType>::value;                           \
-    can_pre_allocate_values =                                                           \
-        !(!is_binary_like(InType::type_id) && is_binary_like(OutType::type_id));        \
+    can_pre_allocate_values = !(is_binary_like(OutType::type_id) ||                     \
+                                is_large_binary_like(OutType::type_id));                \
     func = [](FunctionContext* ctx, const CastOptions& options, const ArrayData& input, \
               ArrayData* out) {                                                         \
       CastFunctor<OutType, InType> func;                                                \
@@ -932,7 +1170,8 @@ class CastKernel : public UnaryKernel {
   FN(IN_TYPE, UInt64Type);         \
   FN(IN_TYPE, Int64Type);          \
   FN(IN_TYPE, FloatType);          \
-  FN(IN_TYPE, DoubleType);
+  FN(IN_TYPE, DoubleType);         \
+  FN(IN_TYPE, StringType);
 
 #define NULL_CASES(FN, IN_TYPE) \
   NUMERIC_CASES(FN, IN_TYPE)    \
@@ -956,7 +1195,8 @@ class CastKernel : public UnaryKernel {
 #define DATE32_CASES(FN, IN_TYPE) \
   FN(Date32Type, Date32Type);     \
   FN(Date32Type, Date64Type);     \
-  FN(Date32Type, Int32Type);
+  FN(Date32Type, Int32Type);      \
+  FN(Date32Type, StringType);
 
 #define DATE64_CASES(FN, IN_TYPE) \
   FN(Date64Type, Date64Type);     \
@@ -977,7 +1217,8 @@ class CastKernel : public UnaryKernel {
   FN(TimestampType, TimestampType);  \
   FN(TimestampType, Date32Type);     \
   FN(TimestampType, Date64Type);     \
-  FN(TimestampType, Int64Type);
+  FN(TimestampType, Int64Type);      \
+  FN(TimestampType, StringType);
 
 #define STRING_CASES(FN, IN_TYPE) \
   FN(StringType, StringType);     \
@@ -991,7 +1232,22 @@ class CastKernel : public UnaryKernel {
   FN(StringType, UInt64Type);     \
   FN(StringType, Int64Type);      \
   FN(StringType, FloatType);      \
-  FN(StringType, DoubleType);
+  FN(StringType, DoubleType);     \
+  FN(StringType, TimestampType);  \
+  FN(StringType, Date32Type);     \
+  FN(StringType, LargeStringType);
+
+#define LARGE_STRING_CASES(FN, IN_TYPE) \
+  FN(LargeStringType, LargeStringType); \
+  FN(LargeStringType, StringType);
+
+#define BINARY_CASES(FN, IN_TYPE) \
+  FN(BinaryType, BinaryType);     \
+  FN(BinaryType, LargeBinaryType);
+
+#define LARGE_BINARY_CASES(FN, IN_TYPE) \
+  FN(LargeBinaryType, LargeBinaryType); \
+  FN(LargeBinaryType, BinaryType);
 
 #define DICTIONARY_CASES(FN, IN_TYPE) \
   FN(IN_TYPE, NullType);              \
@@ -1051,6 +1307,9 @@ GET_CAST_FUNCTION(TIME32_CASES, Time32Type);
 GET_CAST_FUNCTION(TIME64_CASES, Time64Type);
 GET_CAST_FUNCTION(TIMESTAMP_CASES, TimestampType);
 GET_CAST_FUNCTION(STRING_CASES, StringType);
+GET_CAST_FUNCTION(LARGE_STRING_CASES, LargeStringType);
+GET_CAST_FUNCTION(BINARY_CASES, BinaryType);
+GET_CAST_FUNCTION(LARGE_BINARY_CASES, LargeBinaryType);
 GET_CAST_FUNCTION(DICTIONARY_CASES, DictionaryType);
 
 #define CAST_FUNCTION_CASE(InType)                      \
@@ -1062,13 +1321,13 @@ namespace {
 
 Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
-  if (out_type->id() != Type::LIST) {
+  if (out_type->id() != Type::LIST && out_type->id() != Type::LARGE_LIST) {
     // Kernel will be null
     return Status::OK();
   }
-  const DataType& in_value_type = *checked_cast<const ListType&>(in_type).value_type();
-  std::shared_ptr<DataType> out_value_type =
-      checked_cast<const ListType&>(*out_type).value_type();
+  // Lists of either offset width have their value type as only child
+  const DataType& in_value_type = *in_type.child(0)->type();
+  std::shared_ptr<DataType> out_value_type = out_type->child(0)->type();
   std::unique_ptr<UnaryKernel> child_caster;
   RETURN_NOT_OK(GetCastFunction(in_value_type, out_value_type, options, &child_caster));
   *kernel =
@@ -1076,6 +1335,24 @@ Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>&
   return Status::OK();
 }
 
+Status GetDictionaryCastFunc(const DataType& in_type,
+                             const std::shared_ptr<DataType>& out_type,
+                             const CastOptions& options,
+                             std::unique_ptr<UnaryKernel>* kernel) {
+  std::unique_ptr<UnaryKernel> unpacker = GetDictionaryTypeCastFunc(out_type, options);
+  const std::shared_ptr<DataType>& value_type =
+      checked_cast<const DictionaryType&>(in_type).dictionary()->type();
+  if (unpacker == nullptr || value_type->Equals(*out_type)) {
+    *kernel = std::move(unpacker);
+    return Status::OK();
+  }
+  std::unique_ptr<UnaryKernel> values_caster;
+  RETURN_NOT_OK(GetCastFunction(*value_type, out_type, options, &values_caster));
+  kernel->reset(
+      new DictionaryValuesCastKernel(std::move(values_caster), std::move(unpacker)));
+  return Status::OK();
+}
+
 }  // namespace
 
 Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
@@ -1099,8 +1376,14 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
     CAST_FUNCTION_CASE(Time64Type);
     CAST_FUNCTION_CASE(TimestampType);
     CAST_FUNCTION_CASE(StringType);
-    CAST_FUNCTION_CASE(DictionaryType);
+    CAST_FUNCTION_CASE(LargeStringType);
+    CAST_FUNCTION_CASE(BinaryType);
+    CAST_FUNCTION_CASE(LargeBinaryType);
+    case Type::DICTIONARY:
+      RETURN_NOT_OK(GetDictionaryCastFunc(in_type, out_type, options, kernel));
+      break;
     case Type::LIST:
+    case Type::LARGE_LIST:
       RETURN_NOT_OK(GetListCastFunc(in_type, out_type, options, kernel));
       break;
     default:
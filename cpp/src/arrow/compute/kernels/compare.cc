@@ -0,0 +1,315 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/compare.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/elementwise-internal.h"
+#include "arrow/compute/kernels/util-internal.h"
+
+namespace arrow {
+namespace compute {
+
+// Comparisons are evaluated eight at a time and packed into one output byte.
+// The inner loop has a fixed trip count and no branches, so the compiler turns
+// it into vector compares whose mask is written straight into the bitmap.
+template <CompareOperator Op, typename Left, typename Right>
+void CompareToBitmap(const Left& left, const Right& right, int64_t length,
+                     uint8_t* out) {
+  const int64_t whole_bytes = length / 8;
+  for (int64_t i = 0; i < whole_bytes; ++i) {
+    const int64_t base = i * 8;
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; ++j) {
+      byte = static_cast<uint8_t>(
+          byte | (Comparator<Op>::Compare(left[base + j], right[base + j]) << j));
+    }
+    out[i] = byte;
+  }
+
+  const int64_t base = whole_bytes * 8;
+  if (base < length) {
+    uint8_t byte = 0;
+    for (int j = 0; base + j < length; ++j) {
+      byte = static_cast<uint8_t>(
+          byte | (Comparator<Op>::Compare(left[base + j], right[base + j]) << j));
+    }
+    out[whole_bytes] = byte;
+  }
+}
+
+/// \brief A view of one binary or string value, ordered bytewise
+struct BinaryValue {
+  const uint8_t* data;
+  int32_t length;
+};
+
+inline int CompareBytes(const BinaryValue& left, const BinaryValue& right) {
+  const int32_t common_length = std::min(left.length, right.length);
+  if (common_length > 0) {
+    const int result = memcmp(left.data, right.data, common_length);
+    if (result != 0) {
+      return result;
+    }
+  }
+  return (left.length > right.length) - (left.length < right.length);
+}
+
+inline bool operator==(const BinaryValue& left, const BinaryValue& right) {
+  return left.length == right.length &&
+         (left.length == 0 || memcmp(left.data, right.data, left.length) == 0);
+}
+
+inline bool operator!=(const BinaryValue& left, const BinaryValue& right) {
+  return !(left == right);
+}
+
+inline bool operator<(const BinaryValue& left, const BinaryValue& right) {
+  return CompareBytes(left, right) < 0;
+}
+
+inline bool operator<=(const BinaryValue& left, const BinaryValue& right) {
+  return CompareBytes(left, right) <= 0;
+}
+
+inline bool operator>(const BinaryValue& left, const BinaryValue& right) {
+  return CompareBytes(left, right) > 0;
+}
+
+inline bool operator>=(const BinaryValue& left, const BinaryValue& right) {
+  return CompareBytes(left, right) >= 0;
+}
+
+/// \brief Element accessor over the values of a binary or string array
+struct BinaryArrayOperand {
+  explicit BinaryArrayOperand(const ArrayData& data)
+      : offsets(GetValues<int32_t>(data, 1)),
+        data(data.buffers[2] == nullptr ? nullptr : data.buffers[2]->data()) {}
+
+  BinaryValue operator[](int64_t i) const {
+    return BinaryValue{data + offsets[i], offsets[i + 1] - offsets[i]};
+  }
+
+  const int32_t* offsets;
+  const uint8_t* data;
+};
+
+template <typename ArrowType, typename Enable = void>
+struct CompareTraits {
+  using ValueType = typename ArrowType::c_type;
+  using ArrayOperandType = ArrayOperand<ValueType>;
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    return checked_cast<const NumericScalar<ArrowType>&>(scalar).value;
+  }
+};
+
+template <typename ArrowType>
+struct CompareTraits<ArrowType, enable_if_binary<ArrowType>> {
+  using ValueType = BinaryValue;
+  using ArrayOperandType = BinaryArrayOperand;
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    const auto& buffer = checked_cast<const BinaryScalar&>(scalar).value;
+    if (buffer == nullptr) {
+      return BinaryValue{nullptr, 0};
+    }
+    return BinaryValue{buffer->data(), static_cast<int32_t>(buffer->size())};
+  }
+};
+
+template <typename ArrowType, CompareOperator Op>
+class CompareKernel : public BinaryKernel {
+ public:
+  using Traits = CompareTraits<ArrowType>;
+  using T = typename Traits::ValueType;
+  using Operand = typename Traits::ArrayOperandType;
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    const bool scalar_left = left.kind() == Datum::SCALAR;
+    const ArrayData& values = scalar_left ? *right.array() : *left.array();
+    const int64_t length = values.length;
+
+    auto result = ArrayData::Make(boolean(), length,
+                                  std::vector<std::shared_ptr<Buffer>>(2));
+    if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, *left.array(), *right.array(),
+                                           result.get()));
+    } else {
+      const Scalar& scalar = scalar_left ? *left.scalar() : *right.scalar();
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, values, scalar, result.get()));
+    }
+
+    std::shared_ptr<Buffer> bitmap;
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &bitmap));
+    uint8_t* out_bits = bitmap->mutable_data();
+    result->buffers[1] = bitmap;
+
+    if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+      CompareToBitmap<Op>(Operand(*left.array()), Operand(*right.array()), length,
+                          out_bits);
+    } else if (result->null_count == length) {
+      // Null scalar, all slots are null
+      memset(out_bits, 0, static_cast<size_t>(bitmap->size()));
+    } else if (scalar_left) {
+      CompareToBitmap<Op>(ScalarOperand<T>(Traits::ScalarValue(*left.scalar())),
+                          Operand(values), length, out_bits);
+    } else {
+      CompareToBitmap<Op>(Operand(values),
+                          ScalarOperand<T>(Traits::ScalarValue(*right.scalar())), length,
+                          out_bits);
+    }
+
+    out->value = result;
+    return Status::OK();
+  }
+};
+
+template <typename ArrowType>
+std::unique_ptr<BinaryKernel> MakeCompareKernel(CompareOperator op) {
+  switch (op) {
+    case EQUAL:
+      return std::unique_ptr<BinaryKernel>(new CompareKernel<ArrowType, EQUAL>());
+    case NOT_EQUAL:
+      return std::unique_ptr<BinaryKernel>(new CompareKernel<ArrowType, NOT_EQUAL>());
+    case GREATER:
+      return std::unique_ptr<BinaryKernel>(new CompareKernel<ArrowType, GREATER>());
+    case GREATER_EQUAL:
+      return std::unique_ptr<BinaryKernel>(
+          new CompareKernel<ArrowType, GREATER_EQUAL>());
+    case LESS:
+      return std::unique_ptr<BinaryKernel>(new CompareKernel<ArrowType, LESS>());
+    case LESS_EQUAL:
+      return std::unique_ptr<BinaryKernel>(new CompareKernel<ArrowType, LESS_EQUAL>());
+  }
+  return nullptr;
+}
+
+#define COMPARE_KERNEL_CASE(ArrowType)                  \
+  case ArrowType::type_id:                              \
+    *kernel = MakeCompareKernel<ArrowType>(options.op); \
+    break
+
+Status GetCompareKernel(const DataType& type, const CompareOptions& options,
+                        std::unique_ptr<BinaryKernel>* kernel) {
+  switch (type.id()) {
+    COMPARE_KERNEL_CASE(UInt8Type);
+    COMPARE_KERNEL_CASE(Int8Type);
+    COMPARE_KERNEL_CASE(UInt16Type);
+    COMPARE_KERNEL_CASE(Int16Type);
+    COMPARE_KERNEL_CASE(UInt32Type);
+    COMPARE_KERNEL_CASE(Int32Type);
+    COMPARE_KERNEL_CASE(UInt64Type);
+    COMPARE_KERNEL_CASE(Int64Type);
+    COMPARE_KERNEL_CASE(FloatType);
+    COMPARE_KERNEL_CASE(DoubleType);
+    COMPARE_KERNEL_CASE(Date32Type);
+    COMPARE_KERNEL_CASE(Date64Type);
+    COMPARE_KERNEL_CASE(Time32Type);
+    COMPARE_KERNEL_CASE(Time64Type);
+    COMPARE_KERNEL_CASE(TimestampType);
+    COMPARE_KERNEL_CASE(BinaryType);
+    COMPARE_KERNEL_CASE(StringType);
+    default:
+      break;
+  }
+  if (*kernel == nullptr) {
+    std::stringstream ss;
+    ss << "No comparison implemented for " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+#undef COMPARE_KERNEL_CASE
+
+namespace {
+
+// Compare a dictionary-encoded operand with a scalar by comparing the
+// dictionary once, then looking up the result of each index
+Status CompareDictionary(FunctionContext* ctx, const Datum& left, const Datum& right,
+                         const CompareOptions& options, Datum* out) {
+  const bool scalar_left = left.kind() == Datum::SCALAR;
+  const Datum& encoded = scalar_left ? right : left;
+  const Datum& scalar = scalar_left ? left : right;
+  if (scalar.kind() != Datum::SCALAR) {
+    return Status::NotImplemented(
+        "Dictionary-encoded operands can only be compared with a scalar");
+  }
+  const auto& dict_type = checked_cast<const DictionaryType&>(*encoded.type());
+  const std::shared_ptr<Array>& dictionary = dict_type.dictionary();
+  if (!dictionary->type()->Equals(*scalar.type())) {
+    std::stringstream ss;
+    ss << "Cannot compare " << encoded.type()->ToString() << " with "
+       << scalar.type()->ToString();
+    return Status::TypeError(ss.str());
+  }
+
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(GetCompareKernel(*scalar.type(), options, &kernel));
+  const Datum dictionary_datum(dictionary->data());
+  Datum dictionary_result;
+  RETURN_NOT_OK(kernel->Call(ctx, scalar_left ? scalar : dictionary_datum,
+                             scalar_left ? dictionary_datum : scalar,
+                             &dictionary_result));
+  return detail::GatherBooleans(ctx, *dictionary_result.array(), encoded, out);
+}
+
+}  // namespace
+
+Status Compare(FunctionContext* ctx, const Datum& left, const Datum& right,
+               const CompareOptions& options, Datum* out) {
+  std::shared_ptr<DataType> left_type = left.type();
+  std::shared_ptr<DataType> right_type = right.type();
+  if (left_type == nullptr || right_type == nullptr) {
+    return Status::Invalid("Comparison operands must be arrays or scalars");
+  }
+  if (left_type->id() == Type::DICTIONARY || right_type->id() == Type::DICTIONARY) {
+    return CompareDictionary(ctx, left, right, options, out);
+  }
+  if (!left_type->Equals(*right_type)) {
+    std::stringstream ss;
+    ss << "Cannot compare " << left_type->ToString() << " with "
+       << right_type->ToString();
+    return Status::TypeError(ss.str());
+  }
+
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(GetCompareKernel(*left_type, options, &kernel));
+  return detail::InvokeBinaryKernel(ctx, kernel.get(), left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_COMPARE_H
+#define ARROW_COMPUTE_KERNELS_COMPARE_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+#include "arrow/compute/kernel.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+
+class FunctionContext;
+
+enum CompareOperator {
+  EQUAL,
+  NOT_EQUAL,
+  GREATER,
+  GREATER_EQUAL,
+  LESS,
+  LESS_EQUAL,
+};
+
+struct ARROW_EXPORT CompareOptions {
+  explicit CompareOptions(CompareOperator op) : op(op) {}
+
+  CompareOperator op;
+};
+
+/// \brief Return a kernel comparing two operands of the given type
+/// \param[in] type the type of both operands
+/// \param[in] options comparison options
+/// \param[out] kernel the resulting kernel
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetCompareKernel(const DataType& type, const CompareOptions& options,
+                        std::unique_ptr<BinaryKernel>* kernel);
+
+/// \brief Element-wise comparison of two numeric, temporal, binary or string
+/// datums
+///
+/// Either operand may be a scalar, which is compared against every element
+/// of the other operand. The result is a boolean datum shaped like the
+/// array-like operand, null wherever one of the operands is null. Binary and
+/// string values are ordered bytewise.
+///
+/// A dictionary-encoded operand may be compared with a scalar of its value
+/// type; the dictionary is then compared once and the result looked up for
+/// every index.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left left operand (array or scalar)
+/// \param[in] right right operand (array or scalar)
+/// \param[in] options comparison options
+/// \param[out] out resulting boolean datum
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               const CompareOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_COMPARE_H
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ELEMENTWISE_INTERNAL_H
+#define ARROW_COMPUTE_KERNELS_ELEMENTWISE_INTERNAL_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/compare.h"
+
+namespace arrow {
+namespace compute {
+
+// Scalar operations shared by the element-wise kernels and the expression
+// evaluator
+
+template <CompareOperator Op>
+struct Comparator;
+
+template <>
+struct Comparator<EQUAL> {
+  template <typename T>
+  static bool Compare(T left, T right) {
+    return left == right;
+  }
+};
+
+template <>
+struct Comparator<NOT_EQUAL> {
+  template <typename T>
+  static bool Compare(T left, T right) {
+    return left != right;
+  }
+};
+
+template <>
+struct Comparator<GREATER> {
+  template <typename T>
+  static bool Compare(T left, T right) {
+    return left > right;
+  }
+};
+
+template <>
+struct Comparator<GREATER_EQUAL> {
+  template <typename T>
+  static bool Compare(T left, T right) {
+    return left >= right;
+  }
+};
+
+template <>
+struct Comparator<LESS> {
+  template <typename T>
+  static bool Compare(T left, T right) {
+    return left < right;
+  }
+};
+
+template <>
+struct Comparator<LESS_EQUAL> {
+  template <typename T>
+  static bool Compare(T left, T right) {
+    return left <= right;
+  }
+};
+
+template <typename T>
+using IntegerResult = typename std::enable_if<std::is_integral<T>::value, T>::type;
+
+template <typename T>
+using FloatingResult = typename std::enable_if<std::is_floating_point<T>::value, T>::type;
+
+// Integer operations are carried out on unsigned 64-bit values, so that
+// overflow wraps around instead of being undefined behaviour
+
+struct AddOp {
+  template <typename T>
+  static IntegerResult<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<uint64_t>(left) + static_cast<uint64_t>(right));
+  }
+
+  template <typename T>
+  static FloatingResult<T> Call(T left, T right) {
+    return left + right;
+  }
+};
+
+struct SubtractOp {
+  template <typename T>
+  static IntegerResult<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<uint64_t>(left) - static_cast<uint64_t>(right));
+  }
+
+  template <typename T>
+  static FloatingResult<T> Call(T left, T right) {
+    return left - right;
+  }
+};
+
+struct MultiplyOp {
+  template <typename T>
+  static IntegerResult<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<uint64_t>(left) * static_cast<uint64_t>(right));
+  }
+
+  template <typename T>
+  static FloatingResult<T> Call(T left, T right) {
+    return left * right;
+  }
+};
+
+struct DivideOp {
+  // The divisor must not be zero
+  template <typename T>
+  static IntegerResult<T> Call(T left, T right) {
+    if (std::is_signed<T>::value && right == static_cast<T>(-1)) {
+      // Avoid overflow trap for the minimum value
+      return static_cast<T>(0 - static_cast<uint64_t>(left));
+    }
+    return static_cast<T>(left / right);
+  }
+
+  template <typename T>
+  static FloatingResult<T> Call(T left, T right) {
+    return left / right;
+  }
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ELEMENTWISE_INTERNAL_H
@@ -17,6 +17,8 @@
 
 #include "arrow/compute/kernels/hash.h"
 
+#include <algorithm>
+#include <cstring>
 #include <exception>
 #include <limits>
 #include <memory>
@@ -30,9 +32,11 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hash-util.h"
 #include "arrow/util/hash.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 namespace compute {
@@ -132,6 +136,10 @@ class HashTableKernel : public HashTable {};
 // match: raise or set null when not found, otherwise append slot #
 // isin: set false when not found, otherwise true
 // value counts: append to dictionary when not found, increment count for slot
+//
+// A value that is not found is appended to the dictionary, and passed to
+// ObserveNotFound, while the action's allow_expand() is true. Otherwise the
+// table is left unchanged and ObserveMissing is called instead.
 
 template <typename Type, typename Enable = void>
 class HashDictionary {};
@@ -247,35 +255,35 @@ class HashTableKernel<
 
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                               \
-  const T value = values[i];                                            \
-  int64_t j = HashValue(value) & mod_bitmask_;                          \
-  hash_slot_t slot = hash_slots_[j];                                    \
-                                                                        \
-  while (kHashSlotEmpty != slot && dict_.values[slot] != value) {       \
-    ++j;                                                                \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                   \
-      j = 0;                                                            \
-    }                                                                   \
-    slot = hash_slots_[j];                                              \
-  }                                                                     \
-                                                                        \
-  if (slot == kHashSlotEmpty) {                                         \
-    if (!Action::allow_expand) {                                        \
-      throw HashException("Encountered new dictionary value");          \
-    }                                                                   \
-                                                                        \
-    slot = static_cast<hash_slot_t>(dict_.size);                        \
-    hash_slots_[j] = slot;                                              \
-    dict_.values[dict_.size++] = value;                                 \
-                                                                        \
-    action->ObserveNotFound(slot);                                      \
-                                                                        \
-    if (ARROW_PREDICT_FALSE(dict_.size > hash_table_load_threshold_)) { \
-      RETURN_NOT_OK(action->DoubleSize());                              \
-    }                                                                   \
-  } else {                                                              \
-    action->ObserveFound(slot);                                         \
+#define HASH_INNER_LOOP()                                                 \
+  const T value = values[i];                                              \
+  int64_t j = HashValue(value) & mod_bitmask_;                            \
+  hash_slot_t slot = hash_slots_[j];                                      \
+                                                                          \
+  while (kHashSlotEmpty != slot && dict_.values[slot] != value) {         \
+    ++j;                                                                  \
+    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                     \
+      j = 0;                                                              \
+    }                                                                     \
+    slot = hash_slots_[j];                                                \
+  }                                                                       \
+                                                                          \
+  if (slot == kHashSlotEmpty) {                                           \
+    if (!action->allow_expand()) {                                        \
+      action->ObserveMissing();                                           \
+    } else {                                                              \
+      slot = static_cast<hash_slot_t>(dict_.size);                        \
+      hash_slots_[j] = slot;                                              \
+      dict_.values[dict_.size++] = value;                                 \
+                                                                          \
+      action->ObserveNotFound(slot);                                      \
+                                                                          \
+      if (ARROW_PREDICT_FALSE(dict_.size > hash_table_load_threshold_)) { \
+        RETURN_NOT_OK(action->DoubleSize());                              \
+      }                                                                   \
+    }                                                                     \
+  } else {                                                                \
+    action->ObserveFound(slot);                                           \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -334,16 +342,17 @@ class HashTableKernel<Type, Action, enable_if_boolean<Type>> : public HashTable
 
     internal::BitmapReader value_reader(arr.buffers[1]->data(), arr.offset, arr.length);
 
-#define HASH_INNER_LOOP()                                      \
-  if (slot == kHashSlotEmpty) {                                \
-    if (!Action::allow_expand) {                               \
-      throw HashException("Encountered new dictionary value"); \
-    }                                                          \
-    table_[j] = slot = static_cast<hash_slot_t>(dict_.size()); \
-    dict_.push_back(value);                                    \
-    action->ObserveNotFound(slot);                             \
-  } else {                                                     \
-    action->ObserveFound(slot);                                \
+#define HASH_INNER_LOOP()                                        \
+  if (slot == kHashSlotEmpty) {                                  \
+    if (!action->allow_expand()) {                               \
+      action->ObserveMissing();                                  \
+    } else {                                                     \
+      table_[j] = slot = static_cast<hash_slot_t>(dict_.size()); \
+      dict_.push_back(value);                                    \
+      action->ObserveNotFound(slot);                             \
+    }                                                            \
+  } else {                                                       \
+    action->ObserveFound(slot);                                  \
   }
 
     if (arr.null_count != 0) {
@@ -429,44 +438,44 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                                           \
-  const int32_t position = offsets[i];                                              \
-  const int32_t length = offsets[i + 1] - position;                                 \
-  const uint8_t* value = data + position;                                           \
-                                                                                    \
-  int64_t j = HashValue(value, length) & mod_bitmask_;                              \
-  hash_slot_t slot = hash_slots_[j];                                                \
-                                                                                    \
-  const int32_t* dict_offsets = dict_offsets_.data();                               \
-  const uint8_t* dict_data = dict_data_.data();                                     \
-  while (kHashSlotEmpty != slot &&                                                  \
-         !((dict_offsets[slot + 1] - dict_offsets[slot]) == length &&               \
-           0 == memcmp(value, dict_data + dict_offsets[slot], length))) {           \
-    ++j;                                                                            \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                               \
-      j = 0;                                                                        \
-    }                                                                               \
-    slot = hash_slots_[j];                                                          \
-  }                                                                                 \
-                                                                                    \
-  if (slot == kHashSlotEmpty) {                                                     \
-    if (!Action::allow_expand) {                                                    \
-      throw HashException("Encountered new dictionary value");                      \
-    }                                                                               \
-                                                                                    \
-    slot = dict_size_++;                                                            \
-    hash_slots_[j] = slot;                                                          \
-                                                                                    \
-    RETURN_NOT_OK(dict_data_.Append(value, length));                                \
-    RETURN_NOT_OK(dict_offsets_.Append(static_cast<int32_t>(dict_data_.length()))); \
-                                                                                    \
-    action->ObserveNotFound(slot);                                                  \
-                                                                                    \
-    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {             \
-      RETURN_NOT_OK(action->DoubleSize());                                          \
-    }                                                                               \
-  } else {                                                                          \
-    action->ObserveFound(slot);                                                     \
+#define HASH_INNER_LOOP()                                                             \
+  const int32_t position = offsets[i];                                                \
+  const int32_t length = offsets[i + 1] - position;                                   \
+  const uint8_t* value = data + position;                                             \
+                                                                                      \
+  int64_t j = HashValue(value, length) & mod_bitmask_;                                \
+  hash_slot_t slot = hash_slots_[j];                                                  \
+                                                                                      \
+  const int32_t* dict_offsets = dict_offsets_.data();                                 \
+  const uint8_t* dict_data = dict_data_.data();                                       \
+  while (kHashSlotEmpty != slot &&                                                    \
+         !((dict_offsets[slot + 1] - dict_offsets[slot]) == length &&                 \
+           0 == memcmp(value, dict_data + dict_offsets[slot], length))) {             \
+    ++j;                                                                              \
+    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                                 \
+      j = 0;                                                                          \
+    }                                                                                 \
+    slot = hash_slots_[j];                                                            \
+  }                                                                                   \
+                                                                                      \
+  if (slot == kHashSlotEmpty) {                                                       \
+    if (!action->allow_expand()) {                                                    \
+      action->ObserveMissing();                                                       \
+    } else {                                                                          \
+      slot = dict_size_++;                                                            \
+      hash_slots_[j] = slot;                                                          \
+                                                                                      \
+      RETURN_NOT_OK(dict_data_.Append(value, length));                                \
+      RETURN_NOT_OK(dict_offsets_.Append(static_cast<int32_t>(dict_data_.length()))); \
+                                                                                      \
+      action->ObserveNotFound(slot);                                                  \
+                                                                                      \
+      if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {             \
+        RETURN_NOT_OK(action->DoubleSize());                                          \
+      }                                                                               \
+    }                                                                                 \
+  } else {                                                                            \
+    action->ObserveFound(slot);                                                       \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -559,19 +568,19 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
   }                                                                            \
                                                                                \
   if (slot == kHashSlotEmpty) {                                                \
-    if (!Action::allow_expand) {                                               \
-      throw HashException("Encountered new dictionary value");                 \
-    }                                                                          \
+    if (!action->allow_expand()) {                                             \
+      action->ObserveMissing();                                                \
+    } else {                                                                   \
+      slot = dict_size_++;                                                     \
+      hash_slots_[j] = slot;                                                   \
                                                                                \
-    slot = dict_size_++;                                                       \
-    hash_slots_[j] = slot;                                                     \
+      RETURN_NOT_OK(dict_data_.Append(value, byte_width_));                    \
                                                                                \
-    RETURN_NOT_OK(dict_data_.Append(value, byte_width_));                      \
+      action->ObserveNotFound(slot);                                           \
                                                                                \
-    action->ObserveNotFound(slot);                                             \
-                                                                               \
-    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {        \
-      RETURN_NOT_OK(action->DoubleSize());                                     \
+      if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {      \
+        RETURN_NOT_OK(action->DoubleSize());                                   \
+      }                                                                        \
     }                                                                          \
   } else {                                                                     \
     action->ObserveFound(slot);                                                \
@@ -650,22 +659,22 @@ class HashTableKernel<Type, Action, enable_if_8bit_int<Type>> : public HashTable
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                      \
-  const T value = values[i];                                   \
-  const int hash = Hash8Bit<T>(value);                         \
-  hash_slot_t slot = table_[hash];                             \
-                                                               \
-  if (slot == kHashSlotEmpty) {                                \
-    if (!Action::allow_expand) {                               \
-      throw HashException("Encountered new dictionary value"); \
-    }                                                          \
-                                                               \
-    slot = static_cast<hash_slot_t>(dict_.size());             \
-    table_[hash] = slot;                                       \
-    dict_.push_back(value);                                    \
-    action->ObserveNotFound(slot);                             \
-  } else {                                                     \
-    action->ObserveFound(slot);                                \
+#define HASH_INNER_LOOP()                            \
+  const T value = values[i];                         \
+  const int hash = Hash8Bit<T>(value);               \
+  hash_slot_t slot = table_[hash];                   \
+                                                     \
+  if (slot == kHashSlotEmpty) {                      \
+    if (!action->allow_expand()) {                   \
+      action->ObserveMissing();                      \
+    } else {                                         \
+      slot = static_cast<hash_slot_t>(dict_.size()); \
+      table_[hash] = slot;                           \
+      dict_.push_back(value);                        \
+      action->ObserveNotFound(slot);                 \
+    }                                                \
+  } else {                                           \
+    action->ObserveFound(slot);                      \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -697,15 +706,17 @@ class HashTableKernel<Type, Action, enable_if_8bit_int<Type>> : public HashTable
 template <typename Type>
 class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
  public:
-  static constexpr bool allow_expand = true;
   using Base = HashTableKernel<Type, UniqueImpl<Type>>;
   using Base::Base;
 
+  bool allow_expand() const { return true; }
+
   Status Reserve(const int64_t length) { return Status::OK(); }
 
   void ObserveFound(const hash_slot_t slot) {}
   void ObserveNull() {}
   void ObserveNotFound(const hash_slot_t slot) {}
+  void ObserveMissing() {}
 
   Status DoubleSize() { return Base::DoubleTableSize(); }
 
@@ -723,12 +734,13 @@ class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
 template <typename Type>
 class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
  public:
-  static constexpr bool allow_expand = true;
   using Base = HashTableKernel<Type, DictEncodeImpl>;
 
   DictEncodeImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
       : Base(type, pool), indices_builder_(pool) {}
 
+  bool allow_expand() const { return true; }
+
   Status Reserve(const int64_t length) { return indices_builder_.Reserve(length); }
 
   void ObserveNull() { indices_builder_.UnsafeAppendToBitmap(false); }
@@ -737,6 +749,8 @@ class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
 
   void ObserveNotFound(const hash_slot_t slot) { return ObserveFound(slot); }
 
+  void ObserveMissing() {}
+
   Status DoubleSize() { return Base::DoubleTableSize(); }
 
   Status Flush(Datum* out) override {
@@ -752,6 +766,67 @@ class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
   Int32Builder indices_builder_;
 };
 
+// ----------------------------------------------------------------------
+// IsIn implementation
+
+// The value set is hashed first, then the table is frozen: values appended
+// afterwards are only looked up, so memory use is bounded by the value set
+// whatever the cardinality of the values tested
+template <typename Type>
+class IsInImpl : public HashTableKernel<Type, IsInImpl<Type>> {
+ public:
+  using Base = HashTableKernel<Type, IsInImpl<Type>>;
+
+  IsInImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : Base(type, pool), frozen_(false), result_builder_(pool) {}
+
+  Status SetValueSet(const std::vector<std::shared_ptr<ArrayData>>& value_set) {
+    DCHECK(!frozen_);
+    for (const std::shared_ptr<ArrayData>& chunk : value_set) {
+      RETURN_NOT_OK(Base::Append(*chunk));
+    }
+    frozen_ = true;
+    return Status::OK();
+  }
+
+  bool allow_expand() const { return !frozen_; }
+
+  Status Reserve(const int64_t length) {
+    return frozen_ ? result_builder_.Reserve(length) : Status::OK();
+  }
+
+  void ObserveNull() {
+    if (frozen_) {
+      result_builder_.UnsafeAppendToBitmap(false);
+    }
+  }
+
+  void ObserveFound(const hash_slot_t slot) {
+    if (frozen_) {
+      result_builder_.UnsafeAppend(true);
+    }
+  }
+
+  void ObserveNotFound(const hash_slot_t slot) {}
+
+  void ObserveMissing() { result_builder_.UnsafeAppend(false); }
+
+  Status DoubleSize() { return Base::DoubleTableSize(); }
+
+  Status Flush(Datum* out) override {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(result_builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  using Base::Append;
+
+ private:
+  bool frozen_;
+  BooleanBuilder result_builder_;
+};
+
 // ----------------------------------------------------------------------
 // Kernel wrapper for generic hash table kernels
 
@@ -876,10 +951,151 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
 
 namespace {
 
-Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
-                  std::vector<Datum>* kernel_outputs,
+using HashKernelFactory = Status (*)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                     std::unique_ptr<HashKernel>*);
+
+// Map dictionary indices to indices into a merged dictionary, through a
+// transpose table of int32 merged indices, possibly changing the index width
+template <typename InIndex, typename OutIndex>
+Status TransposeIndicesImpl(FunctionContext* ctx, const ArrayData& transpose,
+                            const ArrayData& indices,
+                            const std::shared_ptr<DataType>& out_type,
+                            std::shared_ptr<ArrayData>* out) {
+  const int64_t length = indices.length;
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(OutIndex), &values));
+  OutIndex* out_values = reinterpret_cast<OutIndex*>(values->mutable_data());
+
+  if (length == indices.null_count) {
+    // Nothing to map, and the buffers may not even be allocated
+    std::shared_ptr<Buffer> bitmap;
+    RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &bitmap));
+    std::fill(out_values, out_values + length, static_cast<OutIndex>(0));
+    *out = ArrayData::Make(out_type, length, {bitmap, values}, length);
+    return Status::OK();
+  }
+
+  const int32_t* mapping = GetValues<int32_t>(transpose, 1);
+  const InIndex* in_values = GetValues<InIndex>(indices, 1);
+  std::shared_ptr<Buffer> bitmap;
+  if (indices.null_count == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      out_values[i] = static_cast<OutIndex>(mapping[in_values[i]]);
+    }
+  } else {
+    // Null slots hold arbitrary values
+    internal::BitmapReader valid_reader(indices.buffers[0]->data(), indices.offset,
+                                        length);
+    for (int64_t i = 0; i < length; ++i) {
+      out_values[i] =
+          valid_reader.IsSet() ? static_cast<OutIndex>(mapping[in_values[i]]) : 0;
+      valid_reader.Next();
+    }
+    bitmap = indices.buffers[0];
+    if (indices.offset != 0) {
+      RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), bitmap->data(), indices.offset,
+                               length, &bitmap));
+    }
+  }
+  *out = ArrayData::Make(out_type, length, {bitmap, values}, indices.null_count);
+  return Status::OK();
+}
+
+template <typename InIndex>
+Status TransposeIndicesFrom(FunctionContext* ctx, const ArrayData& transpose,
+                            const ArrayData& indices,
+                            const std::shared_ptr<DataType>& out_type,
+                            std::shared_ptr<ArrayData>* out) {
+  switch (out_type->id()) {
+    case Type::INT8:
+      return TransposeIndicesImpl<InIndex, int8_t>(ctx, transpose, indices, out_type,
+                                                   out);
+    case Type::INT16:
+      return TransposeIndicesImpl<InIndex, int16_t>(ctx, transpose, indices, out_type,
+                                                    out);
+    case Type::INT32:
+      return TransposeIndicesImpl<InIndex, int32_t>(ctx, transpose, indices, out_type,
+                                                    out);
+    default:
+      break;
+  }
+  return Status::NotImplemented("Transposed indices must be int8, int16 or int32");
+}
+
+Status TransposeIndices(FunctionContext* ctx, const ArrayData& transpose,
+                        const ArrayData& indices,
+                        const std::shared_ptr<DataType>& out_type,
+                        std::shared_ptr<ArrayData>* out) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return TransposeIndicesFrom<int8_t>(ctx, transpose, indices, out_type, out);
+    case Type::INT16:
+      return TransposeIndicesFrom<int16_t>(ctx, transpose, indices, out_type, out);
+    case Type::INT32:
+      return TransposeIndicesFrom<int32_t>(ctx, transpose, indices, out_type, out);
+    case Type::INT64:
+      return TransposeIndicesFrom<int64_t>(ctx, transpose, indices, out_type, out);
+    default:
+      break;
+  }
+  std::stringstream ss;
+  ss << "Dictionary indices must be signed integers, got " << indices.type->ToString();
+  return Status::Invalid(ss.str());
+}
+
+// Hash every chunk with its own kernel in parallel, then merge the chunk
+// dictionaries in chunk order. Each chunk dictionary lists values in order of
+// first occurrence, so the merged dictionary is identical to the one built by
+// serial invocation, and hashing a chunk dictionary into the merged one yields
+// the mapping from chunk indices to merged indices.
+Status InvokeHashParallel(FunctionContext* ctx, HashKernelFactory make_kernel,
+                          HashKernel* merger, const ChunkedArray& values,
+                          std::vector<Datum>* kernel_outputs,
+                          std::shared_ptr<Array>* dictionary) {
+  const int num_chunks = values.num_chunks();
+  std::vector<Datum> chunk_outputs(num_chunks);
+  std::vector<std::shared_ptr<ArrayData>> chunk_dictionaries(num_chunks);
+  RETURN_NOT_OK(detail::ParallelForChunks(
+      ctx, num_chunks, [&](FunctionContext* task_ctx, int i) {
+        std::unique_ptr<HashKernel> kernel;
+        RETURN_NOT_OK(make_kernel(task_ctx, values.type(), &kernel));
+        RETURN_NOT_OK(kernel->Call(task_ctx, Datum(values.chunk(i)), &chunk_outputs[i]));
+        return kernel->GetDictionary(&chunk_dictionaries[i]);
+      }));
+
+  for (int i = 0; i < num_chunks; ++i) {
+    Datum transpose;
+    RETURN_NOT_OK(merger->Call(ctx, Datum(chunk_dictionaries[i]), &transpose));
+    if (chunk_outputs[i].kind() == Datum::ARRAY) {
+      std::shared_ptr<ArrayData> indices;
+      const ArrayData& chunk_indices = *chunk_outputs[i].array();
+      RETURN_NOT_OK(TransposeIndices(ctx, *transpose.array(), chunk_indices,
+                                     chunk_indices.type, &indices));
+      kernel_outputs->emplace_back(indices);
+    } else {
+      kernel_outputs->push_back(chunk_outputs[i]);
+    }
+  }
+
+  std::shared_ptr<ArrayData> dict_data;
+  RETURN_NOT_OK(merger->GetDictionary(&dict_data));
+  *dictionary = MakeArray(dict_data);
+  return Status::OK();
+}
+
+Status InvokeHash(FunctionContext* ctx, HashKernelFactory make_kernel,
+                  const Datum& value, std::vector<Datum>* kernel_outputs,
                   std::shared_ptr<Array>* dictionary) {
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func, value, kernel_outputs));
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(make_kernel(ctx, value.type(), &func));
+
+  if (value.kind() == Datum::CHUNKED_ARRAY && ctx->parallelism() > 1 &&
+      value.chunked_array()->num_chunks() > 1) {
+    return InvokeHashParallel(ctx, make_kernel, func.get(), *value.chunked_array(),
+                              kernel_outputs, dictionary);
+  }
+
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func.get(), value, kernel_outputs));
 
   std::shared_ptr<ArrayData> dict_data;
   RETURN_NOT_OK(func->GetDictionary(&dict_data));
@@ -887,23 +1103,88 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+// View the indices of a dictionary-encoded datum as a plain integer datum
+Datum DictionaryIndices(const Datum& value) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*value.type());
+  if (value.kind() == Datum::ARRAY) {
+    std::shared_ptr<ArrayData> indices = value.array()->Copy();
+    indices->type = dict_type.index_type();
+    return Datum(indices);
+  }
+  std::vector<std::shared_ptr<Array>> chunks;
+  for (const std::shared_ptr<Array>& chunk : value.chunked_array()->chunks()) {
+    chunks.push_back(checked_cast<const DictionaryArray&>(*chunk).indices());
+  }
+  return Datum(std::make_shared<ChunkedArray>(chunks, dict_type.index_type()));
+}
+
+// Create a kernel testing membership in value_set, whose chunks are hashed
+// here
+Status GetIsInKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                     const std::vector<std::shared_ptr<ArrayData>>& value_set,
+                     std::unique_ptr<HashKernel>* out) {
+  std::unique_ptr<HashTable> hasher;
+
+#define IS_IN_CASE(InType)                               \
+  case InType::type_id: {                                \
+    std::unique_ptr<IsInImpl<InType>> impl(              \
+        new IsInImpl<InType>(type, ctx->memory_pool())); \
+    RETURN_NOT_OK(impl->SetValueSet(value_set));         \
+    hasher = std::move(impl);                            \
+  } break
+
+  switch (type->id()) {
+    IS_IN_CASE(NullType);
+    IS_IN_CASE(BooleanType);
+    IS_IN_CASE(UInt8Type);
+    IS_IN_CASE(Int8Type);
+    IS_IN_CASE(UInt16Type);
+    IS_IN_CASE(Int16Type);
+    IS_IN_CASE(UInt32Type);
+    IS_IN_CASE(Int32Type);
+    IS_IN_CASE(UInt64Type);
+    IS_IN_CASE(Int64Type);
+    IS_IN_CASE(FloatType);
+    IS_IN_CASE(DoubleType);
+    IS_IN_CASE(Date32Type);
+    IS_IN_CASE(Date64Type);
+    IS_IN_CASE(Time32Type);
+    IS_IN_CASE(Time64Type);
+    IS_IN_CASE(TimestampType);
+    IS_IN_CASE(BinaryType);
+    IS_IN_CASE(StringType);
+    IS_IN_CASE(FixedSizeBinaryType);
+    IS_IN_CASE(Decimal128Type);
+    default:
+      break;
+  }
+
+#undef IS_IN_CASE
+
+  CHECK_IMPLEMENTED(hasher, "isin", type);
+  out->reset(new HashKernelImpl(std::move(hasher)));
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
-
   std::vector<Datum> dummy_outputs;
-  return InvokeHash(ctx, func.get(), value, &dummy_outputs, out);
+  if (value.type()->id() == Type::DICTIONARY) {
+    std::shared_ptr<Array> unique_indices;
+    RETURN_NOT_OK(InvokeHash(ctx, GetUniqueKernel, DictionaryIndices(value),
+                             &dummy_outputs, &unique_indices));
+    *out = std::make_shared<DictionaryArray>(value.type(), unique_indices);
+    return Status::OK();
+  }
+  return InvokeHash(ctx, GetUniqueKernel, value, &dummy_outputs, out);
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
-
   std::shared_ptr<Array> dictionary;
   std::vector<Datum> indices_outputs;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  RETURN_NOT_OK(
+      InvokeHash(ctx, GetDictionaryEncodeKernel, value, &indices_outputs, &dictionary));
 
   // Create the dictionary type
   DCHECK_EQ(indices_outputs[0].kind(), Datum::ARRAY);
@@ -921,5 +1202,122 @@ Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
   return Status::OK();
 }
 
+Status IsIn(FunctionContext* ctx, const Datum& values, const Datum& value_set,
+            Datum* out) {
+  std::shared_ptr<DataType> type = values.type();
+  if (type == nullptr || value_set.type() == nullptr) {
+    return Status::Invalid("IsIn operands must be array-like");
+  }
+  if (type->id() == Type::DICTIONARY) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+    Datum dictionary_result;
+    RETURN_NOT_OK(
+        IsIn(ctx, Datum(dict_type.dictionary()->data()), value_set, &dictionary_result));
+    return detail::GatherBooleans(ctx, *dictionary_result.array(), values, out);
+  }
+  if (!type->Equals(*value_set.type())) {
+    std::stringstream ss;
+    ss << "Cannot look up " << type->ToString() << " values in a set of "
+       << value_set.type()->ToString();
+    return Status::TypeError(ss.str());
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> set_chunks;
+  if (value_set.kind() == Datum::ARRAY) {
+    set_chunks.push_back(value_set.array());
+  } else {
+    for (const std::shared_ptr<Array>& chunk : value_set.chunked_array()->chunks()) {
+      set_chunks.push_back(chunk->data());
+    }
+  }
+  std::unique_ptr<HashKernel> kernel;
+  RETURN_NOT_OK(GetIsInKernel(ctx, type, set_chunks, &kernel));
+
+  if (values.kind() == Datum::ARRAY) {
+    return kernel->Call(ctx, values, out);
+  }
+  std::vector<std::shared_ptr<Array>> results;
+  for (const std::shared_ptr<Array>& chunk : values.chunked_array()->chunks()) {
+    Datum result;
+    RETURN_NOT_OK(kernel->Call(ctx, Datum(chunk->data()), &result));
+    results.push_back(MakeArray(result.array()));
+  }
+  *out = Datum(std::make_shared<ChunkedArray>(results, boolean()));
+  return Status::OK();
+}
+
+Status DictionaryUnify(FunctionContext* ctx,
+                       const std::vector<std::shared_ptr<Array>>& arrays,
+                       std::shared_ptr<ChunkedArray>* out) {
+  if (arrays.empty()) {
+    return Status::Invalid("DictionaryUnify requires at least one array");
+  }
+  const DataType& first_type = *arrays[0]->type();
+  if (first_type.id() != Type::DICTIONARY) {
+    return Status::TypeError("DictionaryUnify expects dictionary arrays");
+  }
+  const auto& value_type =
+      checked_cast<const DictionaryType&>(first_type).dictionary()->type();
+
+  bool all_equal = true;
+  for (const std::shared_ptr<Array>& array : arrays) {
+    if (array->type_id() != Type::DICTIONARY ||
+        !checked_cast<const DictionaryType&>(*array->type())
+             .dictionary()
+             ->type()
+             ->Equals(*value_type)) {
+      std::stringstream ss;
+      ss << "Cannot unify " << array->type()->ToString() << " with "
+         << first_type.ToString();
+      return Status::TypeError(ss.str());
+    }
+    all_equal = all_equal && array->type()->Equals(first_type);
+  }
+  if (all_equal) {
+    *out = std::make_shared<ChunkedArray>(arrays);
+    return Status::OK();
+  }
+
+  // Hash each dictionary into the merged one, which yields the mapping from
+  // its indices to merged indices
+  std::unique_ptr<HashKernel> merger;
+  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value_type, &merger));
+  std::vector<std::shared_ptr<ArrayData>> transposes;
+  for (const std::shared_ptr<Array>& array : arrays) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(*array->type());
+    const std::shared_ptr<Array>& dictionary = dict_type.dictionary();
+    if (dictionary->null_count() != 0) {
+      return Status::NotImplemented("Unifying dictionaries that contain nulls");
+    }
+    Datum transpose;
+    RETURN_NOT_OK(merger->Call(ctx, Datum(dictionary->data()), &transpose));
+    transposes.push_back(transpose.array());
+  }
+  std::shared_ptr<ArrayData> merged;
+  RETURN_NOT_OK(merger->GetDictionary(&merged));
+
+  std::shared_ptr<DataType> index_type;
+  if (merged->length <= std::numeric_limits<int8_t>::max() + 1) {
+    index_type = int8();
+  } else if (merged->length <= std::numeric_limits<int16_t>::max() + 1) {
+    index_type = int16();
+  } else {
+    index_type = int32();
+  }
+  std::shared_ptr<DataType> out_type = ::arrow::dictionary(index_type, MakeArray(merged));
+
+  std::vector<std::shared_ptr<Array>> chunks;
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    const auto& indices =
+        *checked_cast<const DictionaryArray&>(*arrays[i]).indices()->data();
+    std::shared_ptr<ArrayData> transposed;
+    RETURN_NOT_OK(
+        TransposeIndices(ctx, *transposes[i], indices, index_type, &transposed));
+    chunks.push_back(std::make_shared<DictionaryArray>(out_type, MakeArray(transposed)));
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, out_type);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
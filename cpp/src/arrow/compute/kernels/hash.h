@@ -52,6 +52,10 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
                                  std::unique_ptr<HashKernel>* kernel);
 
 /// \brief Compute unique elements from an array-like object
+///
+/// For dictionary-encoded input only the indices are hashed; the result is a
+/// DictionaryArray of the distinct indices sharing the input's dictionary.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -71,10 +75,46 @@ Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Arra
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
-// TODO(wesm): Define API for incremental dictionary encoding
+/// \brief Test whether each element of an array-like object is a member of
+/// a set of values
+///
+/// The output is true where the element occurs in value_set, false where it
+/// does not, and null where the element is null. Nulls in value_set are
+/// ignored. For dictionary-encoded values, membership is tested once per
+/// dictionary entry and looked up for every index.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[in] value_set array-like set of values, of the same type as values
+/// (or as their dictionary)
+/// \param[out] out boolean result with the same shape as values
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IsIn(FunctionContext* context, const Datum& values, const Datum& value_set,
+            Datum* out);
 
-// TODO(wesm): Define API for regularizing DictionaryArray objects with
-// different dictionaries
+/// \brief Re-encode dictionary arrays against a single merged dictionary
+///
+/// The merged dictionary lists the values of the input dictionaries in order
+/// of first appearance, and the output indices use the narrowest of int8,
+/// int16 and int32 able to address it. Only the dictionaries are hashed; the
+/// indices of each array are remapped through a lookup table. If all inputs
+/// already have the same type they are returned unchanged.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] arrays dictionary arrays whose dictionaries have the same type
+/// \param[out] out chunked array with one chunk per input array
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DictionaryUnify(FunctionContext* context,
+                       const std::vector<std::shared_ptr<Array>>& arrays,
+                       std::shared_ptr<ChunkedArray>* out);
+
+// TODO(wesm): Define API for incremental dictionary encoding
 
 // class DictionaryEncoder {
 //  public:
@@ -86,15 +126,10 @@ Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out)
 // Status DictionaryEncode(FunctionContext* context, const Datum& data,
 //                         const Array& prior_dictionary, Datum* out);
 
-// TODO(wesm): Implement these next
 // ARROW_EXPORT
 // Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
 //              Datum* out);
 
-// ARROW_EXPORT
-// Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
-//             Datum* out);
-
 // ARROW_EXPORT
 // Status CountValues(FunctionContext* context, const Datum& values,
 //                    std::shared_ptr<Array>* out_uniques,
@@ -19,11 +19,19 @@
 
 #include <algorithm>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -32,6 +40,17 @@ namespace arrow {
 namespace compute {
 namespace detail {
 
+Status ParallelForChunks(FunctionContext* ctx, int num_tasks,
+                         const std::function<Status(FunctionContext*, int)>& func) {
+  MemoryPool* pool = ctx->memory_pool();
+  return BoundedParallelFor(ctx->parallelism(), num_tasks, [&](int i) {
+    FunctionContext task_ctx(pool);
+    RETURN_NOT_OK(func(&task_ctx, i));
+    // Kernels may report errors through the context only
+    return task_ctx.status();
+  });
+}
+
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs) {
   if (value.kind() == Datum::ARRAY) {
@@ -40,6 +59,15 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
     outputs->push_back(output);
   } else if (value.kind() == Datum::CHUNKED_ARRAY) {
     const ChunkedArray& array = *value.chunked_array();
+    if (ctx->parallelism() > 1 && array.num_chunks() > 1) {
+      std::vector<Datum> chunk_outputs(array.num_chunks());
+      RETURN_NOT_OK(ParallelForChunks(
+          ctx, array.num_chunks(), [&](FunctionContext* task_ctx, int i) {
+            return kernel->Call(task_ctx, Datum(array.chunk(i)), &chunk_outputs[i]);
+          }));
+      outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
+      return Status::OK();
+    }
     for (int i = 0; i < array.num_chunks(); i++) {
       Datum output;
       RETURN_NOT_OK(kernel->Call(ctx, Datum(array.chunk(i)), &output));
@@ -130,6 +158,233 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
   return Status::OK();
 }
 
+Status InvokeBinaryKernel(FunctionContext* ctx, BinaryKernel* kernel, const Datum& left,
+                          const Datum& right, Datum* output) {
+  if (left.is_arraylike() && right.is_arraylike()) {
+    return InvokeBinaryArrayKernel(ctx, kernel, left, right, output);
+  }
+
+  const bool scalar_left = left.kind() == Datum::SCALAR;
+  const Datum& scalar = scalar_left ? left : right;
+  const Datum& values = scalar_left ? right : left;
+  if (scalar.kind() != Datum::SCALAR || !values.is_arraylike()) {
+    return Status::Invalid("Binary kernel operands must be two array-like datums or "
+                           "an array-like datum and a scalar");
+  }
+
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.make_array());
+  } else {
+    chunks = values.chunked_array()->chunks();
+  }
+
+  std::vector<Datum> result;
+  for (const auto& chunk : chunks) {
+    Datum chunk_out;
+    if (scalar_left) {
+      RETURN_NOT_OK(kernel->Call(ctx, scalar, Datum(chunk), &chunk_out));
+    } else {
+      RETURN_NOT_OK(kernel->Call(ctx, Datum(chunk), scalar, &chunk_out));
+    }
+    result.push_back(chunk_out);
+  }
+  *output = WrapDatumsLike(values, result);
+  return Status::OK();
+}
+
+namespace {
+
+inline bool MayHaveNulls(const ArrayData& data) {
+  return data.null_count != 0 && data.buffers[0] != nullptr;
+}
+
+// Share the validity bitmap of the input, copying it only when it does not
+// start on a byte boundary
+Status CopyValidity(FunctionContext* ctx, const ArrayData& input, ArrayData* output) {
+  std::shared_ptr<Buffer> bitmap = input.buffers[0];
+  if (input.offset != 0) {
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), bitmap->data(), input.offset,
+                             input.length, &bitmap));
+  }
+  output->buffers[0] = bitmap;
+  output->null_count = input.null_count;
+  return Status::OK();
+}
+
+template <typename IndexType>
+Status GatherBooleansImpl(FunctionContext* ctx, const ArrayData& values,
+                          const ArrayData& indices, std::shared_ptr<ArrayData>* out) {
+  using IndexCType = typename IndexType::c_type;
+
+  // Expand each dictionary entry into a byte holding its value in bit 0 and
+  // its validity in bit 1, so that the gather is a plain table lookup
+  std::vector<uint8_t> lookup(static_cast<size_t>(values.length));
+  const bool values_have_nulls = MayHaveNulls(values);
+  for (int64_t i = 0; i < values.length; ++i) {
+    const bool valid = !values_have_nulls ||
+                       BitUtil::GetBit(values.buffers[0]->data(), values.offset + i);
+    const bool value = BitUtil::GetBit(values.buffers[1]->data(), values.offset + i);
+    lookup[i] = static_cast<uint8_t>((valid && value) | (valid << 1));
+  }
+
+  const IndexCType* index_values = GetValues<IndexCType>(indices, 1);
+  const int64_t length = indices.length;
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &data));
+
+  auto result =
+      ArrayData::Make(boolean(), length, std::vector<std::shared_ptr<Buffer>>(2));
+  result->buffers[1] = data;
+  const bool indices_have_nulls = MayHaveNulls(indices);
+  if (!values_have_nulls) {
+    // The output is null exactly where the index is
+    int64_t i = 0;
+    if (indices_have_nulls) {
+      // The values behind null indices are unspecified and may be out of range
+      internal::BitmapReader valid_reader(indices.buffers[0]->data(), indices.offset,
+                                          length);
+      internal::GenerateBitsUnrolled(data->mutable_data(), 0, length, [&]() -> bool {
+        const bool value = valid_reader.IsSet() && (lookup[index_values[i]] & 1) != 0;
+        valid_reader.Next();
+        ++i;
+        return value;
+      });
+      RETURN_NOT_OK(CopyValidity(ctx, indices, result.get()));
+    } else {
+      internal::GenerateBitsUnrolled(
+          data->mutable_data(), 0, length,
+          [&]() -> bool { return (lookup[index_values[i++]] & 1) != 0; });
+    }
+    *out = result;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Buffer> validity;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &validity));
+  internal::FirstTimeBitmapWriter data_writer(data->mutable_data(), 0, length);
+  internal::FirstTimeBitmapWriter validity_writer(validity->mutable_data(), 0, length);
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    uint8_t entry = 0;
+    if (!indices_have_nulls ||
+        BitUtil::GetBit(indices.buffers[0]->data(), indices.offset + i)) {
+      entry = lookup[index_values[i]];
+    }
+    if (entry & 1) {
+      data_writer.Set();
+    }
+    if (entry & 2) {
+      validity_writer.Set();
+    } else {
+      ++null_count;
+    }
+    data_writer.Next();
+    validity_writer.Next();
+  }
+  data_writer.Finish();
+  validity_writer.Finish();
+
+  result->buffers[0] = null_count == 0 ? nullptr : validity;
+  result->null_count = null_count;
+  *out = result;
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GatherBooleans(FunctionContext* ctx, const ArrayData& values,
+                      const ArrayData& indices, std::shared_ptr<ArrayData>* out) {
+  DCHECK_EQ(Type::BOOL, values.type->id());
+  switch (indices.type->id()) {
+    case Type::INT8:
+      return GatherBooleansImpl<Int8Type>(ctx, values, indices, out);
+    case Type::INT16:
+      return GatherBooleansImpl<Int16Type>(ctx, values, indices, out);
+    case Type::INT32:
+      return GatherBooleansImpl<Int32Type>(ctx, values, indices, out);
+    case Type::INT64:
+      return GatherBooleansImpl<Int64Type>(ctx, values, indices, out);
+    default:
+      break;
+  }
+  std::stringstream ss;
+  ss << "Dictionary indices must be signed integers, got " << indices.type->ToString();
+  return Status::Invalid(ss.str());
+}
+
+Status GatherBooleans(FunctionContext* ctx, const ArrayData& values,
+                      const Datum& encoded, Datum* out) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*encoded.type());
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (encoded.kind() == Datum::ARRAY) {
+    chunks.push_back(encoded.array());
+  } else {
+    DCHECK_EQ(Datum::CHUNKED_ARRAY, encoded.kind());
+    for (const std::shared_ptr<Array>& chunk : encoded.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  }
+
+  std::vector<std::shared_ptr<Array>> results;
+  for (const std::shared_ptr<ArrayData>& chunk : chunks) {
+    std::shared_ptr<ArrayData> indices = chunk->Copy();
+    indices->type = dict_type.index_type();
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(GatherBooleans(ctx, values, *indices, &result));
+    results.push_back(MakeArray(result));
+  }
+
+  if (encoded.kind() == Datum::ARRAY) {
+    *out = Datum(results[0]->data());
+  } else {
+    // The chunked array may have no chunks at all
+    *out = Datum(std::make_shared<ChunkedArray>(results, boolean()));
+  }
+  return Status::OK();
+}
+
+Status PropagateNulls(FunctionContext* ctx, const ArrayData& left,
+                      const ArrayData& right, ArrayData* output) {
+  DCHECK_EQ(left.length, right.length);
+  const bool left_nulls = MayHaveNulls(left);
+  const bool right_nulls = MayHaveNulls(right);
+
+  if (left_nulls && right_nulls) {
+    std::shared_ptr<Buffer> bitmap;
+    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
+                            right.buffers[0]->data(), right.offset, left.length, 0,
+                            &bitmap));
+    output->buffers[0] = bitmap;
+    output->null_count = left.length - CountSetBits(bitmap->data(), 0, left.length);
+  } else if (left_nulls) {
+    RETURN_NOT_OK(CopyValidity(ctx, left, output));
+  } else if (right_nulls) {
+    RETURN_NOT_OK(CopyValidity(ctx, right, output));
+  } else {
+    output->buffers[0] = nullptr;
+    output->null_count = 0;
+  }
+  return Status::OK();
+}
+
+Status PropagateNulls(FunctionContext* ctx, const ArrayData& input, const Scalar& scalar,
+                      ArrayData* output) {
+  if (!scalar.is_valid) {
+    std::shared_ptr<Buffer> bitmap;
+    RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), input.length, &bitmap));
+    output->buffers[0] = bitmap;
+    output->null_count = input.length;
+  } else if (MayHaveNulls(input)) {
+    RETURN_NOT_OK(CopyValidity(ctx, input, output));
+  } else {
+    output->buffers[0] = nullptr;
+    output->null_count = 0;
+  }
+  return Status::OK();
+}
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays) {
   // Create right kind of datum
@@ -18,6 +18,7 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -47,8 +48,40 @@ static inline void CopyData(const ArrayData& input, ArrayData* output) {
   output->child_data = input.child_data;
 }
 
+/// \brief Element accessor over the values of a fixed-width array
+template <typename T>
+struct ArrayOperand {
+  explicit ArrayOperand(const ArrayData& data) : values(GetValues<T>(data, 1)) {}
+
+  T operator[](int64_t i) const { return values[i]; }
+
+  const T* values;
+};
+
+/// \brief Element accessor broadcasting a single value to every position
+template <typename T>
+struct ScalarOperand {
+  explicit ScalarOperand(T value) : value(value) {}
+
+  T operator[](int64_t) const { return value; }
+
+  T value;
+};
+
 namespace detail {
 
+/// \brief Run func(task_ctx, i) for every i in [0, num_tasks), with up to
+/// ctx->parallelism() tasks at a time on the CPU thread pool
+///
+/// Each task receives its own FunctionContext sharing ctx's memory pool, so
+/// that error statuses set by kernels do not race.
+Status ParallelForChunks(FunctionContext* ctx, int num_tasks,
+                         const std::function<Status(FunctionContext*, int)>& func);
+
+/// \brief Invoke a unary kernel on an array or on each chunk of a chunked array
+///
+/// If ctx allows parallelism, chunks are processed concurrently, so the
+/// kernel's Call method must not modify kernel state.
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
@@ -58,6 +91,35 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right, Datum* output);
 
+/// \brief Invoke a binary kernel where one of the operands may be a scalar,
+/// in which case it is passed unchanged alongside each chunk of the other
+Status InvokeBinaryKernel(FunctionContext* ctx, BinaryKernel* kernel, const Datum& left,
+                          const Datum& right, Datum* output);
+
+/// \brief Set the validity bitmap and null count of the output of an
+/// element-wise operation to the intersection of the operands' validity
+///
+/// output->buffers must already have room for the validity bitmap
+Status PropagateNulls(FunctionContext* ctx, const ArrayData& left,
+                      const ArrayData& right, ArrayData* output);
+
+/// \brief Like PropagateNulls for an array and a broadcast scalar operand
+Status PropagateNulls(FunctionContext* ctx, const ArrayData& input, const Scalar& scalar,
+                      ArrayData* output);
+
+/// \brief Look up a boolean result for every index of a dictionary-encoded
+/// array, where `values` holds one result per dictionary entry
+///
+/// `indices` must have an integer type. A slot of the output is null if its
+/// index is null or if the looked-up value is null.
+Status GatherBooleans(FunctionContext* ctx, const ArrayData& values,
+                      const ArrayData& indices, std::shared_ptr<ArrayData>* out);
+
+/// \brief Apply GatherBooleans to a dictionary-encoded array or to every chunk
+/// of a dictionary-encoded chunked array, yielding a datum of the same shape
+Status GatherBooleans(FunctionContext* ctx, const ArrayData& values,
+                      const Datum& encoded, Datum* out);
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays);
 
@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/concatenate.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+static constexpr int64_t kLength = 300;
+
+class TestConcatenate : public ::testing::Test {
+ protected:
+  std::vector<bool> IsValid() {
+    std::vector<bool> is_valid;
+    random_is_valid(kLength, 0.2, &is_valid);
+    return is_valid;
+  }
+
+  template <typename TYPE, typename C_TYPE>
+  std::shared_ptr<Array> MakeNumeric() {
+    std::vector<C_TYPE> values;
+    randint<int32_t, C_TYPE>(kLength, 0, 100, &values);
+    std::shared_ptr<Array> array;
+    ArrayFromVector<TYPE, C_TYPE>(IsValid(), values, &array);
+    return array;
+  }
+
+  template <typename TYPE = StringType>
+  std::shared_ptr<Array> MakeStrings() {
+    std::vector<std::string> values;
+    for (int64_t i = 0; i < kLength; ++i) {
+      values.push_back(std::string(static_cast<size_t>(i % 7), 'a' + i % 26));
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<TYPE, std::string>(IsValid(), values, &array);
+    return array;
+  }
+
+  // Concatenate slices of the array at various bit alignments, with an
+  // empty one, and check that each lands at its position in the result
+  void CheckConcatenate(const std::shared_ptr<Array>& array) {
+    const std::vector<std::shared_ptr<Array>> slices = {
+        array->Slice(0, 0),   array->Slice(3, 70), array->Slice(73, 1),
+        array->Slice(0, 130), array->Slice(5, 0),  array->Slice(131, 150)};
+    std::shared_ptr<Array> result;
+    ASSERT_OK(Concatenate(slices, default_memory_pool(), &result));
+    ASSERT_OK(ValidateArray(*result));
+
+    int64_t position = 0;
+    int64_t null_count = 0;
+    for (const auto& slice : slices) {
+      ASSERT_TRUE(
+          result->RangeEquals(position, position + slice->length(), 0, slice))
+          << "slice at " << position << " of " << result->ToString();
+      position += slice->length();
+      null_count += slice->null_count();
+    }
+    ASSERT_EQ(position, result->length());
+    ASSERT_EQ(null_count, result->null_count());
+    ASSERT_EQ(0, result->offset());
+  }
+};
+
+TEST_F(TestConcatenate, Null) { CheckConcatenate(std::make_shared<NullArray>(kLength)); }
+
+TEST_F(TestConcatenate, Primitives) {
+  std::vector<bool> values = IsValid();
+  std::shared_ptr<Array> booleans;
+  ArrayFromVector<BooleanType, bool>(IsValid(), std::vector<bool>(values.rbegin(),
+                                                                  values.rend()),
+                                     &booleans);
+  CheckConcatenate(booleans);
+  CheckConcatenate(MakeNumeric<Int8Type, int8_t>());
+  CheckConcatenate(MakeNumeric<UInt16Type, uint16_t>());
+  CheckConcatenate(MakeNumeric<Int32Type, int32_t>());
+  CheckConcatenate(MakeNumeric<Int64Type, int64_t>());
+  CheckConcatenate(MakeNumeric<DoubleType, double>());
+
+  // Without nulls
+  std::vector<int32_t> ints;
+  randint<int32_t>(kLength, 0, 100, &ints);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>(ints, &array);
+  CheckConcatenate(array);
+}
+
+TEST_F(TestConcatenate, FixedSizeBinary) {
+  FixedSizeBinaryBuilder builder(fixed_size_binary(3));
+  const std::vector<bool> is_valid = IsValid();
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (is_valid[i]) {
+      const std::string value = std::to_string(100 + i % 900);
+      ASSERT_OK(builder.Append(value.data()));
+    } else {
+      ASSERT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  CheckConcatenate(array);
+}
+
+TEST_F(TestConcatenate, Strings) {
+  CheckConcatenate(MakeStrings());
+  CheckConcatenate(MakeStrings<LargeStringType>());
+
+  // Binary values spanning the slices
+  std::shared_ptr<Array> array;
+  ArrayFromVector<BinaryType, std::string>({"a", "bc", "", "def"}, &array);
+  std::shared_ptr<Array> result, expected;
+  ASSERT_OK(Concatenate({array->Slice(1, 2), array->Slice(3), array->Slice(0, 1)},
+                        default_memory_pool(), &result));
+  ArrayFromVector<BinaryType, std::string>({"bc", "", "def", "a"}, &expected);
+  AssertArraysEqual(*expected, *result);
+}
+
+TEST_F(TestConcatenate, List) {
+  ListBuilder builder(default_memory_pool(), std::make_shared<Int32Builder>());
+  auto& values = static_cast<Int32Builder&>(*builder.value_builder());
+  const std::vector<bool> is_valid = IsValid();
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (is_valid[i]) {
+      ASSERT_OK(builder.Append());
+      for (int64_t j = 0; j < i % 4; ++j) {
+        ASSERT_OK(values.Append(static_cast<int32_t>(i + j)));
+      }
+    } else {
+      ASSERT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  CheckConcatenate(array);
+}
+
+TEST_F(TestConcatenate, LargeList) {
+  LargeListBuilder builder(default_memory_pool(), std::make_shared<StringBuilder>());
+  auto& values = static_cast<StringBuilder&>(*builder.value_builder());
+  const std::vector<bool> is_valid = IsValid();
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (is_valid[i]) {
+      ASSERT_OK(builder.Append());
+      for (int64_t j = 0; j < i % 3; ++j) {
+        ASSERT_OK(values.Append(std::to_string(i + j)));
+      }
+    } else {
+      ASSERT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  CheckConcatenate(array);
+}
+
+TEST_F(TestConcatenate, Struct) {
+  auto ints = MakeNumeric<Int16Type, int16_t>();
+  auto strings = MakeStrings();
+  auto type = struct_({field("a", int16()), field("b", utf8())});
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(GetBitmapFromVector(IsValid(), &null_bitmap));
+  auto array = std::make_shared<StructArray>(
+      type, kLength, std::vector<std::shared_ptr<Array>>{ints, strings}, null_bitmap,
+      kUnknownNullCount);
+  CheckConcatenate(array);
+}
+
+TEST_F(TestConcatenate, Union) {
+  auto ints = MakeNumeric<Int32Type, int32_t>();
+  auto strings = MakeStrings();
+  std::vector<int8_t> type_ids;
+  randint<int32_t, int8_t>(kLength, 0, 1, &type_ids);
+  std::shared_ptr<Array> type_ids_array;
+  ArrayFromVector<Int8Type, int8_t>(type_ids, &type_ids_array);
+
+  std::shared_ptr<Array> sparse;
+  ASSERT_OK(UnionArray::MakeSparse(*type_ids_array, {ints, strings}, &sparse));
+  CheckConcatenate(sparse);
+
+  // Dense: values of each child taken in order
+  std::vector<int32_t> offsets;
+  int32_t child_lengths[2] = {0, 0};
+  for (int8_t type_id : type_ids) {
+    offsets.push_back(child_lengths[type_id]++);
+  }
+  std::shared_ptr<Array> offsets_array;
+  ArrayFromVector<Int32Type, int32_t>(offsets, &offsets_array);
+  std::shared_ptr<Array> dense;
+  ASSERT_OK(UnionArray::MakeDense(*type_ids_array, *offsets_array,
+                                  {ints->Slice(0, child_lengths[0]),
+                                   strings->Slice(0, child_lengths[1])},
+                                  &dense));
+  CheckConcatenate(dense);
+}
+
+TEST_F(TestConcatenate, Dictionary) {
+  auto indices = MakeNumeric<Int16Type, int16_t>();
+  std::vector<int32_t> values(100);
+  for (int32_t i = 0; i < 100; ++i) {
+    values[i] = i * 10;
+  }
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<Int32Type, int32_t>(values, &dict);
+  auto array = std::make_shared<DictionaryArray>(dictionary(int16(), dict), indices);
+  CheckConcatenate(array);
+}
+
+TEST_F(TestConcatenate, Errors) {
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, Concatenate(std::vector<std::shared_ptr<Array>>{},
+                                     default_memory_pool(), &result));
+  ASSERT_RAISES(Invalid, Concatenate({MakeStrings(), MakeNumeric<Int8Type, int8_t>()},
+                                     default_memory_pool(), &result));
+}
+
+TEST_F(TestConcatenate, ChunkedArray) {
+  auto array = MakeStrings();
+  ChunkedArray chunked({array->Slice(0, 100), array->Slice(100)});
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Concatenate(chunked, default_memory_pool(), &result));
+  AssertArraysEqual(*array, *result);
+
+  ChunkedArray empty(ArrayVector{}, utf8());
+  ASSERT_OK(Concatenate(empty, default_memory_pool(), &result));
+  ASSERT_EQ(0, result->length());
+  ASSERT_TRUE(result->type()->Equals(*utf8()));
+}
+
+}  // namespace arrow
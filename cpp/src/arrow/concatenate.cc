@@ -0,0 +1,317 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/concatenate.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+namespace {
+
+// Set the `length` bits of `bitmap` starting at bit `offset`
+void SetBits(uint8_t* bitmap, int64_t offset, int64_t length) {
+  for (; length > 0 && offset % 8 != 0; --length) {
+    BitUtil::SetBit(bitmap, offset++);
+  }
+  memset(bitmap + offset / 8, 0xFF, static_cast<size_t>(length / 8));
+  for (int64_t i = length - length % 8; i < length; ++i) {
+    BitUtil::SetBit(bitmap, offset + i);
+  }
+}
+
+// The values of a buffer of an array, from the array offset
+template <typename T>
+inline const T* GetValues(const ArrayData& data, int buffer_index) {
+  return reinterpret_cast<const T*>(data.buffers[buffer_index]->data()) + data.offset;
+}
+
+// Concatenate arrays of the same type, which is visited
+class ConcatenateImpl {
+ public:
+  ConcatenateImpl(const std::vector<std::shared_ptr<Array>>& arrays, MemoryPool* pool)
+      : pool_(pool), length_(0), null_count_(0) {
+    for (const auto& array : arrays) {
+      in_.push_back(array->data());
+      length_ += array->length();
+      null_count_ += array->null_count();
+    }
+  }
+
+  Status Concatenate(std::shared_ptr<ArrayData>* out) {
+    const auto& type = in_[0]->type;
+    buffers_.resize(in_[0]->buffers.size());
+    if (null_count_ > 0 && type->id() != Type::NA) {
+      RETURN_NOT_OK(ConcatenateBitmaps(0, &buffers_[0]));
+    }
+    RETURN_NOT_OK(VisitTypeInline(*type, this));
+    *out = ArrayData::Make(type, length_, std::move(buffers_), child_data_, null_count_);
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) { return ConcatenateBitmaps(1, &buffers_[1]); }
+
+  // Primitive, fixed size binary, decimal and dictionary types
+  Status Visit(const FixedWidthType& type) {
+    return ConcatenateFixedWidth(1, type.bit_width() / 8, &buffers_[1]);
+  }
+
+  Status Visit(const BinaryType&) { return ConcatenateBinary<int32_t>(); }
+
+  Status Visit(const LargeBinaryType&) { return ConcatenateBinary<int64_t>(); }
+
+  Status Visit(const ListType&) { return ConcatenateList<int32_t>(); }
+
+  Status Visit(const LargeListType&) { return ConcatenateList<int64_t>(); }
+
+  Status Visit(const StructType& type) {
+    for (int i = 0; i < type.num_children(); ++i) {
+      std::shared_ptr<ArrayData> field;
+      RETURN_NOT_OK(ConcatenateChildren(i, SlotRanges(), &field));
+      child_data_.push_back(field);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const UnionType& type) {
+    RETURN_NOT_OK(ConcatenateFixedWidth(1, sizeof(uint8_t), &buffers_[1]));
+    if (type.mode() == UnionMode::SPARSE) {
+      for (int i = 0; i < type.num_children(); ++i) {
+        std::shared_ptr<ArrayData> child;
+        RETURN_NOT_OK(ConcatenateChildren(i, SlotRanges(), &child));
+        child_data_.push_back(child);
+      }
+      return Status::OK();
+    }
+
+    // Dense: children are concatenated whole, and the value offsets into
+    // each child are shifted by the length of the child in preceding arrays
+    std::vector<int> child_index(std::numeric_limits<uint8_t>::max() + 1, 0);
+    for (size_t i = 0; i < type.type_codes().size(); ++i) {
+      child_index[type.type_codes()[i]] = static_cast<int>(i);
+    }
+    std::vector<int32_t> child_lengths(type.num_children(), 0);
+    RETURN_NOT_OK(AllocateBuffer(pool_, length_ * sizeof(int32_t), &buffers_[2]));
+    auto out_offsets = reinterpret_cast<int32_t*>(buffers_[2]->mutable_data());
+    for (const auto& data : in_) {
+      if (data->length > 0) {
+        const uint8_t* type_ids = GetValues<uint8_t>(*data, 1);
+        const int32_t* offsets = GetValues<int32_t>(*data, 2);
+        for (int64_t j = 0; j < data->length; ++j) {
+          *out_offsets++ = offsets[j] + child_lengths[child_index[type_ids[j]]];
+        }
+      }
+      for (int i = 0; i < type.num_children(); ++i) {
+        child_lengths[i] += static_cast<int32_t>(data->child_data[i]->length);
+      }
+    }
+    for (int i = 0; i < type.num_children(); ++i) {
+      std::vector<Range> ranges;
+      for (const auto& data : in_) {
+        ranges.push_back(Range{0, data->child_data[i]->length});
+      }
+      std::shared_ptr<ArrayData> child;
+      RETURN_NOT_OK(ConcatenateChildren(i, ranges, &child));
+      child_data_.push_back(child);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    std::stringstream ss;
+    ss << "Concatenation of " << type.ToString() << " arrays is not supported";
+    return Status::NotImplemented(ss.str());
+  }
+
+ private:
+  // A range of the values of an input, or of its children
+  struct Range {
+    int64_t offset;
+    int64_t length;
+  };
+
+  template <typename OffsetType>
+  Status ConcatenateBinary() {
+    std::vector<Range> ranges;
+    RETURN_NOT_OK(ConcatenateOffsets<OffsetType>(&buffers_[1], &ranges));
+    int64_t data_length = 0;
+    for (const auto& range : ranges) {
+      data_length += range.length;
+    }
+    RETURN_NOT_OK(AllocateBuffer(pool_, data_length, &buffers_[2]));
+    uint8_t* out_data = buffers_[2]->mutable_data();
+    for (size_t i = 0; i < in_.size(); ++i) {
+      if (ranges[i].length > 0) {
+        memcpy(out_data, in_[i]->buffers[2]->data() + ranges[i].offset,
+               static_cast<size_t>(ranges[i].length));
+        out_data += ranges[i].length;
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename OffsetType>
+  Status ConcatenateList() {
+    std::vector<Range> ranges;
+    RETURN_NOT_OK(ConcatenateOffsets<OffsetType>(&buffers_[1], &ranges));
+    std::shared_ptr<ArrayData> values;
+    RETURN_NOT_OK(ConcatenateChildren(0, ranges, &values));
+    child_data_.push_back(values);
+    return Status::OK();
+  }
+
+  // The ranges of the children covering the slots of the inputs
+  std::vector<Range> SlotRanges() const {
+    std::vector<Range> ranges;
+    for (const auto& data : in_) {
+      ranges.push_back(Range{data->offset, data->length});
+    }
+    return ranges;
+  }
+
+  Status ConcatenateBitmaps(int buffer_index, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, length_, out));
+    uint8_t* out_data = (*out)->mutable_data();
+    int64_t position = 0;
+    for (const auto& data : in_) {
+      const Buffer* bitmap = data->buffers[buffer_index].get();
+      if (bitmap != nullptr) {
+        CopyBitmap(bitmap->data(), data->offset, data->length, out_data, position);
+      } else {
+        SetBits(out_data, position, data->length);
+      }
+      position += data->length;
+    }
+    return Status::OK();
+  }
+
+  Status ConcatenateFixedWidth(int buffer_index, int byte_width,
+                               std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, length_ * byte_width, out));
+    uint8_t* out_data = (*out)->mutable_data();
+    for (const auto& data : in_) {
+      if (data->length > 0) {
+        const int64_t size = data->length * byte_width;
+        memcpy(out_data, data->buffers[buffer_index]->data() + data->offset * byte_width,
+               static_cast<size_t>(size));
+        out_data += size;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Concatenate int32 or int64 offsets, rebasing those of each input to
+  // where its values start in the result. The ranges of values of the
+  // inputs are returned.
+  template <typename OffsetType>
+  Status ConcatenateOffsets(std::shared_ptr<Buffer>* out, std::vector<Range>* ranges) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, (length_ + 1) * sizeof(OffsetType), out));
+    auto out_offsets = reinterpret_cast<OffsetType*>((*out)->mutable_data());
+    int64_t values_length = 0;
+    for (const auto& data : in_) {
+      if (data->length == 0) {
+        ranges->push_back(Range{0, 0});
+        continue;
+      }
+      const OffsetType* offsets = GetValues<OffsetType>(*data, 1);
+      const OffsetType first = offsets[0];
+      const OffsetType last = offsets[data->length];
+      if (ARROW_PREDICT_FALSE(values_length + (last - first) >
+                              std::numeric_limits<OffsetType>::max())) {
+        return Status::Invalid("Concatenated array is too large for int32 offsets");
+      }
+      const auto delta = static_cast<OffsetType>(values_length - first);
+      for (int64_t i = 0; i < data->length; ++i) {
+        out_offsets[i] = offsets[i] + delta;
+      }
+      out_offsets += data->length;
+      ranges->push_back(Range{first, last - first});
+      values_length += last - first;
+    }
+    *out_offsets = static_cast<OffsetType>(values_length);
+    return Status::OK();
+  }
+
+  // Concatenate the given ranges of the children at an index of the inputs
+  Status ConcatenateChildren(int child_index, const std::vector<Range>& ranges,
+                             std::shared_ptr<ArrayData>* out) const {
+    std::vector<std::shared_ptr<Array>> children;
+    for (size_t i = 0; i < in_.size(); ++i) {
+      const auto child = MakeArray(in_[i]->child_data[child_index]);
+      children.push_back(child->Slice(ranges[i].offset, ranges[i].length));
+    }
+    return ConcatenateImpl(children, pool_).Concatenate(out);
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> in_;
+  MemoryPool* pool_;
+  int64_t length_;
+  int64_t null_count_;
+  std::vector<std::shared_ptr<Buffer>> buffers_;
+  std::vector<std::shared_ptr<ArrayData>> child_data_;
+};
+
+}  // namespace
+
+Status Concatenate(const std::vector<std::shared_ptr<Array>>& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out) {
+  if (arrays.empty()) {
+    return Status::Invalid("Must pass at least one array");
+  }
+  for (const auto& array : arrays) {
+    if (!array->type()->Equals(*arrays[0]->type())) {
+      std::stringstream ss;
+      ss << "Cannot concatenate arrays of types " << arrays[0]->type()->ToString()
+         << " and " << array->type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(ConcatenateImpl(arrays, pool).Concatenate(&result));
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+Status Concatenate(const ChunkedArray& chunked_array, MemoryPool* pool,
+                   std::shared_ptr<Array>* out) {
+  if (chunked_array.num_chunks() == 0) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(pool, chunked_array.type(), &builder));
+    return builder->Finish(out);
+  }
+  return Concatenate(chunked_array.chunks(), pool, out);
+}
+
+}  // namespace arrow
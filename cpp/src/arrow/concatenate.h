@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Concatenation of arrays into one contiguous array
+
+#ifndef ARROW_CONCATENATE_H
+#define ARROW_CONCATENATE_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class ChunkedArray;
+class MemoryPool;
+class Status;
+
+/// \brief Concatenate arrays of the same type into one array
+///
+/// Each buffer of the result is sized up front and allocated once. Values
+/// are copied in bulk: bitmaps are shifted a word at a time and offsets
+/// are rebased in one pass per array. All types of type.h are supported
+/// except intervals.
+///
+/// \param[in] arrays the arrays, at least one, all of the same type
+/// \param[in] pool memory pool to allocate the result from
+/// \param[out] out the resulting array, with no offset
+ARROW_EXPORT
+Status Concatenate(const std::vector<std::shared_ptr<Array>>& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out);
+
+/// \brief Concatenate the chunks of a chunked array into one array
+///
+/// A chunked array with no chunks gives an empty array of its type.
+ARROW_EXPORT
+Status Concatenate(const ChunkedArray& chunked_array, MemoryPool* pool,
+                   std::shared_ptr<Array>* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_CONCATENATE_H
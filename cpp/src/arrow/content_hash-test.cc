@@ -0,0 +1,259 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/concatenate.h"
+#include "arrow/content_hash.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+static constexpr int64_t kLength = 300;
+
+class TestContentHash : public ::testing::Test {
+ protected:
+  void SetUp() {
+    random_is_valid(kLength, 0.2, &is_valid_);
+    // A stretch of blocks of 64 slots without nulls
+    std::fill(is_valid_.begin() + 64, is_valid_.begin() + 192, true);
+  }
+
+  uint64_t Hash(const Array& array) {
+    uint64_t hash = 0;
+    ABORT_NOT_OK(HashArray(array, &hash));
+    return hash;
+  }
+
+  std::shared_ptr<Array> MakeInts(int32_t start = 0) {
+    std::vector<int32_t> values(kLength);
+    std::iota(values.begin(), values.end(), start);
+    std::shared_ptr<Array> array;
+    ArrayFromVector<Int32Type, int32_t>(is_valid_, values, &array);
+    return array;
+  }
+
+  template <typename TYPE = StringType>
+  std::shared_ptr<Array> MakeStrings() {
+    std::vector<std::string> values;
+    for (int64_t i = 0; i < kLength; ++i) {
+      values.push_back(std::string(static_cast<size_t>(i % 7), 'a' + i % 26));
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<TYPE, std::string>(is_valid_, values, &array);
+    return array;
+  }
+
+  std::vector<std::shared_ptr<Array>> MakeArrays() {
+    std::vector<std::shared_ptr<Array>> arrays = {MakeInts(), MakeStrings(),
+                                                  MakeStrings<LargeBinaryType>()};
+
+    std::vector<bool> bools;
+    std::vector<double> doubles;
+    for (int64_t i = 0; i < kLength; ++i) {
+      bools.push_back(i % 3 == 0);
+      doubles.push_back(static_cast<double>(i) / 4);
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<BooleanType, bool>(is_valid_, bools, &array);
+    arrays.push_back(array);
+    ArrayFromVector<DoubleType, double>(is_valid_, doubles, &array);
+    arrays.push_back(array);
+
+    FixedSizeBinaryBuilder fsb_builder(fixed_size_binary(3));
+    ListBuilder list_builder(default_memory_pool(), std::make_shared<Int16Builder>());
+    auto& list_values = static_cast<Int16Builder&>(*list_builder.value_builder());
+    LargeListBuilder large_list_builder(default_memory_pool(),
+                                        std::make_shared<Int16Builder>());
+    auto& large_list_values =
+        static_cast<Int16Builder&>(*large_list_builder.value_builder());
+    for (int64_t i = 0; i < kLength; ++i) {
+      if (is_valid_[i]) {
+        ABORT_NOT_OK(fsb_builder.Append(std::to_string(100 + i % 900).data()));
+        ABORT_NOT_OK(list_builder.Append());
+        ABORT_NOT_OK(large_list_builder.Append());
+        for (int64_t j = 0; j < i % 4; ++j) {
+          ABORT_NOT_OK(list_values.Append(static_cast<int16_t>(i + j)));
+          ABORT_NOT_OK(large_list_values.Append(static_cast<int16_t>(i + j)));
+        }
+      } else {
+        ABORT_NOT_OK(fsb_builder.AppendNull());
+        ABORT_NOT_OK(list_builder.AppendNull());
+        ABORT_NOT_OK(large_list_builder.AppendNull());
+      }
+    }
+    ABORT_NOT_OK(fsb_builder.Finish(&array));
+    arrays.push_back(array);
+    ABORT_NOT_OK(list_builder.Finish(&array));
+    arrays.push_back(array);
+    ABORT_NOT_OK(large_list_builder.Finish(&array));
+    arrays.push_back(array);
+
+    std::shared_ptr<Buffer> null_bitmap;
+    std::vector<bool> struct_valid(is_valid_.rbegin(), is_valid_.rend());
+    ABORT_NOT_OK(GetBitmapFromVector(struct_valid, &null_bitmap));
+    arrays.push_back(std::make_shared<StructArray>(
+        struct_({field("a", int32()), field("b", utf8())}), kLength,
+        std::vector<std::shared_ptr<Array>>{MakeInts(), MakeStrings()}, null_bitmap));
+
+    std::shared_ptr<Array> dict;
+    ArrayFromVector<Int32Type, int32_t>({10, 20, 30}, &dict);
+    std::vector<int8_t> indices;
+    randint<int32_t, int8_t>(kLength, 0, 2, &indices);
+    ArrayFromVector<Int8Type, int8_t>(is_valid_, indices, &array);
+    arrays.push_back(std::make_shared<DictionaryArray>(dictionary(int8(), dict), array));
+
+    arrays.push_back(std::make_shared<NullArray>(kLength));
+    return arrays;
+  }
+
+  std::vector<bool> is_valid_;
+};
+
+TEST_F(TestContentHash, LayoutIndependent) {
+  for (const auto& array : MakeArrays()) {
+    const uint64_t hash = Hash(*array);
+    ASSERT_EQ(hash, Hash(*array));
+
+    // A copy with other buffers
+    std::shared_ptr<Array> copy;
+    ASSERT_OK(Concatenate({array->Slice(0, 7), array->Slice(7)}, default_memory_pool(),
+                          &copy));
+    ASSERT_TRUE(array->Equals(copy));
+    ASSERT_EQ(hash, Hash(*copy)) << array->type()->ToString();
+
+    // Slices at an offset, and their copies without one
+    for (int64_t offset : {1, 5, 64, 130}) {
+      auto slice = array->Slice(offset, 150);
+      ASSERT_OK(Concatenate({slice}, default_memory_pool(), &copy));
+      ASSERT_EQ(0, copy->offset());
+      ASSERT_EQ(Hash(*slice), Hash(*copy)) << array->type()->ToString() << " " << offset;
+      if (array->type_id() != Type::NA) {
+        ASSERT_NE(hash, Hash(*slice)) << array->type()->ToString();
+        ASSERT_NE(Hash(*slice), Hash(*array->Slice(offset + 1, 150)))
+            << array->type()->ToString();
+      }
+    }
+  }
+}
+
+TEST_F(TestContentHash, NullSlots) {
+  // Values of null slots are not hashed
+  std::vector<int32_t> values, other_values;
+  for (int32_t i = 0; i < kLength; ++i) {
+    values.push_back(i);
+    other_values.push_back(is_valid_[i] ? i : -1);
+  }
+  std::shared_ptr<Array> array, other;
+  ArrayFromVector<Int32Type, int32_t>(is_valid_, values, &array);
+  ArrayFromVector<Int32Type, int32_t>(is_valid_, other_values, &other);
+  ASSERT_TRUE(array->Equals(other));
+  ASSERT_EQ(Hash(*array), Hash(*other));
+
+  // A null bitmap with all bits set hashes as no bitmap
+  std::fill(is_valid_.begin(), is_valid_.end(), true);
+  auto with_bitmap = MakeInts()->data()->Copy();
+  with_bitmap->null_count = kUnknownNullCount;
+  ASSERT_NE(nullptr, with_bitmap->buffers[0]);
+  auto without_bitmap = MakeInts()->data()->Copy();
+  without_bitmap->buffers[0] = nullptr;
+  without_bitmap->null_count = 0;
+  ASSERT_EQ(Hash(*MakeArray(with_bitmap)), Hash(*MakeArray(without_bitmap)));
+}
+
+TEST_F(TestContentHash, Distinct) {
+  auto ints = MakeInts();
+  std::shared_ptr<Array> uints;
+  std::vector<int32_t> values(kLength);
+  std::iota(values.begin(), values.end(), 0);
+  ArrayFromVector<UInt32Type, uint32_t>(
+      is_valid_, std::vector<uint32_t>(values.begin(), values.end()), &uints);
+  ASSERT_NE(Hash(*ints), Hash(*uints));
+
+  // A single value changed, or a null moved
+  values[100] = -1;
+  std::shared_ptr<Array> changed;
+  ArrayFromVector<Int32Type, int32_t>(is_valid_, values, &changed);
+  values[100] = 100;
+  ASSERT_NE(Hash(*ints), Hash(*changed));
+  is_valid_[100] = false;
+  ArrayFromVector<Int32Type, int32_t>(is_valid_, values, &changed);
+  ASSERT_NE(Hash(*ints), Hash(*changed));
+
+  // Strings split differently
+  std::shared_ptr<Array> left, right;
+  ArrayFromVector<StringType, std::string>({"ab", "c"}, &left);
+  ArrayFromVector<StringType, std::string>({"a", "bc"}, &right);
+  ASSERT_NE(Hash(*left), Hash(*right));
+}
+
+TEST_F(TestContentHash, Unsupported) {
+  std::shared_ptr<Array> type_ids, sparse;
+  ArrayFromVector<Int8Type, int8_t>({0, 0}, &type_ids);
+  ASSERT_OK(UnionArray::MakeSparse(*type_ids, {MakeInts()->Slice(0, 2)}, &sparse));
+  uint64_t hash;
+  ASSERT_RAISES(NotImplemented, HashArray(*sparse, &hash));
+}
+
+TEST_F(TestContentHash, ChunkedArrayAndTable) {
+  auto ints = MakeInts();
+  auto strings = MakeStrings();
+  auto chunked_ints = std::make_shared<ChunkedArray>(
+      ArrayVector{ints->Slice(0, 100), ints->Slice(100)});
+  auto chunked_strings = std::make_shared<ChunkedArray>(
+      ArrayVector{strings->Slice(0, 10), strings->Slice(10, 200), strings->Slice(210)});
+
+  uint64_t serial, threaded;
+  ASSERT_OK(HashChunkedArray(*chunked_ints, false, &serial));
+  ASSERT_OK(HashChunkedArray(*chunked_ints, true, &threaded));
+  ASSERT_EQ(serial, threaded);
+  ChunkedArray empty(ArrayVector{}, int32());
+  ASSERT_OK(HashChunkedArray(empty, true, &threaded));
+  ASSERT_NE(serial, threaded);
+
+  auto schema = ::arrow::schema({field("ints", int32()), field("strings", utf8())});
+  auto table = Table::Make(
+      schema, {std::make_shared<Column>(schema->field(0), chunked_ints),
+               std::make_shared<Column>(schema->field(1), chunked_strings)});
+  ASSERT_OK(HashTable(*table, false, &serial));
+  ASSERT_OK(HashTable(*table, true, &threaded));
+  ASSERT_EQ(serial, threaded);
+
+  // Same chunks in another order
+  auto swapped = Table::Make(
+      schema, {std::make_shared<Column>(schema->field(0), chunked_ints),
+               std::make_shared<Column>(
+                   schema->field(1),
+                   std::make_shared<ChunkedArray>(ArrayVector{
+                       strings->Slice(10, 200), strings->Slice(0, 10),
+                       strings->Slice(210)}))});
+  ASSERT_OK(HashTable(*swapped, true, &threaded));
+  ASSERT_NE(serial, threaded);
+}
+
+}  // namespace arrow
@@ -0,0 +1,345 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/content_hash.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BitBlockCount;
+using internal::BitBlockCounter;
+
+namespace {
+
+constexpr uint64_t kSeed = 0x9e3779b97f4a7c15ULL;
+
+// Fold a value into a running hash, as MurmurHash2_64 does with each word
+inline void Combine(uint64_t value, uint64_t* hash) {
+  value *= HashUtil::MURMUR_PRIME;
+  value ^= value >> HashUtil::MURMUR_R;
+  value *= HashUtil::MURMUR_PRIME;
+  *hash ^= value;
+  *hash *= HashUtil::MURMUR_PRIME;
+}
+
+inline uint64_t HashBytes(const void* data, int64_t length) {
+  return HashUtil::MurmurHash2_64(data, static_cast<int>(length), kSeed);
+}
+
+inline uint64_t HashString(const std::string& value) {
+  return HashBytes(value.data(), static_cast<int64_t>(value.size()));
+}
+
+// Hash the values of a range of slots of an array, without its type.
+//
+// Slots are visited in blocks of 64 from the start of the range, so that
+// the hash does not depend on the offset of the range. The validity of a
+// block with nulls is hashed as a 64-bit mask, and values are hashed only
+// for valid slots: whole blocks without nulls at once, null slots zeroed
+// or skipped otherwise. Nested values are hashed per run of valid slots.
+class RangeHasher {
+ public:
+  RangeHasher(const ArrayData& data, int64_t offset, int64_t length)
+      : data_(data),
+        offset_(data.offset + offset),
+        length_(length),
+        validity_(data.null_count != 0 && data.buffers[0] ? data.buffers[0]->data()
+                                                           : nullptr),
+        hash_(kSeed) {}
+
+  Status Hash(uint64_t* out) {
+    Combine(static_cast<uint64_t>(length_), &hash_);
+    RETURN_NOT_OK(VisitTypeInline(*data_.type, this));
+    *out = hash_;
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* values = GetBuffer(1);
+    VisitBlocks([&](int64_t position, const BitBlockCount& block, uint64_t mask) {
+      uint64_t word = 0;
+      internal::BitmapReader reader(values, offset_ + position, block.length);
+      for (int64_t i = 0; i < block.length; ++i) {
+        word |= static_cast<uint64_t>(reader.IsSet()) << i;
+        reader.Next();
+      }
+      Combine(word & mask, &hash_);
+    });
+    return Status::OK();
+  }
+
+  // Primitive, fixed size binary, decimal and interval types
+  Status Visit(const FixedWidthType& type) {
+    const int64_t byte_width = type.bit_width() / 8;
+    const uint8_t* values = GetBuffer(1) + offset_ * byte_width;
+    std::vector<uint8_t> scratch;
+    VisitBlocks([&](int64_t position, const BitBlockCount& block, uint64_t mask) {
+      const uint8_t* block_values = values + position * byte_width;
+      if (block.AllSet()) {
+        Combine(HashBytes(block_values, block.length * byte_width), &hash_);
+      } else if (!block.NoneSet()) {
+        scratch.assign(block_values, block_values + block.length * byte_width);
+        // Zero the null slots
+        uint64_t nulls = ~mask & (~static_cast<uint64_t>(0) >> (64 - block.length));
+        while (nulls != 0) {
+          const int i = BitUtil::CountTrailingZeros(nulls);
+          memset(scratch.data() + i * byte_width, 0, static_cast<size_t>(byte_width));
+          nulls &= nulls - 1;
+        }
+        Combine(HashBytes(scratch.data(), block.length * byte_width), &hash_);
+      }
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    uint64_t dictionary_hash;
+    RETURN_NOT_OK(HashArray(*type.dictionary(), &dictionary_hash));
+    Combine(dictionary_hash, &hash_);
+    return Visit(static_cast<const FixedWidthType&>(type));
+  }
+
+  Status Visit(const BinaryType&) { return HashBinary<int32_t>(); }
+
+  Status Visit(const LargeBinaryType&) { return HashBinary<int64_t>(); }
+
+  Status Visit(const ListType&) { return HashList<int32_t>(); }
+
+  Status Visit(const LargeListType&) { return HashList<int64_t>(); }
+
+  Status Visit(const StructType&) {
+    return VisitValidRuns([&](int64_t position, int64_t length, uint64_t) {
+      for (const auto& child : data_.child_data) {
+        RETURN_NOT_OK(HashChild(*child, offset_ + position, length));
+      }
+      return Status::OK();
+    });
+  }
+
+  Status Visit(const DataType& type) {
+    std::stringstream ss;
+    ss << "Hashing of " << type.ToString() << " arrays is not supported";
+    return Status::NotImplemented(ss.str());
+  }
+
+ private:
+  template <typename OffsetType>
+  Status HashBinary() {
+    const OffsetType* offsets = GetOffsets<OffsetType>();
+    const uint8_t* values = GetBuffer(2);
+    std::string scratch;
+    VisitBlocks([&](int64_t position, const BitBlockCount& block, uint64_t mask) {
+      if (block.NoneSet()) {
+        return;
+      }
+      HashLengths(offsets + position, block.length, mask);
+      if (block.AllSet()) {
+        const OffsetType start = offsets[position];
+        Combine(HashBytes(values + start, offsets[position + block.length] - start),
+                &hash_);
+      } else {
+        // The values of runs of valid slots are contiguous
+        scratch.clear();
+        uint64_t word = mask;
+        while (word != 0) {
+          const int start = BitUtil::CountTrailingZeros(word);
+          const int end = start + BitUtil::CountTrailingZeros(~(word >> start));
+          const OffsetType first = offsets[position + start];
+          scratch.append(reinterpret_cast<const char*>(values) + first,
+                         static_cast<size_t>(offsets[position + end] - first));
+          word = end < 64 ? word & (~static_cast<uint64_t>(0) << end) : 0;
+        }
+        Combine(HashString(scratch), &hash_);
+      }
+    });
+    return Status::OK();
+  }
+
+  template <typename OffsetType>
+  Status HashList() {
+    const OffsetType* offsets = GetOffsets<OffsetType>();
+    const ArrayData& values = *data_.child_data[0];
+    return VisitValidRuns([&](int64_t position, int64_t length, uint64_t mask) {
+      HashLengths(offsets + position, length, mask);
+      return HashChild(values, offsets[position],
+                       offsets[position + length] - offsets[position]);
+    });
+  }
+
+  const uint8_t* GetBuffer(int index) const {
+    const auto& buffer = data_.buffers[index];
+    return buffer ? buffer->data() : nullptr;
+  }
+
+  template <typename OffsetType>
+  const OffsetType* GetOffsets() const {
+    return reinterpret_cast<const OffsetType*>(GetBuffer(1)) + offset_;
+  }
+
+  // Call `visit(position, block, mask)` on each block of up to 64 slots of
+  // the range, with the validity of the slots of the block as a mask.
+  // Masks of blocks with nulls are hashed.
+  template <typename VisitBlock>
+  void VisitBlocks(VisitBlock&& visit) {
+    BitBlockCounter counter(validity_, offset_, length_);
+    for (int64_t position = 0; position < length_;) {
+      const BitBlockCount block = counter.NextWord();
+      uint64_t mask = ~static_cast<uint64_t>(0);
+      if (!block.AllSet()) {
+        mask = internal::ReadBitmapWord(validity_, offset_ + position, block.length);
+        Combine(mask, &hash_);
+      }
+      visit(position, block, mask);
+      position += block.length;
+    }
+  }
+
+  // Call `visit(position, length, mask)` on each run of valid slots within
+  // blocks of 64 slots, with the validity of the slots from the position
+  // as a mask
+  template <typename VisitRun>
+  Status VisitValidRuns(VisitRun&& visit) {
+    Status status;
+    VisitBlocks([&](int64_t position, const BitBlockCount& block, uint64_t mask) {
+      if (block.AllSet()) {
+        status &= visit(position, block.length, mask);
+      } else {
+        uint64_t word = mask;
+        while (word != 0 && status.ok()) {
+          const int start = BitUtil::CountTrailingZeros(word);
+          const int end = start + BitUtil::CountTrailingZeros(~(word >> start));
+          status &= visit(position + start, end - start, word >> start);
+          word = end < 64 ? word & (~static_cast<uint64_t>(0) << end) : 0;
+        }
+      }
+    });
+    return status;
+  }
+
+  // The lengths of the valid slots, from their offsets
+  template <typename OffsetType>
+  void HashLengths(const OffsetType* offsets, int64_t length, uint64_t mask) {
+    OffsetType lengths[64];
+    for (int64_t i = 0; i < length; ++i) {
+      lengths[i] = ((mask >> i) & 1) ? offsets[i + 1] - offsets[i] : 0;
+    }
+    Combine(HashBytes(lengths, length * sizeof(OffsetType)), &hash_);
+  }
+
+  // `offset` is a slot index of the child, as list offsets are
+  Status HashChild(const ArrayData& child, int64_t offset, int64_t length) {
+    uint64_t child_hash;
+    RETURN_NOT_OK(RangeHasher(child, offset, length).Hash(&child_hash));
+    Combine(child_hash, &hash_);
+    return Status::OK();
+  }
+
+  const ArrayData& data_;
+  // Offset of the range in the buffers of the array
+  const int64_t offset_;
+  const int64_t length_;
+  const uint8_t* validity_;
+  uint64_t hash_;
+};
+
+// Hash arrays independently, on the CPU thread pool if use_threads is true
+Status HashArrays(const std::vector<const Array*>& arrays, bool use_threads,
+                  std::vector<uint64_t>* hashes) {
+  hashes->resize(arrays.size());
+  auto hash_array = [&](int i) { return HashArray(*arrays[i], &(*hashes)[i]); };
+  if (use_threads) {
+    return ParallelFor(static_cast<int>(arrays.size()), hash_array);
+  }
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    RETURN_NOT_OK(hash_array(static_cast<int>(i)));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status HashArray(const Array& array, uint64_t* out) {
+  const ArrayData& data = *array.data();
+  uint64_t values_hash;
+  RETURN_NOT_OK(RangeHasher(data, 0, data.length).Hash(&values_hash));
+  uint64_t hash = HashString(data.type->ToString());
+  Combine(values_hash, &hash);
+  *out = hash;
+  return Status::OK();
+}
+
+Status HashChunkedArray(const ChunkedArray& array, bool use_threads, uint64_t* out) {
+  std::vector<const Array*> chunks;
+  for (const auto& chunk : array.chunks()) {
+    chunks.push_back(chunk.get());
+  }
+  std::vector<uint64_t> hashes;
+  RETURN_NOT_OK(HashArrays(chunks, use_threads, &hashes));
+
+  uint64_t hash = HashString(array.type()->ToString());
+  Combine(static_cast<uint64_t>(hashes.size()), &hash);
+  for (uint64_t chunk_hash : hashes) {
+    Combine(chunk_hash, &hash);
+  }
+  *out = hash;
+  return Status::OK();
+}
+
+Status HashTable(const Table& table, bool use_threads, uint64_t* out) {
+  // All chunks of all columns are hashed at once
+  std::vector<const Array*> chunks;
+  for (int i = 0; i < table.num_columns(); ++i) {
+    for (const auto& chunk : table.column(i)->data()->chunks()) {
+      chunks.push_back(chunk.get());
+    }
+  }
+  std::vector<uint64_t> hashes;
+  RETURN_NOT_OK(HashArrays(chunks, use_threads, &hashes));
+
+  uint64_t hash = HashString(table.schema()->ToString());
+  Combine(static_cast<uint64_t>(table.num_rows()), &hash);
+  size_t chunk_index = 0;
+  for (int i = 0; i < table.num_columns(); ++i) {
+    const int num_chunks = table.column(i)->data()->num_chunks();
+    Combine(static_cast<uint64_t>(num_chunks), &hash);
+    for (int j = 0; j < num_chunks; ++j) {
+      Combine(hashes[chunk_index++], &hash);
+    }
+  }
+  *out = hash;
+  return Status::OK();
+}
+
+}  // namespace arrow
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Hashing of the contents of Arrow data structures
+
+#ifndef ARROW_CONTENT_HASH_H
+#define ARROW_CONTENT_HASH_H
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class ChunkedArray;
+class Status;
+class Table;
+
+/// \brief Compute a 64-bit hash of the type and values of an array
+///
+/// Arrays equal by ArrayEquals hash equal: the hash does not depend on the
+/// offset of the array, on whether it has a null bitmap, or on the values of
+/// null slots. Values are hashed as bytes, so floating point values are
+/// hashed bitwise, as they are compared by ArrayEquals. Slots are hashed
+/// in blocks of 64, and the values of blocks without nulls are hashed with
+/// one call of HashUtil::MurmurHash2_64. Union arrays are not supported.
+///
+/// The hash is not a checksum and is not stable across releases; it is
+/// meant as an in-process cache key.
+///
+/// \param[in] array the array to hash
+/// \param[out] out the hash
+ARROW_EXPORT
+Status HashArray(const Array& array, uint64_t* out);
+
+/// \brief Compute a 64-bit hash of the type and chunks of a chunked array
+///
+/// Chunks are hashed independently, in parallel when use_threads is true,
+/// and the hashes combined in order. The hash thus depends on how the values
+/// are split in chunks.
+ARROW_EXPORT
+Status HashChunkedArray(const ChunkedArray& array, bool use_threads, uint64_t* out);
+
+/// \brief Compute a 64-bit hash of the schema and columns of a table
+///
+/// All chunks of all columns are hashed independently, in parallel when
+/// use_threads is true. As for chunked arrays, the hash depends on the
+/// chunk layout of the columns.
+ARROW_EXPORT
+Status HashTable(const Table& table, bool use_threads, uint64_t* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_CONTENT_HASH_H
@@ -0,0 +1,301 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/converter.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/csv/parser.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+namespace csv {
+
+using ::arrow::internal::StringConverter;
+
+namespace {
+
+// Matches unquoted values against the null values of the options
+class NullMatcher {
+ public:
+  explicit NullMatcher(const std::vector<std::string>& null_values) {
+    for (const auto& value : null_values) {
+      if (value.size() >= by_size_.size()) {
+        by_size_.resize(value.size() + 1);
+      }
+      by_size_[value.size()].push_back(value);
+    }
+  }
+
+  bool Matches(const uint8_t* data, uint32_t size, bool quoted) const {
+    if (quoted || size >= by_size_.size()) {
+      return false;
+    }
+    for (const auto& value : by_size_[size]) {
+      if (memcmp(value.data(), data, size) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  // Null values indexed by their length
+  std::vector<std::vector<std::string>> by_size_;
+};
+
+// StringConverter is not thread-safe, so one is made for each conversion
+template <typename ArrowType>
+struct StringConverterFactory {
+  static StringConverter<ArrowType>* Make(const std::shared_ptr<DataType>&) {
+    return new StringConverter<ArrowType>();
+  }
+};
+
+template <>
+struct StringConverterFactory<TimestampType> {
+  static StringConverter<TimestampType>* Make(const std::shared_ptr<DataType>& type) {
+    return new StringConverter<TimestampType>(type);
+  }
+};
+
+Status ConversionError(const DataType& type, int64_t row, const uint8_t* data,
+                       uint32_t size) {
+  std::stringstream ss;
+  ss << "CSV conversion error to " << type.ToString() << " in row " << row
+     << ": invalid value '" << std::string(reinterpret_cast<const char*>(data), size)
+     << "'";
+  return Status::Invalid(ss.str());
+}
+
+class NullConverter : public Converter {
+ public:
+  NullConverter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+                MemoryPool* pool)
+      : Converter(type, options, pool), nulls_(options.null_values) {}
+
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override {
+    int64_t row = 0;
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (ARROW_PREDICT_FALSE(!nulls_.Matches(data, size, quoted))) {
+        return ConversionError(*type_, row, data, size);
+      }
+      ++row;
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+    *out = std::make_shared<NullArray>(parser.num_rows());
+    return Status::OK();
+  }
+
+ private:
+  NullMatcher nulls_;
+};
+
+// Boolean, numeric, date and timestamp values, parsed by StringConverter
+template <typename ArrowType>
+class PrimitiveConverter : public Converter {
+ public:
+  PrimitiveConverter(const std::shared_ptr<DataType>& type,
+                     const ConvertOptions& options, MemoryPool* pool)
+      : Converter(type, options, pool), nulls_(options.null_values) {}
+
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override {
+    using BuilderType = typename TypeTraits<ArrowType>::BuilderType;
+    using value_type = typename StringConverter<ArrowType>::value_type;
+
+    BuilderType builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+    std::unique_ptr<StringConverter<ArrowType>> converter(
+        StringConverterFactory<ArrowType>::Make(type_));
+
+    int64_t row = 0;
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      value_type value;
+      if (nulls_.Matches(data, size, quoted)) {
+        RETURN_NOT_OK(builder.AppendNull());
+      } else if (ARROW_PREDICT_TRUE(
+                     (*converter)(reinterpret_cast<const char*>(data), size, &value))) {
+        RETURN_NOT_OK(builder.Append(value));
+      } else {
+        return ConversionError(*type_, row, data, size);
+      }
+      ++row;
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+    return builder.Finish(out);
+  }
+
+ private:
+  NullMatcher nulls_;
+};
+
+class BinaryConverter : public Converter {
+ public:
+  BinaryConverter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+                  MemoryPool* pool)
+      : Converter(type, options, pool), nulls_(options.null_values) {}
+
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override {
+    // Size the value data up front
+    int64_t data_size = 0;
+    auto measure = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (!nulls_.Matches(data, size, quoted)) {
+        data_size += size;
+      }
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col_index, measure));
+
+    BinaryBuilder builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+    RETURN_NOT_OK(builder.ReserveData(data_size));
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (nulls_.Matches(data, size, quoted)) {
+        return builder.AppendNull();
+      }
+      return builder.Append(data, static_cast<int32_t>(size));
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+    return builder.Finish(out);
+  }
+
+ private:
+  NullMatcher nulls_;
+};
+
+// Whether all values of a column are null or parse as the given type
+template <typename ArrowType>
+bool AllConvertible(const std::vector<std::shared_ptr<BlockParser>>& parsers,
+                    int32_t col_index, const NullMatcher& nulls,
+                    const std::shared_ptr<DataType>& type) {
+  std::unique_ptr<StringConverter<ArrowType>> converter(
+      StringConverterFactory<ArrowType>::Make(type));
+  typename StringConverter<ArrowType>::value_type value;
+  auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+    if (nulls.Matches(data, size, quoted) ||
+        (*converter)(reinterpret_cast<const char*>(data), size, &value)) {
+      return Status::OK();
+    }
+    // Stop at the first value which does not parse
+    return Status::Invalid("");
+  };
+  for (const auto& parser : parsers) {
+    if (!parser->VisitColumn(col_index, visit).ok()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool AllNull(const std::vector<std::shared_ptr<BlockParser>>& parsers,
+             int32_t col_index, const NullMatcher& nulls) {
+  auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+    return nulls.Matches(data, size, quoted) ? Status::OK() : Status::Invalid("");
+  };
+  for (const auto& parser : parsers) {
+    if (!parser->VisitColumn(col_index, visit).ok()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Converter::Converter(const std::shared_ptr<DataType>& type,
+                     const ConvertOptions& options, MemoryPool* pool)
+    : type_(type), options_(options), pool_(pool) {}
+
+Status Converter::Make(const std::shared_ptr<DataType>& type,
+                       const ConvertOptions& options, MemoryPool* pool,
+                       std::shared_ptr<Converter>* out) {
+  switch (type->id()) {
+#define CONVERTER_CASE(TYPE_ID, CONVERTER_TYPE)                      \
+  case Type::TYPE_ID:                                                \
+    *out = std::make_shared<CONVERTER_TYPE>(type, options, pool);    \
+    break;
+
+    CONVERTER_CASE(NA, NullConverter)
+    CONVERTER_CASE(BOOL, PrimitiveConverter<BooleanType>)
+    CONVERTER_CASE(UINT8, PrimitiveConverter<UInt8Type>)
+    CONVERTER_CASE(INT8, PrimitiveConverter<Int8Type>)
+    CONVERTER_CASE(UINT16, PrimitiveConverter<UInt16Type>)
+    CONVERTER_CASE(INT16, PrimitiveConverter<Int16Type>)
+    CONVERTER_CASE(UINT32, PrimitiveConverter<UInt32Type>)
+    CONVERTER_CASE(INT32, PrimitiveConverter<Int32Type>)
+    CONVERTER_CASE(UINT64, PrimitiveConverter<UInt64Type>)
+    CONVERTER_CASE(INT64, PrimitiveConverter<Int64Type>)
+    CONVERTER_CASE(FLOAT, PrimitiveConverter<FloatType>)
+    CONVERTER_CASE(DOUBLE, PrimitiveConverter<DoubleType>)
+    CONVERTER_CASE(DATE32, PrimitiveConverter<Date32Type>)
+    CONVERTER_CASE(TIMESTAMP, PrimitiveConverter<TimestampType>)
+    CONVERTER_CASE(BINARY, BinaryConverter)
+    CONVERTER_CASE(STRING, BinaryConverter)
+
+#undef CONVERTER_CASE
+
+    default: {
+      std::stringstream ss;
+      ss << "CSV conversion to " << type->ToString() << " is not supported";
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+Status InferColumnType(const std::vector<std::shared_ptr<BlockParser>>& parsers,
+                       int32_t col_index, const ConvertOptions& options,
+                       std::shared_ptr<DataType>* out) {
+  // Each candidate type is tried over all values in turn; a column usually
+  // fails a candidate early on
+  const NullMatcher nulls(options.null_values);
+  if (AllNull(parsers, col_index, nulls)) {
+    *out = null();
+  } else if (AllConvertible<Int64Type>(parsers, col_index, nulls, int64())) {
+    *out = int64();
+  } else if (AllConvertible<BooleanType>(parsers, col_index, nulls, boolean())) {
+    *out = boolean();
+  } else if (AllConvertible<DoubleType>(parsers, col_index, nulls, float64())) {
+    *out = float64();
+  } else if (AllConvertible<Date32Type>(parsers, col_index, nulls, date32())) {
+    *out = date32();
+  } else if (AllConvertible<TimestampType>(parsers, col_index, nulls,
+                                           timestamp(TimeUnit::SECOND))) {
+    *out = timestamp(TimeUnit::SECOND);
+  } else {
+    *out = utf8();
+  }
+  return Status::OK();
+}
+
+}  // namespace csv
+}  // namespace arrow
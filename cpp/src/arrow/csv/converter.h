@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_CONVERTER_H
+#define ARROW_CSV_CONVERTER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class MemoryPool;
+
+namespace csv {
+
+class BlockParser;
+
+/// \brief Convert the values of a column of parsed CSV to an Arrow array
+///
+/// Converters hold no state between calls to Convert and may be used from
+/// several threads at once.
+class ARROW_EXPORT Converter {
+ public:
+  virtual ~Converter() = default;
+
+  /// \brief Create a converter to the given type
+  ///
+  /// Supported types are null, boolean, integers, floating point, date32,
+  /// timestamp, binary and string.
+  static Status Make(const std::shared_ptr<DataType>& type,
+                     const ConvertOptions& options, MemoryPool* pool,
+                     std::shared_ptr<Converter>* out);
+
+  /// \brief Convert the values of a column of the parsed rows
+  virtual Status Convert(const BlockParser& parser, int32_t col_index,
+                         std::shared_ptr<Array>* out) = 0;
+
+  std::shared_ptr<DataType> type() const { return type_; }
+
+ protected:
+  Converter(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
+            MemoryPool* pool);
+
+  std::shared_ptr<DataType> type_;
+  ConvertOptions options_;
+  MemoryPool* pool_;
+};
+
+/// \brief Infer the type of a column from its values in parsed CSV blocks
+///
+/// The first of null, int64, boolean, double, date32, timestamp[s] and
+/// string which can represent all the values is chosen.
+ARROW_EXPORT
+Status InferColumnType(const std::vector<std::shared_ptr<BlockParser>>& parsers,
+                       int32_t col_index, const ConvertOptions& options,
+                       std::shared_ptr<DataType>* out);
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_CONVERTER_H
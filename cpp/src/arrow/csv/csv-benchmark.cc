@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace csv {
+
+// About 10MB of CSV, either long (few columns, many rows) or wide (many
+// columns, few rows). Columns cycle through integers, doubles, quoted
+// strings and mostly null integers.
+static std::shared_ptr<Buffer> MakeCsv(bool wide) {
+  const int32_t num_cols = wide ? 1000 : 8;
+  const int64_t num_rows = wide ? 1000 : 125000;
+  std::vector<int64_t> ints;
+  randint<int64_t>(num_rows, -1000000, 1000000, &ints);
+  std::vector<double> doubles;
+  random_real<double>(num_rows, 42, -1000.0, 1000.0, &doubles);
+
+  std::stringstream ss;
+  for (int32_t j = 0; j < num_cols; ++j) {
+    ss << (j == 0 ? "" : ",") << "col" << j;
+  }
+  ss << "\n";
+  for (int64_t i = 0; i < num_rows; ++i) {
+    for (int32_t j = 0; j < num_cols; ++j) {
+      if (j > 0) {
+        ss << ",";
+      }
+      const int64_t k = (i + j) % num_rows;
+      switch (j % 4) {
+        case 0:
+          ss << ints[k];
+          break;
+        case 1:
+          ss << doubles[k];
+          break;
+        case 2:
+          ss << "\"value, " << k % 1000 << "\"";
+          break;
+        default:
+          if (k % 10 == 0) {
+            ss << k;
+          }
+      }
+    }
+    ss << "\n";
+  }
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(Buffer::FromString(ss.str(), &buffer));
+  return buffer;
+}
+
+static void BM_ParseBlock(benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = MakeCsv(state.range(0) != 0);
+  auto options = ParseOptions::Defaults();
+
+  while (state.KeepRunning()) {
+    BlockParser parser(default_memory_pool(), options);
+    int64_t parsed_size;
+    ABORT_NOT_OK(parser.Parse(csv, &parsed_size));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * csv->size());
+}
+
+static void BM_ReadTable(benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = MakeCsv(state.range(0) != 0);
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = state.range(1) != 0;
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<Table> table;
+    ABORT_NOT_OK(ReadTable(default_memory_pool(), std::make_shared<io::BufferReader>(csv),
+                           read_options, ParseOptions::Defaults(),
+                           ConvertOptions::Defaults(), &table));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * csv->size());
+}
+
+static void BM_StreamingReader(benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = MakeCsv(state.range(0) != 0);
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = state.range(1) != 0;
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<StreamingReader> reader;
+    ABORT_NOT_OK(StreamingReader::Open(
+        default_memory_pool(), std::make_shared<io::BufferReader>(csv), read_options,
+        ParseOptions::Defaults(), ConvertOptions::Defaults(), &reader));
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * csv->size());
+}
+
+// First argument: long (0) or wide (1) file; second: without or with threads
+BENCHMARK(BM_ParseBlock)->Arg(0)->Arg(1)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_ReadTable)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+BENCHMARK(BM_StreamingReader)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,396 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+static std::shared_ptr<Buffer> BufferFromString(const std::string& data) {
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(Buffer::FromString(data, &buffer));
+  return buffer;
+}
+
+static void Parse(const ParseOptions& options, const std::string& csv,
+                  std::shared_ptr<BlockParser>* out) {
+  *out = std::make_shared<BlockParser>(default_memory_pool(), options);
+  int64_t parsed_size;
+  ASSERT_OK((*out)->Parse(BufferFromString(csv), &parsed_size));
+  ASSERT_EQ(static_cast<int64_t>(csv.size()), parsed_size);
+}
+
+static std::vector<std::string> ColumnValues(const BlockParser& parser,
+                                             int32_t col_index) {
+  std::vector<std::string> values;
+  ABORT_NOT_OK(parser.VisitColumn(
+      col_index, [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+        values.emplace_back(reinterpret_cast<const char*>(data), size);
+        return Status::OK();
+      }));
+  return values;
+}
+
+static ParseOptions NoHeader() {
+  auto options = ParseOptions::Defaults();
+  options.header_rows = 0;
+  return options;
+}
+
+TEST(TestChunker, RowBoundaries) {
+  const std::string csv = "a,b\nc,d\r\ne,f";
+  Chunker chunker(ParseOptions::Defaults());
+  auto data = reinterpret_cast<const uint8_t*>(csv.data());
+  ASSERT_EQ(9, chunker.Process(data, csv.size()));
+  ASSERT_EQ(9, chunker.Process(data, 9));
+  // A '\r' ending the data may be followed by a '\n'
+  ASSERT_EQ(4, chunker.Process(data, 8));
+  ASSERT_EQ(0, chunker.Process(data, 3));
+}
+
+TEST(TestChunker, NewlinesInValues) {
+  const std::string csv = "a,\"b\n\"\"c\"\nd,e\\\nf\ng";
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  auto data = reinterpret_cast<const uint8_t*>(csv.data());
+
+  ASSERT_EQ(static_cast<int64_t>(csv.size()) - 1,
+            Chunker(options).Process(data, csv.size()));
+  options.newlines_in_values = true;
+  Chunker chunker(options);
+  ASSERT_EQ(static_cast<int64_t>(csv.size()) - 1, chunker.Process(data, csv.size()));
+  // Inside a quoted value
+  ASSERT_EQ(0, chunker.Process(data, 6));
+  ASSERT_EQ(10, chunker.Process(data, 14));
+}
+
+TEST(TestBlockParser, Basics) {
+  std::shared_ptr<BlockParser> parser;
+  Parse(NoHeader(), "ab,cd,\n,ef,g\r\n\nh,,i\n", &parser);
+  ASSERT_EQ(3, parser->num_rows());
+  ASSERT_EQ(3, parser->num_cols());
+  ASSERT_EQ(std::vector<std::string>({"ab", "", "h"}), ColumnValues(*parser, 0));
+  ASSERT_EQ(std::vector<std::string>({"cd", "ef", ""}), ColumnValues(*parser, 1));
+  ASSERT_EQ(std::vector<std::string>({"", "g", "i"}), ColumnValues(*parser, 2));
+}
+
+TEST(TestBlockParser, EmptyLines) {
+  auto options = NoHeader();
+  options.ignore_empty_lines = false;
+  std::shared_ptr<BlockParser> parser;
+  Parse(options, "a\n\nb\n", &parser);
+  ASSERT_EQ(std::vector<std::string>({"a", "", "b"}), ColumnValues(*parser, 0));
+}
+
+TEST(TestBlockParser, Quoting) {
+  std::shared_ptr<BlockParser> parser;
+  Parse(NoHeader(), "\"a,b\",\"c\"\"d\"\n\"\",e\"f\n", &parser);
+  ASSERT_EQ(2, parser->num_rows());
+  ASSERT_EQ(std::vector<std::string>({"a,b", ""}), ColumnValues(*parser, 0));
+  ASSERT_EQ(std::vector<std::string>({"c\"d", "e\"f"}), ColumnValues(*parser, 1));
+
+  std::vector<bool> quoted;
+  ASSERT_OK(parser->VisitColumn(0, [&](const uint8_t*, uint32_t, bool q) -> Status {
+    quoted.push_back(q);
+    return Status::OK();
+  }));
+  ASSERT_EQ(std::vector<bool>({true, true}), quoted);
+
+  auto options = NoHeader();
+  options.newlines_in_values = true;
+  Parse(options, "\"a\nb\",c\n", &parser);
+  ASSERT_EQ(std::vector<std::string>({"a\nb"}), ColumnValues(*parser, 0));
+}
+
+TEST(TestBlockParser, Escaping) {
+  auto options = NoHeader();
+  options.escaping = true;
+  std::shared_ptr<BlockParser> parser;
+  Parse(options, "a\\,b,\"c\\\"d\"\ne,f\\\\\n", &parser);
+  ASSERT_EQ(std::vector<std::string>({"a,b", "e"}), ColumnValues(*parser, 0));
+  ASSERT_EQ(std::vector<std::string>({"c\"d", "f\\"}), ColumnValues(*parser, 1));
+}
+
+TEST(TestBlockParser, MaxNumRows) {
+  BlockParser parser(default_memory_pool(), NoHeader(), -1, 1);
+  int64_t parsed_size;
+  ASSERT_OK(parser.Parse(BufferFromString("a,b\r\nc,d\n"), &parsed_size));
+  ASSERT_EQ(5, parsed_size);
+  ASSERT_EQ(1, parser.num_rows());
+}
+
+TEST(TestBlockParser, Errors) {
+  BlockParser parser(default_memory_pool(), NoHeader());
+  int64_t parsed_size;
+  ASSERT_RAISES(Invalid, parser.Parse(BufferFromString("a,b\nc\n"), &parsed_size));
+
+  BlockParser parser2(default_memory_pool(), NoHeader());
+  ASSERT_RAISES(Invalid, parser2.Parse(BufferFromString("\"ab\n"), &parsed_size));
+
+  BlockParser parser3(default_memory_pool(), NoHeader());
+  ASSERT_RAISES(Invalid, parser3.Parse(BufferFromString("\"a\"b\n"), &parsed_size));
+}
+
+TEST(TestConverter, Primitives) {
+  std::shared_ptr<BlockParser> parser;
+  Parse(NoHeader(), "1,0.5,true,2018-01-02\n,NA,false,\n-3,1e3,1,1970-01-01\n",
+        &parser);
+  const auto options = ConvertOptions::Defaults();
+
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array, expected;
+  ASSERT_OK(Converter::Make(int32(), options, default_memory_pool(), &converter));
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {1, 0, -3}, &expected);
+  AssertArraysEqual(*expected, *array);
+
+  ASSERT_OK(Converter::Make(float64(), options, default_memory_pool(), &converter));
+  ASSERT_OK(converter->Convert(*parser, 1, &array));
+  ArrayFromVector<DoubleType, double>({true, false, true}, {0.5, 0, 1000}, &expected);
+  AssertArraysEqual(*expected, *array);
+
+  ASSERT_OK(Converter::Make(boolean(), options, default_memory_pool(), &converter));
+  ASSERT_OK(converter->Convert(*parser, 2, &array));
+  ArrayFromVector<BooleanType, bool>({true, true, true}, {true, false, true}, &expected);
+  AssertArraysEqual(*expected, *array);
+
+  ASSERT_OK(Converter::Make(date32(), options, default_memory_pool(), &converter));
+  ASSERT_OK(converter->Convert(*parser, 3, &array));
+  ArrayFromVector<Date32Type, int32_t>({true, false, true}, {17533, 0, 0}, &expected);
+  AssertArraysEqual(*expected, *array);
+
+  // Out of range and malformed values
+  ASSERT_OK(Converter::Make(uint8(), options, default_memory_pool(), &converter));
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0, &array));
+  ASSERT_OK(Converter::Make(int64(), options, default_memory_pool(), &converter));
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 1, &array));
+  ASSERT_RAISES(NotImplemented, Converter::Make(list(int32()), options,
+                                                default_memory_pool(), &converter));
+}
+
+TEST(TestConverter, Strings) {
+  std::shared_ptr<BlockParser> parser;
+  Parse(NoHeader(), "ab\nNA\n\"NA\"\n\"\"\n", &parser);
+  auto options = ConvertOptions::Defaults();
+
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array, expected;
+  // Quoted values are never null
+  ASSERT_OK(Converter::Make(utf8(), options, default_memory_pool(), &converter));
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ArrayFromVector<StringType, std::string>({true, false, true, true},
+                                           {"ab", "", "NA", ""}, &expected);
+  AssertArraysEqual(*expected, *array);
+
+  options.null_values.clear();
+  ASSERT_OK(Converter::Make(binary(), options, default_memory_pool(), &converter));
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ArrayFromVector<BinaryType, std::string>({"ab", "NA", "NA", ""}, &expected);
+  AssertArraysEqual(*expected, *array);
+}
+
+TEST(TestInference, ColumnTypes) {
+  std::shared_ptr<BlockParser> first, second;
+  Parse(NoHeader(), "1,1,true,,1.5,2018-01-01,2018-01-01 00:00:01,x\n", &first);
+  Parse(NoHeader(), "2,2.5,false,,NA,,,1\n", &second);
+  const auto options = ConvertOptions::Defaults();
+  const std::vector<std::shared_ptr<DataType>> expected = {
+      int64(),  float64(), boolean(), null(), float64(), date32(),
+      timestamp(TimeUnit::SECOND), utf8()};
+
+  for (int32_t i = 0; i < static_cast<int32_t>(expected.size()); ++i) {
+    std::shared_ptr<DataType> type;
+    ASSERT_OK(InferColumnType({first, second}, i, options, &type));
+    ASSERT_TRUE(type->Equals(*expected[i])) << i << ": " << type->ToString();
+  }
+  // Only the first block
+  std::shared_ptr<DataType> type;
+  ASSERT_OK(InferColumnType({first}, 1, options, &type));
+  ASSERT_TRUE(type->Equals(*int64()));
+}
+
+class TestReader : public ::testing::Test {
+ protected:
+  std::shared_ptr<io::InputStream> MakeStream(const std::string& csv) {
+    return std::make_shared<io::BufferReader>(BufferFromString(csv));
+  }
+
+  // Rows with an integer, a double, a string needing quotes and a column
+  // with nulls
+  std::string MakeCsv(int num_rows) {
+    std::stringstream ss;
+    ss << "int,double,\"str\",maybe\n";
+    for (int i = 0; i < num_rows; ++i) {
+      ss << i << "," << i << ".5,\"a," << i << "\",";
+      if (i % 3 != 0) {
+        ss << i;
+      }
+      ss << (i % 2 == 0 ? "\n" : "\r\n");
+    }
+    return ss.str();
+  }
+
+  void CheckTable(const Table& table, int num_rows) {
+    ASSERT_EQ(num_rows, table.num_rows());
+    auto expected_schema = schema({field("int", int64()), field("double", float64()),
+                                   field("str", utf8()), field("maybe", int64())});
+    ASSERT_TRUE(table.schema()->Equals(*expected_schema))
+        << table.schema()->ToString();
+
+    std::vector<int64_t> ints, maybe;
+    std::vector<double> doubles;
+    std::vector<std::string> strings;
+    std::vector<bool> is_valid;
+    for (int i = 0; i < num_rows; ++i) {
+      ints.push_back(i);
+      doubles.push_back(i + 0.5);
+      strings.push_back("a," + std::to_string(i));
+      maybe.push_back(i % 3 != 0 ? i : 0);
+      is_valid.push_back(i % 3 != 0);
+    }
+    std::vector<std::shared_ptr<Array>> expected(4);
+    ArrayFromVector<Int64Type, int64_t>(ints, &expected[0]);
+    ArrayFromVector<DoubleType, double>(doubles, &expected[1]);
+    ArrayFromVector<StringType, std::string>(strings, &expected[2]);
+    ArrayFromVector<Int64Type, int64_t>(is_valid, maybe, &expected[3]);
+    // Chunk boundaries are not compared
+    for (int i = 0; i < 4; ++i) {
+      ASSERT_TRUE(table.column(i)->data()->Equals(ChunkedArray({expected[i]})))
+          << "column " << i;
+    }
+  }
+};
+
+TEST_F(TestReader, ReadTable) {
+  const int num_rows = 1000;
+  const std::string csv = MakeCsv(num_rows);
+  for (bool use_threads : {false, true}) {
+    for (int32_t block_size : {1 << 20, 100, 7}) {
+      auto read_options = ReadOptions::Defaults();
+      read_options.use_threads = use_threads;
+      read_options.block_size = block_size;
+      std::shared_ptr<Table> table;
+      ASSERT_OK(ReadTable(default_memory_pool(), MakeStream(csv), read_options,
+                          ParseOptions::Defaults(), ConvertOptions::Defaults(),
+                          &table));
+      ASSERT_OK(table->Validate());
+      CheckTable(*table, num_rows);
+    }
+  }
+}
+
+TEST_F(TestReader, NewlinesInValues) {
+  const std::string csv = "a,b\n\"x\ny\",1\n\"\r\n\",2\n";
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  for (int32_t block_size : {1 << 20, 3}) {
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = block_size;
+    std::shared_ptr<Table> table;
+    ASSERT_OK(ReadTable(default_memory_pool(), MakeStream(csv), read_options,
+                        parse_options, ConvertOptions::Defaults(), &table));
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<StringType, std::string>({"x\ny", "\r\n"}, &expected);
+    ASSERT_TRUE(table->column(0)->data()->Equals(ChunkedArray({expected})));
+  }
+}
+
+TEST_F(TestReader, HeaderAndTypes) {
+  auto parse_options = ParseOptions::Defaults();
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.column_types["b"] = int8();
+  std::shared_ptr<Table> table;
+
+  // Only a header
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeStream("a,b\n"),
+                      ReadOptions::Defaults(), parse_options, convert_options,
+                      &table));
+  ASSERT_EQ(0, table->num_rows());
+  ASSERT_TRUE(table->schema()->Equals(*schema({field("a", null()), field("b", int8())})));
+
+  // No header
+  parse_options.header_rows = 0;
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeStream("1,x\n2,y\n"),
+                      ReadOptions::Defaults(), parse_options, convert_options,
+                      &table));
+  ASSERT_EQ(2, table->num_rows());
+  ASSERT_TRUE(
+      table->schema()->Equals(*schema({field("f0", int64()), field("f1", utf8())})));
+
+  ASSERT_RAISES(Invalid, ReadTable(default_memory_pool(), MakeStream(""),
+                                   ReadOptions::Defaults(), parse_options,
+                                   convert_options, &table));
+  parse_options.header_rows = 1;
+  ASSERT_RAISES(Invalid, ReadTable(default_memory_pool(), MakeStream(""),
+                                   ReadOptions::Defaults(), parse_options,
+                                   convert_options, &table));
+  // Conversion error with an explicit type
+  ASSERT_RAISES(Invalid, ReadTable(default_memory_pool(), MakeStream("a,b\n1,x\n"),
+                                   ReadOptions::Defaults(), parse_options,
+                                   convert_options, &table));
+}
+
+TEST_F(TestReader, StreamingReader) {
+  const int num_rows = 500;
+  const std::string csv = MakeCsv(num_rows);
+  for (bool use_threads : {false, true}) {
+    auto read_options = ReadOptions::Defaults();
+    read_options.use_threads = use_threads;
+    read_options.block_size = 1000;
+    std::shared_ptr<StreamingReader> reader;
+    ASSERT_OK(StreamingReader::Open(default_memory_pool(), MakeStream(csv),
+                                    read_options, ParseOptions::Defaults(),
+                                    ConvertOptions::Defaults(), &reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_OK(batch->Validate());
+      batches.push_back(batch);
+    }
+    ASSERT_GT(batches.size(), 1);
+
+    std::shared_ptr<Table> table;
+    ASSERT_OK(Table::FromRecordBatches(reader->schema(), batches, &table));
+    CheckTable(*table, num_rows);
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
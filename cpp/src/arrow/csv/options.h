@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_OPTIONS_H
+#define ARROW_CSV_OPTIONS_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace csv {
+
+/// \brief Options controlling how CSV text is split into rows and fields
+struct ARROW_EXPORT ParseOptions {
+  static ParseOptions Defaults();
+
+  /// Field delimiter
+  char delimiter;
+
+  /// Whether fields may be quoted
+  bool quoting;
+  /// Quoting character, if quoting is enabled
+  char quote_char;
+  /// Whether a quote inside a quoted field is written as two quotes
+  bool double_quote;
+
+  /// Whether a character may be escaped with escape_char
+  bool escaping;
+  /// Escaping character, if escaping is enabled
+  char escape_char;
+
+  /// Whether quoted or escaped values may contain newlines. This requires
+  /// a slower scan of the input to find where rows end.
+  bool newlines_in_values;
+
+  /// Whether empty lines are skipped rather than read as rows of one empty
+  /// field
+  bool ignore_empty_lines;
+
+  /// Number of header rows. Column names are taken from the first one, the
+  /// others are skipped. Without a header, columns are named "f0", "f1"...
+  int32_t header_rows;
+};
+
+/// \brief Options controlling how CSV fields are converted to Arrow values
+struct ARROW_EXPORT ConvertOptions {
+  static ConvertOptions Defaults();
+
+  /// Types of the columns by name. The types of other columns are inferred:
+  /// the first of null, int64, boolean, double, date32, timestamp[s] and
+  /// string which can represent all of their values is chosen.
+  std::unordered_map<std::string, std::shared_ptr<DataType>> column_types;
+
+  /// Unquoted values read as null
+  std::vector<std::string> null_values;
+};
+
+/// \brief Options controlling how CSV input is read
+struct ARROW_EXPORT ReadOptions {
+  static ReadOptions Defaults();
+
+  /// Whether blocks of input are parsed and converted concurrently on the
+  /// CPU thread pool
+  bool use_threads;
+
+  /// Approximate number of bytes of input making up one block. Blocks
+  /// always end on a row boundary. The streaming reader returns one record
+  /// batch per block, the table reader one chunk per block.
+  int32_t block_size;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_OPTIONS_H
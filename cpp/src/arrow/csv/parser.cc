@@ -0,0 +1,350 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/parser.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace csv {
+
+namespace {
+
+// Find the first occurrence of any of up to four characters. SSE2 is part of
+// the x86-64 baseline, so the vectorized loop needs no runtime CPU check.
+class CharFinder {
+ public:
+  CharFinder(char c0, char c1, char c2, char c3) : chars_{c0, c1, c2, c3} {
+    memset(is_special_, 0, sizeof(is_special_));
+    for (char c : chars_) {
+      is_special_[static_cast<uint8_t>(c)] = true;
+    }
+  }
+
+  const uint8_t* Find(const uint8_t* data, const uint8_t* end) const {
+#ifdef __SSE2__
+    // Compare 16 bytes at a time against each character
+    const __m128i c0 = _mm_set1_epi8(chars_[0]);
+    const __m128i c1 = _mm_set1_epi8(chars_[1]);
+    const __m128i c2 = _mm_set1_epi8(chars_[2]);
+    const __m128i c3 = _mm_set1_epi8(chars_[3]);
+    while (end - data >= 16) {
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+      const __m128i matches01 =
+          _mm_or_si128(_mm_cmpeq_epi8(bytes, c0), _mm_cmpeq_epi8(bytes, c1));
+      const __m128i matches23 =
+          _mm_or_si128(_mm_cmpeq_epi8(bytes, c2), _mm_cmpeq_epi8(bytes, c3));
+      const __m128i matches = _mm_or_si128(matches01, matches23);
+      const int mask = _mm_movemask_epi8(matches);
+      if (mask != 0) {
+        return data + __builtin_ctz(mask);
+      }
+      data += 16;
+    }
+#endif
+    while (data < end && !is_special_[*data]) {
+      ++data;
+    }
+    return data;
+  }
+
+ private:
+  char chars_[4];
+  bool is_special_[256];
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Chunker
+
+Chunker::Chunker(const ParseOptions& options) : options_(options) {}
+
+int64_t Chunker::Process(const uint8_t* data, int64_t size) const {
+  if (!options_.newlines_in_values) {
+    // Any newline ends a row: search backwards from the end
+    int64_t pos = size;
+    if (pos > 0 && data[pos - 1] == '\r') {
+      --pos;
+    }
+    while (pos > 0 && data[pos - 1] != '\n' && data[pos - 1] != '\r') {
+      --pos;
+    }
+    return pos;
+  }
+
+  // Follow quotes and escapes from the beginning of the data
+  const char quote = options_.quoting ? options_.quote_char : '\n';
+  const char escape = options_.escaping ? options_.escape_char : '\n';
+  const CharFinder unquoted_finder(quote, '\n', '\r', escape);
+  const CharFinder quoted_finder(quote, options_.escaping ? escape : quote, quote, quote);
+
+  const uint8_t* end = data + size;
+  const uint8_t* p = data;
+  int64_t row_end = 0;
+  bool in_quotes = false;
+  while (true) {
+    p = (in_quotes ? quoted_finder : unquoted_finder).Find(p, end);
+    if (p == end) {
+      break;
+    }
+    const char c = static_cast<char>(*p);
+    if (options_.escaping && c == escape) {
+      if (end - p <= 2) {
+        break;
+      }
+      p += 2;
+      continue;
+    }
+    if (options_.quoting && c == quote) {
+      if (in_quotes) {
+        if (options_.double_quote && end - p >= 2 && p[1] == quote) {
+          p += 2;
+          continue;
+        }
+        in_quotes = false;
+      } else if (p == data || p[-1] == options_.delimiter || p[-1] == '\n' ||
+                 p[-1] == '\r') {
+        // As in the parser, a quote only opens a value at the start of a field
+        in_quotes = true;
+      }
+      ++p;
+      continue;
+    }
+    if (c == '\r' && p + 1 == end) {
+      break;
+    }
+    ++p;
+    row_end = p - data;
+  }
+  return row_end;
+}
+
+// ----------------------------------------------------------------------
+// BlockParser
+
+// The parsing of one buffer
+class BlockParser::ParseState {
+ public:
+  ParseState(BlockParser* parser, const Buffer& buffer)
+      : parser_(parser),
+        options_(parser->options_),
+        begin_(buffer.data()),
+        end_(buffer.data() + buffer.size()),
+        unquoted_finder_(options_.delimiter, '\n', '\r',
+                         options_.escaping ? options_.escape_char : '\n'),
+        quoted_finder_(options_.quote_char,
+                       options_.escaping ? options_.escape_char : options_.quote_char,
+                       options_.quote_char, options_.quote_char),
+        unescaped_(nullptr) {}
+
+  Status ParseRows(int64_t* parsed_size) {
+    const char delimiter = options_.delimiter;
+    std::vector<Field>& fields = parser_->fields_;
+    const uint8_t* p = begin_;
+
+    while (p < end_ &&
+           (parser_->max_num_rows_ < 0 || parser_->num_rows_ < parser_->max_num_rows_)) {
+      if (options_.ignore_empty_lines && (*p == '\n' || *p == '\r')) {
+        ++p;
+        continue;
+      }
+      const size_t row_begin = fields.size();
+      while (true) {
+        Field field;
+        if (options_.quoting && p < end_ && *p == options_.quote_char) {
+          RETURN_NOT_OK(ParseQuoted(&p, &field));
+        } else {
+          RETURN_NOT_OK(ParseUnquoted(&p, &field));
+        }
+        fields.push_back(field);
+        if (p == end_) {
+          break;
+        }
+        const char c = static_cast<char>(*p++);
+        if (c == delimiter) {
+          continue;
+        }
+        // End of line
+        if (c == '\r' && p < end_ && *p == '\n') {
+          ++p;
+        }
+        break;
+      }
+
+      const auto num_fields = static_cast<int32_t>(fields.size() - row_begin);
+      if (parser_->num_cols_ < 0) {
+        parser_->num_cols_ = num_fields;
+      } else if (ARROW_PREDICT_FALSE(num_fields != parser_->num_cols_)) {
+        std::stringstream ss;
+        ss << "Expected " << parser_->num_cols_ << " fields, got " << num_fields;
+        return Error(ss.str());
+      }
+      ++parser_->num_rows_;
+    }
+    *parsed_size = p - begin_;
+    return Status::OK();
+  }
+
+ private:
+  Status Error(const std::string& message) const {
+    std::stringstream ss;
+    ss << "CSV parse error in row " << parser_->num_rows_ << ": " << message;
+    return Status::Invalid(ss.str());
+  }
+
+  // Copy the beginning of a value containing escapes to the unescaped data,
+  // which is allocated on first use. Values never grow when unescaped, so
+  // the size of the input is enough.
+  Status StartUnescaped(const uint8_t* begin, const uint8_t* end, uint8_t** out) {
+    if (unescaped_ == nullptr) {
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(AllocateBuffer(parser_->pool_, end_ - begin_, &buffer));
+      unescaped_ = buffer->mutable_data();
+      parser_->buffers_.push_back(buffer);
+    }
+    *out = unescaped_;
+    memcpy(unescaped_, begin, end - begin);
+    unescaped_ += end - begin;
+    return Status::OK();
+  }
+
+  // On return, *p points at the delimiter or newline ending the value, or
+  // at the end of input
+  Status ParseUnquoted(const uint8_t** p, Field* out) {
+    const uint8_t* begin = *p;
+    const uint8_t* q = unquoted_finder_.Find(begin, end_);
+    if (!options_.escaping || q == end_ || *q != options_.escape_char) {
+      *out = Field{begin, static_cast<uint32_t>(q - begin), false};
+      *p = q;
+      return Status::OK();
+    }
+
+    uint8_t* value;
+    RETURN_NOT_OK(StartUnescaped(begin, q, &value));
+    while (q < end_ && *q == options_.escape_char) {
+      if (q + 1 == end_) {
+        return Error("Escape character at end of input");
+      }
+      *unescaped_++ = q[1];
+      const uint8_t* next = unquoted_finder_.Find(q + 2, end_);
+      memcpy(unescaped_, q + 2, next - q - 2);
+      unescaped_ += next - q - 2;
+      q = next;
+    }
+    *out = Field{value, static_cast<uint32_t>(unescaped_ - value), false};
+    *p = q;
+    return Status::OK();
+  }
+
+  // On entry, *p points at the opening quote; on return, at the delimiter
+  // or newline ending the value, or at the end of input
+  Status ParseQuoted(const uint8_t** p, Field* out) {
+    const char quote = options_.quote_char;
+    const uint8_t* begin = *p + 1;
+    const uint8_t* segment = begin;
+    // Non-null once the value has escapes and is being unescaped
+    uint8_t* value = nullptr;
+
+    while (true) {
+      const uint8_t* q = quoted_finder_.Find(segment, end_);
+      if (ARROW_PREDICT_FALSE(q == end_)) {
+        return Error(options_.newlines_in_values
+                         ? "Unterminated quoted value"
+                         : "Unterminated quoted value (newlines in values require "
+                           "the newlines_in_values option)");
+      }
+      if (value != nullptr) {
+        memcpy(unescaped_, segment, q - segment);
+        unescaped_ += q - segment;
+      }
+      const bool is_escape = options_.escaping && *q == options_.escape_char;
+      const bool is_double_quote = !is_escape && options_.double_quote &&
+                                   q + 1 < end_ && q[1] == static_cast<uint8_t>(quote);
+      if (!is_escape && !is_double_quote) {
+        // Closing quote
+        if (value == nullptr) {
+          *out = Field{begin, static_cast<uint32_t>(q - begin), true};
+        } else {
+          *out = Field{value, static_cast<uint32_t>(unescaped_ - value), true};
+        }
+        ++q;
+        if (ARROW_PREDICT_FALSE(q < end_ && *q != options_.delimiter && *q != '\n' &&
+                                *q != '\r')) {
+          return Error("Unexpected character after a quoted value");
+        }
+        *p = q;
+        return Status::OK();
+      }
+      if (ARROW_PREDICT_FALSE(q + 1 == end_)) {
+        return Error("Escape character at end of input");
+      }
+      if (value == nullptr) {
+        RETURN_NOT_OK(StartUnescaped(begin, q, &value));
+      }
+      *unescaped_++ = q[1];
+      segment = q + 2;
+    }
+  }
+
+  BlockParser* parser_;
+  const ParseOptions& options_;
+  const uint8_t* begin_;
+  const uint8_t* end_;
+  const CharFinder unquoted_finder_;
+  const CharFinder quoted_finder_;
+  // Where the next unescaped value is written
+  uint8_t* unescaped_;
+};
+
+BlockParser::BlockParser(MemoryPool* pool, const ParseOptions& options,
+                         int32_t num_cols, int64_t max_num_rows)
+    : pool_(pool),
+      options_(options),
+      num_cols_(num_cols),
+      max_num_rows_(max_num_rows),
+      num_rows_(0) {}
+
+Status BlockParser::Parse(const std::shared_ptr<Buffer>& buffer, int64_t* parsed_size) {
+  buffers_.push_back(buffer);
+  ParseState state(this, *buffer);
+  return state.ParseRows(parsed_size);
+}
+
+Status BlockParser::Parse(const std::vector<std::shared_ptr<Buffer>>& block) {
+  for (const auto& buffer : block) {
+    int64_t parsed_size;
+    RETURN_NOT_OK(Parse(buffer, &parsed_size));
+  }
+  return Status::OK();
+}
+
+}  // namespace csv
+}  // namespace arrow
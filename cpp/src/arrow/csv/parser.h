@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_PARSER_H
+#define ARROW_CSV_PARSER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+
+namespace csv {
+
+/// \brief Find where the last complete row of a piece of CSV input ends
+class ARROW_EXPORT Chunker {
+ public:
+  explicit Chunker(const ParseOptions& options);
+
+  /// \brief Return the size of the longest prefix of the data made of whole
+  /// rows, or 0 if no row ends in the data
+  ///
+  /// The data must start at the beginning of a row. A '\r' ending the data
+  /// does not end a row, as it may be followed by a '\n'. Newlines in quoted
+  /// or escaped values are only recognized when options.newlines_in_values
+  /// is set.
+  int64_t Process(const uint8_t* data, int64_t size) const;
+
+ private:
+  ParseOptions options_;
+};
+
+/// \brief Split CSV input into rows of fields
+///
+/// Field values are referenced where they are in the input: only quoted and
+/// escaped values containing escapes are copied, to unescape them. The parser
+/// keeps the buffers it parses alive.
+class ARROW_EXPORT BlockParser {
+ public:
+  /// \param[in] pool the memory pool for unescaped values
+  /// \param[in] options the parse options
+  /// \param[in] num_cols the number of fields of each row, or -1 to take it
+  /// from the first row
+  /// \param[in] max_num_rows the number of rows after which to stop parsing,
+  /// or -1 to parse all input
+  BlockParser(MemoryPool* pool, const ParseOptions& options, int32_t num_cols = -1,
+              int64_t max_num_rows = -1);
+
+  /// \brief Parse a sequence of buffers, each holding whole rows
+  Status Parse(const std::vector<std::shared_ptr<Buffer>>& block);
+
+  /// \brief Parse rows from a buffer, until its end or until max_num_rows
+  /// rows have been parsed
+  ///
+  /// \param[in] buffer the input, starting at the beginning of a row
+  /// \param[out] parsed_size the number of bytes of input consumed
+  Status Parse(const std::shared_ptr<Buffer>& buffer, int64_t* parsed_size);
+
+  /// \brief The number of rows parsed
+  int64_t num_rows() const { return num_rows_; }
+
+  /// \brief The number of fields of each row, -1 if no row was parsed yet
+  int32_t num_cols() const { return num_cols_; }
+
+  /// \brief Visit the values of a column in row order
+  ///
+  /// The visitor is called as `Status visitor(const uint8_t* data,
+  /// uint32_t size, bool quoted)`.
+  template <typename Visitor>
+  Status VisitColumn(int32_t col_index, Visitor&& visitor) const {
+    const int64_t num_fields = static_cast<int64_t>(fields_.size());
+    for (int64_t i = col_index; i < num_fields; i += num_cols_) {
+      const Field& field = fields_[i];
+      RETURN_NOT_OK(visitor(field.data, field.size, field.quoted));
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Field {
+    const uint8_t* data;
+    uint32_t size;
+    bool quoted;
+  };
+
+  class ParseState;
+
+  MemoryPool* pool_;
+  ParseOptions options_;
+  int32_t num_cols_;
+  int64_t max_num_rows_;
+  int64_t num_rows_;
+
+  // Fields of all rows, in row-major order
+  std::vector<Field> fields_;
+  // Input and unescaped values referenced by the fields
+  std::vector<std::shared_ptr<Buffer>> buffers_;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_PARSER_H
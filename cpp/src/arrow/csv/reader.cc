@@ -0,0 +1,458 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/reader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/parser.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/block-reader.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace csv {
+
+ParseOptions ParseOptions::Defaults() {
+  ParseOptions options;
+  options.delimiter = ',';
+  options.quoting = true;
+  options.quote_char = '"';
+  options.double_quote = true;
+  options.escaping = false;
+  options.escape_char = '\\';
+  options.newlines_in_values = false;
+  options.ignore_empty_lines = true;
+  options.header_rows = 1;
+  return options;
+}
+
+ConvertOptions ConvertOptions::Defaults() {
+  ConvertOptions options;
+  // The default null values of pandas
+  options.null_values = {"",     "#N/A", "#N/A N/A", "#NA",     "-1.#IND", "-1.#QNAN",
+                         "-NaN", "-nan", "1.#IND",   "1.#QNAN", "N/A",     "NA",
+                         "NULL", "NaN",  "n/a",      "nan",     "null"};
+  return options;
+}
+
+ReadOptions ReadOptions::Defaults() {
+  ReadOptions options;
+  options.use_threads = true;
+  options.block_size = 1 << 20;
+  return options;
+}
+
+namespace {
+
+using internal::BlockReader;
+using internal::ReadaheadQueue;
+
+// The buffers holding the whole rows of one block of input
+using Block = std::vector<std::shared_ptr<Buffer>>;
+
+// The end of the first row of the data, which holds at least one newline
+int64_t FirstRowEnd(const uint8_t* data, int64_t size) {
+  int64_t pos = 0;
+  while (data[pos] != '\n' && data[pos] != '\r') {
+    ++pos;
+  }
+  ++pos;
+  if (data[pos - 1] == '\r' && pos < size && data[pos] == '\n') {
+    ++pos;
+  }
+  return pos;
+}
+
+// ----------------------------------------------------------------------
+// Reading of the header and of blocks of input, common to both readers
+
+class BaseReader {
+ public:
+  BaseReader(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+             const ReadOptions& read_options, const ParseOptions& parse_options,
+             const ConvertOptions& convert_options)
+      : pool_(pool),
+        input_(input),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        convert_options_(convert_options),
+        chunker_(parse_options),
+        block_reader_(
+            pool, input, read_options.block_size,
+            [this](const uint8_t* data, int64_t size) {
+              return chunker_.Process(data, size);
+            },
+            FirstRowEnd,
+            // Where the straddling row ends depends on the quoting state at
+            // the end of the previous data, so scan both together
+            parse_options.newlines_in_values),
+        num_cols_(-1) {}
+
+ protected:
+  // Read the header rows and parse the first block holding data rows, which
+  // gives the number of columns when there is no header. At the end of
+  // input, first_parser_ holds no rows.
+  Status ReadFirstBlock() {
+    Block block;
+    const int32_t header_rows = parse_options_.header_rows;
+    if (header_rows > 0) {
+      BlockParser header(pool_, parse_options_, -1, header_rows);
+      while (header.num_rows() < header_rows) {
+        RETURN_NOT_OK(ReadBlock(&block));
+        if (block.empty()) {
+          return Status::Invalid("CSV file ends before the end of its header");
+        }
+        // Data rows may follow the header in the same block
+        Block rest;
+        for (const auto& buffer : block) {
+          if (header.num_rows() < header_rows) {
+            int64_t parsed_size;
+            RETURN_NOT_OK(header.Parse(buffer, &parsed_size));
+            if (parsed_size < buffer->size()) {
+              rest.push_back(
+                  SliceBuffer(buffer, parsed_size, buffer->size() - parsed_size));
+            }
+          } else {
+            rest.push_back(buffer);
+          }
+        }
+        block = std::move(rest);
+      }
+      num_cols_ = header.num_cols();
+      for (int32_t i = 0; i < num_cols_; ++i) {
+        // Names are taken from the first header row
+        bool first = true;
+        RETURN_NOT_OK(header.VisitColumn(
+            i, [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+              if (first) {
+                column_names_.emplace_back(reinterpret_cast<const char*>(data), size);
+                first = false;
+              }
+              return Status::OK();
+            }));
+      }
+    }
+
+    // Blocks of blank lines hold no data rows
+    while (first_parser_ == nullptr || first_parser_->num_rows() == 0) {
+      if (block.empty()) {
+        RETURN_NOT_OK(ReadBlock(&block));
+        if (block.empty()) {
+          break;
+        }
+      }
+      RETURN_NOT_OK(ParseBlock(block, &first_parser_));
+      block.clear();
+    }
+    if (num_cols_ < 0) {
+      if (first_parser_ == nullptr || first_parser_->num_rows() == 0) {
+        return Status::Invalid("Empty CSV file");
+      }
+      num_cols_ = first_parser_->num_cols();
+      for (int32_t i = 0; i < num_cols_; ++i) {
+        std::stringstream ss;
+        ss << "f" << i;
+        column_names_.push_back(ss.str());
+      }
+    }
+    if (first_parser_ == nullptr) {
+      first_parser_ = std::make_shared<BlockParser>(pool_, parse_options_, num_cols_);
+    }
+    return Status::OK();
+  }
+
+  // May be called from any thread
+  Status ParseBlock(const Block& block, std::shared_ptr<BlockParser>* out) const {
+    auto parser = std::make_shared<BlockParser>(pool_, parse_options_, num_cols_);
+    RETURN_NOT_OK(parser->Parse(block));
+    *out = parser;
+    return Status::OK();
+  }
+
+  // The type of a column, given by the options or inferred from the parsed rows
+  Status ColumnType(const std::vector<std::shared_ptr<BlockParser>>& parsers,
+                    int32_t col_index, std::shared_ptr<DataType>* out) const {
+    const auto it = convert_options_.column_types.find(column_names_[col_index]);
+    if (it != convert_options_.column_types.end()) {
+      *out = it->second;
+      return Status::OK();
+    }
+    return InferColumnType(parsers, col_index, convert_options_, out);
+  }
+
+  // Read input up to the end of the last whole row. An empty block is
+  // returned at the end of input.
+  Status ReadBlock(Block* out) { return block_reader_.ReadBlock(out); }
+
+  MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+  Chunker chunker_;
+  BlockReader block_reader_;
+
+  int32_t num_cols_;
+  std::vector<std::string> column_names_;
+  std::shared_ptr<BlockParser> first_parser_;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// StreamingReader implementation
+
+class StreamingReader::StreamingReaderImpl : public BaseReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                      const ReadOptions& read_options,
+                      const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options)
+      : BaseReader(pool, input, read_options, parse_options, convert_options),
+        pending_(std::max(1, GetCpuThreadPoolCapacity())) {}
+
+  Status Init() {
+    RETURN_NOT_OK(ReadFirstBlock());
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int32_t i = 0; i < num_cols_; ++i) {
+      std::shared_ptr<DataType> type;
+      RETURN_NOT_OK(ColumnType({first_parser_}, i, &type));
+      std::shared_ptr<Converter> converter;
+      RETURN_NOT_OK(Converter::Make(type, convert_options_, pool_, &converter));
+      converters_.push_back(converter);
+      fields.push_back(field(column_names_[i], type));
+    }
+    schema_ = ::arrow::schema(fields);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    // Blocks of blank lines yield no record batch
+    do {
+      RETURN_NOT_OK(read_options_.use_threads ? NextConverted(out) : ConvertNext(out));
+    } while (*out != nullptr && (*out)->num_rows() == 0);
+    return Status::OK();
+  }
+
+ private:
+  // Parse the block unless already parsed, then convert it. May be called
+  // from any thread.
+  Status ConvertBlock(const Block& block, std::shared_ptr<BlockParser> parser,
+                      std::shared_ptr<RecordBatch>* out) const {
+    if (parser == nullptr) {
+      RETURN_NOT_OK(ParseBlock(block, &parser));
+    }
+    std::vector<std::shared_ptr<Array>> columns(converters_.size());
+    for (int32_t i = 0; i < num_cols_; ++i) {
+      RETURN_NOT_OK(converters_[i]->Convert(*parser, i, &columns[i]));
+    }
+    *out = RecordBatch::Make(schema_, parser->num_rows(), columns);
+    return Status::OK();
+  }
+
+  // Either the first block, already parsed, or the next block of input.
+  // Both are empty at the end of input.
+  Status NextBlock(Block* block, std::shared_ptr<BlockParser>* parser) {
+    if (first_parser_ != nullptr) {
+      *parser = std::move(first_parser_);
+      first_parser_.reset();
+      block->clear();
+      return Status::OK();
+    }
+    parser->reset();
+    return ReadBlock(block);
+  }
+
+  Status ConvertNext(std::shared_ptr<RecordBatch>* out) {
+    Block block;
+    std::shared_ptr<BlockParser> parser;
+    RETURN_NOT_OK(NextBlock(&block, &parser));
+    if (block.empty() && parser == nullptr) {
+      out->reset();
+      return Status::OK();
+    }
+    return ConvertBlock(block, parser, out);
+  }
+
+  Status NextConverted(std::shared_ptr<RecordBatch>* out) {
+    // Keep the blocks following the one returned being converted
+    while (!pending_.full()) {
+      Block block;
+      std::shared_ptr<BlockParser> parser;
+      RETURN_NOT_OK(NextBlock(&block, &parser));
+      if (block.empty() && parser == nullptr) {
+        break;
+      }
+      pending_.Submit([this, block, parser](std::shared_ptr<RecordBatch>* batch) {
+        return ConvertBlock(block, parser, batch);
+      });
+    }
+    if (pending_.empty()) {
+      out->reset();
+      return Status::OK();
+    }
+    return pending_.Pop(out);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<Converter>> converters_;
+  // Conversion tasks refer to this reader, so they are waited for first
+  ReadaheadQueue<std::shared_ptr<RecordBatch>> pending_;
+};
+
+StreamingReader::StreamingReader() {}
+
+StreamingReader::~StreamingReader() {}
+
+Status StreamingReader::Open(MemoryPool* pool,
+                             const std::shared_ptr<io::InputStream>& input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             const ConvertOptions& convert_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  std::shared_ptr<StreamingReader> reader(new StreamingReader());
+  reader->impl_.reset(new StreamingReaderImpl(pool, input, read_options, parse_options,
+                                              convert_options));
+  RETURN_NOT_OK(reader->impl_->Init());
+  *out = reader;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> StreamingReader::schema() const { return impl_->schema(); }
+
+Status StreamingReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+// ----------------------------------------------------------------------
+// Table reading
+
+namespace {
+
+class TableReader : public BaseReader {
+ public:
+  using BaseReader::BaseReader;
+
+  Status Read(std::shared_ptr<Table>* out) {
+    RETURN_NOT_OK(ReadFirstBlock());
+    std::vector<std::shared_ptr<BlockParser>> parsers;
+    RETURN_NOT_OK(ParseAll(&parsers));
+
+    std::vector<std::shared_ptr<Field>> fields(num_cols_);
+    std::vector<std::shared_ptr<Column>> columns(num_cols_);
+    auto convert_column = [&](int i) -> Status {
+      std::shared_ptr<DataType> type;
+      RETURN_NOT_OK(ColumnType(parsers, i, &type));
+      std::shared_ptr<Converter> converter;
+      RETURN_NOT_OK(Converter::Make(type, convert_options_, pool_, &converter));
+      ArrayVector chunks;
+      for (const auto& parser : parsers) {
+        std::shared_ptr<Array> chunk;
+        RETURN_NOT_OK(converter->Convert(*parser, i, &chunk));
+        chunks.push_back(chunk);
+      }
+      fields[i] = field(column_names_[i], type);
+      columns[i] = std::make_shared<Column>(fields[i], chunks);
+      return Status::OK();
+    };
+    if (read_options_.use_threads) {
+      RETURN_NOT_OK(ParallelFor(num_cols_, convert_column));
+    } else {
+      for (int32_t i = 0; i < num_cols_; ++i) {
+        RETURN_NOT_OK(convert_column(i));
+      }
+    }
+    *out = Table::Make(schema(fields), columns);
+    return Status::OK();
+  }
+
+ private:
+  struct ParseTask {
+    std::future<Status> status;
+    std::shared_ptr<BlockParser> parser;
+  };
+
+  // Parse all blocks holding rows, on the thread pool as they are read if
+  // enabled
+  Status ParseAll(std::vector<std::shared_ptr<BlockParser>>* out) {
+    if (first_parser_->num_rows() > 0) {
+      out->push_back(first_parser_);
+    }
+    std::vector<std::unique_ptr<ParseTask>> tasks;
+    Status status;
+    while (true) {
+      Block block;
+      status = ReadBlock(&block);
+      if (!status.ok() || block.empty()) {
+        break;
+      }
+      if (read_options_.use_threads) {
+        std::unique_ptr<ParseTask> task(new ParseTask);
+        ParseTask* raw_task = task.get();
+        task->status = ::arrow::internal::GetCpuThreadPool()->Submit(
+            [this, block, raw_task]() { return ParseBlock(block, &raw_task->parser); });
+        tasks.push_back(std::move(task));
+      } else {
+        std::shared_ptr<BlockParser> parser;
+        status = ParseBlock(block, &parser);
+        if (!status.ok()) {
+          break;
+        }
+        if (parser->num_rows() > 0) {
+          out->push_back(parser);
+        }
+      }
+    }
+    // Tasks refer to this reader, so wait for all of them
+    for (const auto& task : tasks) {
+      status &= task->status.get();
+      if (status.ok() && task->parser->num_rows() > 0) {
+        out->push_back(task->parser);
+      }
+    }
+    return status;
+  }
+};
+
+}  // namespace
+
+Status ReadTable(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                 const ReadOptions& read_options, const ParseOptions& parse_options,
+                 const ConvertOptions& convert_options, std::shared_ptr<Table>* out) {
+  TableReader reader(pool, input, read_options, parse_options, convert_options);
+  return reader.Read(out);
+}
+
+}  // namespace csv
+}  // namespace arrow
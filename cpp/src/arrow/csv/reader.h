@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Reading of CSV files into Arrow record batches and tables
+
+#ifndef ARROW_CSV_READER_H
+#define ARROW_CSV_READER_H
+
+#include <memory>
+
+#include "arrow/csv/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Table;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace csv {
+
+/// \class StreamingReader
+/// \brief Read CSV from a stream, one record batch per block of input
+///
+/// Blocks are split on row boundaries and converted in input order. The
+/// types of the columns not given in ConvertOptions::column_types are
+/// inferred from the first block holding data rows. When
+/// ReadOptions::use_threads is set, the blocks following the one being
+/// returned are parsed and converted ahead on the CPU thread pool while the
+/// caller consumes the record batches.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  ~StreamingReader() override;
+
+  /// \brief Create a reader, reading the header and the first block of data
+  static Status Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                     const ReadOptions& read_options,
+                     const ParseOptions& parse_options,
+                     const ConvertOptions& convert_options,
+                     std::shared_ptr<StreamingReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  StreamingReader();
+
+  class StreamingReaderImpl;
+  std::unique_ptr<StreamingReaderImpl> impl_;
+};
+
+/// \brief Read all CSV rows from a stream into a table
+///
+/// The types of the columns not given in ConvertOptions::column_types are
+/// inferred from all rows. When ReadOptions::use_threads is set, blocks are
+/// parsed on the CPU thread pool as they are read, then columns are
+/// converted in parallel. Each column has one chunk per block of input.
+ARROW_EXPORT
+Status ReadTable(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                 const ReadOptions& read_options, const ParseOptions& parse_options,
+                 const ConvertOptions& convert_options, std::shared_ptr<Table>* out);
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_READER_H
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arrow {
 namespace io {
@@ -86,6 +87,30 @@ class BufferedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status WriteV(const std::vector<IOVec>& iov) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t total = 0;
+    for (const auto& region : iov) {
+      if (region.nbytes < 0) {
+        return Status::Invalid("write count should be >= 0");
+      }
+      total += region.nbytes;
+    }
+    if (total + buffer_pos_ >= BUFFER_SIZE) {
+      // Pass the regions through in one call rather than copying them
+      RETURN_NOT_OK(FlushUnlocked());
+      raw_pos_ = -1;
+      return raw_->WriteV(iov);
+    }
+    for (const auto& region : iov) {
+      if (region.nbytes > 0) {
+        std::memcpy(buffer_data_ + buffer_pos_, region.data, region.nbytes);
+        buffer_pos_ += region.nbytes;
+      }
+    }
+    return Status::OK();
+  }
+
   Status FlushUnlocked() {
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
@@ -131,6 +156,10 @@ Status BufferedOutputStream::Write(const void* data, int64_t nbytes) {
   return impl_->Write(data, nbytes);
 }
 
+Status BufferedOutputStream::WriteV(const std::vector<IOVec>& iov) {
+  return impl_->WriteV(iov);
+}
+
 Status BufferedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -49,6 +50,9 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write several regions to the stream. Thread-safe
+  Status WriteV(const std::vector<IOVec>& iov) override;
+
   Status Flush() override;
 
   /// \brief Return the underlying raw output stream.
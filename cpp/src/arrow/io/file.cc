@@ -38,6 +38,7 @@
 #include <cstring>
 #include <mutex>
 #include <sstream>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -149,6 +150,16 @@ class OSFile {
     return internal::FileWrite(fd_, reinterpret_cast<const uint8_t*>(data), length);
   }
 
+  Status WriteV(const std::vector<IOVec>& iov) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto& region : iov) {
+      if (region.nbytes < 0) {
+        return Status::IOError("Length must be non-negative");
+      }
+    }
+    return internal::FileWriteV(fd_, iov);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -343,6 +354,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteV(const std::vector<IOVec>& iov) {
+  return impl_->WriteV(iov);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -569,6 +584,18 @@ Status MemoryMappedFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
 
 bool MemoryMappedFile::supports_zero_copy() const { return true; }
 
+Status MemoryMappedFile::WillNeed(int64_t position, int64_t nbytes) {
+  if (position < 0) {
+    return Status::Invalid("position is out of bounds");
+  }
+  std::lock_guard<std::mutex> resize_guard(memory_map_->resize_lock());
+  nbytes = std::max<int64_t>(0, std::min(nbytes, memory_map_->size() - position));
+  if (nbytes == 0) {
+    return Status::OK();
+  }
+  return internal::MemoryAdviseWillNeed(memory_map_->data() + position, nbytes);
+}
+
 Status MemoryMappedFile::WriteAt(int64_t position, const void* data, int64_t nbytes) {
   std::lock_guard<std::mutex> guard(memory_map_->write_lock());
 
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -94,6 +95,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write several regions with vectored system calls. Thread-safe
+  Status WriteV(const std::vector<IOVec>& iov) override;
+
   int file_descriptor() const;
 
  private:
@@ -210,6 +214,9 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   bool supports_zero_copy() const override;
 
+  // Advise the operating system to page in a range of the map. Thread-safe
+  Status WillNeed(int64_t position, int64_t nbytes) override;
+
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/status.h"
 
@@ -51,10 +52,23 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+Status RandomAccessFile::WillNeed(int64_t position, int64_t nbytes) {
+  return Status::OK();
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+Status Writable::WriteV(const std::vector<IOVec>& iov) {
+  for (const auto& region : iov) {
+    if (region.nbytes > 0) {
+      RETURN_NOT_OK(Write(region.data, region.nbytes));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 }  // namespace io
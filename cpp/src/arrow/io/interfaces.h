@@ -86,12 +86,24 @@ class ARROW_EXPORT Seekable {
   virtual Status Seek(int64_t position) = 0;
 };
 
+/// \brief A region of memory to be written, see Writable::WriteV
+struct ARROW_EXPORT IOVec {
+  const void* data;
+  int64_t nbytes;
+};
+
 class ARROW_EXPORT Writable {
  public:
   virtual ~Writable() = default;
 
   virtual Status Write(const void* data, int64_t nbytes) = 0;
 
+  /// \brief Write several regions of memory, one after the other
+  ///
+  /// The default implementation calls Write for each region. Implementations
+  /// may override it to write all regions with a single system call or copy.
+  virtual Status WriteV(const std::vector<IOVec>& iov);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -154,6 +166,16 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   virtual Status ReadAt(int64_t position, int64_t nbytes,
                         std::shared_ptr<Buffer>* out) = 0;
 
+  /// \brief Advise that a range of the file will be read soon, so that it can
+  /// be brought into memory ahead of time. The default implementation does
+  /// nothing. This is only a hint: callers may ignore a failure, and reads of
+  /// the range must not depend on it.
+  ///
+  /// \param[in] position Where the range starts
+  /// \param[in] nbytes The length of the range
+  /// \return Status
+  virtual Status WillNeed(int64_t position, int64_t nbytes);
+
  protected:
   RandomAccessFile();
 
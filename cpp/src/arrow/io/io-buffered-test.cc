@@ -188,6 +188,27 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
+TEST_F(TestBufferedOutputStream, WriteV) {
+  OpenBuffered();
+
+  const std::string small = GenerateRandomData(100);
+  const std::string large = GenerateRandomData(10000);
+  auto Region = [](const std::string& data) {
+    return IOVec{data.data(), static_cast<int64_t>(data.size())};
+  };
+
+  // Small regions are buffered, large ones go through to the file
+  ASSERT_OK(stream_->WriteV({Region(small), Region(small)}));
+  AssertTell(200);
+  ASSERT_OK(stream_->WriteV({Region(small), Region(large), Region(small)}));
+  AssertTell(10400);
+  ASSERT_OK(stream_->WriteV({Region(small)}));
+  AssertTell(10500);
+  ASSERT_OK(stream_->Close());
+
+  AssertFileContents(path_, small + small + small + large + small + small);
+}
+
 TEST_F(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
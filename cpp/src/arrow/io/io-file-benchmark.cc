@@ -29,6 +29,7 @@
 #include <iostream>
 #include <thread>
 #include <valarray>
+#include <vector>
 
 #include <fcntl.h>
 #include <poll.h>
@@ -121,14 +122,25 @@ static void SetupPipeWriter(std::shared_ptr<io::OutputStream>* stream,
 static void BenchmarkStreamingWrites(benchmark::State& state,
                                      std::valarray<int64_t> sizes,
                                      io::OutputStream* stream,
-                                     BackgroundReader* reader = nullptr) {
+                                     BackgroundReader* reader = nullptr,
+                                     bool vectored = false) {
   const std::string datastr(*std::max_element(std::begin(sizes), std::end(sizes)), 'x');
   const void* data = datastr.data();
   const int64_t sum_sizes = sizes.sum();
 
+  // With vectored writes, all sizes are written in a single WriteV call
+  std::vector<io::IOVec> iov;
+  for (const int64_t size : sizes) {
+    iov.push_back({data, size});
+  }
+
   while (state.KeepRunning()) {
-    for (const int64_t size : sizes) {
-      ABORT_NOT_OK(stream->Write(data, size));
+    if (vectored) {
+      ABORT_NOT_OK(stream->WriteV(iov));
+    } else {
+      for (const int64_t size : sizes) {
+        ABORT_NOT_OK(stream->Write(data, size));
+      }
     }
   }
   const int64_t total_bytes = static_cast<int64_t>(state.iterations()) * sum_sizes;
@@ -177,6 +189,15 @@ static void BM_FileOutputStreamSmallWritesToPipe(
   BenchmarkStreamingWrites(state, small_sizes, stream.get(), reader.get());
 }
 
+static void BM_FileOutputStreamSmallWritesVToPipe(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::shared_ptr<io::OutputStream> stream;
+  std::shared_ptr<BackgroundReader> reader;
+  SetupPipeWriter(&stream, &reader);
+
+  BenchmarkStreamingWrites(state, small_sizes, stream.get(), reader.get(), true);
+}
+
 static void BM_FileOutputStreamLargeWritesToPipe(
     benchmark::State& state) {  // NOLINT non-const reference
   std::shared_ptr<io::OutputStream> stream;
@@ -217,6 +238,10 @@ BENCHMARK(BM_FileOutputStreamSmallWritesToPipe)
     ->Repetitions(2)
     ->MinTime(1.0)
     ->UseRealTime();
+BENCHMARK(BM_FileOutputStreamSmallWritesVToPipe)
+    ->Repetitions(2)
+    ->MinTime(1.0)
+    ->UseRealTime();
 BENCHMARK(BM_FileOutputStreamLargeWritesToPipe)
     ->Repetitions(2)
     ->MinTime(1.0)
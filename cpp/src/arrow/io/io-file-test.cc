@@ -190,6 +190,35 @@ TEST_F(TestFileOutputStream, InvalidWrites) {
   ASSERT_RAISES(IOError, stream_->Write(data, -1));
 }
 
+TEST_F(TestFileOutputStream, WriteV) {
+  OpenFile();
+
+  // More regions than a single writev call accepts on common platforms
+  std::string expected;
+  std::vector<std::string> pieces;
+  for (int i = 0; i < 3000; ++i) {
+    pieces.push_back(std::to_string(i));
+    expected += pieces.back();
+  }
+  std::vector<IOVec> iov;
+  for (const auto& piece : pieces) {
+    iov.push_back({piece.data(), static_cast<int64_t>(piece.size())});
+    iov.push_back({nullptr, 0});
+  }
+  ASSERT_OK(file_->WriteV(iov));
+  ASSERT_OK(stream_->WriteV({}));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), position);
+  ASSERT_OK(file_->Close());
+
+  AssertFileContents(path_, expected);
+
+  OpenFile();
+  ASSERT_RAISES(IOError, file_->WriteV({{"", -1}}));
+}
+
 TEST_F(TestFileOutputStream, Tell) {
   OpenFile();
 
@@ -614,6 +643,29 @@ TEST_F(TestMemoryMappedFile, WriteRead) {
   }
 }
 
+TEST_F(TestMemoryMappedFile, WillNeed) {
+  const int64_t buffer_size = 1 << 16;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-will-need-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+
+  // Unaligned, empty and out of bounds ranges are fine
+  ASSERT_OK(result->WillNeed(0, buffer_size));
+  ASSERT_OK(result->WillNeed(100, 5000));
+  ASSERT_OK(result->WillNeed(buffer_size - 1, 100));
+  ASSERT_OK(result->WillNeed(10, 0));
+  ASSERT_OK(result->WillNeed(buffer_size + 10, 10));
+  ASSERT_RAISES(Invalid, result->WillNeed(-1, 10));
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(result->ReadAt(100, 5000, &out_buffer));
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data() + 100, 5000));
+}
+
 TEST_F(TestMemoryMappedFile, WriteResizeRead) {
   const int64_t buffer_size = 1024;
   const int reps = 5;
@@ -82,6 +82,24 @@ TEST_F(TestBufferOutputStream, WriteAfterFinish) {
   ASSERT_RAISES(IOError, stream_->Write(data));
 }
 
+TEST_F(TestBufferOutputStream, WriteV) {
+  std::string data1 = "data123456";
+  std::string data2 = "abc";
+  ASSERT_OK(stream_->Write(data2));
+  ASSERT_OK(stream_->WriteV({{data1.data(), static_cast<int64_t>(data1.size())},
+                             {nullptr, 0},
+                             {data2.data(), static_cast<int64_t>(data2.size())}}));
+  ASSERT_OK(stream_->WriteV({}));
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(16, position);
+
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ("abcdata123456abc",
+            std::string(reinterpret_cast<const char*>(buffer_->data()), 16));
+}
+
 TEST(TestFixedSizeBufferWriter, Basics) {
   std::shared_ptr<Buffer> buffer;
   ASSERT_OK(AllocateBuffer(1024, &buffer));
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <mutex>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
@@ -91,6 +92,26 @@ Status BufferOutputStream::Write(const void* data, int64_t nbytes) {
   return Status::OK();
 }
 
+Status BufferOutputStream::WriteV(const std::vector<IOVec>& iov) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  DCHECK(buffer_);
+  int64_t total = 0;
+  for (const auto& region : iov) {
+    total += region.nbytes;
+  }
+  // Grow the buffer once, then copy everything in a single pass
+  RETURN_NOT_OK(Reserve(total));
+  for (const auto& region : iov) {
+    if (region.nbytes > 0) {
+      memcpy(mutable_data_ + position_, region.data, region.nbytes);
+      position_ += region.nbytes;
+    }
+  }
+  return Status::OK();
+}
+
 Status BufferOutputStream::Reserve(int64_t nbytes) {
   int64_t new_capacity = capacity_;
   while (position_ + nbytes > new_capacity) {
@@ -122,6 +143,13 @@ Status MockOutputStream::Write(const void* data, int64_t nbytes) {
   return Status::OK();
 }
 
+Status MockOutputStream::WriteV(const std::vector<IOVec>& iov) {
+  for (const auto& region : iov) {
+    extent_bytes_written_ += region.nbytes;
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // In-memory buffer writer
 
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -49,6 +50,7 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   Status Close() override;
   Status Tell(int64_t* position) const override;
   Status Write(const void* data, int64_t nbytes) override;
+  Status WriteV(const std::vector<IOVec>& iov) override;
 
   /// Close the stream and return the buffer
   Status Finish(std::shared_ptr<Buffer>* result);
@@ -73,6 +75,7 @@ class ARROW_EXPORT MockOutputStream : public OutputStream {
   Status Close() override;
   Status Tell(int64_t* position) const override;
   Status Write(const void* data, int64_t nbytes) override;
+  Status WriteV(const std::vector<IOVec>& iov) override;
 
   int64_t GetExtentBytesWritten() const { return extent_bytes_written_; }
 
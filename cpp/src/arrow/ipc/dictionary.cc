@@ -22,7 +22,10 @@
 #include <sstream>
 #include <utility>
 
+#include "arrow/array.h"
+#include "arrow/concatenate.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
 
 namespace arrow {
 namespace ipc {
@@ -80,5 +83,34 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::UpdateDictionary(int64_t id,
+                                        const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    std::stringstream ss;
+    ss << "Dictionary with id " << id << " not found";
+    return Status::KeyError(ss.str());
+  }
+  intptr_t address = reinterpret_cast<intptr_t>(dictionary.get());
+  it->second = dictionary;
+  dictionary_to_id_[address] = id;
+  return Status::OK();
+}
+
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(GetDictionary(id, &dictionary));
+  if (!dictionary->type()->Equals(*delta->type())) {
+    std::stringstream ss;
+    ss << "Delta dictionary with id " << id << " has type " << delta->type()->ToString()
+       << ", expected " << dictionary->type()->ToString();
+    return Status::TypeError(ss.str());
+  }
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(Concatenate({dictionary, delta}, pool, &combined));
+  return UpdateDictionary(id, combined);
+}
+
 }  // namespace ipc
 }  // namespace arrow
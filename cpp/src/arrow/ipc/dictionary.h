@@ -32,6 +32,7 @@ namespace arrow {
 
 class Array;
 class Field;
+class MemoryPool;
 
 namespace ipc {
 
@@ -59,6 +60,19 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Replace the dictionary with a particular id. The previous
+  /// dictionary object still maps to the same id. Returns KeyError if there
+  /// is no dictionary with that id
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
+  /// \brief Append the entries of a delta dictionary to the dictionary with a
+  /// particular id. Returns KeyError if there is no dictionary with that id
+  ///
+  /// Only dictionaries of null, boolean, fixed-width and binary types are
+  /// supported
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                            MemoryPool* pool);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of dictionaries stored in the memo
@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/test-util.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+
+// 16MB
+constexpr int64_t kTotalSize = 1 << 24;
+constexpr int kNumFields = 64;
+
+// A table of int64 columns with nulls and few distinct values, split into
+// num_chunks chunks
+static std::shared_ptr<Table> MakeTable(int num_chunks) {
+  const int64_t length = kTotalSize / kNumFields / sizeof(int64_t);
+
+  std::vector<bool> is_valid;
+  random_is_valid(length, 0.1, &is_valid);
+  std::vector<int64_t> values;
+  randint<int64_t>(length, 0, 100, &values);
+
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(is_valid, values, &array);
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Column>> columns;
+  for (int i = 0; i < kNumFields; ++i) {
+    std::stringstream ss;
+    ss << "f" << i;
+    fields.push_back(field(ss.str(), int64()));
+
+    ArrayVector chunks;
+    const int64_t chunk_length = length / num_chunks;
+    for (int j = 0; j < num_chunks; ++j) {
+      const int64_t offset = j * chunk_length;
+      chunks.push_back(j == num_chunks - 1 ? array->Slice(offset)
+                                           : array->Slice(offset, chunk_length));
+    }
+    columns.push_back(std::make_shared<Column>(fields.back(), chunks));
+  }
+  return Table::Make(::arrow::schema(fields), columns);
+}
+
+static Status WriteFeather(const Table& table, Compression::type compression,
+                           std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<io::BufferOutputStream> stream;
+  RETURN_NOT_OK(
+      io::BufferOutputStream::Create(kTotalSize, default_memory_pool(), &stream));
+  std::unique_ptr<ipc::feather::TableWriter> writer;
+  RETURN_NOT_OK(ipc::feather::TableWriter::Open(stream, &writer));
+  RETURN_NOT_OK(writer->SetCompression(compression));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  RETURN_NOT_OK(writer->Finalize());
+  return stream->Finish(out);
+}
+
+// Arguments: compression, number of chunks
+static void BM_WriteFeather(benchmark::State& state) {  // NOLINT non-const reference
+  const auto compression = static_cast<Compression::type>(state.range(0));
+  auto table = MakeTable(static_cast<int>(state.range(1)));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<Buffer> buffer;
+    if (!WriteFeather(*table, compression, &buffer).ok()) {
+      state.SkipWithError("Failed to write!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+static void BM_ReadFeather(benchmark::State& state) {  // NOLINT non-const reference
+  const auto compression = static_cast<Compression::type>(state.range(0));
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(WriteFeather(*MakeTable(1), compression, &buffer));
+
+  while (state.KeepRunning()) {
+    std::unique_ptr<ipc::feather::TableReader> reader;
+    ABORT_NOT_OK(ipc::feather::TableReader::Open(
+        std::make_shared<io::BufferReader>(buffer), &reader));
+    std::shared_ptr<Table> table;
+    if (!reader->Read(&table).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+// Read the columns one at a time, for comparison with BM_ReadFeather
+static void BM_ReadFeatherSerial(benchmark::State& state) {  // NOLINT non-const ref
+  const auto compression = static_cast<Compression::type>(state.range(0));
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(WriteFeather(*MakeTable(1), compression, &buffer));
+
+  while (state.KeepRunning()) {
+    std::unique_ptr<ipc::feather::TableReader> reader;
+    ABORT_NOT_OK(ipc::feather::TableReader::Open(
+        std::make_shared<io::BufferReader>(buffer), &reader));
+    for (int i = 0; i < reader->num_columns(); ++i) {
+      std::shared_ptr<Column> column;
+      if (!reader->GetColumn(i, &column).ok()) {
+        state.SkipWithError("Failed to read!");
+      }
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+// Read a file on local disk through a source without zero-copy reads.
+// Arguments: whether columns are read with Read() rather than one at a time
+static void BM_ReadFeatherFile(benchmark::State& state) {  // NOLINT non-const ref
+  const char* path = "feather-benchmark.feather";
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(WriteFeather(*MakeTable(1), Compression::UNCOMPRESSED, &buffer));
+  {
+    std::shared_ptr<io::FileOutputStream> stream;
+    ABORT_NOT_OK(io::FileOutputStream::Open(path, &stream));
+    ABORT_NOT_OK(stream->Write(buffer->data(), buffer->size()));
+    ABORT_NOT_OK(stream->Close());
+  }
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::ReadableFile> file;
+    ABORT_NOT_OK(io::ReadableFile::Open(path, &file));
+    std::unique_ptr<ipc::feather::TableReader> reader;
+    ABORT_NOT_OK(ipc::feather::TableReader::Open(file, &reader));
+
+    Status st;
+    if (state.range(0)) {
+      std::shared_ptr<Table> table;
+      st = reader->Read(&table);
+    } else {
+      for (int i = 0; i < reader->num_columns() && st.ok(); ++i) {
+        std::shared_ptr<Column> column;
+        st = reader->GetColumn(i, &column);
+      }
+    }
+    if (!st.ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+BENCHMARK(BM_WriteFeather)
+    ->Args({Compression::UNCOMPRESSED, 1})
+    ->Args({Compression::UNCOMPRESSED, 16})
+    ->Args({Compression::LZ4, 1})
+    ->Args({Compression::LZ4, 16})
+    ->Args({Compression::ZSTD, 1})
+    ->Args({Compression::ZSTD, 16})
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+BENCHMARK(BM_ReadFeather)
+    ->Arg(Compression::UNCOMPRESSED)
+    ->Arg(Compression::LZ4)
+    ->Arg(Compression::ZSTD)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+BENCHMARK(BM_ReadFeatherSerial)
+    ->Arg(Compression::UNCOMPRESSED)
+    ->Arg(Compression::LZ4)
+    ->Arg(Compression::ZSTD)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+BENCHMARK(BM_ReadFeatherFile)->Arg(0)->Arg(1)->MinTime(1.0)->UseRealTime();
+
+}  // namespace arrow
@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -47,7 +48,8 @@ struct ARROW_EXPORT ColumnType {
 };
 
 struct ARROW_EXPORT ArrayMetadata {
-  ArrayMetadata() {}
+  ArrayMetadata()
+      : compression(fbs::CompressionType_UNCOMPRESSED), uncompressed_size(0) {}
 
   ArrayMetadata(fbs::Type type, int64_t offset, int64_t length, int64_t null_count,
                 int64_t total_bytes)
@@ -55,12 +57,16 @@ struct ARROW_EXPORT ArrayMetadata {
         offset(offset),
         length(length),
         null_count(null_count),
-        total_bytes(total_bytes) {}
+        total_bytes(total_bytes),
+        compression(fbs::CompressionType_UNCOMPRESSED),
+        uncompressed_size(0) {}
 
   bool Equals(const ArrayMetadata& other) const {
     return this->type == other.type && this->offset == other.offset &&
            this->length == other.length && this->null_count == other.null_count &&
-           this->total_bytes == other.total_bytes;
+           this->total_bytes == other.total_bytes &&
+           this->compression == other.compression &&
+           this->uncompressed_size == other.uncompressed_size;
   }
 
   fbs::Type type;
@@ -68,6 +74,10 @@ struct ARROW_EXPORT ArrayMetadata {
   int64_t length;
   int64_t null_count;
   int64_t total_bytes;
+
+  // Only set for compressed arrays
+  fbs::CompressionType compression;
+  int64_t uncompressed_size;
 };
 
 struct ARROW_EXPORT CategoryMetadata {
@@ -115,6 +125,7 @@ class ARROW_EXPORT TableBuilder {
   bool finished_;
   std::string description_;
   int64_t num_rows_;
+  int version_;
 };
 
 class ARROW_EXPORT TableMetadata {
@@ -130,6 +141,23 @@ class ARROW_EXPORT TableMetadata {
       std::cout << "This Feather file is old"
                 << " and will not be readable beyond the 0.3.0 release" << std::endl;
     }
+    if (table_->version() > kFeatherCompressedChunkedVersion) {
+      std::stringstream ss;
+      ss << "Unsupported Feather file version " << table_->version();
+      return Status::Invalid(ss.str());
+    }
+    if (table_->version() < kFeatherCompressedChunkedVersion) {
+      // Compression and chunks are unknown to older versions, so their
+      // fields cannot be trusted in such files
+      for (int64_t i = 0; i < num_columns(); ++i) {
+        if (UsesCompressionOrChunks(column(static_cast<int>(i)))) {
+          std::stringstream ss;
+          ss << "Feather file of version " << table_->version()
+             << " has compressed or chunked columns";
+          return Status::Invalid(ss.str());
+        }
+      }
+    }
     return Status::OK();
   }
 
@@ -149,6 +177,20 @@ class ARROW_EXPORT TableMetadata {
   const fbs::Column* column(int i) { return table_->columns()->Get(i); }
 
  private:
+  static bool UsesCompressionOrChunks(const fbs::Column* column) {
+    if (column->chunks() != nullptr) {
+      return true;
+    }
+    if (column->values()->compression() != fbs::CompressionType_UNCOMPRESSED) {
+      return true;
+    }
+    if (column->metadata_type() == fbs::TypeMetadata_CategoryMetadata) {
+      auto meta = static_cast<const fbs::CategoryMetadata*>(column->metadata());
+      return meta->levels()->compression() != fbs::CompressionType_UNCOMPRESSED;
+    }
+    return false;
+  }
+
   std::shared_ptr<Buffer> metadata_buffer_;
   const fbs::CTable* table_;
 };
@@ -156,7 +198,8 @@ class ARROW_EXPORT TableMetadata {
 static inline flatbuffers::Offset<fbs::PrimitiveArray> GetPrimitiveArray(
     FBB& fbb, const ArrayMetadata& array) {
   return fbs::CreatePrimitiveArray(fbb, array.type, fbs::Encoding_PLAIN, array.offset,
-                                   array.length, array.null_count, array.total_bytes);
+                                   array.length, array.null_count, array.total_bytes,
+                                   array.compression, array.uncompressed_size);
 }
 
 static inline fbs::TimeUnit ToFlatbufferEnum(TimeUnit::type unit) {
@@ -187,6 +230,8 @@ static inline void FromFlatbuffer(const fbs::PrimitiveArray* values, ArrayMetada
   out->length = values->length();
   out->null_count = values->null_count();
   out->total_bytes = values->total_bytes();
+  out->compression = values->compression();
+  out->uncompressed_size = values->uncompressed_size();
 }
 
 class ARROW_EXPORT ColumnBuilder {
@@ -198,6 +243,11 @@ class ARROW_EXPORT ColumnBuilder {
 
   Status Finish();
   void SetValues(const ArrayMetadata& values);
+
+  // Append a chunk of a column written in several pieces. The first chunk
+  // becomes the column values, overriding SetValues
+  void AddChunk(const ArrayMetadata& chunk);
+
   void SetUserMetadata(const std::string& data);
   void SetCategory(const ArrayMetadata& levels, bool ordered = false);
   void SetTimestamp(TimeUnit::type unit);
@@ -211,6 +261,7 @@ class ARROW_EXPORT ColumnBuilder {
 
   std::string name_;
   ArrayMetadata values_;
+  std::vector<ArrayMetadata> chunks_;
   std::string user_metadata_;
 
   // Column metadata
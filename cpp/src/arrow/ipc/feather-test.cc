@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstdio>
 #include <memory>
 #include <random>
 #include <sstream>
@@ -24,6 +25,7 @@
 
 #include "gtest/gtest.h"
 
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather.h"
@@ -90,6 +92,8 @@ void AssertArrayEquals(const ArrayMetadata& left, const ArrayMetadata& right) {
   EXPECT_EQ(left.length, right.length);
   EXPECT_EQ(left.null_count, right.null_count);
   EXPECT_EQ(left.total_bytes, right.total_bytes);
+  EXPECT_EQ(left.compression, right.compression);
+  EXPECT_EQ(left.uncompressed_size, right.uncompressed_size);
 }
 
 TEST_F(TestTableBuilder, AddPrimitiveColumn) {
@@ -142,6 +146,94 @@ TEST_F(TestTableBuilder, AddPrimitiveColumn) {
   AssertArrayEquals(values4, values2);
 }
 
+TEST_F(TestTableBuilder, AddChunkedColumn) {
+  std::unique_ptr<ColumnBuilder> cb = tb_->AddColumn("f0");
+
+  // The first chunk becomes the column values, the others are listed in chunks
+  ArrayMetadata chunk1(fbs::Type_INT32, 0, 1000, 100, 4000);
+  ArrayMetadata chunk2(fbs::Type_INT32, 4000, 500, 0, 1200);
+  chunk2.compression = fbs::CompressionType_LZ4;
+  chunk2.uncompressed_size = 2000;
+  ArrayMetadata chunk3(fbs::Type_INT32, 5200, 10, 1, 56);
+  chunk3.compression = fbs::CompressionType_ZSTD;
+  chunk3.uncompressed_size = 48;
+  cb->AddChunk(chunk1);
+  cb->AddChunk(chunk2);
+  cb->AddChunk(chunk3);
+  ASSERT_OK(cb->Finish());
+
+  // A column written in one piece has no chunk list
+  cb = tb_->AddColumn("f1");
+  cb->SetValues(chunk2);
+  ASSERT_OK(cb->Finish());
+
+  Finish();
+
+  auto col = table_->column(0);
+  ArrayMetadata result;
+  FromFlatbuffer(col->values(), &result);
+  AssertArrayEquals(result, chunk1);
+  ASSERT_EQ(fbs::CompressionType_UNCOMPRESSED, col->values()->compression());
+
+  ASSERT_NE(nullptr, col->chunks());
+  ASSERT_EQ(2, static_cast<int>(col->chunks()->size()));
+  FromFlatbuffer(col->chunks()->Get(0), &result);
+  AssertArrayEquals(result, chunk2);
+  FromFlatbuffer(col->chunks()->Get(1), &result);
+  AssertArrayEquals(result, chunk3);
+
+  col = table_->column(1);
+  ASSERT_EQ(nullptr, col->chunks());
+  FromFlatbuffer(col->values(), &result);
+  AssertArrayEquals(result, chunk2);
+
+  ASSERT_EQ(kFeatherCompressedChunkedVersion, table_->version());
+}
+
+TEST_F(TestTableBuilder, CompressedColumnVersion) {
+  ArrayMetadata values(fbs::Type_INT32, 0, 1000, 0, 1200);
+  values.compression = fbs::CompressionType_LZ4;
+  values.uncompressed_size = 4000;
+  std::unique_ptr<ColumnBuilder> cb = tb_->AddColumn("f0");
+  cb->SetValues(values);
+  ASSERT_OK(cb->Finish());
+  Finish();
+
+  ASSERT_EQ(kFeatherCompressedChunkedVersion, table_->version());
+}
+
+TEST(TestTableMetadata, VersionChecks) {
+  auto make_table = [](int version, bool compressed, std::shared_ptr<Buffer>* out) {
+    FBB fbb;
+    ArrayMetadata values(fbs::Type_INT32, 0, 10, 0, 40);
+    if (compressed) {
+      values.compression = fbs::CompressionType_LZ4;
+      values.uncompressed_size = 40;
+    }
+    auto column = fbs::CreateColumn(fbb, fbb.CreateString("f0"),
+                                    GetPrimitiveArray(fbb, values));
+    std::vector<flatbuffers::Offset<fbs::Column>> columns = {column};
+    fbb.Finish(fbs::CreateCTable(fbb, 0, 10, fbb.CreateVector(columns), version));
+    const uint8_t* data = fbb.GetBufferPointer();
+    std::vector<uint8_t> bytes(data, data + fbb.GetSize());
+    ASSERT_OK(CopyBufferFromVector(bytes, default_memory_pool(), out));
+  };
+
+  std::shared_ptr<Buffer> buffer;
+  TableMetadata table;
+  make_table(kFeatherVersion, false, &buffer);
+  ASSERT_OK(table.Open(buffer));
+  make_table(kFeatherCompressedChunkedVersion, true, &buffer);
+  ASSERT_OK(table.Open(buffer));
+
+  // Version 2 files cannot use the fields added by the next version
+  make_table(kFeatherVersion, true, &buffer);
+  ASSERT_RAISES(Invalid, table.Open(buffer));
+
+  make_table(kFeatherCompressedChunkedVersion + 1, false, &buffer);
+  ASSERT_RAISES(Invalid, table.Open(buffer));
+}
+
 TEST_F(TestTableBuilder, AddCategoryColumn) {
   ArrayMetadata values1(fbs::Type_UINT8, 10000, 1000, 100, 4000);
   ArrayMetadata levels(fbs::Type_UTF8, 14000, 10, 0, 300);
@@ -290,6 +382,38 @@ class TestTableWriter : public ::testing::Test {
     }
   }
 
+  // Write a batch in three chunks, with and without compression
+  void CheckRecordBatchChunks(const RecordBatch& batch) {
+    const int64_t length = batch.num_rows();
+    std::vector<std::shared_ptr<RecordBatch>> batches = {
+        batch.Slice(0, length / 3), batch.Slice(length / 3, 1),
+        batch.Slice(length / 3 + 1)};
+    ASSERT_OK(writer_->WriteRecordBatch(*batches[0]));
+    ASSERT_OK(writer_->SetCompression(Compression::LZ4));
+    ASSERT_OK(writer_->WriteRecordBatch(*batches[1]));
+    ASSERT_OK(writer_->WriteRecordBatch(*batches[2]));
+    Finish();
+
+    ASSERT_EQ(kFeatherCompressedChunkedVersion, reader_->version());
+    ASSERT_EQ(length, reader_->num_rows());
+    ASSERT_EQ(batch.num_columns(), reader_->num_columns());
+
+    std::shared_ptr<Column> col;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      ASSERT_OK(reader_->GetColumn(i, &col));
+      ASSERT_EQ(batch.column_name(i), col->name());
+      ASSERT_EQ(3, col->data()->num_chunks());
+      for (int j = 0; j < 3; ++j) {
+        CheckArrays(*batches[j]->column(i), *col->data()->chunk(j));
+      }
+    }
+
+    std::shared_ptr<Table> expected, result;
+    ASSERT_OK(Table::FromRecordBatches(batches, &expected));
+    ASSERT_OK(reader_->Read(&result));
+    ASSERT_TRUE(result->Equals(*expected));
+  }
+
  protected:
   std::shared_ptr<io::BufferOutputStream> stream_;
   std::unique_ptr<TableWriter> writer_;
@@ -334,6 +458,10 @@ TEST_F(TestTableWriter, PrimitiveRoundTrip) {
   ASSERT_OK(writer_->Append("f1", *batch->column(1)));
   Finish();
 
+  // Files without compressed or chunked columns stay readable by version 2
+  // readers
+  ASSERT_EQ(kFeatherVersion, reader_->version());
+
   std::shared_ptr<Column> col;
   ASSERT_OK(reader_->GetColumn(0, &col));
   ASSERT_TRUE(col->data()->chunk(0)->Equals(batch->column(0)));
@@ -422,6 +550,183 @@ TEST_F(TestTableWriter, PrimitiveNullRoundTrip) {
   }
 }
 
+void CheckCompressedRoundTrip(Compression::type compression) {
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+  std::unique_ptr<TableWriter> writer;
+  ASSERT_OK(TableWriter::Open(stream, &writer));
+
+  std::shared_ptr<RecordBatch> ints, strings, categories, booleans;
+  ASSERT_OK(MakeIntBatchSized(1000, &ints));
+  ASSERT_OK(MakeStringTypesRecordBatch(&strings));
+  ASSERT_OK(MakeDictionaryFlat(&categories));
+  ASSERT_OK(MakeBooleanBatchSized(1000, &booleans));
+
+  // The first column is left uncompressed
+  std::vector<std::shared_ptr<Array>> columns = {ints->column(0)};
+  ASSERT_OK(writer->Append("f0", *ints->column(0)));
+  ASSERT_OK(writer->SetCompression(compression));
+  for (const auto& batch : {ints, strings, categories, booleans}) {
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      std::stringstream ss;
+      ss << "f" << columns.size();
+      ASSERT_OK(writer->Append(ss.str(), *batch->column(i)));
+      columns.push_back(batch->column(i));
+    }
+  }
+  ASSERT_OK(writer->Finalize());
+
+  std::shared_ptr<Buffer> output;
+  ASSERT_OK(stream->Finish(&output));
+
+  std::unique_ptr<TableReader> reader;
+  ASSERT_OK(TableReader::Open(std::make_shared<io::BufferReader>(output), &reader));
+  ASSERT_EQ(kFeatherCompressedChunkedVersion, reader->version());
+  ASSERT_EQ(static_cast<int64_t>(columns.size()), reader->num_columns());
+
+  std::shared_ptr<Column> col;
+  for (int i = 0; i < reader->num_columns(); ++i) {
+    ASSERT_OK(reader->GetColumn(i, &col));
+    ASSERT_EQ(1, col->data()->num_chunks());
+    CheckArrays(*columns[i], *col->data()->chunk(0));
+  }
+}
+
+TEST(TestFeatherCompression, LZ4) { CheckCompressedRoundTrip(Compression::LZ4); }
+
+TEST(TestFeatherCompression, ZSTD) { CheckCompressedRoundTrip(Compression::ZSTD); }
+
+TEST_F(TestTableWriter, UnsupportedCompression) {
+  ASSERT_RAISES(Invalid, writer_->SetCompression(Compression::GZIP));
+}
+
+TEST_F(TestTableWriter, WriteRecordBatches) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(600, &batch));
+  CheckRecordBatchChunks(*batch);
+}
+
+TEST_F(TestTableWriter, WriteStringRecordBatches) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeStringTypesRecordBatch(&batch));
+  CheckRecordBatchChunks(*batch);
+}
+
+TEST_F(TestTableWriter, WriteCategoryRecordBatches) {
+  // Dictionary columns keep the same levels across batches
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionaryFlat(&batch));
+  CheckRecordBatchChunks(*batch);
+}
+
+TEST_F(TestTableWriter, WriteTable) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(600, &batch));
+
+  std::shared_ptr<Table> table;
+  std::vector<std::shared_ptr<RecordBatch>> batches = {batch->Slice(0, 100),
+                                                       batch->Slice(100)};
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  ASSERT_OK(writer_->WriteTable(*table));
+  Finish();
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->Read(&result));
+  ASSERT_TRUE(result->Equals(*table));
+}
+
+TEST_F(TestTableWriter, RecordBatchSchemaMismatch) {
+  std::shared_ptr<RecordBatch> ints, strings;
+  ASSERT_OK(MakeIntRecordBatch(&ints));
+  ASSERT_OK(MakeStringTypesRecordBatch(&strings));
+
+  ASSERT_OK(writer_->WriteRecordBatch(*ints));
+  ASSERT_RAISES(Invalid, writer_->WriteRecordBatch(*strings));
+  ASSERT_RAISES(Invalid, writer_->Append("f0", *ints->column(0)));
+}
+
+TEST_F(TestTableWriter, ReadTable) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeStringTypesRecordBatch(&batch));
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    ASSERT_OK(writer_->Append(batch->column_name(i), *batch->column(i)));
+  }
+  writer_->SetNumRows(batch->num_rows());
+  Finish();
+
+  std::shared_ptr<Table> expected, result;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &expected));
+  ASSERT_OK(reader_->Read(&result));
+  ASSERT_TRUE(result->Equals(*expected));
+}
+
+TEST_F(TestTableWriter, ReadColumnSubset) {
+  std::shared_ptr<RecordBatch> ints, strings, categories;
+  ASSERT_OK(MakeIntRecordBatch(&ints));
+  ASSERT_OK(MakeStringTypesRecordBatch(&strings));
+  ASSERT_OK(MakeDictionaryFlat(&categories));
+
+  std::vector<std::shared_ptr<Column>> columns;
+  for (const auto& batch : {ints, strings, categories}) {
+    // Leave some of the columns uncompressed
+    ASSERT_OK(writer_->SetCompression(columns.size() % 2 == 0 ? Compression::UNCOMPRESSED
+                                                              : Compression::ZSTD));
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      std::stringstream ss;
+      ss << "f" << columns.size();
+      ASSERT_OK(writer_->Append(ss.str(), *batch->column(i)));
+      columns.push_back(std::make_shared<Column>(ss.str(), batch->column(i)));
+    }
+  }
+  Finish();
+
+  auto check_columns = [&](const std::vector<int>& indices, const Table& table) {
+    ASSERT_EQ(static_cast<int>(indices.size()), table.num_columns());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      ASSERT_TRUE(table.column(static_cast<int>(i))->Equals(*columns[indices[i]]));
+    }
+  };
+
+  std::shared_ptr<Table> table;
+  std::vector<int> indices = {5, 0, 3};
+  ASSERT_OK(reader_->Read(indices, &table));
+  check_columns(indices, *table);
+
+  std::vector<std::string> names = {"f1", "f4"};
+  ASSERT_OK(reader_->Read(names, &table));
+  check_columns({1, 4}, *table);
+
+  // Read through a source without zero-copy reads
+  const std::string path = "feather-test-read-columns.feather";
+  {
+    std::shared_ptr<io::FileOutputStream> file;
+    ASSERT_OK(io::FileOutputStream::Open(path, &file));
+    ASSERT_OK(file->Write(output_->data(), output_->size()));
+    ASSERT_OK(file->Close());
+  }
+  std::shared_ptr<io::ReadableFile> file;
+  ASSERT_OK(io::ReadableFile::Open(path, &file));
+  ASSERT_FALSE(file->supports_zero_copy());
+  std::unique_ptr<TableReader> file_reader;
+  ASSERT_OK(TableReader::Open(file, &file_reader));
+  ASSERT_OK(file_reader->Read(indices, &table));
+  check_columns(indices, *table);
+  ASSERT_OK(file->Close());
+
+  // Read through a memory map, which is advised to page the columns in
+  std::shared_ptr<io::MemoryMappedFile> mmap;
+  ASSERT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &mmap));
+  ASSERT_OK(TableReader::Open(mmap, &file_reader));
+  ASSERT_OK(file_reader->Read(indices, &table));
+  check_columns(indices, *table);
+  ASSERT_OK(mmap->Close());
+  std::remove(path.c_str());
+
+  ASSERT_RAISES(Invalid, reader_->Read(std::vector<int>{0, 8}, &table));
+  ASSERT_RAISES(Invalid, reader_->Read(std::vector<int>{-1}, &table));
+  ASSERT_RAISES(Invalid, reader_->Read(std::vector<std::string>{"f9"}, &table));
+}
+
 class TestTableWriterSlice : public TestTableWriter,
                              public ::testing::WithParamInterface<std::tuple<int, int>> {
  public:
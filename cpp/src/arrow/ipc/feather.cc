@@ -17,11 +17,15 @@
 
 #include "arrow/ipc/feather.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <future>
 #include <memory>
+#include <numeric>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -30,16 +34,21 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather_generated.h"
 #include "arrow/ipc/util.h"  // IWYU pragma: keep
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -48,6 +57,18 @@ namespace feather {
 
 static const uint8_t kPaddingBytes[kFeatherDefaultAlignment] = {0};
 
+// Arrays of selected columns that are at most this many bytes apart are
+// fetched with a single read when reading from a source without zero-copy
+// reads; the bytes in between are read and discarded
+static constexpr int64_t kMaxCoalesceGap = 8192;
+
+// Upper bound on the size of a single merged read. Kept small enough that a
+// large selection is split into several reads issued in parallel
+static constexpr int64_t kMaxCoalescedReadSize = 4 << 20;
+
+// Initial capacity of the in-memory copy of an array before compression
+static constexpr int64_t kStagingBufferSize = 1 << 16;
+
 static inline int64_t PaddedLength(int64_t nbytes) {
   static const int64_t alignment = kFeatherDefaultAlignment;
   return ((nbytes + alignment - 1) / alignment) * alignment;
@@ -130,10 +151,55 @@ static Status WritePaddedBlank(io::OutputStream* stream, int64_t length,
   return Status::OK();
 }
 
+static Status ToFlatbufferCompression(Compression::type compression,
+                                      fbs::CompressionType* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = fbs::CompressionType_UNCOMPRESSED;
+      break;
+    case Compression::LZ4:
+      *out = fbs::CompressionType_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = fbs::CompressionType_ZSTD;
+      break;
+    default:
+      return Status::Invalid("Feather files only support LZ4 and ZSTD compression");
+  }
+  return Status::OK();
+}
+
+static Status DecompressValues(const fbs::PrimitiveArray& meta, const Buffer& compressed,
+                               std::shared_ptr<Buffer>* out) {
+  Compression::type compression;
+  switch (meta.compression()) {
+    case fbs::CompressionType_LZ4:
+      compression = Compression::LZ4;
+      break;
+    case fbs::CompressionType_ZSTD:
+      compression = Compression::ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unrecognized compression type");
+  }
+
+  std::unique_ptr<Codec> codec;
+  RETURN_NOT_OK(Codec::Create(compression, &codec));
+
+  const int64_t uncompressed_size = meta.uncompressed_size();
+  RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), uncompressed_size, out));
+  if (uncompressed_size == 0) {
+    return Status::OK();
+  }
+  return codec->Decompress(compressed.size(), compressed.data(), uncompressed_size,
+                           (*out)->mutable_data());
+}
+
 // ----------------------------------------------------------------------
 // TableBuilder
 
-TableBuilder::TableBuilder(int64_t num_rows) : finished_(false), num_rows_(num_rows) {}
+TableBuilder::TableBuilder(int64_t num_rows)
+    : finished_(false), num_rows_(num_rows), version_(kFeatherVersion) {}
 
 FBB& TableBuilder::fbb() { return fbb_; }
 
@@ -150,7 +216,7 @@ Status TableBuilder::Finish() {
   flatbuffers::Offset<flatbuffers::String> metadata = 0;
 
   auto root = fbs::CreateCTable(fbb_, desc, num_rows_, fbb_.CreateVector(columns_),
-                                kFeatherVersion, metadata);
+                                version_, metadata);
   fbb_.Finish(root);
   finished_ = true;
 
@@ -218,12 +284,39 @@ Status ColumnBuilder::Finish() {
   FBB& buf = fbb();
 
   // values
+  if (!chunks_.empty()) {
+    values_ = chunks_[0];
+  }
   auto values = GetPrimitiveArray(buf, values_);
   flatbuffers::Offset<void> metadata = CreateColumnMetadata();
 
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<fbs::PrimitiveArray>>>
+      chunks = 0;
+  if (chunks_.size() > 1) {
+    std::vector<flatbuffers::Offset<fbs::PrimitiveArray>> chunk_offsets;
+    for (size_t i = 1; i < chunks_.size(); ++i) {
+      chunk_offsets.push_back(GetPrimitiveArray(buf, chunks_[i]));
+    }
+    chunks = buf.CreateVector(chunk_offsets);
+  }
+
   auto column = fbs::CreateColumn(buf, buf.CreateString(name_), values,
                                   ToFlatbufferEnum(type_),  // metadata_type
-                                  metadata, buf.CreateString(user_metadata_));
+                                  metadata, buf.CreateString(user_metadata_), chunks);
+
+  // Files with compressed or chunked columns record a newer version, so that
+  // readers can tell them from version 2 files
+  bool compressed = values_.compression != fbs::CompressionType_UNCOMPRESSED;
+  for (const ArrayMetadata& chunk : chunks_) {
+    compressed = compressed || chunk.compression != fbs::CompressionType_UNCOMPRESSED;
+  }
+  if (type_ == ColumnType::CATEGORY) {
+    compressed = compressed ||
+                 meta_category_.levels.compression != fbs::CompressionType_UNCOMPRESSED;
+  }
+  if (compressed || chunks_.size() > 1) {
+    parent_->version_ = kFeatherCompressedChunkedVersion;
+  }
 
   // bad coupling, but OK for now
   parent_->add_column(column);
@@ -232,6 +325,8 @@ Status ColumnBuilder::Finish() {
 
 void ColumnBuilder::SetValues(const ArrayMetadata& values) { values_ = values; }
 
+void ColumnBuilder::AddChunk(const ArrayMetadata& chunk) { chunks_.push_back(chunk); }
+
 void ColumnBuilder::SetUserMetadata(const std::string& data) { user_metadata_ = data; }
 
 void ColumnBuilder::SetCategory(const ArrayMetadata& levels, bool ordered) {
@@ -308,8 +403,13 @@ class TableReader::TableReaderImpl {
     return metadata_->Open(buffer);
   }
 
+  // Array data read ahead of decoding, keyed by array metadata
+  typedef std::unordered_map<const fbs::PrimitiveArray*, std::shared_ptr<Buffer>>
+      PrefetchedData;
+
   Status GetDataType(const fbs::PrimitiveArray* values, fbs::TypeMetadata metadata_type,
-                     const void* metadata, std::shared_ptr<DataType>* out) {
+                     const void* metadata, const PrefetchedData* prefetched,
+                     std::shared_ptr<DataType>* out) {
 #define PRIMITIVE_CASE(CAP_TYPE, FACTORY_FUNC) \
   case fbs::Type_##CAP_TYPE:                   \
     *out = FACTORY_FUNC();                     \
@@ -320,11 +420,12 @@ class TableReader::TableReaderImpl {
         auto meta = static_cast<const fbs::CategoryMetadata*>(metadata);
 
         std::shared_ptr<DataType> index_type;
-        RETURN_NOT_OK(GetDataType(values, fbs::TypeMetadata_NONE, nullptr, &index_type));
+        RETURN_NOT_OK(GetDataType(values, fbs::TypeMetadata_NONE, nullptr, prefetched,
+                                  &index_type));
 
         std::shared_ptr<Array> levels;
-        RETURN_NOT_OK(
-            LoadValues(meta->levels(), fbs::TypeMetadata_NONE, nullptr, &levels));
+        RETURN_NOT_OK(LoadValues(meta->levels(), fbs::TypeMetadata_NONE, nullptr,
+                                 prefetched, &levels));
 
         *out = std::make_shared<DictionaryType>(index_type, levels, meta->ordered());
         break;
@@ -379,16 +480,28 @@ class TableReader::TableReaderImpl {
   // @returns: a Buffer instance, the precise type will depend on the kind of
   // input data source (which may or may not have memory-map like semantics)
   Status LoadValues(const fbs::PrimitiveArray* meta, fbs::TypeMetadata metadata_type,
-                    const void* metadata, std::shared_ptr<Array>* out) {
+                    const void* metadata, const PrefetchedData* prefetched,
+                    std::shared_ptr<Array>* out) {
     std::shared_ptr<DataType> type;
-    RETURN_NOT_OK(GetDataType(meta, metadata_type, metadata, &type));
+    RETURN_NOT_OK(GetDataType(meta, metadata_type, metadata, prefetched, &type));
+    return LoadValues(type, meta, prefetched, out);
+  }
 
+  Status LoadValues(const std::shared_ptr<DataType>& type,
+                    const fbs::PrimitiveArray* meta, const PrefetchedData* prefetched,
+                    std::shared_ptr<Array>* out) {
     std::vector<std::shared_ptr<Buffer>> buffers;
 
     // Buffer data from the source (may or may not perform a copy depending on
     // input source)
     std::shared_ptr<Buffer> buffer;
-    RETURN_NOT_OK(source_->ReadAt(meta->offset(), meta->total_bytes(), &buffer));
+    RETURN_NOT_OK(GetArrayData(meta, prefetched, &buffer));
+
+    if (meta->compression() != fbs::CompressionType_UNCOMPRESSED) {
+      std::shared_ptr<Buffer> decompressed;
+      RETURN_NOT_OK(DecompressValues(*meta, *buffer, &decompressed));
+      buffer = decompressed;
+    }
 
     int64_t offset = 0;
 
@@ -429,19 +542,216 @@ class TableReader::TableReaderImpl {
   }
 
   Status GetColumn(int i, std::shared_ptr<Column>* out) {
+    return GetColumn(i, nullptr, out);
+  }
+
+  Status GetColumn(int i, const PrefetchedData* prefetched,
+                   std::shared_ptr<Column>* out) {
     const fbs::Column* col_meta = metadata_->column(i);
 
     // auto user_meta = column->user_metadata();
     // if (user_meta->size() > 0) { user_metadata_ = user_meta->str(); }
 
-    std::shared_ptr<Array> values;
-    RETURN_NOT_OK(LoadValues(col_meta->values(), col_meta->metadata_type(),
-                             col_meta->metadata(), &values));
-    out->reset(new Column(col_meta->name()->str(), values));
+    // The type, including the category levels, is shared by all chunks
+    std::shared_ptr<DataType> type;
+    RETURN_NOT_OK(GetDataType(col_meta->values(), col_meta->metadata_type(),
+                              col_meta->metadata(), prefetched, &type));
+
+    ArrayVector chunks(1);
+    RETURN_NOT_OK(LoadValues(type, col_meta->values(), prefetched, &chunks[0]));
+
+    auto chunks_meta = col_meta->chunks();
+    if (chunks_meta != nullptr) {
+      for (flatbuffers::uoffset_t j = 0; j < chunks_meta->size(); ++j) {
+        std::shared_ptr<Array> chunk;
+        RETURN_NOT_OK(LoadValues(type, chunks_meta->Get(j), prefetched, &chunk));
+        chunks.push_back(chunk);
+      }
+    }
+    out->reset(
+        new Column(col_meta->name()->str(), std::make_shared<ChunkedArray>(chunks)));
+    return Status::OK();
+  }
+
+  Status Read(std::shared_ptr<Table>* out) {
+    std::vector<int> indices(static_cast<size_t>(num_columns()));
+    std::iota(indices.begin(), indices.end(), 0);
+    return Read(indices, out);
+  }
+
+  Status Read(const std::vector<std::string>& names, std::shared_ptr<Table>* out) {
+    std::vector<int> indices;
+    for (const auto& name : names) {
+      int index = -1;
+      for (int i = 0; i < num_columns(); ++i) {
+        if (GetColumnName(i) == name) {
+          index = i;
+          break;
+        }
+      }
+      if (index == -1) {
+        std::stringstream ss;
+        ss << "No column named " << name;
+        return Status::Invalid(ss.str());
+      }
+      indices.push_back(index);
+    }
+    return Read(indices, out);
+  }
+
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    for (int i : indices) {
+      if (i < 0 || i >= num_columns()) {
+        std::stringstream ss;
+        ss << "Column index " << i << " out of range";
+        return Status::Invalid(ss.str());
+      }
+    }
+
+    // Fetch the data of every selected array first, then decode the columns
+    PrefetchedData prefetched;
+    RETURN_NOT_OK(PrefetchColumns(indices, &prefetched));
+
+    const int num_selected = static_cast<int>(indices.size());
+    std::vector<std::shared_ptr<Column>> columns(num_selected);
+    RETURN_NOT_OK(ParallelFor(num_selected, [&](int i) {
+      return GetColumn(indices[i], &prefetched, &columns[i]);
+    }));
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (const auto& column : columns) {
+      fields.push_back(column->field());
+    }
+    *out = Table::Make(::arrow::schema(fields), columns, num_rows());
     return Status::OK();
   }
 
  private:
+  Status ReadRange(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(source_->ReadAt(offset, length, out));
+    if ((*out)->size() < length) {
+      std::stringstream ss;
+      ss << "Expected to read " << length << " bytes at offset " << offset
+         << " but got " << (*out)->size();
+      return Status::IOError(ss.str());
+    }
+    return Status::OK();
+  }
+
+  // Read the (possibly compressed) data of an array from the source
+  Status ReadArrayData(const fbs::PrimitiveArray* meta, std::shared_ptr<Buffer>* out) {
+    return ReadRange(meta->offset(), meta->total_bytes(), out);
+  }
+
+  Status GetArrayData(const fbs::PrimitiveArray* meta, const PrefetchedData* prefetched,
+                      std::shared_ptr<Buffer>* out) {
+    if (prefetched != nullptr) {
+      auto it = prefetched->find(meta);
+      if (it != prefetched->end()) {
+        *out = it->second;
+        return Status::OK();
+      }
+    }
+    return ReadArrayData(meta, out);
+  }
+
+  // Issue the reads of all arrays of the given columns, including category
+  // levels. Zero-copy sources (e.g. memory maps) are only asked to page the
+  // data in ahead of the slicing; other sources are read with a few merged
+  // reads issued concurrently on the IO thread pool
+  Status PrefetchColumns(const std::vector<int>& indices, PrefetchedData* out) {
+    std::vector<const fbs::PrimitiveArray*> arrays;
+    for (int i : indices) {
+      const fbs::Column* col_meta = metadata_->column(i);
+      arrays.push_back(col_meta->values());
+      if (col_meta->metadata_type() == fbs::TypeMetadata_CategoryMetadata) {
+        auto meta = static_cast<const fbs::CategoryMetadata*>(col_meta->metadata());
+        arrays.push_back(meta->levels());
+      }
+      auto chunks_meta = col_meta->chunks();
+      if (chunks_meta != nullptr) {
+        for (flatbuffers::uoffset_t j = 0; j < chunks_meta->size(); ++j) {
+          arrays.push_back(chunks_meta->Get(j));
+        }
+      }
+    }
+
+    if (source_->supports_zero_copy()) {
+      // Paging in is only a hint, so a failure does not fail the read
+      for (const fbs::PrimitiveArray* meta : arrays) {
+        ARROW_UNUSED(source_->WillNeed(meta->offset(), meta->total_bytes()));
+      }
+      for (const fbs::PrimitiveArray* meta : arrays) {
+        RETURN_NOT_OK(ReadArrayData(meta, &(*out)[meta]));
+      }
+      return Status::OK();
+    }
+
+    // Group the arrays into ranges [begin, end) of arrays that are close
+    // together in the file
+    std::sort(arrays.begin(), arrays.end(),
+              [](const fbs::PrimitiveArray* left, const fbs::PrimitiveArray* right) {
+                return left->offset() < right->offset();
+              });
+    std::vector<std::pair<size_t, size_t>> groups;
+    size_t begin = 0;
+    while (begin < arrays.size()) {
+      const int64_t read_offset = arrays[begin]->offset();
+      int64_t read_end = read_offset + arrays[begin]->total_bytes();
+      size_t end = begin + 1;
+      while (end < arrays.size()) {
+        const fbs::PrimitiveArray* next = arrays[end];
+        const int64_t next_end = std::max(read_end, next->offset() + next->total_bytes());
+        if (next->offset() - read_end > kMaxCoalesceGap ||
+            next_end - read_offset > kMaxCoalescedReadSize) {
+          break;
+        }
+        read_end = next_end;
+        ++end;
+      }
+      groups.emplace_back(begin, end);
+      begin = end;
+    }
+
+    std::vector<std::shared_ptr<Buffer>> ranges(groups.size());
+    auto read_group = [this, &arrays, &groups, &ranges](size_t group) {
+      const size_t first = groups[group].first;
+      const size_t last = groups[group].second;
+      int64_t read_end = arrays[first]->offset();
+      for (size_t k = first; k < last; ++k) {
+        read_end = std::max(read_end, arrays[k]->offset() + arrays[k]->total_bytes());
+      }
+      return ReadRange(arrays[first]->offset(), read_end - arrays[first]->offset(),
+                       &ranges[group]);
+    };
+
+    Status st;
+    if (groups.size() <= 1) {
+      for (size_t group = 0; group < groups.size(); ++group) {
+        st &= read_group(group);
+      }
+    } else {
+      auto pool = ::arrow::internal::GetIOThreadPool();
+      std::vector<std::future<Status>> futures;
+      for (size_t group = 0; group < groups.size(); ++group) {
+        futures.push_back(pool->Submit(read_group, group));
+      }
+      for (auto& fut : futures) {
+        st &= fut.get();
+      }
+    }
+    RETURN_NOT_OK(st);
+
+    for (size_t group = 0; group < groups.size(); ++group) {
+      const int64_t read_offset = arrays[groups[group].first]->offset();
+      for (size_t k = groups[group].first; k < groups[group].second; ++k) {
+        (*out)[arrays[k]] = SliceBuffer(ranges[group], arrays[k]->offset() - read_offset,
+                                        arrays[k]->total_bytes());
+      }
+    }
+    return Status::OK();
+  }
+
   std::shared_ptr<io::RandomAccessFile> source_;
   std::unique_ptr<TableMetadata> metadata_;
 
@@ -477,6 +787,17 @@ Status TableReader::GetColumn(int i, std::shared_ptr<Column>* out) {
   return impl_->GetColumn(i, out);
 }
 
+Status TableReader::Read(std::shared_ptr<Table>* out) { return impl_->Read(out); }
+
+Status TableReader::Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+  return impl_->Read(indices, out);
+}
+
+Status TableReader::Read(const std::vector<std::string>& names,
+                         std::shared_ptr<Table>* out) {
+  return impl_->Read(names, out);
+}
+
 // ----------------------------------------------------------------------
 // writer.cc
 
@@ -538,7 +859,14 @@ static Status SanitizeUnsupportedTypes(const Array& values, std::shared_ptr<Arra
 
 class TableWriter::TableWriterImpl : public ArrayVisitor {
  public:
-  TableWriterImpl() : initialized_stream_(false), metadata_(0) {}
+  TableWriterImpl()
+      : initialized_stream_(false),
+        metadata_(0),
+        compression_(fbs::CompressionType_UNCOMPRESSED),
+        appended_columns_(false),
+        num_batch_rows_(0),
+        current_column_(NULLPTR),
+        first_chunk_(true) {}
 
   Status Open(const std::shared_ptr<io::OutputStream>& stream) {
     stream_ = stream;
@@ -549,8 +877,25 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
 
   void SetNumRows(int64_t num_rows) { metadata_.SetNumRows(num_rows); }
 
+  Status SetCompression(Compression::type compression) {
+    fbs::CompressionType fbs_compression;
+    RETURN_NOT_OK(ToFlatbufferCompression(compression, &fbs_compression));
+
+    std::unique_ptr<Codec> codec;
+    if (compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(Codec::Create(compression, &codec));
+    }
+    codec_ = std::move(codec);
+    compression_ = fbs_compression;
+    return Status::OK();
+  }
+
   Status Finalize() {
     RETURN_NOT_OK(CheckStarted());
+    for (const auto& column : batch_columns_) {
+      RETURN_NOT_OK(column->Finish());
+    }
+    batch_columns_.clear();
     RETURN_NOT_OK(metadata_.Finish());
 
     auto buffer = metadata_.GetBuffer();
@@ -588,6 +933,44 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     RETURN_NOT_OK(CheckStarted());
     RETURN_NOT_OK(LoadArrayMetadata(values, meta));
 
+    if (!codec_) {
+      return WriteArrayData(values, stream_.get(), &meta->total_bytes);
+    }
+
+    // Lay the data out in memory as it would be written without compression,
+    // then write it as a single compressed block
+    std::shared_ptr<io::BufferOutputStream> staging;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(kStagingBufferSize,
+                                                 default_memory_pool(), &staging));
+    RETURN_NOT_OK(WriteArrayData(values, staging.get(), &meta->uncompressed_size));
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(staging->Finish(&data));
+
+    const int64_t max_length = codec_->MaxCompressedLen(data->size(), data->data());
+    if (!compressed_) {
+      RETURN_NOT_OK(
+          AllocateResizableBuffer(default_memory_pool(), max_length, &compressed_));
+    } else {
+      RETURN_NOT_OK(compressed_->Resize(max_length, false));
+    }
+
+    int64_t compressed_length;
+    RETURN_NOT_OK(codec_->Compress(data->size(), data->data(), max_length,
+                                   compressed_->mutable_data(), &compressed_length));
+
+    // The padding is not part of the compressed block
+    int64_t bytes_written_unused;
+    RETURN_NOT_OK(WritePadded(stream_.get(), compressed_->data(), compressed_length,
+                              &bytes_written_unused));
+    meta->compression = compression_;
+    meta->total_bytes = compressed_length;
+    return Status::OK();
+  }
+
+  // Write the null bitmap, offsets and values of an array to dst, each padded
+  Status WriteArrayData(const Array& values, io::OutputStream* dst,
+                        int64_t* total_bytes) {
+    *total_bytes = 0;
     int64_t bytes_written;
 
     // Write the null bitmask
@@ -597,13 +980,12 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
       int64_t null_bitmap_size = GetOutputLength(BitUtil::BytesForBits(values.length()));
       if (values.null_bitmap()) {
         auto null_bitmap = values.null_bitmap();
-        RETURN_NOT_OK(WritePaddedWithOffset(stream_.get(), null_bitmap->data(),
-                                            values.offset(), null_bitmap_size,
-                                            &bytes_written));
+        RETURN_NOT_OK(WritePaddedWithOffset(dst, null_bitmap->data(), values.offset(),
+                                            null_bitmap_size, &bytes_written));
       } else {
-        RETURN_NOT_OK(WritePaddedBlank(stream_.get(), null_bitmap_size, &bytes_written));
+        RETURN_NOT_OK(WritePaddedBlank(dst, null_bitmap_size, &bytes_written));
       }
-      meta->total_bytes += bytes_written;
+      *total_bytes += bytes_written;
     }
 
     int64_t values_bytes = 0;
@@ -620,14 +1002,13 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
         values_bytes = bin_values.raw_value_offsets()[values.length()];
 
         // Write the variable-length offsets
-        RETURN_NOT_OK(
-            WritePadded(stream_.get(),
-                        reinterpret_cast<const uint8_t*>(bin_values.raw_value_offsets()),
-                        offset_bytes, &bytes_written));
+        const auto offsets =
+            reinterpret_cast<const uint8_t*>(bin_values.raw_value_offsets());
+        RETURN_NOT_OK(WritePadded(dst, offsets, offset_bytes, &bytes_written));
       } else {
-        RETURN_NOT_OK(WritePaddedBlank(stream_.get(), offset_bytes, &bytes_written));
+        RETURN_NOT_OK(WritePaddedBlank(dst, offset_bytes, &bytes_written));
       }
-      meta->total_bytes += bytes_written;
+      *total_bytes += bytes_written;
 
       if (bin_values.value_data()) {
         values_buffer = bin_values.value_data()->data();
@@ -645,12 +1026,12 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
       }
     }
     if (values_buffer) {
-      RETURN_NOT_OK(WritePaddedWithOffset(stream_.get(), values_buffer, bit_offset,
-                                          values_bytes, &bytes_written));
+      RETURN_NOT_OK(WritePaddedWithOffset(dst, values_buffer, bit_offset, values_bytes,
+                                          &bytes_written));
     } else {
-      RETURN_NOT_OK(WritePaddedBlank(stream_.get(), values_bytes, &bytes_written));
+      RETURN_NOT_OK(WritePaddedBlank(dst, values_bytes, &bytes_written));
     }
-    meta->total_bytes += bytes_written;
+    *total_bytes += bytes_written;
 
     return Status::OK();
   }
@@ -659,7 +1040,7 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     // Prepare metadata payload
     ArrayMetadata meta;
     RETURN_NOT_OK(WriteArray(values, &meta));
-    current_column_->SetValues(meta);
+    current_column_->AddChunk(meta);
     return Status::OK();
   }
 
@@ -697,6 +1078,12 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
 
     RETURN_NOT_OK(WritePrimitiveValues(*values.indices()));
 
+    // Chunks after the first share the levels, which are checked to be equal
+    // through the schema
+    if (!first_chunk_) {
+      return Status::OK();
+    }
+
     ArrayMetadata levels_meta;
     std::shared_ptr<Array> sanitized_dictionary;
     RETURN_NOT_OK(
@@ -731,9 +1118,55 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
   }
 
   Status Append(const std::string& name, const Array& values) {
-    current_column_ = metadata_.AddColumn(name);
+    if (batch_schema_) {
+      return Status::Invalid("Cannot append columns to a file written by record batches");
+    }
+    appended_columns_ = true;
+
+    std::unique_ptr<ColumnBuilder> column = metadata_.AddColumn(name);
+    current_column_ = column.get();
+    first_chunk_ = true;
     RETURN_NOT_OK(values.Accept(this));
-    return current_column_->Finish();
+    return column->Finish();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) {
+    if (appended_columns_) {
+      return Status::Invalid("Cannot write a record batch to a file written by columns");
+    }
+
+    if (!batch_schema_) {
+      batch_schema_ = batch.schema();
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        batch_columns_.push_back(metadata_.AddColumn(batch.column_name(i)));
+      }
+      first_chunk_ = true;
+    } else if (batch.schema()->Equals(*batch_schema_, false)) {
+      first_chunk_ = false;
+    } else {
+      return Status::Invalid("Record batch schema does not match previous batches");
+    }
+
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      current_column_ = batch_columns_[i].get();
+      RETURN_NOT_OK(batch.column(i)->Accept(this));
+    }
+    num_batch_rows_ += batch.num_rows();
+    metadata_.SetNumRows(num_batch_rows_);
+    return Status::OK();
+  }
+
+  Status WriteTable(const Table& table) {
+    TableBatchReader reader(table);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      RETURN_NOT_OK(WriteRecordBatch(*batch));
+    }
+    return Status::OK();
   }
 
  private:
@@ -753,7 +1186,19 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
   bool initialized_stream_;
   TableBuilder metadata_;
 
-  std::unique_ptr<ColumnBuilder> current_column_;
+  // Codec for the arrays written next, null when uncompressed
+  std::unique_ptr<Codec> codec_;
+  fbs::CompressionType compression_;
+  std::shared_ptr<ResizableBuffer> compressed_;
+
+  // Files are written either by columns (Append) or by record batches
+  bool appended_columns_;
+  std::shared_ptr<Schema> batch_schema_;
+  std::vector<std::unique_ptr<ColumnBuilder>> batch_columns_;
+  int64_t num_batch_rows_;
+
+  ColumnBuilder* current_column_;
+  bool first_chunk_;
 
   Status AppendPrimitive(const PrimitiveArray& values, ArrayMetadata* out);
 };
@@ -772,10 +1217,20 @@ void TableWriter::SetDescription(const std::string& desc) { impl_->SetDescriptio
 
 void TableWriter::SetNumRows(int64_t num_rows) { impl_->SetNumRows(num_rows); }
 
+Status TableWriter::SetCompression(Compression::type compression) {
+  return impl_->SetCompression(compression);
+}
+
 Status TableWriter::Append(const std::string& name, const Array& values) {
   return impl_->Append(name, values);
 }
 
+Status TableWriter::WriteRecordBatch(const RecordBatch& batch) {
+  return impl_->WriteRecordBatch(batch);
+}
+
+Status TableWriter::WriteTable(const Table& table) { return impl_->WriteTable(table); }
+
 Status TableWriter::Finalize() { return impl_->Finalize(); }
 
 }  // namespace feather
@@ -24,14 +24,18 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
 class Array;
 class Column;
+class RecordBatch;
 class Status;
+class Table;
 
 namespace io {
 
@@ -45,6 +49,10 @@ namespace feather {
 
 static constexpr const int kFeatherVersion = 2;
 
+/// Version of files with compressed or chunked columns. Readers of version 2
+/// do not know these fields, so only files using them record this version
+static constexpr const int kFeatherCompressedChunkedVersion = 3;
+
 // ----------------------------------------------------------------------
 // Metadata accessor classes
 
@@ -89,8 +97,36 @@ class ARROW_EXPORT TableReader {
   /// \return Status
   ///
   /// This function is zero-copy if the file source supports zero-copy reads
+  /// and the column is not compressed. Columns written in several chunks are
+  /// returned with one chunk per written array
   Status GetColumn(int i, std::shared_ptr<Column>* out);
 
+  /// \brief Read all columns of the file as an arrow::Table
+  ///
+  /// \param[out] out the returned table
+  /// \return Status
+  Status Read(std::shared_ptr<Table>* out);
+
+  /// \brief Read a set of columns of the file as an arrow::Table
+  ///
+  /// The reads of all selected columns are issued at once, concurrently on
+  /// the IO thread pool, before the columns are decompressed and assembled in
+  /// parallel on the CPU thread pool. Sources supporting zero-copy reads
+  /// (e.g. memory-mapped files) are sliced rather than read.
+  ///
+  /// \param[in] indices the column indices to read, in the order of the
+  /// resulting table columns
+  /// \param[out] out the returned table
+  /// \return Status
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out);
+
+  /// \brief Read a set of columns of the file, selected by name
+  ///
+  /// \param[in] names the names of the columns to read
+  /// \param[out] out the returned table
+  /// \return Status
+  Status Read(const std::vector<std::string>& names, std::shared_ptr<Table>* out);
+
  private:
   class ARROW_NO_EXPORT TableReaderImpl;
   std::unique_ptr<TableReaderImpl> impl_;
@@ -115,6 +151,16 @@ class ARROW_EXPORT TableWriter {
   /// \brief Set the number of rows in the file
   void SetNumRows(int64_t num_rows);
 
+  /// \brief Set the codec used for the arrays written from now on
+  ///
+  /// Each array is compressed on its own, so this can be changed between
+  /// columns. Only Compression::UNCOMPRESSED, Compression::LZ4 and
+  /// Compression::ZSTD are supported.
+  ///
+  /// \param[in] compression the codec to use
+  /// \return Status
+  Status SetCompression(Compression::type compression);
+
   /// \brief Append a column to the file
   ///
   /// \param[in] name the column name
@@ -122,6 +168,23 @@ class ARROW_EXPORT TableWriter {
   /// \return Status
   Status Append(const std::string& name, const Array& values);
 
+  /// \brief Append the rows of a record batch to the file
+  ///
+  /// Each column of the batch is written as one chunk of the corresponding
+  /// file column, so that a table can be written incrementally. All batches
+  /// must have the same schema, and the number of rows of the file is
+  /// maintained automatically. This cannot be mixed with Append.
+  ///
+  /// \param[in] batch the batch to write
+  /// \return Status
+  Status WriteRecordBatch(const RecordBatch& batch);
+
+  /// \brief Append the rows of a table, one record batch at a time
+  ///
+  /// \param[in] table the table to write
+  /// \return Status
+  Status WriteTable(const Table& table);
+
   /// \brief Finalize the file by writing the file metadata and footer
   /// \return Status
   Status Finalize();
@@ -377,7 +377,7 @@ TEST(TestJsonFileReadWrite, MinimalFormatExample) {
                     &MakeZeroLengthRecordBatch, &MakeDeeplyNestedList,                  \
                     &MakeStringTypesRecordBatchWithNulls, &MakeStruct, &MakeUnion,      \
                     &MakeDates, &MakeTimestamps, &MakeTimes, &MakeFWBinary,             \
-                    &MakeDecimal, &MakeDictionary);
+                    &MakeDecimal, &MakeDictionary)
 
 class TestJsonRoundTrip : public ::testing::TestWithParam<MakeRecordBatch*> {
  public:
@@ -20,8 +20,15 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "arrow/api.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/test-util.h"
@@ -87,6 +94,55 @@ static void BM_WriteRecordBatch(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// A batch of an int64 and a string column, both with nulls
+static std::shared_ptr<RecordBatch> MakeStringRecordBatch(int64_t length) {
+  std::vector<bool> is_valid;
+  random_is_valid(length, 0.1, &is_valid);
+
+  Int64Builder int_builder;
+  StringBuilder string_builder;
+  const std::string value = "0123456789abcdef";
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid[i]) {
+      ABORT_NOT_OK(int_builder.Append(i));
+      ABORT_NOT_OK(string_builder.Append(value.data(), static_cast<int32_t>(i % 16)));
+    } else {
+      ABORT_NOT_OK(int_builder.AppendNull());
+      ABORT_NOT_OK(string_builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> ints, strings;
+  ABORT_NOT_OK(int_builder.Finish(&ints));
+  ABORT_NOT_OK(string_builder.Finish(&strings));
+
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", utf8())});
+  return RecordBatch::Make(schema, length, {ints, strings});
+}
+
+static void BM_WriteSlicedRecordBatch(benchmark::State& state) {  // NOLINT non-const ref
+  constexpr int64_t kLength = 1 << 20;
+  const int64_t offset = state.range(0);
+
+  auto record_batch = MakeStringRecordBatch(kLength + offset)->Slice(offset, kLength);
+  int64_t total_size;
+  ABORT_NOT_OK(ipc::GetRecordBatchSize(*record_batch, &total_size));
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(AllocateResizableBuffer(total_size, &buffer));
+
+  while (state.KeepRunning()) {
+    io::BufferOutputStream stream(buffer);
+    int32_t metadata_length;
+    int64_t body_length;
+    if (!ipc::WriteRecordBatch(*record_batch, 0, &stream, &metadata_length, &body_length,
+                               default_memory_pool())
+             .ok()) {
+      state.SkipWithError("Failed to write!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * total_size);
+}
+
 static void BM_ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const reference
   // 1MB
   constexpr int64_t kTotalSize = 1 << 20;
@@ -116,16 +172,190 @@ static void BM_ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const r
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Write a single-batch file with a wide schema, for comparing full reads with
+// reads of a few columns
+static std::shared_ptr<Buffer> MakeWideFile(int64_t total_size, int64_t num_fields) {
+  auto record_batch = MakeRecordBatch<Int64Type>(total_size, num_fields);
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream stream(buffer);
+
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(
+      ipc::RecordBatchFileWriter::Open(&stream, record_batch->schema(), &writer));
+  ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(stream.Close());
+  return buffer;
+}
+
+static void BM_ReadAllFields(benchmark::State& state) {  // NOLINT non-const reference
+  // 16MB
+  constexpr int64_t kTotalSize = 1 << 24;
+  constexpr int64_t kNumFields = 500;
+
+  auto buffer = MakeWideFile(kTotalSize, kNumFields);
+  io::BufferReader file(buffer);
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  ABORT_NOT_OK(ipc::RecordBatchFileReader::Open(&file, &reader));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    if (!reader->ReadRecordBatch(0, &result).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kNumFields);
+}
+
+static void BM_ReadFieldSubset(benchmark::State& state) {  // NOLINT non-const reference
+  // 16MB
+  constexpr int64_t kTotalSize = 1 << 24;
+  constexpr int64_t kNumFields = 500;
+
+  auto buffer = MakeWideFile(kTotalSize, kNumFields);
+  io::BufferReader file(buffer);
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  ABORT_NOT_OK(ipc::RecordBatchFileReader::Open(&file, &reader));
+
+  // Selected fields are spread out across the schema
+  std::vector<int> field_indices;
+  for (int i = 0; i < state.range(0); ++i) {
+    field_indices.push_back(static_cast<int>(i * kNumFields / state.range(0)));
+  }
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    if (!reader->ReadRecordBatch(0, field_indices, &result).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+// A multi-batch file on local disk, for comparing serial reads with
+// prefetching reads
+static const char* kBenchmarkFilePath = "ipc-read-write-benchmark.arrow";
+constexpr int kBenchmarkFileBatches = 32;
+// 4MB per batch
+constexpr int64_t kBenchmarkFileBatchSize = 1 << 22;
+
+static void WriteBenchmarkFile() {
+  auto record_batch = MakeRecordBatch<Int64Type>(kBenchmarkFileBatchSize, 64);
+
+  std::shared_ptr<io::FileOutputStream> stream;
+  ABORT_NOT_OK(io::FileOutputStream::Open(kBenchmarkFilePath, &stream));
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(
+      ipc::RecordBatchFileWriter::Open(stream.get(), record_batch->schema(), &writer));
+  for (int i = 0; i < kBenchmarkFileBatches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(stream->Close());
+}
+
+// Evict the file from the OS page cache, so that reads go to the disk
+static void DropFileCache() {
+#ifdef __linux__
+  int fd = open(kBenchmarkFilePath, O_RDONLY);
+  if (fd >= 0) {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+#endif
+}
+
+static void OpenColdBenchmarkFile(std::shared_ptr<io::ReadableFile>* file,
+                                  std::shared_ptr<ipc::RecordBatchFileReader>* reader) {
+  DropFileCache();
+  ABORT_NOT_OK(io::ReadableFile::Open(kBenchmarkFilePath, file));
+  ABORT_NOT_OK(ipc::RecordBatchFileReader::Open(file->get(), reader));
+}
+
+static void BM_ReadColdFileSerial(benchmark::State& state) {  // NOLINT non-const ref
+  WriteBenchmarkFile();
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::shared_ptr<io::ReadableFile> file;
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    OpenColdBenchmarkFile(&file, &reader);
+    state.ResumeTiming();
+
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      if (!reader->ReadRecordBatch(i, &batch).ok()) {
+        state.SkipWithError("Failed to read!");
+      }
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kBenchmarkFileBatches *
+                          kBenchmarkFileBatchSize);
+}
+
+// Arguments: readahead, ordered
+static void BM_ReadColdFilePrefetch(benchmark::State& state) {  // NOLINT non-const ref
+  WriteBenchmarkFile();
+
+  auto options = ipc::FilePrefetchOptions::Defaults();
+  options.readahead = static_cast<int>(state.range(0));
+  options.ordered = state.range(1) != 0;
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::shared_ptr<io::ReadableFile> file;
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    OpenColdBenchmarkFile(&file, &reader);
+    state.ResumeTiming();
+
+    std::shared_ptr<RecordBatchReader> batch_reader;
+    ABORT_NOT_OK(reader->OpenPrefetchingReader(options, &batch_reader));
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      if (!batch_reader->ReadNext(&batch).ok()) {
+        state.SkipWithError("Failed to read!");
+        break;
+      }
+    } while (batch != nullptr);
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kBenchmarkFileBatches *
+                          kBenchmarkFileBatchSize);
+}
+
 BENCHMARK(BM_WriteRecordBatch)
     ->RangeMultiplier(4)
     ->Range(1, 1 << 13)
     ->MinTime(1.0)
     ->UseRealTime();
 
+// Slices at a zero, a byte-aligned and an unaligned offset
+BENCHMARK(BM_WriteSlicedRecordBatch)->Arg(0)->Arg(8)->Arg(3)->MinTime(1.0)->UseRealTime();
+
 BENCHMARK(BM_ReadRecordBatch)
     ->RangeMultiplier(4)
     ->Range(1, 1 << 13)
     ->MinTime(1.0)
     ->UseRealTime();
 
+BENCHMARK(BM_ReadColdFileSerial)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_ReadColdFilePrefetch)
+    ->Args({1, 1})
+    ->Args({4, 1})
+    ->Args({4, 0})
+    ->Args({16, 1})
+    ->Args({16, 0})
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+BENCHMARK(BM_ReadAllFields)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_ReadFieldSubset)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
 }  // namespace arrow
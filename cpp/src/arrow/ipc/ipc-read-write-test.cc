@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -28,6 +31,7 @@
 #include "arrow/buffer.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test-common.h"
+#include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/test-common.h"
@@ -133,7 +137,7 @@ TEST_F(TestSchemaMetadata, KeyValueMetadata) {
                     &MakeZeroLengthRecordBatch, &MakeDeeplyNestedList,                  \
                     &MakeStringTypesRecordBatchWithNulls, &MakeStruct, &MakeUnion,      \
                     &MakeDictionary, &MakeDates, &MakeTimestamps, &MakeTimes,           \
-                    &MakeFWBinary, &MakeNull, &MakeDecimal, &MakeBooleanBatch);
+                    &MakeFWBinary, &MakeNull, &MakeDecimal, &MakeBooleanBatch)
 
 static int g_file_number = 0;
 
@@ -369,6 +373,97 @@ TEST_F(TestWriteRecordBatch, SliceTruncatesBuffers) {
   CheckArray(a1);
 }
 
+// Copy an unsliced array with int32 offsets as the type with int64 offsets
+static Status WidenOffsets(const Array& array, const std::shared_ptr<DataType>& type,
+                           std::shared_ptr<Array>* out) {
+  auto offsets = reinterpret_cast<const int32_t*>(array.data()->buffers[1]->data());
+  std::shared_ptr<Buffer> wide_offsets;
+  RETURN_NOT_OK(AllocateBuffer(default_memory_pool(),
+                               (array.length() + 1) * sizeof(int64_t), &wide_offsets));
+  auto out_offsets = reinterpret_cast<int64_t*>(wide_offsets->mutable_data());
+  for (int64_t i = 0; i <= array.length(); ++i) {
+    out_offsets[i] = offsets[i];
+  }
+  auto data = array.data()->Copy();
+  data->type = type;
+  data->buffers[1] = wide_offsets;
+  *out = MakeArray(data);
+  return Status::OK();
+}
+
+TEST_F(TestWriteRecordBatch, SliceAtOffsets) {
+  // Bitmaps of slices starting on a byte boundary are written without being
+  // copied, and offsets are rebased as they are written
+  std::shared_ptr<Array> a0, a1, a2, a3, a4, a5;
+  auto pool = default_memory_pool();
+
+  // Enough offsets for rebasing to go through more than one scratch block
+  const int64_t length = 40000;
+  ASSERT_OK(MakeRandomInt32Array(length, true, pool, &a0));
+  ASSERT_OK((MakeRandomBinaryArray<StringBuilder, char>(length, true, pool, &a1)));
+  ASSERT_OK(MakeRandomBooleanArray(length, true, &a2));
+  ASSERT_OK(MakeRandomListArray(a0, 1000, true, pool, &a3));
+  ASSERT_OK(WidenOffsets(*a1, large_utf8(), &a4));
+  ASSERT_OK(WidenOffsets(*a3, large_list(int32()), &a5));
+
+  // The large string column follows an int32 offsets column, so its rebased
+  // offsets need not start on an 8-byte boundary of the scratch space
+  auto schema =
+      ::arrow::schema({field("f0", a0->type()), field("f1", a1->type()),
+                       field("f2", a2->type()), field("f3", a4->type())});
+  auto batch = RecordBatch::Make(schema, length, {a0, a1, a2, a4});
+  auto list_schema = ::arrow::schema({field("f0", a3->type()), field("f1", a5->type())});
+  auto list_batch = RecordBatch::Make(list_schema, a3->length(), {a3, a5});
+
+  for (int64_t offset : {0, 3, 8, 13, 64}) {
+    CheckRoundtrip(*batch->Slice(offset, 900), 1 << 20);
+    CheckRoundtrip(*batch->Slice(offset), 1 << 22);
+    CheckRoundtrip(*list_batch->Slice(offset, 500), 1 << 20);
+  }
+}
+
+TEST_F(TestWriteRecordBatch, BatchViewAtOffsets) {
+  // Writing a view gives the same bytes as writing the equivalent slice
+  std::shared_ptr<Array> a0, a1, a2, a3;
+  auto pool = default_memory_pool();
+  const int64_t length = 40000;
+  ASSERT_OK(MakeRandomInt32Array(length, true, pool, &a0));
+  ASSERT_OK((MakeRandomBinaryArray<StringBuilder, char>(length, true, pool, &a1)));
+  ASSERT_OK(MakeRandomBooleanArray(length, true, &a2));
+  ASSERT_OK(MakeRandomListArray(a0, length, true, pool, &a3));
+
+  auto schema = ::arrow::schema({field("f0", a0->type()), field("f1", a1->type()),
+                                 field("f2", a2->type()), field("f3", a3->type())});
+  auto batch = RecordBatch::Make(schema, length, {a0, a1, a2, a3});
+  const BatchView view(*batch);
+
+  auto write_to_buffer = [&](const BatchView* window, const RecordBatch* slice,
+                             std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ASSERT_OK(io::BufferOutputStream::Create(1024, pool, &stream));
+    int32_t metadata_length;
+    int64_t body_length;
+    if (window != nullptr) {
+      ASSERT_OK(WriteRecordBatch(*window, 0, stream.get(), &metadata_length,
+                                 &body_length, pool));
+    } else {
+      ASSERT_OK(WriteRecordBatch(*slice, 0, stream.get(), &metadata_length,
+                                 &body_length, pool));
+    }
+    ASSERT_OK(stream->Finish(out));
+  };
+
+  for (int64_t offset : {0, 3, 8, 13, 64}) {
+    for (int64_t window_length : {900, 30000}) {
+      BatchView window = view.Slice(offset, window_length);
+      std::shared_ptr<Buffer> from_view, from_slice;
+      write_to_buffer(&window, nullptr, &from_view);
+      write_to_buffer(nullptr, window.ToRecordBatch().get(), &from_slice);
+      ASSERT_TRUE(from_view->Equals(*from_slice));
+    }
+  }
+}
+
 void TestGetRecordBatchSize(std::shared_ptr<RecordBatch> batch) {
   io::MockOutputStream mock;
   int32_t mock_metadata_length = -1;
@@ -399,6 +494,38 @@ TEST_F(TestWriteRecordBatch, IntegerGetRecordBatchSize) {
   TestGetRecordBatchSize(batch);
 }
 
+// Counts the calls made to the output stream interface
+class CountingOutputStream : public io::MockOutputStream {
+ public:
+  Status Write(const void* data, int64_t nbytes) override {
+    ++num_writes;
+    return io::MockOutputStream::Write(data, nbytes);
+  }
+
+  Status WriteV(const std::vector<io::IOVec>& iov) override {
+    ++num_vectored_writes;
+    return io::MockOutputStream::WriteV(iov);
+  }
+
+  int num_writes = 0;
+  int num_vectored_writes = 0;
+};
+
+TEST_F(TestWriteRecordBatch, SingleVectoredWrite) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+
+  CountingOutputStream stream;
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_OK(WriteRecordBatch(*batch, 0, &stream, &metadata_length, &body_length, pool_));
+
+  // Metadata, buffers and padding all go through one call
+  ASSERT_EQ(0, stream.num_writes);
+  ASSERT_EQ(1, stream.num_vectored_writes);
+  ASSERT_EQ(metadata_length + body_length, stream.GetExtentBytesWritten());
+}
+
 class RecursionLimits : public ::testing::Test, public io::MemoryMapFixture {
  public:
   void SetUp() { pool_ = default_memory_pool(); }
@@ -514,14 +641,13 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
+  Status WriteAndOpen(const BatchVector& in_batches,
+                      std::shared_ptr<RecordBatchFileReader>* reader) {
     // Write the file
     std::shared_ptr<RecordBatchWriter> writer;
     RETURN_NOT_OK(
         RecordBatchFileWriter::Open(sink_.get(), in_batches[0]->schema(), &writer));
 
-    const int num_batches = static_cast<int>(in_batches.size());
-
     for (const auto& batch : in_batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
     }
@@ -533,10 +659,15 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
     RETURN_NOT_OK(sink_->Tell(&footer_offset));
 
     // Open the file
-    auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    buf_reader_ = std::make_shared<io::BufferReader>(buffer_);
+    return RecordBatchFileReader::Open(buf_reader_.get(), footer_offset, reader);
+  }
+
+  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset, &reader));
+    RETURN_NOT_OK(WriteAndOpen(in_batches, &reader));
 
+    const int num_batches = static_cast<int>(in_batches.size());
     EXPECT_EQ(num_batches, reader->num_record_batches());
     for (int i = 0; i < num_batches; ++i) {
       std::shared_ptr<RecordBatch> chunk;
@@ -552,6 +683,7 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
 
   std::unique_ptr<io::BufferOutputStream> sink_;
   std::shared_ptr<ResizableBuffer> buffer_;
+  std::shared_ptr<io::BufferReader> buf_reader_;
 };
 
 TEST_P(TestFileFormat, RoundTrip) {
@@ -571,6 +703,278 @@ TEST_P(TestFileFormat, RoundTrip) {
   }
 }
 
+TEST_P(TestFileFormat, ReadFieldSubset) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch}, &reader));
+
+  auto CheckSubset = [&](const std::vector<int>& indices) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadRecordBatch(0, indices, &result));
+    ASSERT_EQ(static_cast<int>(indices.size()), result->num_columns());
+    ASSERT_EQ(batch->num_rows(), result->num_rows());
+    for (size_t k = 0; k < indices.size(); ++k) {
+      ASSERT_TRUE(result->schema()->field(static_cast<int>(k))->Equals(
+          batch->schema()->field(indices[k])));
+      ASSERT_ARRAYS_EQUAL(*batch->column(indices[k]),
+                          *result->column(static_cast<int>(k)));
+    }
+  };
+
+  // Each field on its own, then all fields in reverse order
+  std::vector<int> reversed;
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    CheckSubset({i});
+    reversed.insert(reversed.begin(), i);
+  }
+  CheckSubset(reversed);
+  CheckSubset({});
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {batch->num_columns()}, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {-1}, &result));
+}
+
+TEST_F(TestFileFormat, ReadNestedDictionaryFieldSubset) {
+  std::shared_ptr<RecordBatch> dict_batch;
+  ASSERT_OK(MakeDictionary(&dict_batch));
+
+  // A struct whose children are a dictionary and a list of dictionaries, between
+  // top-level dictionary fields, so that skipped fields own dictionaries and
+  // nested buffers
+  const auto& dict_schema = *dict_batch->schema();
+  auto struct_type = struct_({dict_schema.field(0), dict_schema.field(3)});
+  auto struct_array = std::make_shared<StructArray>(
+      struct_type, dict_batch->num_rows(),
+      std::vector<std::shared_ptr<Array>>{dict_batch->column(0), dict_batch->column(3)});
+  auto schema = ::arrow::schema({dict_schema.field(1), field("nested", struct_type),
+                                 dict_schema.field(2), dict_schema.field(4)});
+  auto batch = RecordBatch::Make(schema, dict_batch->num_rows(),
+                                 {dict_batch->column(1), struct_array,
+                                  dict_batch->column(2), dict_batch->column(4)});
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch, batch}, &reader));
+
+  for (const std::vector<int>& indices :
+       std::vector<std::vector<int>>{{1}, {3, 1}, {2}, {1, 0}, {3}}) {
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> result;
+      ASSERT_OK(reader->ReadRecordBatch(i, indices, &result));
+      ASSERT_OK(result->Validate());
+      ASSERT_EQ(static_cast<int>(indices.size()), result->num_columns());
+      for (size_t k = 0; k < indices.size(); ++k) {
+        const int j = static_cast<int>(k);
+        ASSERT_TRUE(result->schema()->field(j)->Equals(schema->field(indices[k])));
+        ASSERT_ARRAYS_EQUAL(*batch->column(indices[k]), *result->column(j));
+      }
+    }
+  }
+}
+
+TEST_P(TestFileFormat, LazyTable) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  BatchVector in_batches = {batch, batch, batch};
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen(in_batches, &reader));
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches(in_batches, &expected));
+
+  std::shared_ptr<LazyFileTable> table;
+  ASSERT_OK(reader->OpenLazyTable(&table));
+  ASSERT_EQ(expected->num_rows(), table->num_rows());
+  ASSERT_EQ(expected->num_columns(), table->num_columns());
+  ASSERT_TRUE(table->schema()->Equals(*expected->schema()));
+
+  // Read the columns in reverse order
+  for (int i = table->num_columns() - 1; i >= 0; --i) {
+    std::shared_ptr<Column> column, column_again;
+    ASSERT_OK(table->ReadColumn(i, &column));
+    ASSERT_TRUE(column->Equals(expected->column(i)));
+    ASSERT_OK(table->ReadColumn(i, &column_again));
+    ASSERT_EQ(column.get(), column_again.get());
+  }
+  std::shared_ptr<Column> unused;
+  ASSERT_RAISES(Invalid, table->ReadColumn(-1, &unused));
+  ASSERT_RAISES(Invalid, table->ReadColumn(table->num_columns(), &unused));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(table->ReadTable(&result));
+  ASSERT_OK(result->Validate());
+  ASSERT_TRUE(result->Equals(*expected));
+
+  if (table->num_columns() > 0) {
+    std::shared_ptr<LazyFileTable> removed;
+    std::shared_ptr<Table> expected_removed;
+    ASSERT_OK(table->RemoveColumn(0, &removed));
+    ASSERT_OK(expected->RemoveColumn(0, &expected_removed));
+    ASSERT_OK(removed->ReadTable(&result));
+    ASSERT_TRUE(result->Equals(*expected_removed));
+  }
+}
+
+// Fails positional reads once told to
+class FailingBufferReader : public io::BufferReader {
+ public:
+  explicit FailingBufferReader(const std::shared_ptr<Buffer>& buffer)
+      : io::BufferReader(buffer), fail_reads_(false) {}
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    if (fail_reads_) {
+      return Status::IOError("injected read failure");
+    }
+    return io::BufferReader::ReadAt(position, nbytes, out);
+  }
+
+  void set_fail_reads(bool fail_reads) { fail_reads_ = fail_reads; }
+
+ private:
+  bool fail_reads_;
+};
+
+TEST_F(TestFileFormat, LazyTableReadError) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(100, &batch));
+  std::shared_ptr<RecordBatchFileReader> unused;
+  ASSERT_OK(WriteAndOpen({batch, batch}, &unused));
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+
+  FailingBufferReader file(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&file, footer_offset, &reader));
+  std::shared_ptr<LazyFileTable> table;
+  ASSERT_OK(reader->OpenLazyTable(&table));
+
+  // Read errors are returned, and a failed read is not cached
+  file.set_fail_reads(true);
+  std::shared_ptr<Column> column;
+  ASSERT_RAISES(IOError, table->ReadColumn(0, &column));
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(IOError, table->ReadTable(&result));
+
+  file.set_fail_reads(false);
+  ASSERT_OK(table->ReadColumn(0, &column));
+  ASSERT_EQ(2 * batch->num_rows(), column->length());
+  ASSERT_OK(table->ReadTable(&result));
+  ASSERT_OK(result->Validate());
+}
+
+TEST_F(TestFileFormat, PrefetchingReader) {
+  // Batches of distinct lengths, so that unordered results can be matched
+  const int kNumBatches = 10;
+  BatchVector in_batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(100 + i, &batch));
+    in_batches.push_back(batch);
+  }
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen(in_batches, &reader));
+
+  for (int readahead : {1, 3, kNumBatches + 5}) {
+    for (bool ordered : {true, false}) {
+      auto options = FilePrefetchOptions::Defaults();
+      options.readahead = readahead;
+      options.ordered = ordered;
+      std::shared_ptr<RecordBatchReader> batch_reader;
+      ASSERT_OK(reader->OpenPrefetchingReader(options, &batch_reader));
+      ASSERT_TRUE(batch_reader->schema()->Equals(*in_batches[0]->schema()));
+
+      std::vector<bool> seen(kNumBatches, false);
+      for (int i = 0; i < kNumBatches; ++i) {
+        std::shared_ptr<RecordBatch> batch;
+        ASSERT_OK(batch_reader->ReadNext(&batch));
+        ASSERT_NE(nullptr, batch);
+        const int index = static_cast<int>(batch->num_rows()) - 100;
+        if (ordered) {
+          ASSERT_EQ(i, index);
+        }
+        ASSERT_FALSE(seen[index]);
+        seen[index] = true;
+        CompareBatch(*in_batches[index], *batch);
+      }
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(batch_reader->ReadNext(&batch));
+      ASSERT_EQ(nullptr, batch);
+    }
+  }
+}
+
+// Counts the positional reads in progress, and makes each take a while so that
+// prefetches are still running when the test acts
+class SlowBufferReader : public io::BufferReader {
+ public:
+  explicit SlowBufferReader(const std::shared_ptr<Buffer>& buffer)
+      : io::BufferReader(buffer), active_reads_(0), finished_reads_(0) {}
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++active_reads_;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    Status st = io::BufferReader::ReadAt(position, nbytes, out);
+    ++finished_reads_;
+    --active_reads_;
+    return st;
+  }
+
+  int active_reads() const { return active_reads_.load(); }
+  int finished_reads() const { return finished_reads_.load(); }
+
+ private:
+  std::atomic<int> active_reads_;
+  std::atomic<int> finished_reads_;
+};
+
+TEST_F(TestFileFormat, PrefetchingReaderDestroyedWithReadsInFlight) {
+  const int kNumBatches = 20;
+  BatchVector in_batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(100 + i, &batch));
+    in_batches.push_back(batch);
+  }
+  std::shared_ptr<RecordBatchFileReader> unused;
+  ASSERT_OK(WriteAndOpen(in_batches, &unused));
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+
+  SlowBufferReader file(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&file, footer_offset, &reader));
+
+  auto options = FilePrefetchOptions::Defaults();
+  options.readahead = kNumBatches;
+  for (int num_read : {0, 1, 5}) {
+    std::shared_ptr<RecordBatchReader> batch_reader;
+    ASSERT_OK(reader->OpenPrefetchingReader(options, &batch_reader));
+    for (int i = 0; i < num_read; ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(batch_reader->ReadNext(&batch));
+      CompareBatch(*in_batches[i], *batch);
+    }
+
+    // Destroying the reader waits for the reads it started, which would
+    // otherwise write into a released reader state. Nothing is submitted
+    // before the first ReadNext
+    batch_reader.reset();
+    ASSERT_EQ(0, file.active_reads());
+  }
+  // The destroyed readers had submitted their whole readahead window, and
+  // every read they started has completed
+  ASSERT_GT(file.finished_reads(), kNumBatches);
+
+  // The file reader is still usable afterwards
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadRecordBatch(kNumBatches - 1, &batch));
+  CompareBatch(*in_batches[kNumBatches - 1], *batch);
+}
+
 class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
  public:
   void SetUp() {
@@ -706,6 +1110,110 @@ TEST_F(TestStreamFormat, WriteTable) {
   ASSERT_TRUE(b3->Equals(*out_batches[2]));
 }
 
+TEST_F(TestStreamFormat, WriteBatchViews) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeStringTypesRecordBatch(&batch));
+  std::shared_ptr<RecordBatch> dict_batch;
+  ASSERT_OK(MakeDictionaryFlat(&dict_batch));
+
+  for (const auto& source : {batch, dict_batch}) {
+    ASSERT_OK(AllocateResizableBuffer(pool_, 0, &buffer_));
+    sink_.reset(new io::BufferOutputStream(buffer_));
+    std::shared_ptr<RecordBatchWriter> writer;
+    ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), source->schema(), &writer));
+
+    const BatchView view(*source);
+    BatchVector expected;
+    for (int64_t offset = 0; offset < view.num_rows(); offset += 3) {
+      ASSERT_OK(writer->WriteRecordBatch(view.Slice(offset, 3)));
+      expected.push_back(source->Slice(offset, 3));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink_->Close());
+
+    io::BufferReader buf_reader(buffer_);
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+    for (const auto& expected_batch : expected) {
+      std::shared_ptr<RecordBatch> result;
+      ASSERT_OK(reader->ReadNext(&result));
+      ASSERT_NE(nullptr, result);
+      CompareBatch(*expected_batch, *result);
+    }
+    std::shared_ptr<RecordBatch> end;
+    ASSERT_OK(reader->ReadNext(&end));
+    ASSERT_EQ(nullptr, end);
+  }
+}
+
+// Batches sharing a dictionary-encoded column whose dictionary is first
+// extended and then replaced
+static void MakeChangingDictionaryBatches(BatchVector* out) {
+  std::shared_ptr<Array> dict0, dict1, dict2;
+  ArrayFromVector<StringType, std::string>({"foo", "bar"}, &dict0);
+  ArrayFromVector<StringType, std::string>({"foo", "bar", "baz", "qux"}, &dict1);
+  ArrayFromVector<StringType, std::string>({"quux"}, &dict2);
+
+  auto MakeBatch = [](const std::shared_ptr<Array>& dict,
+                      const std::vector<int32_t>& values) {
+    std::shared_ptr<Array> indices;
+    ArrayFromVector<Int32Type, int32_t>(values, &indices);
+    auto type = dictionary(int32(), dict);
+    auto column = std::make_shared<DictionaryArray>(type, indices);
+    auto schema = ::arrow::schema({field("f0", type)});
+    return RecordBatch::Make(schema, column->length(), {column});
+  };
+
+  *out = {MakeBatch(dict0, {0, 1, 1}), MakeBatch(dict1, {3, 2, 0}),
+          MakeBatch(dict1, {2, 2}), MakeBatch(dict2, {0, 0})};
+}
+
+TEST_F(TestStreamFormat, DictionaryDeltaAndReplacement) {
+  BatchVector batches;
+  MakeChangingDictionaryBatches(&batches);
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper(batches, &out_batches));
+
+  ASSERT_EQ(batches.size(), out_batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    CompareBatch(*batches[i], *out_batches[i]);
+  }
+
+  // The initial dictionary, a delta with the two new entries when it is
+  // extended, nothing when a batch reuses it, then a replacement
+  io::BufferReader buf_reader(buffer_);
+  auto message_reader = MessageReader::Open(&buf_reader);
+  std::vector<bool> is_delta;
+  std::vector<int64_t> dictionary_lengths;
+  std::unique_ptr<Message> message;
+  while (true) {
+    ASSERT_OK(message_reader->ReadNextMessage(&message));
+    if (message == nullptr) {
+      break;
+    }
+    if (message->type() != Message::DICTIONARY_BATCH) {
+      continue;
+    }
+    auto dictionary_batch = reinterpret_cast<const flatbuf::DictionaryBatch*>(
+        flatbuf::GetMessage(message->metadata()->data())->header());
+    is_delta.push_back(dictionary_batch->isDelta());
+    dictionary_lengths.push_back(dictionary_batch->data()->length());
+  }
+  ASSERT_EQ(std::vector<bool>({false, true, false}), is_delta);
+  ASSERT_EQ(std::vector<int64_t>({2, 2, 1}), dictionary_lengths);
+}
+
+TEST_F(TestFileFormat, DictionaryChangeNotSupported) {
+  BatchVector batches;
+  MakeChangingDictionaryBatches(&batches);
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batches[1]));
+}
+
 TEST_F(TestFileFormat, DictionaryRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeDictionary(&batch));
@@ -177,6 +177,7 @@ class SchemaWriter {
   template <typename T>
   typename std::enable_if<std::is_base_of<NoExtraMeta, T>::value ||
                               std::is_base_of<ListType, T>::value ||
+                              std::is_base_of<LargeListType, T>::value ||
                               std::is_base_of<StructType, T>::value,
                           void>::type
   WriteTypeMetadata(const T& type) {}
@@ -308,6 +309,10 @@ class SchemaWriter {
   Status Visit(const TimeType& type) { return WritePrimitive("time", type); }
   Status Visit(const StringType& type) { return WriteVarBytes("utf8", type); }
   Status Visit(const BinaryType& type) { return WriteVarBytes("binary", type); }
+  Status Visit(const LargeStringType& type) { return WriteVarBytes("largeutf8", type); }
+  Status Visit(const LargeBinaryType& type) {
+    return WriteVarBytes("largebinary", type);
+  }
   Status Visit(const FixedSizeBinaryType& type) {
     return WritePrimitive("fixedsizebinary", type);
   }
@@ -321,6 +326,11 @@ class SchemaWriter {
     return Status::OK();
   }
 
+  Status Visit(const LargeListType& type) {
+    WriteName("largelist", type);
+    return Status::OK();
+  }
+
   Status Visit(const StructType& type) {
     WriteName("struct", type);
     return Status::OK();
@@ -413,17 +423,21 @@ class ArrayWriter {
 
   // Binary, encode to hexadecimal. UTF8 string write as is
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryArray, T>::value, void>::type
+  typename std::enable_if<std::is_base_of<BinaryArray, T>::value ||
+                              std::is_base_of<LargeBinaryArray, T>::value,
+                          void>::type
   WriteDataValues(const T& arr) {
     for (int64_t i = 0; i < arr.length(); ++i) {
-      int32_t length;
+      typename T::TypeClass::offset_type length;
       const uint8_t* buf = arr.GetValue(i, &length);
 
-      if (std::is_base_of<StringArray, T>::value) {
+      if (std::is_base_of<StringArray, T>::value ||
+          std::is_base_of<LargeStringArray, T>::value) {
         // Presumed UTF-8
-        writer_->String(reinterpret_cast<const char*>(buf), length);
+        writer_->String(reinterpret_cast<const char*>(buf),
+                        static_cast<rj::SizeType>(length));
       } else {
-        writer_->String(HexEncode(buf, length));
+        writer_->String(HexEncode(buf, static_cast<int32_t>(length)));
       }
     }
   }
@@ -525,8 +539,10 @@ class ArrayWriter {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryArray, T>::value, Status>::type Visit(
-      const T& array) {
+  typename std::enable_if<std::is_base_of<BinaryArray, T>::value ||
+                              std::is_base_of<LargeBinaryArray, T>::value,
+                          Status>::type
+  Visit(const T& array) {
     WriteValidityField(array);
     WriteIntegerField("OFFSET", array.raw_value_offsets(), array.length() + 1);
     WriteDataField(array);
@@ -545,6 +561,13 @@ class ArrayWriter {
     return WriteChildren(type.children(), {array.values()});
   }
 
+  Status Visit(const LargeListArray& array) {
+    WriteValidityField(array);
+    WriteIntegerField("OFFSET", array.raw_value_offsets(), array.length() + 1);
+    const auto& type = checked_cast<const LargeListType&>(*array.type());
+    return WriteChildren(type.children(), {array.values()});
+  }
+
   Status Visit(const StructArray& array) {
     WriteValidityField(array);
     const auto& type = checked_cast<const StructType&>(*array.type());
@@ -808,6 +831,10 @@ static Status GetType(const RjObject& json_type,
     *type = utf8();
   } else if (type_name == "binary") {
     *type = binary();
+  } else if (type_name == "largeutf8") {
+    *type = large_utf8();
+  } else if (type_name == "largebinary") {
+    *type = large_binary();
   } else if (type_name == "fixedsizebinary") {
     return GetFixedSizeBinary(json_type, type);
   } else if (type_name == "decimal") {
@@ -825,6 +852,11 @@ static Status GetType(const RjObject& json_type,
       return Status::Invalid("List must have exactly one child");
     }
     *type = list(children[0]);
+  } else if (type_name == "largelist") {
+    if (children.size() != 1) {
+      return Status::Invalid("LargeList must have exactly one child");
+    }
+    *type = large_list(children[0]);
   } else if (type_name == "struct") {
     *type = struct_(children);
   } else if (type_name == "union") {
@@ -1006,8 +1038,10 @@ class ArrayReader {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryType, T>::value, Status>::type Visit(
-      const T& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, T>::value ||
+                              std::is_base_of<LargeBinaryType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
     typename TypeTraits<T>::BuilderType builder(pool_);
 
     const auto& json_data = obj_->FindMember("DATA");
@@ -1025,7 +1059,8 @@ class ArrayReader {
 
       const rj::Value& val = json_data_arr[i];
       DCHECK(val.IsString());
-      if (std::is_base_of<StringType, T>::value) {
+      if (std::is_base_of<StringType, T>::value ||
+          std::is_base_of<LargeStringType, T>::value) {
         RETURN_NOT_OK(builder.Append(val.GetString()));
       } else {
         std::string hex_string = val.GetString();
@@ -1130,15 +1165,22 @@ class ArrayReader {
     T* values = reinterpret_cast<T*>(buffer->mutable_data());
     for (int i = 0; i < length; ++i) {
       const rj::Value& val = json_array[i];
-      DCHECK(val.IsInt());
-      values[i] = static_cast<T>(val.GetInt());
+      DCHECK(val.IsInt64());
+      values[i] = static_cast<T>(val.GetInt64());
     }
 
     *out = buffer;
     return Status::OK();
   }
 
-  Status Visit(const ListType& type) {
+  Status Visit(const ListType& type) { return GetList<ListArray, int32_t>(type); }
+
+  Status Visit(const LargeListType& type) {
+    return GetList<LargeListArray, int64_t>(type);
+  }
+
+  template <typename ArrayType, typename OffsetType>
+  Status GetList(const DataType& type) {
     int32_t null_count = 0;
     std::shared_ptr<Buffer> validity_buffer;
     RETURN_NOT_OK(GetValidityBuffer(is_valid_, &null_count, &validity_buffer));
@@ -1146,14 +1188,14 @@ class ArrayReader {
     const auto& json_offsets = obj_->FindMember("OFFSET");
     RETURN_NOT_ARRAY("OFFSET", json_offsets, *obj_);
     std::shared_ptr<Buffer> offsets_buffer;
-    RETURN_NOT_OK(GetIntArray<int32_t>(json_offsets->value.GetArray(), length_ + 1,
-                                       &offsets_buffer));
+    RETURN_NOT_OK(GetIntArray<OffsetType>(json_offsets->value.GetArray(), length_ + 1,
+                                          &offsets_buffer));
 
     std::vector<std::shared_ptr<Array>> children;
     RETURN_NOT_OK(GetChildren(*obj_, type, &children));
     DCHECK_EQ(children.size(), 1);
 
-    result_ = std::make_shared<ListArray>(type_, length_, offsets_buffer, children[0],
+    result_ = std::make_shared<ArrayType>(type_, length_, offsets_buffer, children[0],
                                           validity_buffer, null_count);
 
     return Status::OK();
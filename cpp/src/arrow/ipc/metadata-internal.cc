@@ -149,6 +149,14 @@ static Status ListToFlatbuffer(FBB& fbb, const DataType& type,
   return Status::OK();
 }
 
+static Status LargeListToFlatbuffer(FBB& fbb, const DataType& type,
+                                    std::vector<FieldOffset>* out_children,
+                                    DictionaryMemo* dictionary_memo, Offset* offset) {
+  RETURN_NOT_OK(AppendChildFields(fbb, type, out_children, dictionary_memo));
+  *offset = flatbuf::CreateLargeList(fbb).Union();
+  return Status::OK();
+}
+
 static Status StructToFlatbuffer(FBB& fbb, const DataType& type,
                                  std::vector<FieldOffset>* out_children,
                                  DictionaryMemo* dictionary_memo, Offset* offset) {
@@ -271,6 +279,12 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
     case flatbuf::Type_Utf8:
       *out = utf8();
       return Status::OK();
+    case flatbuf::Type_LargeBinary:
+      *out = large_binary();
+      return Status::OK();
+    case flatbuf::Type_LargeUtf8:
+      *out = large_utf8();
+      return Status::OK();
     case flatbuf::Type_Bool:
       *out = boolean();
       return Status::OK();
@@ -321,12 +335,20 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
     }
     case flatbuf::Type_Interval:
       return Status::NotImplemented("Interval");
+    case flatbuf::Type_Duration:
+      return Status::NotImplemented("Duration");
     case flatbuf::Type_List:
       if (children.size() != 1) {
         return Status::Invalid("List must have exactly 1 child field");
       }
       *out = std::make_shared<ListType>(children[0]);
       return Status::OK();
+    case flatbuf::Type_LargeList:
+      if (children.size() != 1) {
+        return Status::Invalid("LargeList must have exactly 1 child field");
+      }
+      *out = std::make_shared<LargeListType>(children[0]);
+      return Status::OK();
     case flatbuf::Type_Struct_:
       *out = std::make_shared<StructType>(children);
       return Status::OK();
@@ -402,6 +424,14 @@ static Status TypeToFlatbuffer(FBB& fbb, const DataType& type,
       *out_type = flatbuf::Type_Utf8;
       *offset = flatbuf::CreateUtf8(fbb).Union();
       break;
+    case Type::LARGE_BINARY:
+      *out_type = flatbuf::Type_LargeBinary;
+      *offset = flatbuf::CreateLargeBinary(fbb).Union();
+      break;
+    case Type::LARGE_STRING:
+      *out_type = flatbuf::Type_LargeUtf8;
+      *offset = flatbuf::CreateLargeUtf8(fbb).Union();
+      break;
     case Type::DATE32:
       *out_type = flatbuf::Type_Date;
       *offset = flatbuf::CreateDate(fbb, flatbuf::DateUnit_DAY).Union();
@@ -440,6 +470,9 @@ static Status TypeToFlatbuffer(FBB& fbb, const DataType& type,
     case Type::LIST:
       *out_type = flatbuf::Type_List;
       return ListToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
+    case Type::LARGE_LIST:
+      *out_type = flatbuf::Type_LargeList;
+      return LargeListToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
     case Type::STRUCT:
       *out_type = flatbuf::Type_Struct_;
       return StructToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
@@ -799,13 +832,14 @@ Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
 }
 
 Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
-                              const std::vector<FieldMetadata>& nodes,
+                              bool is_delta, const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
                         body_length, out);
 }
@@ -953,13 +987,11 @@ Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type
 // ----------------------------------------------------------------------
 // Implement message writing
 
-Status WriteMessage(const Buffer& message, io::OutputStream* file,
-                    int32_t* message_length) {
+void AppendMessageRegions(const Buffer& message, int64_t start_offset,
+                          int32_t* prefix, std::vector<io::IOVec>* iov,
+                          int32_t* message_length) {
   // Need to write 4 bytes (message size), the message, plus padding to
   // end on an 8-byte offset
-  int64_t start_offset;
-  RETURN_NOT_OK(file->Tell(&start_offset));
-
   int32_t padded_message_length = static_cast<int32_t>(message.size()) + 4;
   const int32_t remainder =
       (padded_message_length + static_cast<int32_t>(start_offset)) % 8;
@@ -971,20 +1003,29 @@ Status WriteMessage(const Buffer& message, io::OutputStream* file,
   // plus padding
   *message_length = padded_message_length;
 
-  // Write the flatbuffer size prefix including padding
-  int32_t flatbuffer_size = padded_message_length - 4;
-  RETURN_NOT_OK(file->Write(&flatbuffer_size, sizeof(int32_t)));
+  // The flatbuffer size prefix including padding
+  *prefix = padded_message_length - 4;
+  iov->push_back({prefix, sizeof(int32_t)});
 
-  // Write the flatbuffer
-  RETURN_NOT_OK(file->Write(message.data(), message.size()));
+  // The flatbuffer
+  iov->push_back({message.data(), message.size()});
 
-  // Write any padding
+  // Any padding
   int32_t padding = padded_message_length - static_cast<int32_t>(message.size()) - 4;
   if (padding > 0) {
-    RETURN_NOT_OK(file->Write(kPaddingBytes, padding));
+    iov->push_back({kPaddingBytes, padding});
   }
+}
 
-  return Status::OK();
+Status WriteMessage(const Buffer& message, io::OutputStream* file,
+                    int32_t* message_length) {
+  int64_t start_offset;
+  RETURN_NOT_OK(file->Tell(&start_offset));
+
+  int32_t prefix;
+  std::vector<io::IOVec> iov;
+  AppendMessageRegions(message, start_offset, &prefix, &iov, message_length);
+  return file->WriteV(iov);
 }
 
 }  // namespace internal
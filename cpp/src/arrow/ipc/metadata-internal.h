@@ -27,6 +27,7 @@
 
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/message.h"
 
 namespace arrow {
@@ -103,6 +104,15 @@ Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type
 Status WriteMessage(const Buffer& message, io::OutputStream* file,
                     int32_t* message_length);
 
+/// Append the regions written by WriteMessage for a message starting at
+/// start_offset to a gather list, for writing together with other data
+///
+/// \param[out] prefix storage for the length prefix, which must remain valid
+/// until iov has been written
+void AppendMessageRegions(const Buffer& message, int64_t start_offset,
+                          int32_t* prefix, std::vector<io::IOVec>* iov,
+                          int32_t* message_length);
+
 // Serialize arrow::Schema as a Flatbuffer
 //
 // \param[in] schema a Schema instance
@@ -125,8 +135,10 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        DictionaryMemo* dictionary_memo, io::OutputStream* out);
 
+// \param[in] is_delta if true, the entries are to be appended to the
+// dictionary with the same id read previously
 Status WriteDictionaryMessage(const int64_t id, const int64_t length,
-                              const int64_t body_length,
+                              const int64_t body_length, const bool is_delta,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
                               std::shared_ptr<Buffer>* out);
@@ -17,8 +17,15 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -38,12 +45,16 @@
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -54,18 +65,41 @@ namespace ipc {
 
 using internal::FileBlock;
 using internal::kArrowMagicBytes;
+using ::arrow::internal::GetCpuThreadPool;
+using ::arrow::internal::GetIOThreadPool;
+using ::arrow::internal::ThreadPool;
 
 // ----------------------------------------------------------------------
 // Record batch read path
 
+// Buffers of selected fields that are at most this many bytes apart are
+// fetched with a single read; the bytes in between are read and discarded
+static constexpr int64_t kMaxCoalesceGap = 8192;
+
+// Upper bound on the size of a single coalesced read
+static constexpr int64_t kMaxCoalescedReadSize = 32 << 20;
+
 /// Accessor class for flatbuffers metadata
+///
+/// Buffer offsets in the metadata are relative to the start of the message
+/// body, which is located at body_offset in the file. When reads are deferred,
+/// GetBuffer only records the requested byte ranges, which are then fetched
+/// together by ReadDeferredBuffers.
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata),
+        file_(file),
+        body_offset_(body_offset),
+        defer_reads_(false) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
-    const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
+    auto buffers = metadata_->buffers();
+    if (buffer_index >= static_cast<int>(buffers->size())) {
+      return Status::IOError("Buffer index out of range, likely malformed");
+    }
+    const flatbuf::Buffer* buffer = buffers->Get(buffer_index);
 
     if (buffer->length() == 0) {
       *out = nullptr;
@@ -74,7 +108,12 @@ class IpcComponentSource {
       DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
           << "Buffer " << buffer_index
           << " did not start on 8-byte aligned offset: " << buffer->offset();
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      if (defer_reads_) {
+        deferred_reads_.push_back(
+            {body_offset_ + buffer->offset(), buffer->length(), out});
+        return Status::OK();
+      }
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length(), out);
     }
   }
 
@@ -92,9 +131,99 @@ class IpcComponentSource {
     return Status::OK();
   }
 
+  void set_defer_reads(bool defer_reads) { defer_reads_ = defer_reads; }
+
+  /// \brief Read all deferred buffers, merging ranges that are close together
+  /// in the file into a single ReadAt call
+  ///
+  /// If io_pool is not null, the merged reads are issued concurrently on it.
+  Status ReadDeferredBuffers(ThreadPool* io_pool = nullptr) {
+    std::sort(deferred_reads_.begin(), deferred_reads_.end(),
+              [](const DeferredRead& left, const DeferredRead& right) {
+                return left.offset < right.offset;
+              });
+
+    // Group the requests into ranges [begin, end) of deferred_reads_
+    std::vector<std::pair<size_t, size_t>> groups;
+    size_t begin = 0;
+    while (begin < deferred_reads_.size()) {
+      const int64_t read_offset = deferred_reads_[begin].offset;
+      int64_t read_end = read_offset + deferred_reads_[begin].length;
+      size_t end = begin + 1;
+      while (end < deferred_reads_.size()) {
+        const DeferredRead& next = deferred_reads_[end];
+        const int64_t next_end = std::max(read_end, next.offset + next.length);
+        if (next.offset - read_end > kMaxCoalesceGap ||
+            next_end - read_offset > kMaxCoalescedReadSize) {
+          break;
+        }
+        read_end = next_end;
+        ++end;
+      }
+      groups.emplace_back(begin, end);
+      begin = end;
+    }
+
+    Status st;
+    if (io_pool == nullptr || groups.size() <= 1) {
+      for (const auto& group : groups) {
+        RETURN_NOT_OK(ReadGroup(group.first, group.second));
+      }
+    } else {
+      std::vector<std::future<Status>> futures;
+      for (const auto& group : groups) {
+        futures.push_back(io_pool->Submit(
+            [this](size_t first, size_t last) { return ReadGroup(first, last); },
+            group.first, group.second));
+      }
+      for (auto& fut : futures) {
+        st &= fut.get();
+      }
+    }
+    deferred_reads_.clear();
+    return st;
+  }
+
  private:
+  struct DeferredRead {
+    int64_t offset;
+    int64_t length;
+    std::shared_ptr<Buffer>* out;
+  };
+
+  // Fetch the deferred reads [begin, end) with a single ReadAt
+  Status ReadGroup(size_t begin, size_t end) {
+    const int64_t read_offset = deferred_reads_[begin].offset;
+    int64_t read_end = read_offset;
+    for (size_t i = begin; i < end; ++i) {
+      const DeferredRead& read = deferred_reads_[i];
+      read_end = std::max(read_end, read.offset + read.length);
+    }
+
+    // Let memory-mapped files page in the range ahead of the first access. This
+    // is only a hint, so a failure does not fail the read
+    ARROW_UNUSED(file_->WillNeed(read_offset, read_end - read_offset));
+
+    std::shared_ptr<Buffer> range;
+    RETURN_NOT_OK(file_->ReadAt(read_offset, read_end - read_offset, &range));
+    if (range->size() < read_end - read_offset) {
+      std::stringstream ss;
+      ss << "Expected to read " << (read_end - read_offset) << " bytes at offset "
+         << read_offset << " but got " << range->size();
+      return Status::IOError(ss.str());
+    }
+    for (size_t i = begin; i < end; ++i) {
+      const DeferredRead& read = deferred_reads_[i];
+      *read.out = SliceBuffer(range, read.offset - read_offset, read.length);
+    }
+    return Status::OK();
+  }
+
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
+  bool defer_reads_;
+  std::vector<DeferredRead> deferred_reads_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -102,11 +231,16 @@ class IpcComponentSource {
 /// The field_index and buffer_index are incremented in the ArrayLoader
 /// based on how much of the batch is "consumed" (through nested data
 /// reconstruction, for example)
+///
+/// When skip_buffers is set, the loader walks the field metadata of a field
+/// that was not selected, to keep both indices in sync, without touching its
+/// buffers.
 struct ArrayLoaderContext {
   IpcComponentSource* source;
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  bool skip_buffers;
 };
 
 static Status LoadArray(const std::shared_ptr<DataType>& type,
@@ -130,6 +264,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_buffers) {
+      *out = nullptr;
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -208,8 +346,10 @@ class ArrayLoader {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryType, T>::value, Status>::type Visit(
-      const T& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, T>::value ||
+                              std::is_base_of<LargeBinaryType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
     return LoadBinary<T>();
   }
 
@@ -219,7 +359,12 @@ class ArrayLoader {
     return GetBuffer(context_->buffer_index++, &out_->buffers[1]);
   }
 
-  Status Visit(const ListType& type) {
+  Status Visit(const ListType& type) { return LoadList(type); }
+
+  Status Visit(const LargeListType& type) { return LoadList(type); }
+
+  template <typename TYPE>
+  Status LoadList(const TYPE& type) {
     out_->buffers.resize(2);
 
     RETURN_NOT_OK(LoadCommon());
@@ -299,6 +444,7 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
   context.field_index = 0;
   context.buffer_index = 0;
   context.max_recursion_depth = max_recursion_depth;
+  context.skip_buffers = false;
 
   std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
   for (int i = 0; i < schema->num_fields(); ++i) {
@@ -312,6 +458,65 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
   return Status::OK();
 }
 
+// Load only the selected top-level fields. The field nodes and buffers of a
+// batch are laid out in schema order, so every field is walked to keep the
+// metadata indices in sync; the buffers of the selected fields are read once
+// all of them are known, coalescing nearby ranges.
+static Status LoadRecordBatchSubsetFromSource(const std::shared_ptr<Schema>& schema,
+                                              const std::vector<int>& field_indices,
+                                              int64_t num_rows, int max_recursion_depth,
+                                              IpcComponentSource* source,
+                                              ThreadPool* io_pool,
+                                              std::shared_ptr<RecordBatch>* out) {
+  std::vector<bool> selected(schema->num_fields(), false);
+  for (int i : field_indices) {
+    if (i < 0 || i >= schema->num_fields()) {
+      std::stringstream ss;
+      ss << "Field index " << i << " out of range for schema with "
+         << schema->num_fields() << " fields";
+      return Status::Invalid(ss.str());
+    }
+    selected[i] = true;
+  }
+
+  ArrayLoaderContext context;
+  context.source = source;
+  context.field_index = 0;
+  context.buffer_index = 0;
+  context.max_recursion_depth = max_recursion_depth;
+
+  // Fields past the last selected one need not be walked at all
+  int num_fields_to_walk = 0;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (selected[i]) {
+      num_fields_to_walk = i + 1;
+    }
+  }
+
+  source->set_defer_reads(true);
+  std::vector<std::shared_ptr<ArrayData>> loaded(schema->num_fields());
+  for (int i = 0; i < num_fields_to_walk; ++i) {
+    auto arr = std::make_shared<ArrayData>();
+    context.skip_buffers = !selected[i];
+    RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
+    DCHECK_EQ(num_rows, arr->length) << "Array length did not match record batch length";
+    if (selected[i]) {
+      loaded[i] = std::move(arr);
+    }
+  }
+  RETURN_NOT_OK(source->ReadDeferredBuffers(io_pool));
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  for (int i : field_indices) {
+    fields.push_back(schema->field(i));
+    arrays.push_back(loaded[i]);
+  }
+  *out = RecordBatch::Make(::arrow::schema(fields, schema->metadata()), num_rows,
+                           std::move(arrays));
+  return Status::OK();
+}
+
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      int max_recursion_depth, io::RandomAccessFile* file,
@@ -321,9 +526,8 @@ static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                    &source, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       int max_recursion_depth, io::RandomAccessFile* file,
-                       std::shared_ptr<RecordBatch>* out) {
+static Status GetRecordBatchMetadata(const Buffer& metadata,
+                                     const flatbuf::RecordBatch** out) {
   auto message = flatbuf::GetMessage(metadata.data());
   if (message->header_type() != flatbuf::MessageHeader_RecordBatch) {
     DCHECK_EQ(message->header_type(), flatbuf::MessageHeader_RecordBatch);
@@ -331,18 +535,46 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
   if (message->header() == nullptr) {
     return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
   }
-  auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+  *out = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+  return Status::OK();
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out) {
+  const flatbuf::RecordBatch* batch;
+  RETURN_NOT_OK(GetRecordBatchMetadata(metadata, &batch));
   return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
 }
 
+static Status ReadRecordBatchSubset(const Buffer& metadata,
+                                    const std::shared_ptr<Schema>& schema,
+                                    const std::vector<int>& field_indices,
+                                    int64_t body_offset, io::RandomAccessFile* file,
+                                    ThreadPool* io_pool,
+                                    std::shared_ptr<RecordBatch>* out) {
+  const flatbuf::RecordBatch* batch;
+  RETURN_NOT_OK(GetRecordBatchMetadata(metadata, &batch));
+  IpcComponentSource source(batch, file, body_offset);
+  return LoadRecordBatchSubsetFromSource(schema, field_indices, batch->length(),
+                                         kMaxNestingDepth, &source, io_pool, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const std::vector<int>& field_indices, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatchSubset(metadata, schema, field_indices, 0, file, nullptr, out);
+}
+
 Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionary_types,
-                      io::RandomAccessFile* file, int64_t* dictionary_id,
+                      io::RandomAccessFile* file, int64_t* dictionary_id, bool* is_delta,
                       std::shared_ptr<Array>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   auto dictionary_batch =
       reinterpret_cast<const flatbuf::DictionaryBatch*>(message->header());
 
   int64_t id = *dictionary_id = dictionary_batch->id();
+  *is_delta = dictionary_batch->isDelta();
   auto it = dictionary_types.find(id);
   if (it == dictionary_types.end()) {
     std::stringstream ss;
@@ -402,7 +634,7 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
 
 class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  public:
-  RecordBatchStreamReaderImpl() {}
+  RecordBatchStreamReaderImpl() : dictionaries_updated_(false) {}
   ~RecordBatchStreamReaderImpl() {}
 
   Status Open(std::unique_ptr<MessageReader> message_reader) {
@@ -419,20 +651,43 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     std::shared_ptr<Array> dictionary;
     int64_t id;
+    bool is_delta;
     RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, &reader, &id,
-                                 &dictionary));
+                                 &is_delta, &dictionary));
+    if (is_delta) {
+      return Status::Invalid("Delta dictionary batch precedes its initial dictionary");
+    }
     return dictionary_memo_.AddDictionary(id, dictionary);
   }
 
+  // Apply a dictionary batch which follows the initial dictionaries
+  Status ReadDictionaryUpdate(const Message& message) {
+    io::BufferReader reader(message.body());
+
+    std::shared_ptr<Array> dictionary;
+    int64_t id;
+    bool is_delta;
+    RETURN_NOT_OK(ReadDictionary(*message.metadata(), dictionary_types_, &reader, &id,
+                                 &is_delta, &dictionary));
+    if (is_delta) {
+      RETURN_NOT_OK(dictionary_memo_.AddDictionaryDelta(id, dictionary,
+                                                        default_memory_pool()));
+    } else {
+      RETURN_NOT_OK(dictionary_memo_.UpdateDictionary(id, dictionary));
+    }
+    dictionaries_updated_ = true;
+    return Status::OK();
+  }
+
   Status ReadSchema() {
-    std::unique_ptr<Message> message;
-    RETURN_NOT_OK(
-        ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false, &message));
+    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false,
+                                         &schema_message_));
 
-    if (message->header() == nullptr) {
+    if (schema_message_->header() == nullptr) {
       return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
     }
-    RETURN_NOT_OK(internal::GetDictionaryTypes(message->header(), &dictionary_types_));
+    RETURN_NOT_OK(
+        internal::GetDictionaryTypes(schema_message_->header(), &dictionary_types_));
 
     // TODO(wesm): In future, we may want to reconcile the ids in the stream with
     // those found in the schema
@@ -441,18 +696,36 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
       RETURN_NOT_OK(ReadNextDictionary());
     }
 
-    return internal::GetSchema(message->header(), dictionary_memo_, &schema_);
+    return internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_);
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::RECORD_BATCH,
-                                         true, &message));
+    while (true) {
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      RETURN_NOT_OK(ReadDictionaryUpdate(*message));
+    }
 
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    if (message->type() != Message::RECORD_BATCH) {
+      std::stringstream ss;
+      ss << "Message not expected type: " << FormatMessageType(Message::RECORD_BATCH)
+         << ", was: " << message->type();
+      return Status::IOError(ss.str());
+    }
+
+    if (dictionaries_updated_) {
+      // The dictionaries are part of the column types
+      RETURN_NOT_OK(
+          internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_));
+      dictionaries_updated_ = false;
     }
 
     io::BufferReader reader(message->body());
@@ -464,9 +737,13 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  private:
   std::unique_ptr<MessageReader> message_reader_;
 
+  // The schema message is kept to rebuild the schema when dictionaries change
+  std::unique_ptr<Message> schema_message_;
+
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
   DictionaryMemo dictionary_memo_;
+  bool dictionaries_updated_;
   std::shared_ptr<Schema> schema_;
 };
 
@@ -503,6 +780,253 @@ Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
   return impl_->ReadNext(batch);
 }
 
+// ----------------------------------------------------------------------
+// Prefetching reader
+
+// Reads the batches of a file on the CPU thread pool, ahead of the consumer.
+// At most `readahead` batches are being read or waiting to be consumed at
+// any time. The file reader must outlive this object; the destructor waits
+// for the outstanding reads.
+class PrefetchingRecordBatchReader : public RecordBatchReader {
+ public:
+  using ReadFunction = std::function<Status(int, std::shared_ptr<RecordBatch>*)>;
+
+  PrefetchingRecordBatchReader(const std::shared_ptr<Schema>& schema, int num_batches,
+                               const FilePrefetchOptions& options,
+                               ReadFunction read_batch)
+      : schema_(schema),
+        num_batches_(num_batches),
+        readahead_(std::max(1, options.readahead)),
+        ordered_(options.ordered),
+        read_batch_(std::move(read_batch)),
+        state_(std::make_shared<State>()),
+        num_submitted_(0),
+        num_yielded_(0) {}
+
+  ~PrefetchingRecordBatchReader() override {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->cv.wait(lock, [this] { return state_->num_in_flight == 0; });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (num_yielded_ == num_batches_) {
+      // EOS
+      *batch = nullptr;
+      return Status::OK();
+    }
+
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    RETURN_NOT_OK(SubmitReadsUnlocked());
+
+    auto it = state_->results.end();
+    state_->cv.wait(lock, [this, &it] {
+      it = ordered_ ? state_->results.find(num_yielded_) : state_->results.begin();
+      return it != state_->results.end();
+    });
+    ReadResult result = std::move(it->second);
+    state_->results.erase(it);
+    ++num_yielded_;
+
+    // Replace the consumed batch in the readahead window
+    RETURN_NOT_OK(SubmitReadsUnlocked());
+    RETURN_NOT_OK(result.status);
+    *batch = std::move(result.batch);
+    return Status::OK();
+  }
+
+ private:
+  struct ReadResult {
+    Status status;
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  // Shared with the read tasks, which may finish after the reader is gone
+  struct State {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int num_in_flight = 0;
+    // Finished reads not yet consumed, by batch index
+    std::map<int, ReadResult> results;
+  };
+
+  // Must be called with state_->mutex held
+  Status SubmitReadsUnlocked() {
+    while (num_submitted_ < num_batches_ &&
+           state_->num_in_flight + static_cast<int>(state_->results.size()) <
+               readahead_) {
+      const int index = num_submitted_;
+      std::shared_ptr<State> state = state_;
+      ReadFunction read_batch = read_batch_;
+      RETURN_NOT_OK(GetCpuThreadPool()->Spawn([state, read_batch, index]() {
+        ReadResult result;
+        result.status = read_batch(index, &result.batch);
+        std::lock_guard<std::mutex> guard(state->mutex);
+        state->results[index] = std::move(result);
+        --state->num_in_flight;
+        state->cv.notify_all();
+      }));
+      ++state_->num_in_flight;
+      ++num_submitted_;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  int num_batches_;
+  int readahead_;
+  bool ordered_;
+  ReadFunction read_batch_;
+  std::shared_ptr<State> state_;
+
+  int num_submitted_;
+  int num_yielded_;
+};
+
+// Read the metadata of an encapsulated message at the given file offset,
+// leaving its body unread
+static Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                                  io::RandomAccessFile* file,
+                                  std::unique_ptr<Message>* message) {
+  DCHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t));
+
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(file->ReadAt(offset, metadata_length, &buffer));
+  if (buffer->size() < metadata_length) {
+    std::stringstream ss;
+    ss << "Expected to read " << metadata_length << " metadata bytes but got "
+       << buffer->size();
+    return Status::Invalid(ss.str());
+  }
+
+  int32_t flatbuffer_size = *reinterpret_cast<const int32_t*>(buffer->data());
+  if (flatbuffer_size + static_cast<int>(sizeof(int32_t)) > metadata_length) {
+    std::stringstream ss;
+    ss << "flatbuffer size " << flatbuffer_size << " invalid. File offset: " << offset
+       << ", metadata length: " << metadata_length;
+    return Status::Invalid(ss.str());
+  }
+
+  return Message::Open(SliceBuffer(buffer, 4, buffer->size() - 4), nullptr, message);
+}
+
+// ----------------------------------------------------------------------
+// Lazily materialized table
+
+// What a LazyFileTable needs to read columns, shared with the tables derived
+// from it
+struct LazyTableSource {
+  io::RandomAccessFile* file;
+  std::shared_ptr<Schema> file_schema;
+
+  // Message metadata and body offset of each record batch
+  std::vector<std::shared_ptr<Buffer>> metadata;
+  std::vector<int64_t> body_offsets;
+};
+
+class LazyFileTable::LazyFileTableImpl {
+ public:
+  LazyFileTableImpl(const std::shared_ptr<LazyTableSource>& source,
+                    const std::shared_ptr<Schema>& schema,
+                    const std::vector<int>& field_indices,
+                    const std::vector<std::shared_ptr<Column>>& columns,
+                    int64_t num_rows)
+      : source_(source),
+        schema_(schema),
+        field_indices_(field_indices),
+        columns_(columns),
+        num_rows_(num_rows) {}
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  int64_t num_rows() const { return num_rows_; }
+
+  Status ReadColumn(int i, std::shared_ptr<Column>* out) {
+    if (i < 0 || i >= schema_->num_fields()) {
+      std::stringstream ss;
+      ss << "Invalid column index " << i << " for a table with "
+         << schema_->num_fields() << " columns";
+      return Status::Invalid(ss.str());
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (columns_[i] == nullptr) {
+      const std::vector<int> field_indices = {field_indices_[i]};
+      ArrayVector chunks;
+      for (size_t j = 0; j < source_->metadata.size(); ++j) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(ReadRecordBatchSubset(*source_->metadata[j], source_->file_schema,
+                                            field_indices, source_->body_offsets[j],
+                                            source_->file, nullptr, &batch));
+        chunks.push_back(batch->column(0));
+      }
+      columns_[i] = std::make_shared<Column>(schema_->field(i), chunks);
+    }
+    *out = columns_[i];
+    return Status::OK();
+  }
+
+  Status RemoveColumn(int i, std::unique_ptr<LazyFileTableImpl>* out) {
+    std::shared_ptr<Schema> new_schema;
+    RETURN_NOT_OK(schema_->RemoveField(i, &new_schema));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    out->reset(new LazyFileTableImpl(
+        source_, new_schema, ::arrow::internal::DeleteVectorElement(field_indices_, i),
+        ::arrow::internal::DeleteVectorElement(columns_, i), num_rows_));
+    return Status::OK();
+  }
+
+  Status ReadTable(std::shared_ptr<Table>* out) {
+    std::vector<std::shared_ptr<Column>> columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      RETURN_NOT_OK(ReadColumn(i, &columns[i]));
+    }
+    *out = Table::Make(schema_, columns, num_rows_);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<LazyTableSource> source_;
+  std::shared_ptr<Schema> schema_;
+
+  // Index in the file schema of each column
+  std::vector<int> field_indices_;
+
+  // Columns read so far
+  std::vector<std::shared_ptr<Column>> columns_;
+  std::mutex mutex_;
+
+  int64_t num_rows_;
+};
+
+LazyFileTable::LazyFileTable(std::unique_ptr<LazyFileTableImpl> impl)
+    : impl_(std::move(impl)) {}
+
+LazyFileTable::~LazyFileTable() {}
+
+std::shared_ptr<Schema> LazyFileTable::schema() const { return impl_->schema(); }
+
+int LazyFileTable::num_columns() const { return impl_->schema()->num_fields(); }
+
+int64_t LazyFileTable::num_rows() const { return impl_->num_rows(); }
+
+Status LazyFileTable::ReadColumn(int i, std::shared_ptr<Column>* out) const {
+  return impl_->ReadColumn(i, out);
+}
+
+Status LazyFileTable::RemoveColumn(int i, std::shared_ptr<LazyFileTable>* out) const {
+  std::unique_ptr<LazyFileTableImpl> impl;
+  RETURN_NOT_OK(impl_->RemoveColumn(i, &impl));
+  out->reset(new LazyFileTable(std::move(impl)));
+  return Status::OK();
+}
+
+Status LazyFileTable::ReadTable(std::shared_ptr<Table>* out) const {
+  return impl_->ReadTable(out);
+}
+
 // ----------------------------------------------------------------------
 // Reader implementation
 
@@ -582,6 +1106,62 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
   }
 
+  // Read the metadata of record batch i, leaving its body unread
+  Status ReadRecordBatchMetadata(int i, std::unique_ptr<Message>* message,
+                                 int64_t* body_offset) {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+    FileBlock block = record_batch(i);
+
+    DCHECK(BitUtil::IsMultipleOf8(block.offset));
+    DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
+    DCHECK(BitUtil::IsMultipleOf8(block.body_length));
+
+    RETURN_NOT_OK(
+        ReadMessageMetadata(block.offset, block.metadata_length, file_, message));
+    if ((*message)->type() != Message::RECORD_BATCH) {
+      std::stringstream ss;
+      ss << "Expected record batch message at offset " << block.offset << ", was "
+         << FormatMessageType((*message)->type());
+      return Status::IOError(ss.str());
+    }
+    *body_offset = block.offset + block.metadata_length;
+    return Status::OK();
+  }
+
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         ThreadPool* io_pool,
+                         std::shared_ptr<RecordBatch>* batch) {
+    // Only read the metadata here; the body is read piecewise
+    std::unique_ptr<Message> message;
+    int64_t body_offset;
+    RETURN_NOT_OK(ReadRecordBatchMetadata(i, &message, &body_offset));
+    return ReadRecordBatchSubset(*message->metadata(), schema_, field_indices,
+                                 body_offset, file_, io_pool, batch);
+  }
+
+  Status ReadLazyTableSource(std::shared_ptr<LazyTableSource>* out, int64_t* num_rows) {
+    auto source = std::make_shared<LazyTableSource>();
+    source->file = file_;
+    source->file_schema = schema_;
+
+    *num_rows = 0;
+    for (int i = 0; i < num_record_batches(); ++i) {
+      std::unique_ptr<Message> message;
+      int64_t body_offset;
+      RETURN_NOT_OK(ReadRecordBatchMetadata(i, &message, &body_offset));
+
+      const flatbuf::RecordBatch* batch;
+      RETURN_NOT_OK(GetRecordBatchMetadata(*message->metadata(), &batch));
+      *num_rows += batch->length();
+
+      source->metadata.push_back(message->metadata());
+      source->body_offsets.push_back(body_offset);
+    }
+    *out = source;
+    return Status::OK();
+  }
+
   Status ReadSchema() {
     RETURN_NOT_OK(internal::GetDictionaryTypes(footer_->schema(), &dictionary_fields_));
 
@@ -600,8 +1180,12 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
       std::shared_ptr<Array> dictionary;
       int64_t dictionary_id;
+      bool is_delta;
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_fields_, &reader,
-                                   &dictionary_id, &dictionary));
+                                   &dictionary_id, &is_delta, &dictionary));
+      if (is_delta) {
+        return Status::Invalid("Delta dictionary batches are not supported in files");
+      }
       RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
     }
 
@@ -689,6 +1273,48 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::ReadRecordBatch(int i,
+                                              const std::vector<int>& field_indices,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, field_indices, nullptr, batch);
+}
+
+Status RecordBatchFileReader::OpenLazyTable(std::shared_ptr<LazyFileTable>* out) {
+  std::shared_ptr<LazyTableSource> source;
+  int64_t num_rows;
+  RETURN_NOT_OK(impl_->ReadLazyTableSource(&source, &num_rows));
+
+  std::vector<int> field_indices(schema()->num_fields());
+  std::iota(field_indices.begin(), field_indices.end(), 0);
+  std::vector<std::shared_ptr<Column>> columns(schema()->num_fields());
+  std::unique_ptr<LazyFileTable::LazyFileTableImpl> impl(
+      new LazyFileTable::LazyFileTableImpl(source, schema(), field_indices, columns,
+                                           num_rows));
+  out->reset(new LazyFileTable(std::move(impl)));
+  return Status::OK();
+}
+
+FilePrefetchOptions FilePrefetchOptions::Defaults() {
+  FilePrefetchOptions options;
+  options.readahead = 4;
+  options.ordered = true;
+  return options;
+}
+
+Status RecordBatchFileReader::OpenPrefetchingReader(
+    const FilePrefetchOptions& options, std::shared_ptr<RecordBatchReader>* out) {
+  std::vector<int> all_fields(impl_->schema()->num_fields());
+  std::iota(all_fields.begin(), all_fields.end(), 0);
+
+  RecordBatchFileReaderImpl* impl = impl_.get();
+  auto read_batch = [impl, all_fields](int i, std::shared_ptr<RecordBatch>* batch) {
+    return impl->ReadRecordBatch(i, all_fields, GetIOThreadPool(), batch);
+  };
+  out->reset(new PrefetchingRecordBatchReader(schema(), num_record_batches(), options,
+                                              read_batch));
+  return Status::OK();
+}
+
 static Status ReadContiguousPayload(io::InputStream* file, bool aligned,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, aligned, message));
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/message.h"
 #include "arrow/record_batch.h"
@@ -30,8 +31,10 @@
 namespace arrow {
 
 class Buffer;
+class Column;
 class Schema;
 class Status;
+class Table;
 class Tensor;
 
 namespace io {
@@ -45,12 +48,18 @@ namespace ipc {
 
 using RecordBatchReader = ::arrow::RecordBatchReader;
 
+class LazyFileTable;
+
 /// \class RecordBatchStreamReader
 /// \brief Synchronous batch stream reader that reads from io::InputStream
 ///
 /// This class reads the schema (plus any dictionaries) as the first messages
 /// in the stream, followed by record batches. For more granular zero-copy
 /// reads see the ReadRecordBatch functions
+///
+/// Dictionary batches between record batches either replace a dictionary or,
+/// if they are deltas, append entries to it. Record batches read afterwards,
+/// and schema(), have the updated dictionaries in their types
 class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
  public:
   ~RecordBatchStreamReader() override;
@@ -90,6 +99,22 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   std::unique_ptr<RecordBatchStreamReaderImpl> impl_;
 };
 
+/// \brief Options for RecordBatchFileReader::OpenPrefetchingReader
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+struct ARROW_EXPORT FilePrefetchOptions {
+  static FilePrefetchOptions Defaults();
+
+  /// Maximum number of batches being read or waiting to be consumed, which
+  /// bounds the memory held by the reader
+  int readahead;
+
+  /// Whether batches are yielded in file order; otherwise each batch is
+  /// yielded as soon as it has been read
+  bool ordered;
+};
+
 /// \brief Reads the record batch file format
 class ARROW_EXPORT RecordBatchFileReader {
  public:
@@ -153,6 +178,50 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read a subset of the top-level fields of a record batch
+  ///
+  /// Only the buffers of the selected fields are read from the file, and
+  /// buffers lying close together are fetched with a single read. The
+  /// resulting batch has the selected fields in the order given.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] field_indices the indices of the fields to read
+  /// \param[out] batch the read batch
+  /// \return Status
+  ///
+  /// \since 0.11.0
+  /// \note API not yet finalized
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Return a reader over all batches of the file which reads ahead of
+  /// the consumer
+  ///
+  /// Batches are read on the global CPU thread pool. Within a batch, the reads
+  /// of the buffers are issued concurrently on the global IO thread pool. This
+  /// file reader must outlive the returned reader.
+  ///
+  /// \param[in] options the readahead and ordering options
+  /// \param[out] out the returned reader
+  /// \return Status
+  ///
+  /// \since 0.11.0
+  /// \note API not yet finalized
+  Status OpenPrefetchingReader(const FilePrefetchOptions& options,
+                               std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Open a LazyFileTable over all batches of the file
+  ///
+  /// Only the metadata of the record batches is read here. This file reader
+  /// must outlive the returned object, but not the columns read from it.
+  ///
+  /// \param[out] out the returned lazy table
+  /// \return Status
+  ///
+  /// \since 0.11.0
+  /// \note API not yet finalized
+  Status OpenLazyTable(std::shared_ptr<LazyFileTable>* out);
+
  private:
   RecordBatchFileReader();
 
@@ -160,6 +229,60 @@ class ARROW_EXPORT RecordBatchFileReader {
   std::unique_ptr<RecordBatchFileReaderImpl> impl_;
 };
 
+/// \class LazyFileTable
+/// \brief The columns of an Arrow file, each read from all record batches on
+/// first access
+///
+/// Reading a column issues one projected read per record batch and caches
+/// the result; memory-mapped files are advised to page its buffers in. Unlike
+/// a Table, reads can fail, so columns are returned through Status-returning
+/// accessors. Opened with RecordBatchFileReader::OpenLazyTable
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+class ARROW_EXPORT LazyFileTable {
+ public:
+  ~LazyFileTable();
+
+  /// \brief Return the schema of the table
+  std::shared_ptr<Schema> schema() const;
+
+  /// \brief Return the number of columns in the table
+  int num_columns() const;
+
+  /// \brief Return the number of rows, summed over all record batches
+  int64_t num_rows() const;
+
+  /// \brief Return the i-th column, reading it if it was not read before
+  ///
+  /// \param[in] i the column index, 0 <= i < num_columns()
+  /// \param[out] out the column
+  /// \return Status
+  Status ReadColumn(int i, std::shared_ptr<Column>* out) const;
+
+  /// \brief Return a lazy table without the i-th column. Columns already read
+  /// are shared with this table
+  ///
+  /// \param[in] i the column index
+  /// \param[out] out the new lazy table
+  /// \return Status
+  Status RemoveColumn(int i, std::shared_ptr<LazyFileTable>* out) const;
+
+  /// \brief Read all columns into an in-memory Table
+  ///
+  /// \param[out] out the table
+  /// \return Status
+  Status ReadTable(std::shared_ptr<Table>* out) const;
+
+ private:
+  friend class RecordBatchFileReader;
+
+  class ARROW_NO_EXPORT LazyFileTableImpl;
+  explicit LazyFileTable(std::unique_ptr<LazyFileTableImpl> impl);
+
+  std::unique_ptr<LazyFileTableImpl> impl_;
+};
+
 // Generic read functions; does not copy data if the input supports zero copy reads
 
 /// \brief Read Schema from stream serialized as a sequence of one or more IPC
@@ -219,6 +342,24 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
                        int max_recursion_depth, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \brief Read a subset of the top-level fields of a record batch from a file
+/// given metadata and schema
+///
+/// \param[in] metadata a Message containing the record batch metadata
+/// \param[in] schema the record batch schema
+/// \param[in] field_indices the indices of the fields to read
+/// \param[in] file a random access file whose contents start with the body
+/// \param[out] out the read record batch, with the selected fields in the
+/// order given
+/// \return Status
+///
+/// \since 0.11.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const std::vector<int>& field_indices, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out);
+
 /// \brief EXPERIMENTAL: Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] offset the file location of the start of the message
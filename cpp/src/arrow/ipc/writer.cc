@@ -59,11 +59,19 @@ static inline Status GetTruncatedBitmap(int64_t offset, int64_t length,
     return Status::OK();
   }
   int64_t min_length = PaddedLength(BitUtil::BytesForBits(length));
-  if (offset != 0 || min_length < input->size()) {
-    // With a sliced array / non-zero offset, we must copy the bitmap
-    RETURN_NOT_OK(CopyBitmap(pool, input->data(), offset, length, buffer));
+  if (offset % 8 == 0) {
+    // Byte-aligned bitmaps can be written directly. Bits past the end of the
+    // array in the last byte are unspecified, as is padding.
+    const int64_t byte_offset = offset / 8;
+    if (byte_offset != 0 || min_length < input->size()) {
+      *buffer = SliceBuffer(input, byte_offset,
+                            std::min(min_length, input->size() - byte_offset));
+    } else {
+      *buffer = input;
+    }
   } else {
-    *buffer = input;
+    // Otherwise the bits must be shifted into a new bitmap
+    RETURN_NOT_OK(CopyBitmap(pool, input->data(), offset, length, buffer));
   }
   return Status::OK();
 }
@@ -96,11 +104,15 @@ static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
   return offset != 0 || min_length < buffer->size();
 }
 
+// Size of the scratch space used to rebase the offsets of sliced arrays
+static constexpr int64_t kRebaseScratchSize = 1 << 16;
+
 class RecordBatchSerializer : public ArrayVisitor {
  public:
   RecordBatchSerializer(MemoryPool* pool, int64_t buffer_start_offset,
                         int max_recursion_depth, bool allow_64bit)
       : pool_(pool),
+        scratch_position_(0),
         max_recursion_depth_(max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
         allow_64bit_(allow_64bit) {
@@ -125,26 +137,46 @@ class RecordBatchSerializer : public ArrayVisitor {
       std::shared_ptr<Buffer> bitmap;
       RETURN_NOT_OK(GetTruncatedBitmap(arr.offset(), arr.length(), arr.null_bitmap(),
                                        pool_, &bitmap));
-      buffers_.push_back(bitmap);
+      PushBuffer(bitmap);
     } else {
       // Push a dummy zero-length buffer, not to be copied
-      buffers_.push_back(std::make_shared<Buffer>(nullptr, 0));
+      PushBuffer(std::make_shared<Buffer>(nullptr, 0));
     }
     return arr.Accept(this);
   }
 
   Status Assemble(const RecordBatch& batch, int64_t* body_length) {
-    if (field_nodes_.size() > 0) {
-      field_nodes_.clear();
-      buffer_meta_.clear();
-      buffers_.clear();
-    }
+    Reset();
 
     // Perform depth-first traversal of the row-batch
     for (int i = 0; i < batch.num_columns(); ++i) {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
+    return AssembleBufferMetadata(body_length);
+  }
+
+  Status Assemble(const BatchView& view, int64_t* body_length) {
+    Reset();
+
+    // Each column span is boxed on its own, as an array sliced to the viewed
+    // rows; no RecordBatch is built
+    for (int i = 0; i < view.num_columns(); ++i) {
+      RETURN_NOT_OK(VisitArray(*view.column(i).ToArray()));
+    }
+    return AssembleBufferMetadata(body_length);
+  }
+
+  void Reset() {
+    if (field_nodes_.size() > 0) {
+      field_nodes_.clear();
+      buffer_meta_.clear();
+      buffers_.clear();
+      offset_bases_.clear();
+      offset_widths_.clear();
+    }
+  }
 
+  Status AssembleBufferMetadata(int64_t* body_length) {
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -183,11 +215,21 @@ class RecordBatchSerializer : public ArrayVisitor {
   Status Write(const RecordBatch& batch, io::OutputStream* dst, int32_t* metadata_length,
                int64_t* body_length) {
     RETURN_NOT_OK(Assemble(batch, body_length));
+    return WriteAssembled(batch.num_rows(), dst, metadata_length, body_length);
+  }
 
-#ifndef NDEBUG
-    int64_t start_position, current_position;
+  Status Write(const BatchView& view, io::OutputStream* dst, int32_t* metadata_length,
+               int64_t* body_length) {
+    RETURN_NOT_OK(Assemble(view, body_length));
+    return WriteAssembled(view.num_rows(), dst, metadata_length, body_length);
+  }
+
+ protected:
+  // Write the message for the buffers gathered by Assemble
+  Status WriteAssembled(int64_t num_rows, io::OutputStream* dst,
+                        int32_t* metadata_length, int64_t* body_length) {
+    int64_t start_position;
     RETURN_NOT_OK(dst->Tell(&start_position));
-#endif
 
     // Now that we have computed the locations of all of the buffers in shared
     // memory, the data header can be converted to a flatbuffer and written out
@@ -195,15 +237,17 @@ class RecordBatchSerializer : public ArrayVisitor {
     // Note: The memory written here is prefixed by the size of the flatbuffer
     // itself as an int32_t.
     std::shared_ptr<Buffer> metadata_fb;
-    RETURN_NOT_OK(WriteMetadataMessage(batch.num_rows(), *body_length, &metadata_fb));
-    RETURN_NOT_OK(internal::WriteMessage(*metadata_fb, dst, metadata_length));
+    RETURN_NOT_OK(WriteMetadataMessage(num_rows, *body_length, &metadata_fb));
 
-#ifndef NDEBUG
-    RETURN_NOT_OK(dst->Tell(&current_position));
-    DCHECK(BitUtil::IsMultipleOf8(current_position));
-#endif
+    // The metadata, the buffers and all padding are written with a single
+    // vectored write, rather than one write per buffer
+    std::vector<io::IOVec> iov;
+    iov.reserve(3 + 2 * buffers_.size());
+    int32_t prefix;
+    internal::AppendMessageRegions(*metadata_fb, start_position, &prefix, &iov,
+                                   metadata_length);
+    DCHECK(BitUtil::IsMultipleOf8(start_position + *metadata_length));
 
-    // Now write the buffers
     for (size_t i = 0; i < buffers_.size(); ++i) {
       const Buffer* buffer = buffers_[i].get();
       int64_t size = 0;
@@ -216,15 +260,26 @@ class RecordBatchSerializer : public ArrayVisitor {
       }
 
       if (size > 0) {
-        RETURN_NOT_OK(dst->Write(buffer->data(), size));
+        if (offset_bases_[i] == 0) {
+          iov.push_back({buffer->data(), size});
+        } else if (offset_widths_[i] == sizeof(int64_t)) {
+          RETURN_NOT_OK(
+              AppendRebasedOffsets<int64_t>(*buffer, offset_bases_[i], dst, &iov));
+        } else {
+          RETURN_NOT_OK(AppendRebasedOffsets<int32_t>(
+              *buffer, static_cast<int32_t>(offset_bases_[i]), dst, &iov));
+        }
       }
 
       if (padding > 0) {
-        RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+        iov.push_back({kPaddingBytes, padding});
       }
     }
+    RETURN_NOT_OK(dst->WriteV(iov));
+    scratch_position_ = 0;
 
 #ifndef NDEBUG
+    int64_t current_position;
     RETURN_NOT_OK(dst->Tell(&current_position));
     DCHECK(BitUtil::IsMultipleOf8(current_position));
 #endif
@@ -232,7 +287,6 @@ class RecordBatchSerializer : public ArrayVisitor {
     return Status::OK();
   }
 
- protected:
   template <typename ArrayType>
   Status VisitFixedWidth(const ArrayType& array) {
     std::shared_ptr<Buffer> data = array.values();
@@ -251,48 +305,101 @@ class RecordBatchSerializer : public ArrayVisitor {
                    data->size() - byte_offset);
       data = SliceBuffer(data, byte_offset, buffer_length);
     }
-    buffers_.push_back(data);
+    PushBuffer(data);
     return Status::OK();
   }
 
-  template <typename ArrayType>
-  Status GetZeroBasedValueOffsets(const ArrayType& array,
-                                  std::shared_ptr<Buffer>* value_offsets) {
-    // Share slicing logic between ListArray and BinaryArray
+  void PushBuffer(const std::shared_ptr<Buffer>& buffer, int64_t offset_base = 0,
+                  int offset_width = sizeof(int32_t)) {
+    buffers_.push_back(buffer);
+    offset_bases_.push_back(offset_base);
+    offset_widths_.push_back(offset_width);
+  }
 
+  // Share slicing logic between the list and binary arrays, with 32-bit or
+  // 64-bit offsets
+  template <typename ArrayType>
+  void PushValueOffsets(const ArrayType& array) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
     auto offsets = array.value_offsets();
 
-    if (array.offset() != 0) {
+    if (array.offset() != 0 && offsets) {
       // If we have a non-zero offset, then the value offsets do not start at
-      // zero. We must a) create a new offsets array with shifted offsets and
-      // b) slice the values array accordingly
+      // zero. Rather than allocating shifted offsets here, the range of
+      // offsets is sliced and rebased while the body is written.
+      offsets = SliceBuffer(offsets, array.offset() * sizeof(offset_type),
+                            (array.length() + 1) * sizeof(offset_type));
+      PushBuffer(offsets, array.value_offset(0), sizeof(offset_type));
+    } else {
+      PushBuffer(offsets);
+    }
+  }
 
-      std::shared_ptr<Buffer> shifted_offsets;
-      RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(int32_t) * (array.length() + 1),
-                                   &shifted_offsets));
+  Status PushOffsets(const BinaryArray& array) {
+    PushValueOffsets<BinaryArray>(array);
+    return Status::OK();
+  }
+
+  Status PushOffsets(const ListArray& array) {
+    PushValueOffsets<ListArray>(array);
+    return Status::OK();
+  }
+
+  Status PushOffsets(const LargeBinaryArray& array) {
+    PushValueOffsets<LargeBinaryArray>(array);
+    return Status::OK();
+  }
 
-      int32_t* dest_offsets = reinterpret_cast<int32_t*>(shifted_offsets->mutable_data());
-      const int32_t start_offset = array.value_offset(0);
+  Status PushOffsets(const LargeListArray& array) {
+    PushValueOffsets<LargeListArray>(array);
+    return Status::OK();
+  }
 
-      for (int i = 0; i < array.length(); ++i) {
-        dest_offsets[i] = array.value_offset(i) - start_offset;
+  // Append the offsets in `offsets` minus `base` to the gather list. They are
+  // computed into the scratch buffer; when it is full, the gather list is
+  // written out so that the scratch space can be reused.
+  template <typename offset_type>
+  Status AppendRebasedOffsets(const Buffer& offsets, offset_type base,
+                              io::OutputStream* dst, std::vector<io::IOVec>* iov) {
+    if (!scratch_) {
+      RETURN_NOT_OK(AllocateBuffer(pool_, kRebaseScratchSize, &scratch_));
+      scratch_position_ = 0;
+    }
+    // Keep 64-bit offsets aligned after 32-bit ones in the scratch space
+    scratch_position_ = BitUtil::RoundUpToMultipleOf8(scratch_position_);
+
+    const auto source = reinterpret_cast<const offset_type*>(offsets.data());
+    const int64_t length = offsets.size() / sizeof(offset_type);
+    int64_t i = 0;
+    while (i < length) {
+      if (scratch_position_ == kRebaseScratchSize) {
+        RETURN_NOT_OK(dst->WriteV(*iov));
+        iov->clear();
+        scratch_position_ = 0;
       }
-      // Final offset
-      dest_offsets[array.length()] = array.value_offset(array.length()) - start_offset;
-      offsets = shifted_offsets;
+      const int64_t scratch_capacity =
+          (kRebaseScratchSize - scratch_position_) / sizeof(offset_type);
+      const int64_t chunk_length = std::min(length - i, scratch_capacity);
+      auto out =
+          reinterpret_cast<offset_type*>(scratch_->mutable_data() + scratch_position_);
+      for (int64_t j = 0; j < chunk_length; ++j) {
+        out[j] = source[i + j] - base;
+      }
+      const int64_t nbytes = chunk_length * static_cast<int64_t>(sizeof(offset_type));
+      iov->push_back({out, nbytes});
+      scratch_position_ += nbytes;
+      i += chunk_length;
     }
-
-    *value_offsets = offsets;
     return Status::OK();
   }
 
-  Status VisitBinary(const BinaryArray& array) {
-    std::shared_ptr<Buffer> value_offsets;
-    RETURN_NOT_OK(GetZeroBasedValueOffsets<BinaryArray>(array, &value_offsets));
+  template <typename ArrayType>
+  Status VisitBinary(const ArrayType& array) {
+    RETURN_NOT_OK(PushOffsets(array));
     auto data = array.value_data();
 
     int64_t total_data_bytes = 0;
-    if (value_offsets) {
+    if (array.value_offsets()) {
       total_data_bytes = array.value_offset(array.length()) - array.value_offset(0);
     }
     if (NeedTruncate(array.offset(), data.get(), total_data_bytes)) {
@@ -303,8 +410,7 @@ class RecordBatchSerializer : public ArrayVisitor {
       data = SliceBuffer(data, start_offset, slice_length);
     }
 
-    buffers_.push_back(value_offsets);
-    buffers_.push_back(data);
+    PushBuffer(data);
     return Status::OK();
   }
 
@@ -312,12 +418,12 @@ class RecordBatchSerializer : public ArrayVisitor {
     std::shared_ptr<Buffer> data;
     RETURN_NOT_OK(
         GetTruncatedBitmap(array.offset(), array.length(), array.values(), pool_, &data));
-    buffers_.push_back(data);
+    PushBuffer(data);
     return Status::OK();
   }
 
   Status Visit(const NullArray& array) override {
-    buffers_.push_back(nullptr);
+    PushBuffer(nullptr);
     return Status::OK();
   }
 
@@ -349,17 +455,24 @@ class RecordBatchSerializer : public ArrayVisitor {
 
   Status Visit(const BinaryArray& array) override { return VisitBinary(array); }
 
-  Status Visit(const ListArray& array) override {
-    std::shared_ptr<Buffer> value_offsets;
-    RETURN_NOT_OK(GetZeroBasedValueOffsets<ListArray>(array, &value_offsets));
-    buffers_.push_back(value_offsets);
+  Status Visit(const LargeStringArray& array) override { return VisitBinary(array); }
+
+  Status Visit(const LargeBinaryArray& array) override { return VisitBinary(array); }
+
+  Status Visit(const ListArray& array) override { return VisitList(array); }
+
+  Status Visit(const LargeListArray& array) override { return VisitList(array); }
+
+  template <typename ArrayType>
+  Status VisitList(const ArrayType& array) {
+    RETURN_NOT_OK(PushOffsets(array));
 
     --max_recursion_depth_;
     std::shared_ptr<Array> values = array.values();
 
-    int32_t values_offset = 0;
-    int32_t values_length = 0;
-    if (value_offsets) {
+    int64_t values_offset = 0;
+    int64_t values_length = 0;
+    if (array.value_offsets()) {
       values_offset = array.value_offset(0);
       values_length = array.value_offset(array.length()) - values_offset;
     }
@@ -390,7 +503,7 @@ class RecordBatchSerializer : public ArrayVisitor {
     std::shared_ptr<Buffer> type_ids;
     RETURN_NOT_OK(GetTruncatedBuffer<UnionArray::type_id_t>(
         offset, length, array.type_ids(), pool_, &type_ids));
-    buffers_.push_back(type_ids);
+    PushBuffer(type_ids);
 
     --max_recursion_depth_;
     if (array.mode() == UnionMode::DENSE) {
@@ -449,7 +562,7 @@ class RecordBatchSerializer : public ArrayVisitor {
 
         value_offsets = shifted_offsets_buffer;
       }
-      buffers_.push_back(value_offsets);
+      PushBuffer(value_offsets);
 
       // Visit children and slice accordingly
       for (int i = 0; i < type.num_children(); ++i) {
@@ -493,6 +606,15 @@ class RecordBatchSerializer : public ArrayVisitor {
   std::vector<internal::FieldMetadata> field_nodes_;
   std::vector<internal::BufferMetadata> buffer_meta_;
   std::vector<std::shared_ptr<Buffer>> buffers_;
+  // For each buffer, a value to subtract from its offsets while it is
+  // written, or 0 if it is written as is, and the width of those offsets
+  std::vector<int64_t> offset_bases_;
+  std::vector<int> offset_widths_;
+
+  // Scratch space for rebased offsets, which holds them until they are
+  // written. The position is in bytes
+  std::shared_ptr<Buffer> scratch_;
+  int64_t scratch_position_;
 
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
@@ -505,13 +627,15 @@ class DictionaryWriter : public RecordBatchSerializer {
 
   Status WriteMetadataMessage(int64_t num_rows, int64_t body_length,
                               std::shared_ptr<Buffer>* out) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, body_length, field_nodes_,
-                                  buffer_meta_, out);
+    return WriteDictionaryMessage(dictionary_id_, num_rows, body_length, is_delta_,
+                                  field_nodes_, buffer_meta_, out);
   }
 
   Status Write(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
-               io::OutputStream* dst, int32_t* metadata_length, int64_t* body_length) {
+               bool is_delta, io::OutputStream* dst, int32_t* metadata_length,
+               int64_t* body_length) {
     dictionary_id_ = dictionary_id;
+    is_delta_ = is_delta;
 
     // Make a dummy record batch. A bit tedious as we have to make a schema
     auto schema = arrow::schema({arrow::field("dictionary", dictionary->type())});
@@ -522,6 +646,7 @@ class DictionaryWriter : public RecordBatchSerializer {
  private:
   // TODO(wesm): Setting this in Write is a bit unclean, but it works
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 // Adds padding bytes if necessary to ensure all memory blocks are written on
@@ -545,6 +670,15 @@ Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
   return writer.Write(batch, dst, metadata_length, body_length);
 }
 
+Status WriteRecordBatch(const BatchView& view, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, MemoryPool* pool, int max_recursion_depth,
+                        bool allow_64bit) {
+  RecordBatchSerializer writer(pool, buffer_start_offset, max_recursion_depth,
+                               allow_64bit);
+  return writer.Write(view, dst, metadata_length, body_length);
+}
+
 Status WriteRecordBatchStream(const std::vector<std::shared_ptr<RecordBatch>>& batches,
                               io::OutputStream* dst) {
   std::shared_ptr<RecordBatchWriter> writer;
@@ -673,10 +807,11 @@ Status GetTensorMessage(const Tensor& tensor, MemoryPool* pool,
 }
 
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
-                       int64_t buffer_start_offset, io::OutputStream* dst,
+                       bool is_delta, int64_t buffer_start_offset, io::OutputStream* dst,
                        int32_t* metadata_length, int64_t* body_length, MemoryPool* pool) {
   DictionaryWriter writer(pool, buffer_start_offset, kMaxNestingDepth, false);
-  return writer.Write(dictionary_id, dictionary, dst, metadata_length, body_length);
+  return writer.Write(dictionary_id, dictionary, is_delta, dst, metadata_length,
+                      body_length);
 }
 
 Status GetRecordBatchSize(const RecordBatch& batch, int64_t* size) {
@@ -725,6 +860,10 @@ Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize)
 
 Status RecordBatchWriter::WriteTable(const Table& table) { return WriteTable(table, -1); }
 
+Status RecordBatchWriter::WriteRecordBatch(const BatchView& view, bool allow_64bit) {
+  return WriteRecordBatch(*view.ToRecordBatch(), allow_64bit);
+}
+
 // ----------------------------------------------------------------------
 // Stream writer implementation
 
@@ -761,7 +900,10 @@ class SchemaWriter : public StreamBookKeeper {
  public:
   SchemaWriter(const Schema& schema, DictionaryMemo* dictionary_memo, MemoryPool* pool,
                io::OutputStream* sink)
-      : StreamBookKeeper(sink), schema_(schema), dictionary_memo_(dictionary_memo) {}
+      : StreamBookKeeper(sink),
+        pool_(pool),
+        schema_(schema),
+        dictionary_memo_(dictionary_memo) {}
 
   Status WriteSchema() {
     std::shared_ptr<Buffer> schema_fb;
@@ -788,8 +930,9 @@ class SchemaWriter : public StreamBookKeeper {
 
       // Frame of reference in file format is 0, see ARROW-384
       const int64_t buffer_start_offset = 0;
-      RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, buffer_start_offset, sink_,
-                                    &block->metadata_length, &block->body_length, pool_));
+      RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, false, buffer_start_offset,
+                                    sink_, &block->metadata_length, &block->body_length,
+                                    pool_));
       RETURN_NOT_OK(UpdatePosition());
       DCHECK(position_ % 8 == 0) << "WriteDictionary did not perform aligned writes";
     }
@@ -817,7 +960,8 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
       : StreamBookKeeper(sink),
         schema_(schema),
         pool_(default_memory_pool()),
-        started_(false) {}
+        started_(false),
+        allow_dictionary_updates_(true) {}
 
   virtual ~RecordBatchStreamWriterImpl() = default;
 
@@ -845,7 +989,9 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     return Status::OK();
   }
 
-  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit, FileBlock* block) {
+  // Write a RecordBatch or a BatchView
+  template <typename BatchType>
+  Status WriteRecordBatch(const BatchType& batch, bool allow_64bit, FileBlock* block) {
     RETURN_NOT_OK(CheckStarted());
     RETURN_NOT_OK(UpdatePosition());
 
@@ -863,13 +1009,93 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     return Status::OK();
   }
 
+  // Write a dictionary batch for each dictionary of the batch which is not
+  // the one last written for the same field: a delta batch with the new
+  // entries if the dictionary extends that one, otherwise a replacement
+  Status WriteDictionaryUpdates(const RecordBatch& batch) {
+    if (batch.num_columns() != schema_->num_fields()) {
+      return Status::Invalid("RecordBatch has a different number of fields than schema");
+    }
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      RETURN_NOT_OK(WriteDictionaryUpdates(*schema_->field(i)->type(),
+                                           *batch.column(i)->type()));
+    }
+    return Status::OK();
+  }
+
+  Status WriteDictionaryUpdates(const DataType& schema_type, const DataType& batch_type) {
+    if (schema_type.id() == Type::DICTIONARY) {
+      if (batch_type.id() != Type::DICTIONARY) {
+        return Status::Invalid("Expected a dictionary-encoded column");
+      }
+      const auto& schema_dict_type = checked_cast<const DictionaryType&>(schema_type);
+      const auto& batch_dict_type = checked_cast<const DictionaryType&>(batch_type);
+      return WriteDictionaryUpdate(dictionary_memo_.GetId(schema_dict_type.dictionary()),
+                                   batch_dict_type.dictionary());
+    }
+    if (schema_type.num_children() != batch_type.num_children()) {
+      return Status::Invalid("RecordBatch type does not match schema");
+    }
+    for (int i = 0; i < schema_type.num_children(); ++i) {
+      RETURN_NOT_OK(WriteDictionaryUpdates(*schema_type.child(i)->type(),
+                                           *batch_type.child(i)->type()));
+    }
+    return Status::OK();
+  }
+
+  Status WriteDictionaryUpdate(int64_t id, const std::shared_ptr<Array>& dictionary) {
+    std::shared_ptr<Array> previous;
+    RETURN_NOT_OK(dictionary_memo_.GetDictionary(id, &previous));
+    if (dictionary.get() == previous.get()) {
+      return Status::OK();
+    }
+    if (!dictionary->type()->Equals(*previous->type())) {
+      std::stringstream ss;
+      ss << "Dictionary with id " << id << " changed type from "
+         << previous->type()->ToString() << " to " << dictionary->type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+
+    // Only the new entries are compared when the dictionary was built on top
+    // of the previous one
+    const int64_t previous_length = previous->length();
+    const bool is_delta = dictionary->length() >= previous_length &&
+                          dictionary->RangeEquals(0, previous_length, 0, previous);
+    if (!is_delta || dictionary->length() > previous_length) {
+      if (!allow_dictionary_updates_) {
+        return Status::Invalid(
+            "Dictionaries cannot be replaced or extended in the IPC file format");
+      }
+      int32_t metadata_length = 0;
+      int64_t body_length = 0;
+      RETURN_NOT_OK(WriteDictionary(
+          id, is_delta ? dictionary->Slice(previous_length) : dictionary, is_delta, 0,
+          sink_, &metadata_length, &body_length, pool_));
+    }
+
+    // Remember the dictionary object so that it is not compared again
+    return dictionary_memo_.UpdateDictionary(id, dictionary);
+  }
+
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit) {
+    RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WriteDictionaryUpdates(batch));
+
     // Push an empty FileBlock. Can be written in the footer later
     record_batches_.push_back({0, 0, 0});
     return WriteRecordBatch(batch, allow_64bit,
                             &record_batches_[record_batches_.size() - 1]);
   }
 
+  Status WriteRecordBatch(const BatchView& view, bool allow_64bit) {
+    RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WriteDictionaryUpdates(view.batch()));
+
+    record_batches_.push_back({0, 0, 0});
+    return WriteRecordBatch(view, allow_64bit,
+                            &record_batches_[record_batches_.size() - 1]);
+  }
+
   void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
 
  protected:
@@ -877,8 +1103,13 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
   MemoryPool* pool_;
   bool started_;
 
+  // Whether dictionaries may change between record batches, which the file
+  // format does not support
+  bool allow_dictionary_updates_;
+
   // When writing out the schema, we keep track of all the dictionaries we
-  // encounter, as they must be written out first in the stream
+  // encounter, as they must be written out first in the stream. Afterwards
+  // the memo holds the dictionaries last written for each id
   DictionaryMemo dictionary_memo_;
 
   std::vector<FileBlock> dictionaries_;
@@ -894,6 +1125,11 @@ Status RecordBatchStreamWriter::WriteRecordBatch(const RecordBatch& batch,
   return impl_->WriteRecordBatch(batch, allow_64bit);
 }
 
+Status RecordBatchStreamWriter::WriteRecordBatch(const BatchView& view,
+                                                 bool allow_64bit) {
+  return impl_->WriteRecordBatch(view, allow_64bit);
+}
+
 void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
   impl_->set_memory_pool(pool);
 }
@@ -919,7 +1155,9 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
   using BASE = RecordBatchStreamWriter::RecordBatchStreamWriterImpl;
 
   RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema)
-      : BASE(sink, schema) {}
+      : BASE(sink, schema) {
+    allow_dictionary_updates_ = false;
+  }
 
   Status Start() override {
     // It is only necessary to align to 8-byte boundary at the start of the file
@@ -973,6 +1211,11 @@ Status RecordBatchFileWriter::WriteRecordBatch(const RecordBatch& batch,
   return file_impl_->WriteRecordBatch(batch, allow_64bit);
 }
 
+Status RecordBatchFileWriter::WriteRecordBatch(const BatchView& view,
+                                               bool allow_64bit) {
+  return file_impl_->WriteRecordBatch(view, allow_64bit);
+}
+
 Status RecordBatchFileWriter::Close() { return file_impl_->Close(); }
 
 // ----------------------------------------------------------------------
@@ -31,6 +31,7 @@
 namespace arrow {
 
 class Array;
+class BatchView;
 class Buffer;
 class Field;
 class MemoryPool;
@@ -60,6 +61,17 @@ class ARROW_EXPORT RecordBatchWriter {
   /// \return Status
   virtual Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) = 0;
 
+  /// \brief Write the rows of a record batch covered by a view
+  ///
+  /// The result is the same as writing view.ToRecordBatch(). The default
+  /// implementation does exactly that; the IPC writers serialize the viewed
+  /// ranges of the columns directly.
+  ///
+  /// \param[in] view the rows to write
+  /// \param[in] allow_64bit boolean permitting field lengths exceeding INT32_MAX
+  /// \return Status
+  virtual Status WriteRecordBatch(const BatchView& view, bool allow_64bit = false);
+
   /// \brief Write possibly-chunked table by creating sequence of record batches
   /// \param[in] table table to write
   /// \return Status
@@ -86,6 +98,12 @@ class ARROW_EXPORT RecordBatchWriter {
 /// \class RecordBatchStreamWriter
 /// \brief Synchronous batch stream writer that writes the Arrow streaming
 /// format
+///
+/// The dictionaries of the schema are written after it. When a record batch
+/// has a different dictionary than the one last written for a field, a
+/// dictionary batch is written before it: a delta with only the new entries
+/// if the dictionary starts with all entries of the previous one, otherwise
+/// a replacement
 class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
  public:
   ~RecordBatchStreamWriter() override;
@@ -107,6 +125,13 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
   /// \return Status
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
 
+  /// \brief Write the rows of a record batch covered by a view
+  ///
+  /// \param[in] view the rows to write
+  /// \param[in] allow_64bit allow array lengths over INT32_MAX - 1
+  /// \return Status
+  Status WriteRecordBatch(const BatchView& view, bool allow_64bit = false) override;
+
   /// \brief Close the stream by writing a 4-byte int32 0 EOS market
   /// \return Status
   Status Close() override;
@@ -123,7 +148,8 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
 ///
 /// Implements the random access file format, which structurally is a record
 /// batch stream followed by a metadata footer at the end of the file. Magic
-/// numbers are written at the start and end of the file
+/// numbers are written at the start and end of the file. Dictionaries must
+/// stay the same for all record batches
 class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
  public:
   ~RecordBatchFileWriter() override;
@@ -144,6 +170,13 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   /// \return Status
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
 
+  /// \brief Write the rows of a record batch covered by a view to the file
+  ///
+  /// \param[in] view the rows to write
+  /// \param[in] allow_64bit allow array lengths over INT32_MAX - 1
+  /// \return Status
+  Status WriteRecordBatch(const BatchView& view, bool allow_64bit = false) override;
+
   /// \brief Close the file stream by writing the file footer and magic number
   /// \return Status
   Status Close() override;
@@ -187,6 +220,18 @@ Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         int max_recursion_depth = kMaxNestingDepth,
                         bool allow_64bit = false);
 
+/// \brief Low-level API for writing the rows of a record batch covered by a
+/// view, as WriteRecordBatch does for view.ToRecordBatch()
+///
+/// The viewed ranges of the columns are serialized directly, without building
+/// a sliced RecordBatch.
+ARROW_EXPORT
+Status WriteRecordBatch(const BatchView& view, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, MemoryPool* pool,
+                        int max_recursion_depth = kMaxNestingDepth,
+                        bool allow_64bit = false);
+
 /// \brief Serialize record batch as encapsulated IPC message in a new buffer
 ///
 /// \param[in] batch the record batch
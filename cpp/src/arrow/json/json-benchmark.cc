@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/api.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace json {
+
+constexpr int64_t kNumRows = 100000;
+
+// Objects with integer, number, string and list fields, some of them
+// missing or null
+static std::shared_ptr<Buffer> MakeJson() {
+  std::vector<int64_t> ints;
+  randint<int64_t>(kNumRows, -1000000, 1000000, &ints);
+  std::vector<double> doubles;
+  random_real<double>(kNumRows, 42, -1000.0, 1000.0, &doubles);
+
+  std::stringstream ss;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ss << "{\"int\": " << ints[i] << ", \"double\": " << doubles[i]
+       << ", \"string\": \"value " << i % 1000 << "\", \"list\": [" << i % 10 << ", "
+       << i % 100 << "]";
+    if (i % 5 == 0) {
+      ss << ", \"maybe\": null";
+    } else if (i % 5 == 1) {
+      ss << ", \"maybe\": true";
+    }
+    ss << "}\n";
+  }
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(Buffer::FromString(ss.str(), &buffer));
+  return buffer;
+}
+
+static void BM_ParseOne(benchmark::State& state) {  // NOLINT non-const reference
+  auto json = MakeJson();
+  auto options = ParseOptions::Defaults();
+  if (state.range(0)) {
+    // Parse with the inferred schema given explicitly, to leave out inference
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(ParseOne(default_memory_pool(), options, json, &batch));
+    options.explicit_schema = batch->schema();
+  }
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(ParseOne(default_memory_pool(), options, json, &batch));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * json->size());
+}
+
+static void BM_ReadTable(benchmark::State& state) {  // NOLINT non-const reference
+  auto json = MakeJson();
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = state.range(0) != 0;
+  read_options.block_size = 1 << 18;
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<Table> table;
+    ABORT_NOT_OK(ReadTable(default_memory_pool(),
+                           std::make_shared<io::BufferReader>(json), read_options,
+                           ParseOptions::Defaults(), &table));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * json->size());
+}
+
+BENCHMARK(BM_ParseOne)->Arg(0)->Arg(1)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_ReadTable)->Arg(0)->Arg(1)->MinTime(1.0)->UseRealTime();
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,339 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace json {
+
+static std::shared_ptr<Buffer> BufferFromString(const std::string& data) {
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(Buffer::FromString(data, &buffer));
+  return buffer;
+}
+
+static void Parse(const ParseOptions& options, const std::string& json,
+                  std::shared_ptr<RecordBatch>* out) {
+  ASSERT_OK(ParseOne(default_memory_pool(), options, BufferFromString(json), out));
+  ASSERT_OK((*out)->Validate());
+}
+
+TEST(TestJsonInference, ScalarTypes) {
+  const std::string json =
+      "{\"a\": 1, \"b\": 1.5, \"c\": \"x\", \"d\": true, \"e\": null, \"f\": 2}\n"
+      "{\"a\": -3, \"b\": 2, \"c\": null, \"d\": false, \"e\": null, \"f\": 2.5}\n";
+
+  std::shared_ptr<RecordBatch> batch;
+  Parse(ParseOptions::Defaults(), json, &batch);
+
+  auto expected_schema =
+      schema({field("a", int64()), field("b", float64()), field("c", utf8()),
+              field("d", boolean()), field("e", null()), field("f", float64())});
+  ASSERT_TRUE(batch->schema()->Equals(*expected_schema))
+      << batch->schema()->ToString();
+  ASSERT_EQ(2, batch->num_rows());
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int64Type, int64_t>({1, -3}, &expected);
+  AssertArraysEqual(*expected, *batch->column(0));
+  ArrayFromVector<DoubleType, double>({1.5, 2}, &expected);
+  AssertArraysEqual(*expected, *batch->column(1));
+  ArrayFromVector<StringType, std::string>({true, false}, {"x", ""}, &expected);
+  AssertArraysEqual(*expected, *batch->column(2));
+  ArrayFromVector<BooleanType, bool>({true, true}, {true, false}, &expected);
+  AssertArraysEqual(*expected, *batch->column(3));
+  ASSERT_EQ(2, batch->column(4)->null_count());
+  ArrayFromVector<DoubleType, double>({2, 2.5}, &expected);
+  AssertArraysEqual(*expected, *batch->column(5));
+}
+
+TEST(TestJsonInference, NestedTypes) {
+  const std::string json =
+      "{\"list\": [1, 2], \"obj\": {\"x\": \"a\"}}\n"
+      "{\"list\": [], \"obj\": {\"y\": [true]}}\n"
+      "{\"list\": null, \"obj\": null, \"nulls\": [null]}\n";
+
+  std::shared_ptr<RecordBatch> batch;
+  Parse(ParseOptions::Defaults(), json, &batch);
+
+  auto expected_schema = schema(
+      {field("list", list(int64())),
+       field("obj", struct_({field("x", utf8()), field("y", list(boolean()))})),
+       field("nulls", list(null()))});
+  ASSERT_TRUE(batch->schema()->Equals(*expected_schema))
+      << batch->schema()->ToString();
+  ASSERT_EQ(3, batch->num_rows());
+
+  const auto& lists = static_cast<const ListArray&>(*batch->column(0));
+  ASSERT_EQ(1, lists.null_count());
+  ASSERT_EQ(2, lists.value_length(0));
+  ASSERT_EQ(0, lists.value_length(1));
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int64Type, int64_t>({1, 2}, &expected);
+  AssertArraysEqual(*expected, *lists.values());
+
+  const auto& objects = static_cast<const StructArray&>(*batch->column(1));
+  ASSERT_EQ(1, objects.null_count());
+  ArrayFromVector<StringType, std::string>({true, false, false}, {"a", "", ""},
+                                           &expected);
+  AssertArraysEqual(*expected, *objects.field(0));
+  ASSERT_EQ(2, objects.field(1)->null_count());
+
+  ASSERT_EQ(2, batch->column(2)->null_count());
+}
+
+TEST(TestJsonInference, ConflictingTypes) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), ParseOptions::Defaults(),
+                                  BufferFromString("{\"a\": 1}\n{\"a\": \"x\"}\n"),
+                                  &batch));
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), ParseOptions::Defaults(),
+                                  BufferFromString("{\"a\": [1]}\n{\"a\": {}}\n"),
+                                  &batch));
+}
+
+TEST(TestJsonParser, ExplicitSchema) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("i8", int8()), field("u32", uint32()), field("f", float32()),
+              field("date", date32()), field("ts", timestamp(TimeUnit::SECOND)),
+              field("bin", binary())});
+  const std::string json =
+      "{\"i8\": -128, \"u32\": 4294967295, \"f\": 0.5, \"date\": \"1970-01-02\", "
+      "\"ts\": \"1970-01-01 00:01:00\", \"bin\": \"abc\"}\n"
+      "{\"ts\": 5, \"date\": 3, \"f\": 2}\n";
+
+  std::shared_ptr<RecordBatch> batch;
+  Parse(options, json, &batch);
+  ASSERT_TRUE(batch->schema()->Equals(*options.explicit_schema));
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int8Type, int8_t>({true, false}, {-128, 0}, &expected);
+  AssertArraysEqual(*expected, *batch->column(0));
+  ArrayFromVector<UInt32Type, uint32_t>({true, false}, {4294967295U, 0}, &expected);
+  AssertArraysEqual(*expected, *batch->column(1));
+  ArrayFromVector<FloatType, float>({0.5f, 2.0f}, &expected);
+  AssertArraysEqual(*expected, *batch->column(2));
+  ArrayFromVector<Date32Type, int32_t>({1, 3}, &expected);
+  AssertArraysEqual(*expected, *batch->column(3));
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND), {60, 5},
+                                          &expected);
+  AssertArraysEqual(*expected, *batch->column(4));
+  ArrayFromVector<BinaryType, std::string>({true, false}, {"abc", ""}, &expected);
+  AssertArraysEqual(*expected, *batch->column(5));
+}
+
+TEST(TestJsonParser, ConversionErrors) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int8())});
+
+  std::shared_ptr<RecordBatch> batch;
+  // Out of range
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString("{\"a\": 128}"), &batch));
+  // Type mismatch
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString("{\"a\": 1.5}"), &batch));
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString("{\"a\": [1]}"), &batch));
+  // Not an object
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString("[1]"), &batch));
+  // Duplicate field
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString("{\"a\": 1, \"a\": 2}"), &batch));
+  // Malformed JSON
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString("{\"a\": 1\n"), &batch));
+
+  options.explicit_schema = schema({field("a", decimal(10, 2))});
+  ASSERT_RAISES(NotImplemented, ParseOne(default_memory_pool(), options,
+                                         BufferFromString("{}"), &batch));
+}
+
+TEST(TestJsonParser, UnexpectedFields) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int64())});
+  const std::string json =
+      "{\"skip\": {\"x\": [1, {\"y\": 2}]}, \"a\": 1, \"other\": [[]]}\n"
+      "{\"a\": 2, \"skip\": \"x\"}\n";
+
+  std::shared_ptr<RecordBatch> batch;
+  Parse(options, json, &batch);
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int64Type, int64_t>({1, 2}, &expected);
+  AssertArraysEqual(*expected, *batch->column(0));
+
+  options.ignore_unexpected_fields = false;
+  ASSERT_RAISES(Invalid, ParseOne(default_memory_pool(), options,
+                                  BufferFromString(json), &batch));
+}
+
+// ----------------------------------------------------------------------
+// Streaming reads
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() {
+    read_options_ = ReadOptions::Defaults();
+    read_options_.use_threads = GetParam();
+    parse_options_ = ParseOptions::Defaults();
+  }
+
+  std::shared_ptr<io::InputStream> MakeInput(const std::string& json) {
+    return std::make_shared<io::BufferReader>(BufferFromString(json));
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+};
+
+TEST_P(TestStreamingReader, Blocks) {
+  const int64_t num_rows = 1000;
+  std::stringstream ss;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ss << "{\"i\": " << i << ", \"s\": \"" << std::string(i % 7, 'x') << "\"}";
+    // The last row has no newline
+    if (i < num_rows - 1) {
+      ss << (i % 3 == 0 ? "\r\n" : "\n");
+    }
+  }
+  // Blocks are shorter than some rows
+  read_options_.block_size = 17;
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Open(default_memory_pool(), MakeInput(ss.str()),
+                                  read_options_, parse_options_, &reader));
+  ASSERT_TRUE(reader->schema()->Equals(
+      *schema({field("i", int64()), field("s", utf8())})));
+
+  int64_t expected = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_GT(batch->num_rows(), 0);
+    const auto& ints = static_cast<const Int64Array&>(*batch->column(0));
+    const auto& strings = static_cast<const StringArray&>(*batch->column(1));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      ASSERT_EQ(expected, ints.Value(i));
+      ASSERT_EQ(std::string(expected % 7, 'x'), strings.GetString(i));
+      ++expected;
+    }
+  }
+  ASSERT_EQ(num_rows, expected);
+}
+
+TEST_P(TestStreamingReader, ReadTable) {
+  const std::string json = "{\"a\": 1}\n\n   \n{\"a\": 2, \"b\": true}\n{}\n";
+  read_options_.block_size = 10;
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeInput(json), read_options_,
+                      parse_options_, &table));
+  ASSERT_OK(table->Validate());
+  // Fields first seen in a later block are inferred
+  ASSERT_TRUE(table->schema()->Equals(
+      *schema({field("a", int64()), field("b", boolean())})));
+  ASSERT_EQ(3, table->num_rows());
+  ASSERT_EQ(2, table->column(1)->null_count());
+
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeInput(json), read_options_,
+                      parse_options_, &table));
+  ASSERT_EQ(1, table->num_columns());
+
+  parse_options_.ignore_unexpected_fields = false;
+  ASSERT_RAISES(Invalid, ReadTable(default_memory_pool(), MakeInput(json),
+                                   read_options_, parse_options_, &table));
+}
+
+TEST_P(TestStreamingReader, TypesChangingAcrossBlocks) {
+  // The first block holds only nulls and integers
+  const std::string json =
+      "{\"n\": null, \"x\": 1}\n{\"n\": null, \"x\": 2}\n"
+      "{\"n\": \"s\", \"x\": 2.5}\n";
+  read_options_.block_size = 32;
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Open(default_memory_pool(), MakeInput(json),
+                                  read_options_, parse_options_, &reader));
+  ASSERT_TRUE(reader->schema()->Equals(
+      *schema({field("n", null()), field("x", int64())})));
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeInput(json), read_options_,
+                      parse_options_, &table));
+  ASSERT_OK(table->Validate());
+  ASSERT_TRUE(table->schema()->Equals(
+      *schema({field("n", utf8()), field("x", float64())})));
+  ASSERT_EQ(3, table->num_rows());
+  ASSERT_GT(table->column(0)->data()->num_chunks(), 1);
+  ASSERT_EQ(2, table->column(0)->null_count());
+
+  std::shared_ptr<Table> expected;
+  parse_options_.explicit_schema = table->schema();
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeInput(json), read_options_,
+                      parse_options_, &expected));
+  AssertTablesEqual(*expected, *table);
+}
+
+TEST_P(TestStreamingReader, EmptyInput) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeInput(""), read_options_,
+                      parse_options_, &table));
+  ASSERT_EQ(0, table->num_columns());
+  ASSERT_EQ(0, table->num_rows());
+
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  ASSERT_OK(ReadTable(default_memory_pool(), MakeInput("\n\n"), read_options_,
+                      parse_options_, &table));
+  ASSERT_EQ(1, table->num_columns());
+  ASSERT_EQ(0, table->num_rows());
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestStreamingReader,
+                        ::testing::Values(false, true));
+
+}  // namespace json
+}  // namespace arrow
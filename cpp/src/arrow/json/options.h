@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_JSON_OPTIONS_H
+#define ARROW_JSON_OPTIONS_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Schema;
+
+namespace json {
+
+/// \brief Options controlling how JSON objects are converted to Arrow data
+struct ARROW_EXPORT ParseOptions {
+  static ParseOptions Defaults();
+
+  /// Schema of the record batches. When null, the schema is inferred from
+  /// the first block of input (from all of it by ReadTable): numbers are
+  /// int64 unless one of the values of the field is not an integer, in which
+  /// case they are double, and fields which are only ever null have the null
+  /// type. A StreamingReader raises an error on a later value which does not
+  /// convert to the inferred type.
+  std::shared_ptr<Schema> explicit_schema;
+
+  /// Whether object fields missing from the schema are skipped rather than
+  /// raising an error
+  bool ignore_unexpected_fields;
+};
+
+/// \brief Options controlling how JSON input is read
+struct ARROW_EXPORT ReadOptions {
+  static ReadOptions Defaults();
+
+  /// Whether blocks of input are parsed concurrently on the CPU thread pool
+  bool use_threads;
+
+  /// Approximate number of bytes of input making up one record batch. Blocks
+  /// always end on a newline; a row longer than the block size makes the
+  /// block grow until the end of the row.
+  int32_t block_size;
+};
+
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_OPTIONS_H
@@ -0,0 +1,812 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/parser-internal.h"
+
+#define RAPIDJSON_HAS_STDSTRING 1
+#define RAPIDJSON_HAS_CXX11_RVALUE_REFS 1
+#define RAPIDJSON_HAS_CXX11_RANGE_FOR 1
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rapidjson/error/en.h"
+#include "rapidjson/memorystream.h"
+#include "rapidjson/reader.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
+
+namespace rj = rapidjson;
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+namespace {
+
+// Feed the SAX events of every JSON value in the block to the handler
+template <typename Handler>
+Status ParseValues(const std::vector<std::shared_ptr<Buffer>>& block, Handler* handler) {
+  rj::Reader reader;
+  for (const auto& buffer : block) {
+    const auto size = static_cast<size_t>(buffer->size());
+    rj::MemoryStream stream(reinterpret_cast<const char*>(buffer->data()), size);
+    while (true) {
+      rj::SkipWhitespace(stream);
+      if (stream.Tell() == size) {
+        break;
+      }
+      reader.Parse<rj::kParseStopWhenDoneFlag>(stream, *handler);
+      if (ARROW_PREDICT_FALSE(reader.HasParseError())) {
+        // The handler stopped the parse with an error of its own
+        RETURN_NOT_OK(handler->status());
+        std::stringstream ss;
+        ss << "JSON parse error in row " << handler->num_rows() << ": "
+           << rj::GetParseError_En(reader.GetParseErrorCode());
+        return Status::Invalid(ss.str());
+      }
+    }
+  }
+  return Status::OK();
+}
+
+// Common state of the SAX handlers
+class HandlerBase {
+ public:
+  const Status& status() const { return status_; }
+
+  int64_t num_rows() const { return num_rows_; }
+
+  // Number parsing with kParseNumbersAsStringsFlag, which is not used
+  bool RawNumber(const char*, rj::SizeType, bool) { return false; }
+
+ protected:
+  bool Check(const Status& status) {
+    if (ARROW_PREDICT_FALSE(!status.ok())) {
+      status_ = status;
+      return false;
+    }
+    return true;
+  }
+
+  bool ExpectedObject() {
+    std::stringstream ss;
+    ss << "Expected a JSON object in row " << num_rows_;
+    return Check(Status::Invalid(ss.str()));
+  }
+
+  Status status_;
+  int64_t num_rows_ = 0;
+};
+
+// ----------------------------------------------------------------------
+// Schema inference
+
+// A type being inferred from the JSON values at one position in the objects
+struct InferredType {
+  explicit InferredType(const std::string& name) : id(Type::NA), name(name) {}
+
+  std::shared_ptr<DataType> ToDataType() const {
+    switch (id) {
+      case Type::NA:
+        return null();
+      case Type::BOOL:
+        return boolean();
+      case Type::INT64:
+        return int64();
+      case Type::DOUBLE:
+        return float64();
+      case Type::STRING:
+        return utf8();
+      case Type::LIST:
+        return list(children[0]->ToDataType());
+      default:
+        DCHECK_EQ(id, Type::STRUCT);
+        return struct_(ToFields());
+    }
+  }
+
+  std::vector<std::shared_ptr<Field>> ToFields() const {
+    std::vector<std::shared_ptr<Field>> fields;
+    for (const auto& child : children) {
+      fields.push_back(field(child->name, child->ToDataType()));
+    }
+    return fields;
+  }
+
+  // One of NA (no non-null value seen yet), BOOL, INT64, DOUBLE, STRING,
+  // LIST and STRUCT
+  Type::type id;
+  std::string name;
+  // Struct fields in order of first appearance, or the list value type
+  std::vector<std::unique_ptr<InferredType>> children;
+  std::unordered_map<std::string, int> field_index;
+};
+
+const char* JsonTypeName(Type::type id) {
+  switch (id) {
+    case Type::BOOL:
+      return "boolean";
+    case Type::INT64:
+      return "integer";
+    case Type::DOUBLE:
+      return "number";
+    case Type::STRING:
+      return "string";
+    case Type::LIST:
+      return "array";
+    case Type::STRUCT:
+      return "object";
+    default:
+      return "null";
+  }
+}
+
+class InferenceHandler : public HandlerBase {
+ public:
+  InferenceHandler() : root_("") { root_.id = Type::STRUCT; }
+
+  const InferredType& root() const { return root_; }
+
+  bool Null() { return Observe(Type::NA); }
+  bool Bool(bool) { return Observe(Type::BOOL); }
+  bool Int(int) { return Observe(Type::INT64); }
+  bool Uint(unsigned) { return Observe(Type::INT64); }
+  bool Int64(int64_t) { return Observe(Type::INT64); }
+  bool Uint64(uint64_t value) {
+    // Integers beyond the range of int64 are inferred as double
+    return Observe(value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())
+                       ? Type::DOUBLE
+                       : Type::INT64);
+  }
+  bool Double(double) { return Observe(Type::DOUBLE); }
+  bool String(const char*, rj::SizeType, bool) { return Observe(Type::STRING); }
+
+  bool StartObject() {
+    if (stack_.empty()) {
+      stack_.emplace_back(&root_, nullptr);
+      return true;
+    }
+    InferredType* type;
+    if (!Observe(Type::STRUCT, &type)) {
+      return false;
+    }
+    stack_.emplace_back(type, nullptr);
+    return true;
+  }
+
+  bool Key(const char* key, rj::SizeType length, bool) {
+    InferredType* object = stack_.back().first;
+    std::string name(key, length);
+    auto it = object->field_index.find(name);
+    if (it == object->field_index.end()) {
+      const int index = static_cast<int>(object->children.size());
+      it = object->field_index.emplace(name, index).first;
+      object->children.emplace_back(new InferredType(name));
+    }
+    stack_.back().second = object->children[it->second].get();
+    return true;
+  }
+
+  bool EndObject(rj::SizeType) {
+    stack_.pop_back();
+    if (stack_.empty()) {
+      ++num_rows_;
+    }
+    return true;
+  }
+
+  bool StartArray() {
+    InferredType* type;
+    if (!Observe(Type::LIST, &type)) {
+      return false;
+    }
+    if (type->children.empty()) {
+      type->children.emplace_back(new InferredType(type->name));
+    }
+    stack_.emplace_back(type, type->children[0].get());
+    return true;
+  }
+
+  bool EndArray(rj::SizeType) {
+    stack_.pop_back();
+    return true;
+  }
+
+ private:
+  // Merge the JSON type of a value into the type inferred at its position
+  bool Observe(Type::type id, InferredType** out = nullptr) {
+    if (ARROW_PREDICT_FALSE(stack_.empty())) {
+      return ExpectedObject();
+    }
+    InferredType* type = stack_.back().second;
+    if (out != nullptr) {
+      *out = type;
+    }
+    if (id == Type::NA || id == type->id) {
+      return true;
+    }
+    if (type->id == Type::NA) {
+      type->id = id;
+      return true;
+    }
+    if ((id == Type::INT64 || id == Type::DOUBLE) &&
+        (type->id == Type::INT64 || type->id == Type::DOUBLE)) {
+      type->id = Type::DOUBLE;
+      return true;
+    }
+    std::stringstream ss;
+    ss << "JSON field '" << type->name << "' has values of conflicting types "
+       << JsonTypeName(type->id) << " and " << JsonTypeName(id) << " in row "
+       << num_rows_;
+    return Check(Status::Invalid(ss.str()));
+  }
+
+  InferredType root_;
+  // Open objects and arrays, with the type of the value being parsed
+  std::vector<std::pair<InferredType*, InferredType*>> stack_;
+};
+
+// ----------------------------------------------------------------------
+// Conversion to Arrow arrays
+
+// The builder for the values at one position in the JSON objects
+struct BuilderNode {
+  Type::type id;
+  std::shared_ptr<Field> field;
+  ArrayBuilder* builder;
+  // Struct fields, or the list value builder
+  std::vector<std::unique_ptr<BuilderNode>> children;
+  // Struct fields only: index by name, and the stamp of the last object in
+  // which each field was present
+  std::unordered_map<std::string, int> field_index;
+  std::vector<int64_t> last_seen;
+};
+
+Status MakeBuilderNode(const std::shared_ptr<Field>& field, ArrayBuilder* builder,
+                       std::unique_ptr<BuilderNode>* out);
+
+Status AddFieldNodes(const std::vector<std::shared_ptr<Field>>& fields,
+                     const std::vector<ArrayBuilder*>& builders, BuilderNode* node) {
+  for (size_t i = 0; i < fields.size(); ++i) {
+    node->field_index.emplace(fields[i]->name(), static_cast<int>(i));
+    node->children.emplace_back();
+    RETURN_NOT_OK(MakeBuilderNode(fields[i], builders[i], &node->children.back()));
+  }
+  node->last_seen.assign(fields.size(), -1);
+  return Status::OK();
+}
+
+Status MakeBuilderNode(const std::shared_ptr<Field>& field, ArrayBuilder* builder,
+                       std::unique_ptr<BuilderNode>* out) {
+  std::unique_ptr<BuilderNode> node(new BuilderNode);
+  node->id = field->type()->id();
+  node->field = field;
+  node->builder = builder;
+
+  switch (node->id) {
+    case Type::NA:
+    case Type::BOOL:
+    case Type::UINT8:
+    case Type::INT8:
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::DATE32:
+    case Type::TIMESTAMP:
+      break;
+    case Type::LIST: {
+      const auto& list_type = checked_cast<const ListType&>(*field->type());
+      node->children.emplace_back();
+      RETURN_NOT_OK(MakeBuilderNode(list_type.value_field(),
+                                    checked_cast<ListBuilder*>(builder)->value_builder(),
+                                    &node->children.back()));
+      break;
+    }
+    case Type::STRUCT: {
+      auto struct_builder = checked_cast<StructBuilder*>(builder);
+      std::vector<ArrayBuilder*> field_builders;
+      for (int i = 0; i < struct_builder->num_fields(); ++i) {
+        field_builders.push_back(struct_builder->field_builder(i));
+      }
+      RETURN_NOT_OK(AddFieldNodes(field->type()->children(), field_builders, node.get()));
+      break;
+    }
+    default: {
+      std::stringstream ss;
+      ss << "Conversion of JSON to " << field->type()->ToString()
+         << " is not supported";
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  *out = std::move(node);
+  return Status::OK();
+}
+
+template <typename T>
+bool IntegerInRange(int64_t value) {
+  return std::is_signed<T>::value
+             ? value >= static_cast<int64_t>(std::numeric_limits<T>::min()) &&
+                   value <= static_cast<int64_t>(std::numeric_limits<T>::max())
+             : value >= 0 && static_cast<uint64_t>(value) <=
+                                 static_cast<uint64_t>(std::numeric_limits<T>::max());
+}
+
+template <typename T>
+bool IntegerInRange(uint64_t value) {
+  return value <= static_cast<uint64_t>(std::numeric_limits<T>::max());
+}
+
+class BuilderHandler : public HandlerBase {
+ public:
+  BuilderHandler(MemoryPool* pool, const std::shared_ptr<Schema>& schema,
+                 const ParseOptions& options)
+      : pool_(pool),
+        schema_(schema),
+        ignore_unexpected_fields_(options.ignore_unexpected_fields) {}
+
+  Status Init() {
+    std::vector<ArrayBuilder*> builders;
+    for (const auto& field : schema_->fields()) {
+      std::unique_ptr<ArrayBuilder> builder;
+      RETURN_NOT_OK(MakeBuilder(pool_, field->type(), &builder));
+      builders.push_back(builder.get());
+      builders_.push_back(std::move(builder));
+    }
+    root_.id = Type::STRUCT;
+    root_.builder = nullptr;
+    return AddFieldNodes(schema_->fields(), builders, &root_);
+  }
+
+  Status Finish(std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<Array>> columns(builders_.size());
+    for (size_t i = 0; i < builders_.size(); ++i) {
+      RETURN_NOT_OK(builders_[i]->Finish(&columns[i]));
+    }
+    *out = RecordBatch::Make(schema_, num_rows_, std::move(columns));
+    return Status::OK();
+  }
+
+  bool Null() {
+    BuilderNode* node;
+    return SkipScalar() || (Target(&node) && Check(AppendNull(node)));
+  }
+
+  bool Bool(bool value) {
+    BuilderNode* node;
+    if (SkipScalar()) {
+      return true;
+    }
+    if (!Target(&node)) {
+      return false;
+    }
+    if (node->id != Type::BOOL) {
+      return Check(TypeMismatch(node, "boolean"));
+    }
+    return Check(checked_cast<BooleanBuilder*>(node->builder)->Append(value));
+  }
+
+  bool Int(int value) { return Int64(value); }
+  bool Uint(unsigned value) { return Uint64(value); }
+
+  bool Int64(int64_t value) {
+    BuilderNode* node;
+    return SkipScalar() || (Target(&node) && Check(AppendInteger(node, value)));
+  }
+
+  bool Uint64(uint64_t value) {
+    BuilderNode* node;
+    return SkipScalar() || (Target(&node) && Check(AppendInteger(node, value)));
+  }
+
+  bool Double(double value) {
+    BuilderNode* node;
+    if (SkipScalar()) {
+      return true;
+    }
+    if (!Target(&node)) {
+      return false;
+    }
+    switch (node->id) {
+      case Type::FLOAT:
+        return Check(checked_cast<FloatBuilder*>(node->builder)
+                         ->Append(static_cast<float>(value)));
+      case Type::DOUBLE:
+        return Check(checked_cast<DoubleBuilder*>(node->builder)->Append(value));
+      default:
+        return Check(TypeMismatch(node, "number"));
+    }
+  }
+
+  bool String(const char* data, rj::SizeType length, bool) {
+    BuilderNode* node;
+    return SkipScalar() || (Target(&node) && Check(AppendString(node, data, length)));
+  }
+
+  bool StartObject() {
+    if (SkipStart()) {
+      return true;
+    }
+    if (stack_.empty()) {
+      stack_.emplace_back(&root_, ++stamp_);
+      return true;
+    }
+    BuilderNode* node;
+    if (!Target(&node)) {
+      return false;
+    }
+    if (node->id != Type::STRUCT) {
+      return Check(TypeMismatch(node, "object"));
+    }
+    if (!Check(checked_cast<StructBuilder*>(node->builder)->Append())) {
+      return false;
+    }
+    stack_.emplace_back(node, ++stamp_);
+    return true;
+  }
+
+  bool Key(const char* key, rj::SizeType length, bool) {
+    if (skip_depth_ > 0) {
+      return true;
+    }
+    Frame& frame = stack_.back();
+    BuilderNode* node = frame.node;
+    const int index = FindField(*node, frame.field + 1, key, length);
+    if (index < 0) {
+      if (ignore_unexpected_fields_) {
+        skip_value_ = true;
+        return true;
+      }
+      std::stringstream ss;
+      ss << "JSON field '" << std::string(key, length) << "' in row " << num_rows_
+         << " is not in the schema";
+      return Check(Status::Invalid(ss.str()));
+    }
+    if (ARROW_PREDICT_FALSE(node->last_seen[index] == frame.stamp)) {
+      std::stringstream ss;
+      ss << "Duplicate JSON field '" << std::string(key, length) << "' in row "
+         << num_rows_;
+      return Check(Status::Invalid(ss.str()));
+    }
+    node->last_seen[index] = frame.stamp;
+    frame.field = index;
+    return true;
+  }
+
+  bool EndObject(rj::SizeType) {
+    if (SkipEnd()) {
+      return true;
+    }
+    const Frame& frame = stack_.back();
+    BuilderNode* node = frame.node;
+    // Fields absent from the object are null
+    for (size_t i = 0; i < node->children.size(); ++i) {
+      if (node->last_seen[i] != frame.stamp &&
+          !Check(AppendNull(node->children[i].get()))) {
+        return false;
+      }
+    }
+    stack_.pop_back();
+    if (stack_.empty()) {
+      ++num_rows_;
+    }
+    return true;
+  }
+
+  bool StartArray() {
+    if (SkipStart()) {
+      return true;
+    }
+    BuilderNode* node;
+    if (!Target(&node)) {
+      return false;
+    }
+    if (node->id != Type::LIST) {
+      return Check(TypeMismatch(node, "array"));
+    }
+    if (!Check(checked_cast<ListBuilder*>(node->builder)->Append())) {
+      return false;
+    }
+    stack_.emplace_back(node, 0);
+    return true;
+  }
+
+  bool EndArray(rj::SizeType) {
+    if (SkipEnd()) {
+      return true;
+    }
+    stack_.pop_back();
+    return true;
+  }
+
+ private:
+  struct Frame {
+    Frame(BuilderNode* node, int64_t stamp) : node(node), stamp(stamp), field(-1) {}
+
+    // A struct node (or the root) for objects, a list node for arrays
+    BuilderNode* node;
+    // Identifies the object, to track which fields it has
+    int64_t stamp;
+    // Index of the field whose value is being parsed
+    int field;
+  };
+
+  // Objects usually list their fields in the same order, so the field
+  // following the previous one is tried before a hash lookup
+  static int FindField(const BuilderNode& node, int expected, const char* key,
+                       rj::SizeType length) {
+    if (expected < static_cast<int>(node.children.size())) {
+      const std::string& name = node.children[expected]->field->name();
+      if (name.size() == length && memcmp(name.data(), key, length) == 0) {
+        return expected;
+      }
+    }
+    auto it = node.field_index.find(std::string(key, length));
+    return it == node.field_index.end() ? -1 : it->second;
+  }
+
+  // Ignored fields: return true when the value is part of an ignored field
+  bool SkipScalar() {
+    if (skip_depth_ > 0) {
+      return true;
+    }
+    if (skip_value_) {
+      skip_value_ = false;
+      return true;
+    }
+    return false;
+  }
+
+  bool SkipStart() {
+    if (skip_depth_ > 0) {
+      ++skip_depth_;
+      return true;
+    }
+    if (skip_value_) {
+      skip_value_ = false;
+      skip_depth_ = 1;
+      return true;
+    }
+    return false;
+  }
+
+  bool SkipEnd() {
+    if (skip_depth_ > 0) {
+      --skip_depth_;
+      return true;
+    }
+    return false;
+  }
+
+  // The builder for the value being parsed
+  bool Target(BuilderNode** out) {
+    if (ARROW_PREDICT_FALSE(stack_.empty())) {
+      return ExpectedObject();
+    }
+    const Frame& frame = stack_.back();
+    *out = frame.node->id == Type::LIST ? frame.node->children[0].get()
+                                        : frame.node->children[frame.field].get();
+    return true;
+  }
+
+  Status TypeMismatch(const BuilderNode* node, const char* json_type) {
+    std::stringstream ss;
+    ss << "Cannot convert JSON " << json_type << " to "
+       << node->field->type()->ToString() << " for field '" << node->field->name()
+       << "' in row " << num_rows_;
+    return Status::Invalid(ss.str());
+  }
+
+  template <typename BuilderType>
+  static Status AppendNullTo(ArrayBuilder* builder) {
+    return checked_cast<BuilderType*>(builder)->AppendNull();
+  }
+
+  Status AppendNull(BuilderNode* node) {
+    switch (node->id) {
+      case Type::NA:
+        return AppendNullTo<NullBuilder>(node->builder);
+      case Type::BOOL:
+        return AppendNullTo<BooleanBuilder>(node->builder);
+      case Type::UINT8:
+        return AppendNullTo<UInt8Builder>(node->builder);
+      case Type::INT8:
+        return AppendNullTo<Int8Builder>(node->builder);
+      case Type::UINT16:
+        return AppendNullTo<UInt16Builder>(node->builder);
+      case Type::INT16:
+        return AppendNullTo<Int16Builder>(node->builder);
+      case Type::UINT32:
+        return AppendNullTo<UInt32Builder>(node->builder);
+      case Type::INT32:
+        return AppendNullTo<Int32Builder>(node->builder);
+      case Type::UINT64:
+        return AppendNullTo<UInt64Builder>(node->builder);
+      case Type::INT64:
+        return AppendNullTo<Int64Builder>(node->builder);
+      case Type::FLOAT:
+        return AppendNullTo<FloatBuilder>(node->builder);
+      case Type::DOUBLE:
+        return AppendNullTo<DoubleBuilder>(node->builder);
+      case Type::STRING:
+      case Type::BINARY:
+        return AppendNullTo<BinaryBuilder>(node->builder);
+      case Type::DATE32:
+        return AppendNullTo<Date32Builder>(node->builder);
+      case Type::TIMESTAMP:
+        return AppendNullTo<TimestampBuilder>(node->builder);
+      case Type::LIST:
+        return AppendNullTo<ListBuilder>(node->builder);
+      default: {
+        DCHECK_EQ(node->id, Type::STRUCT);
+        // Struct children are appended to separately
+        RETURN_NOT_OK(AppendNullTo<StructBuilder>(node->builder));
+        for (const auto& child : node->children) {
+          RETURN_NOT_OK(AppendNull(child.get()));
+        }
+        return Status::OK();
+      }
+    }
+  }
+
+  template <typename ArrowType, typename Value>
+  Status AppendIntegerAs(BuilderNode* node, Value value) {
+    using c_type = typename ArrowType::c_type;
+    if (ARROW_PREDICT_FALSE(!IntegerInRange<c_type>(value))) {
+      std::stringstream ss;
+      ss << "JSON integer " << value << " is out of range for field '"
+         << node->field->name() << "' of type " << node->field->type()->ToString()
+         << " in row " << num_rows_;
+      return Status::Invalid(ss.str());
+    }
+    return checked_cast<NumericBuilder<ArrowType>*>(node->builder)
+        ->Append(static_cast<c_type>(value));
+  }
+
+  // Integers convert to all numeric types, and to dates and timestamps as
+  // a count of units since the UNIX epoch
+  template <typename Value>
+  Status AppendInteger(BuilderNode* node, Value value) {
+    switch (node->id) {
+      case Type::UINT8:
+        return AppendIntegerAs<UInt8Type>(node, value);
+      case Type::INT8:
+        return AppendIntegerAs<Int8Type>(node, value);
+      case Type::UINT16:
+        return AppendIntegerAs<UInt16Type>(node, value);
+      case Type::INT16:
+        return AppendIntegerAs<Int16Type>(node, value);
+      case Type::UINT32:
+        return AppendIntegerAs<UInt32Type>(node, value);
+      case Type::INT32:
+        return AppendIntegerAs<Int32Type>(node, value);
+      case Type::UINT64:
+        return AppendIntegerAs<UInt64Type>(node, value);
+      case Type::INT64:
+        return AppendIntegerAs<Int64Type>(node, value);
+      case Type::DATE32:
+        return AppendIntegerAs<Date32Type>(node, value);
+      case Type::TIMESTAMP:
+        return AppendIntegerAs<TimestampType>(node, value);
+      case Type::FLOAT:
+        return checked_cast<FloatBuilder*>(node->builder)
+            ->Append(static_cast<float>(value));
+      case Type::DOUBLE:
+        return checked_cast<DoubleBuilder*>(node->builder)
+            ->Append(static_cast<double>(value));
+      default:
+        return TypeMismatch(node, "integer");
+    }
+  }
+
+  template <typename ArrowType>
+  Status AppendParsed(BuilderNode* node, const char* data, rj::SizeType length,
+                      ::arrow::internal::StringConverter<ArrowType>* converter) {
+    typename ArrowType::c_type value;
+    if (ARROW_PREDICT_FALSE(!(*converter)(data, length, &value))) {
+      std::stringstream ss;
+      ss << "Cannot parse JSON string '" << std::string(data, length) << "' as "
+         << node->field->type()->ToString() << " for field '" << node->field->name()
+         << "' in row " << num_rows_;
+      return Status::Invalid(ss.str());
+    }
+    return checked_cast<NumericBuilder<ArrowType>*>(node->builder)->Append(value);
+  }
+
+  // Strings convert to strings and binary, and to dates and timestamps
+  // written in ISO-8601 format
+  Status AppendString(BuilderNode* node, const char* data, rj::SizeType length) {
+    switch (node->id) {
+      case Type::STRING:
+      case Type::BINARY:
+        return checked_cast<BinaryBuilder*>(node->builder)
+            ->Append(data, static_cast<int32_t>(length));
+      case Type::DATE32: {
+        ::arrow::internal::StringConverter<Date32Type> converter;
+        return AppendParsed(node, data, length, &converter);
+      }
+      case Type::TIMESTAMP: {
+        ::arrow::internal::StringConverter<TimestampType> converter(
+            node->field->type());
+        return AppendParsed(node, data, length, &converter);
+      }
+      default:
+        return TypeMismatch(node, "string");
+    }
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<Schema> schema_;
+  bool ignore_unexpected_fields_;
+
+  std::vector<std::unique_ptr<ArrayBuilder>> builders_;
+  BuilderNode root_;
+  std::vector<Frame> stack_;
+  int64_t stamp_ = 0;
+
+  // Nesting depth within the value of an ignored field
+  int skip_depth_ = 0;
+  // Whether the next value is that of an ignored field
+  bool skip_value_ = false;
+};
+
+}  // namespace
+
+Status InferSchema(const std::vector<std::shared_ptr<Buffer>>& block,
+                   std::shared_ptr<Schema>* out) {
+  InferenceHandler handler;
+  RETURN_NOT_OK(ParseValues(block, &handler));
+  *out = ::arrow::schema(handler.root().ToFields());
+  return Status::OK();
+}
+
+Status ParseBlock(MemoryPool* pool, const std::shared_ptr<Schema>& schema,
+                  const ParseOptions& options,
+                  const std::vector<std::shared_ptr<Buffer>>& block,
+                  std::shared_ptr<RecordBatch>* out) {
+  BuilderHandler handler(pool, schema, options);
+  RETURN_NOT_OK(handler.Init());
+  RETURN_NOT_OK(ParseValues(block, &handler));
+  return handler.Finish(out);
+}
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
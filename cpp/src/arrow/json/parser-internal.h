@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Conversion of newline-delimited JSON objects to record batches. The
+// objects are read with the SAX interface of RapidJSON and appended straight
+// to array builders, without materializing a document.
+
+#ifndef ARROW_JSON_PARSER_INTERNAL_H
+#define ARROW_JSON_PARSER_INTERNAL_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class RecordBatch;
+class Schema;
+
+namespace json {
+
+struct ParseOptions;
+
+namespace internal {
+
+/// \brief Infer a schema from the JSON objects in a block of input
+///
+/// \param[in] block buffers holding whole lines of input, in order
+/// \param[out] out the schema, with fields in order of first appearance
+ARROW_EXPORT
+Status InferSchema(const std::vector<std::shared_ptr<Buffer>>& block,
+                   std::shared_ptr<Schema>* out);
+
+/// \brief Convert the JSON objects in a block of input to a record batch
+///
+/// \param[in] pool the memory pool for the builders
+/// \param[in] schema the schema of the record batch
+/// \param[in] options parse options; explicit_schema is ignored
+/// \param[in] block buffers holding whole lines of input, in order
+/// \param[out] out a record batch with one row per object
+ARROW_EXPORT
+Status ParseBlock(MemoryPool* pool, const std::shared_ptr<Schema>& schema,
+                  const ParseOptions& options,
+                  const std::vector<std::shared_ptr<Buffer>>& block,
+                  std::shared_ptr<RecordBatch>* out);
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_PARSER_INTERNAL_H
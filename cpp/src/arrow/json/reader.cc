@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/reader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/json/parser-internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/util/block-reader.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace json {
+
+using internal::InferSchema;
+using internal::ParseBlock;
+using ::arrow::internal::BlockReader;
+using ::arrow::internal::ReadaheadQueue;
+
+ParseOptions ParseOptions::Defaults() {
+  ParseOptions options;
+  options.ignore_unexpected_fields = true;
+  return options;
+}
+
+ReadOptions ReadOptions::Defaults() {
+  ReadOptions options;
+  options.use_threads = true;
+  options.block_size = 1 << 20;
+  return options;
+}
+
+Status ParseOne(MemoryPool* pool, const ParseOptions& options,
+                const std::shared_ptr<Buffer>& json, std::shared_ptr<RecordBatch>* out) {
+  const std::vector<std::shared_ptr<Buffer>> block = {json};
+  std::shared_ptr<Schema> schema = options.explicit_schema;
+  if (schema == nullptr) {
+    RETURN_NOT_OK(InferSchema(block, &schema));
+  }
+  return ParseBlock(pool, schema, options, block, out);
+}
+
+namespace {
+
+// The buffers holding the whole lines of one block of input
+using Block = std::vector<std::shared_ptr<Buffer>>;
+
+int64_t LastLineEnd(const uint8_t* data, int64_t size) {
+  int64_t end = size;
+  while (end > 0 && data[end - 1] != '\n') {
+    --end;
+  }
+  return end;
+}
+
+int64_t FirstLineEnd(const uint8_t* data, int64_t size) {
+  const auto newline = static_cast<const uint8_t*>(memchr(data, '\n', size));
+  return newline - data + 1;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// StreamingReader implementation
+
+class StreamingReader::StreamingReaderImpl {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                      const ReadOptions& read_options,
+                      const ParseOptions& parse_options)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        block_reader_(pool, input, read_options.block_size, LastLineEnd, FirstLineEnd),
+        pending_(std::max(1, GetCpuThreadPoolCapacity())) {}
+
+  // When the schema is inferred, infer_from_all_input reads the whole input
+  // ahead so that the schema covers every block rather than the first one
+  Status Init(bool infer_from_all_input) {
+    schema_ = parse_options_.explicit_schema;
+    if (schema_ != nullptr) {
+      return Status::OK();
+    }
+    // The blocks read are kept to be parsed with the inferred schema
+    Block lines;
+    do {
+      buffered_.emplace_back();
+      RETURN_NOT_OK(block_reader_.ReadBlock(&buffered_.back()));
+      lines.insert(lines.end(), buffered_.back().begin(), buffered_.back().end());
+    } while (infer_from_all_input && !buffered_.back().empty());
+    return InferSchema(lines, &schema_);
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    // Blocks of blank lines yield no record batch
+    do {
+      RETURN_NOT_OK(read_options_.use_threads ? NextParsed(out) : ParseNext(out));
+    } while (*out != nullptr && (*out)->num_rows() == 0);
+    return Status::OK();
+  }
+
+ private:
+  Status ParseNext(std::shared_ptr<RecordBatch>* out) {
+    Block block;
+    RETURN_NOT_OK(NextBlock(&block));
+    if (block.empty()) {
+      out->reset();
+      return Status::OK();
+    }
+    return ParseBlock(pool_, schema_, parse_options_, block, out);
+  }
+
+  Status NextParsed(std::shared_ptr<RecordBatch>* out) {
+    // Keep the blocks following the one returned being parsed
+    while (!pending_.full()) {
+      Block block;
+      RETURN_NOT_OK(NextBlock(&block));
+      if (block.empty()) {
+        break;
+      }
+      MemoryPool* pool = pool_;
+      std::shared_ptr<Schema> schema = schema_;
+      ParseOptions options = parse_options_;
+      pending_.Submit(
+          [pool, schema, options, block](std::shared_ptr<RecordBatch>* batch) {
+            return ParseBlock(pool, schema, options, block, batch);
+          });
+    }
+    if (pending_.empty()) {
+      out->reset();
+      return Status::OK();
+    }
+    return pending_.Pop(out);
+  }
+
+  Status NextBlock(Block* out) {
+    if (!buffered_.empty()) {
+      *out = std::move(buffered_.front());
+      buffered_.pop_front();
+      return Status::OK();
+    }
+    return block_reader_.ReadBlock(out);
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  BlockReader block_reader_;
+
+  std::shared_ptr<Schema> schema_;
+  // Blocks read ahead for schema inference
+  std::deque<Block> buffered_;
+  ReadaheadQueue<std::shared_ptr<RecordBatch>> pending_;
+};
+
+StreamingReader::StreamingReader() {}
+
+StreamingReader::~StreamingReader() {}
+
+Status StreamingReader::Open(MemoryPool* pool,
+                             const std::shared_ptr<io::InputStream>& input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  std::shared_ptr<StreamingReader> reader(new StreamingReader());
+  reader->impl_.reset(
+      new StreamingReaderImpl(pool, input, read_options, parse_options));
+  RETURN_NOT_OK(reader->impl_->Init(false));
+  *out = reader;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> StreamingReader::schema() const { return impl_->schema(); }
+
+Status StreamingReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+Status ReadTable(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                 const ReadOptions& read_options, const ParseOptions& parse_options,
+                 std::shared_ptr<Table>* out) {
+  std::shared_ptr<StreamingReader> reader(new StreamingReader());
+  reader->impl_.reset(new StreamingReader::StreamingReaderImpl(
+      pool, input, read_options, parse_options));
+  RETURN_NOT_OK(reader->impl_->Init(true));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  return Table::FromRecordBatches(reader->schema(), batches, out);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Reading of newline-delimited JSON (one JSON object per line) into Arrow
+// record batches
+
+#ifndef ARROW_JSON_READER_H
+#define ARROW_JSON_READER_H
+
+#include <memory>
+
+#include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Table;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace json {
+
+/// \brief Parse a buffer of newline-delimited JSON objects into one record
+/// batch
+///
+/// The schema is inferred from the whole buffer unless
+/// options.explicit_schema is set.
+ARROW_EXPORT
+Status ParseOne(MemoryPool* pool, const ParseOptions& options,
+                const std::shared_ptr<Buffer>& json, std::shared_ptr<RecordBatch>* out);
+
+/// \class StreamingReader
+/// \brief Read newline-delimited JSON objects from a stream, one record batch
+/// per block of input
+///
+/// Blocks are split at newlines, so that each holds whole objects, and are
+/// converted in input order. When ReadOptions::use_threads is set, the
+/// blocks following the one being returned are parsed ahead on the CPU
+/// thread pool while the caller consumes the record batches.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  ~StreamingReader() override;
+
+  /// \brief Create a reader, inferring the schema from the first block of
+  /// input unless parse_options.explicit_schema is set
+  ///
+  /// The inferred schema is not revised by later blocks: a field which is
+  /// null or integral throughout the first block fails to convert the
+  /// strings, objects or non-integral numbers of a later block. Set
+  /// explicit_schema, or use ReadTable, when the first block may not be
+  /// representative.
+  static Status Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                     const ReadOptions& read_options,
+                     const ParseOptions& parse_options,
+                     std::shared_ptr<StreamingReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  StreamingReader();
+
+  friend Status ReadTable(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options, std::shared_ptr<Table>* out);
+
+  class StreamingReaderImpl;
+  std::unique_ptr<StreamingReaderImpl> impl_;
+};
+
+/// \brief Read all newline-delimited JSON objects from a stream into a table
+///
+/// Unless parse_options.explicit_schema is set, the whole input is read
+/// before conversion and the schema is inferred from all of it, so that a
+/// field first seen, or first seen non-null or non-integral, in a later
+/// block has the type of its values there.
+ARROW_EXPORT
+Status ReadTable(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                 const ReadOptions& read_options, const ParseOptions& parse_options,
+                 std::shared_ptr<Table>* out);
+
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_READER_H
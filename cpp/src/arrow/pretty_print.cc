@@ -148,24 +148,28 @@ class ArrayPrinter : public PrettyPrinter {
 
   // String (Utf8)
   template <typename T>
-  inline typename std::enable_if<std::is_same<StringArray, T>::value, Status>::type
+  inline typename std::enable_if<std::is_same<StringArray, T>::value ||
+                                     std::is_same<LargeStringArray, T>::value,
+                                 Status>::type
   WriteDataValues(const T& array) {
     WriteValues(array, [&](int64_t i) {
-      int32_t length;
+      typename T::TypeClass::offset_type length;
       const char* buf = reinterpret_cast<const char*>(array.GetValue(i, &length));
-      (*sink_) << "\"" << std::string(buf, length) << "\"";
+      (*sink_) << "\"" << std::string(buf, static_cast<size_t>(length)) << "\"";
     });
     return Status::OK();
   }
 
   // Binary
   template <typename T>
-  inline typename std::enable_if<std::is_same<BinaryArray, T>::value, Status>::type
+  inline typename std::enable_if<std::is_same<BinaryArray, T>::value ||
+                                     std::is_same<LargeBinaryArray, T>::value,
+                                 Status>::type
   WriteDataValues(const T& array) {
     WriteValues(array, [&](int64_t i) {
-      int32_t length;
+      typename T::TypeClass::offset_type length;
       const uint8_t* buf = array.GetValue(i, &length);
-      (*sink_) << HexEncode(buf, length);
+      (*sink_) << HexEncode(buf, static_cast<int32_t>(length));
     });
     return Status::OK();
   }
@@ -195,7 +199,9 @@ class ArrayPrinter : public PrettyPrinter {
   }
 
   template <typename T>
-  inline typename std::enable_if<std::is_base_of<ListArray, T>::value, Status>::type
+  inline typename std::enable_if<std::is_base_of<ListArray, T>::value ||
+                                     std::is_base_of<LargeListArray, T>::value,
+                                 Status>::type
   WriteDataValues(const T& array) {
     bool skip_comma = true;
     for (int64_t i = 0; i < array.length(); ++i) {
@@ -231,7 +237,9 @@ class ArrayPrinter : public PrettyPrinter {
   typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value ||
                               std::is_base_of<FixedSizeBinaryArray, T>::value ||
                               std::is_base_of<BinaryArray, T>::value ||
-                              std::is_base_of<ListArray, T>::value,
+                              std::is_base_of<LargeBinaryArray, T>::value ||
+                              std::is_base_of<ListArray, T>::value ||
+                              std::is_base_of<LargeListArray, T>::value,
                           Status>::type
   Visit(const T& array) {
     OpenArray(array);
@@ -28,6 +28,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "arrow/array.h"
@@ -84,6 +85,20 @@ struct WrapBytes<BinaryArray> {
   }
 };
 
+template <>
+struct WrapBytes<LargeStringArray> {
+  static inline PyObject* Wrap(const uint8_t* data, int64_t length) {
+    return PyUnicode_FromStringAndSize(reinterpret_cast<const char*>(data), length);
+  }
+};
+
+template <>
+struct WrapBytes<LargeBinaryArray> {
+  static inline PyObject* Wrap(const uint8_t* data, int64_t length) {
+    return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(data), length);
+  }
+};
+
 template <>
 struct WrapBytes<FixedSizeBinaryArray> {
   static inline PyObject* Wrap(const uint8_t* data, int64_t length) {
@@ -292,6 +307,37 @@ inline const T* GetPrimitiveValues(const Array& arr) {
   return raw_values + arr.offset();
 }
 
+// Call visit_valid(i) for the valid slots of an array and visit_null(i) for the
+// null ones. The validity bitmap is walked a word at a time, so that single
+// bits are only tested in words mixing valid and null slots.
+template <typename VisitValid, typename VisitNull>
+inline void VisitValidity(const Array& arr, VisitValid&& visit_valid,
+                          VisitNull&& visit_null) {
+  ::arrow::internal::VisitBitBlocks(arr.null_bitmap_data(), arr.offset(), arr.length(),
+                                    std::forward<VisitValid>(visit_valid),
+                                    std::forward<VisitNull>(visit_null));
+}
+
+// Write Python objects for the slots of an array: None for the null ones,
+// and the object made by write_valid(i, &out_values[i]) for the others.
+// Nothing more is made after the first error.
+template <typename WriteValid>
+inline Status WriteObjectsWithNulls(const Array& arr, WriteValid&& write_valid,
+                                    PyObject** out_values) {
+  Status st;
+  VisitValidity(arr,
+                [&](int64_t i) {
+                  if (ARROW_PREDICT_TRUE(st.ok())) {
+                    st = write_valid(i, &out_values[i]);
+                  }
+                },
+                [&](int64_t i) {
+                  Py_INCREF(Py_None);
+                  out_values[i] = Py_None;
+                });
+  return st;
+}
+
 template <typename T>
 inline void ConvertIntegerWithNulls(PandasOptions options, const ChunkedArray& data,
                                     double* out_values) {
@@ -299,10 +345,10 @@ inline void ConvertIntegerWithNulls(PandasOptions options, const ChunkedArray& d
     const auto& arr = *data.chunk(c);
     const T* in_values = GetPrimitiveValues<T>(arr);
     // Upcast to double, set NaN as appropriate
-
-    for (int i = 0; i < arr.length(); ++i) {
-      *out_values++ = arr.IsNull(i) ? NAN : static_cast<double>(in_values[i]);
-    }
+    VisitValidity(arr,
+                  [&](int64_t i) { out_values[i] = static_cast<double>(in_values[i]); },
+                  [&](int64_t i) { out_values[i] = NAN; });
+    out_values += arr.length();
   }
 }
 
@@ -336,21 +382,14 @@ static Status ConvertBooleanWithNulls(PandasOptions options, const ChunkedArray&
   PyAcquireGIL lock;
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = checked_cast<const BooleanArray&>(*data.chunk(c));
-
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      if (arr.IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values++ = Py_None;
-      } else if (arr.Value(i)) {
-        // True
-        Py_INCREF(Py_True);
-        *out_values++ = Py_True;
-      } else {
-        // False
-        Py_INCREF(Py_False);
-        *out_values++ = Py_False;
-      }
-    }
+    RETURN_NOT_OK(WriteObjectsWithNulls(arr,
+                                        [&](int64_t i, PyObject** out) {
+                                          *out = arr.Value(i) ? Py_True : Py_False;
+                                          Py_INCREF(*out);
+                                          return Status::OK();
+                                        },
+                                        out_values));
+    out_values += arr.length();
   }
   return Status::OK();
 }
@@ -373,17 +412,17 @@ static Status ConvertIntegerObjects(PandasOptions options, const ChunkedArray& d
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = *data.chunk(c);
     const auto* in_values = GetPrimitiveValues<T>(arr);
-
-    for (int i = 0; i < arr.length(); ++i) {
-      if (arr.IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values++ = Py_None;
-      } else {
-        *out_values++ = is_signed ? PyLong_FromLongLong(in_values[i])
-                                  : PyLong_FromUnsignedLongLong(in_values[i]);
-        RETURN_IF_PYERROR();
-      }
-    }
+    RETURN_NOT_OK(WriteObjectsWithNulls(arr,
+                                        [&](int64_t i, PyObject** out) {
+                                          *out = is_signed
+                                                     ? PyLong_FromLongLong(in_values[i])
+                                                     : PyLong_FromUnsignedLongLong(
+                                                           in_values[i]);
+                                          RETURN_IF_PYERROR();
+                                          return Status::OK();
+                                        },
+                                        out_values));
+    out_values += arr.length();
   }
   return Status::OK();
 }
@@ -395,27 +434,24 @@ inline Status ConvertBinaryLike(PandasOptions options, const ChunkedArray& data,
   PyAcquireGIL lock;
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
-
-    const uint8_t* data_ptr;
-    int32_t length;
-    const bool has_nulls = data.null_count() > 0;
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      if (has_nulls && arr.IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values = Py_None;
-      } else {
-        data_ptr = arr.GetValue(i, &length);
-        *out_values = WrapBytes<ArrayType>::Wrap(data_ptr, length);
-        if (*out_values == nullptr) {
-          PyErr_Clear();
-          std::stringstream ss;
-          ss << "Wrapping "
-             << std::string(reinterpret_cast<const char*>(data_ptr), length) << " failed";
-          return Status::UnknownError(ss.str());
-        }
-      }
-      ++out_values;
-    }
+    RETURN_NOT_OK(WriteObjectsWithNulls(
+        arr,
+        [&](int64_t i, PyObject** out) {
+          typename Type::offset_type length;
+          const uint8_t* data_ptr = arr.GetValue(i, &length);
+          *out = WrapBytes<ArrayType>::Wrap(data_ptr, length);
+          if (*out == nullptr) {
+            PyErr_Clear();
+            std::stringstream ss;
+            ss << "Wrapping "
+               << std::string(reinterpret_cast<const char*>(data_ptr), length)
+               << " failed";
+            return Status::UnknownError(ss.str());
+          }
+          return Status::OK();
+        },
+        out_values));
+    out_values += arr.length();
   }
   return Status::OK();
 }
@@ -442,27 +478,25 @@ inline Status ConvertFixedSizeBinary(PandasOptions options, const ChunkedArray&
   for (int c = 0; c < data.num_chunks(); c++) {
     auto arr = checked_cast<FixedSizeBinaryArray*>(data.chunk(c).get());
 
-    const uint8_t* data_ptr;
     int32_t length =
         std::dynamic_pointer_cast<FixedSizeBinaryType>(arr->type())->byte_width();
-    const bool has_nulls = data.null_count() > 0;
-    for (int64_t i = 0; i < arr->length(); ++i) {
-      if (has_nulls && arr->IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values = Py_None;
-      } else {
-        data_ptr = arr->GetValue(i);
-        *out_values = WrapBytes<FixedSizeBinaryArray>::Wrap(data_ptr, length);
-        if (*out_values == nullptr) {
-          PyErr_Clear();
-          std::stringstream ss;
-          ss << "Wrapping "
-             << std::string(reinterpret_cast<const char*>(data_ptr), length) << " failed";
-          return Status::UnknownError(ss.str());
-        }
-      }
-      ++out_values;
-    }
+    RETURN_NOT_OK(WriteObjectsWithNulls(
+        *arr,
+        [&](int64_t i, PyObject** out) {
+          const uint8_t* data_ptr = arr->GetValue(i);
+          *out = WrapBytes<FixedSizeBinaryArray>::Wrap(data_ptr, length);
+          if (*out == nullptr) {
+            PyErr_Clear();
+            std::stringstream ss;
+            ss << "Wrapping "
+               << std::string(reinterpret_cast<const char*>(data_ptr), length)
+               << " failed";
+            return Status::UnknownError(ss.str());
+          }
+          return Status::OK();
+        },
+        out_values));
+    out_values += arr->length();
   }
   return Status::OK();
 }
@@ -491,41 +525,39 @@ inline Status ConvertStruct(PandasOptions options, const ChunkedArray& data,
     }
 
     // Construct a dictionary for each row
-    const bool has_nulls = data.null_count() > 0;
-    for (int64_t i = 0; i < arr->length(); ++i) {
-      if (has_nulls && arr->IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values = Py_None;
-      } else {
-        // Build the new dict object for the row
-        dict_item.reset(PyDict_New());
-        RETURN_IF_PYERROR();
-        for (int32_t field_idx = 0; field_idx < num_fields; ++field_idx) {
-          OwnedRef field_value;
-          auto name = array_type->child(static_cast<int>(field_idx))->name();
-          if (!arr->field(static_cast<int>(field_idx))->IsNull(i)) {
-            // Value exists in child array, obtain it
-            auto array = reinterpret_cast<PyArrayObject*>(fields_data[field_idx].obj());
-            auto ptr = reinterpret_cast<const char*>(PyArray_GETPTR1(array, i));
-            field_value.reset(PyArray_GETITEM(array, ptr));
+    RETURN_NOT_OK(WriteObjectsWithNulls(
+        *arr,
+        [&](int64_t i, PyObject** out) {
+          // Build the new dict object for the row
+          dict_item.reset(PyDict_New());
+          RETURN_IF_PYERROR();
+          for (int32_t field_idx = 0; field_idx < num_fields; ++field_idx) {
+            OwnedRef field_value;
+            auto name = array_type->child(static_cast<int>(field_idx))->name();
+            if (!arr->field(static_cast<int>(field_idx))->IsNull(i)) {
+              // Value exists in child array, obtain it
+              auto array = reinterpret_cast<PyArrayObject*>(fields_data[field_idx].obj());
+              auto ptr = reinterpret_cast<const char*>(PyArray_GETPTR1(array, i));
+              field_value.reset(PyArray_GETITEM(array, ptr));
+              RETURN_IF_PYERROR();
+            } else {
+              // Translate the Null to a None
+              Py_INCREF(Py_None);
+              field_value.reset(Py_None);
+            }
+            // PyDict_SetItemString increments reference count
+            auto setitem_result =
+                PyDict_SetItemString(dict_item.obj(), name.c_str(), field_value.obj());
             RETURN_IF_PYERROR();
-          } else {
-            // Translate the Null to a None
-            Py_INCREF(Py_None);
-            field_value.reset(Py_None);
+            DCHECK_EQ(setitem_result, 0);
           }
-          // PyDict_SetItemString increments reference count
-          auto setitem_result =
-              PyDict_SetItemString(dict_item.obj(), name.c_str(), field_value.obj());
-          RETURN_IF_PYERROR();
-          DCHECK_EQ(setitem_result, 0);
-        }
-        *out_values = dict_item.obj();
-        // Grant ownership to the resulting array
-        Py_INCREF(*out_values);
-      }
-      ++out_values;
-    }
+          *out = dict_item.obj();
+          // Grant ownership to the resulting array
+          Py_INCREF(*out);
+          return Status::OK();
+        },
+        out_values));
+    out_values += arr->length();
   }
   return Status::OK();
 }
@@ -558,30 +590,19 @@ inline Status ConvertListsLike(PandasOptions options, const std::shared_ptr<Colu
   for (int c = 0; c < data.num_chunks(); c++) {
     auto arr = std::static_pointer_cast<ListArray>(data.chunk(c));
 
-    const bool has_nulls = data.null_count() > 0;
-    for (int64_t i = 0; i < arr->length(); ++i) {
-      if (has_nulls && arr->IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values = Py_None;
-      } else {
-        OwnedRef start(PyLong_FromLongLong(arr->value_offset(i) + chunk_offset));
-        OwnedRef end(PyLong_FromLongLong(arr->value_offset(i + 1) + chunk_offset));
-        OwnedRef slice(PySlice_New(start.obj(), end.obj(), nullptr));
-
-        if (ARROW_PREDICT_FALSE(slice.obj() == nullptr)) {
-          // Fall out of loop, will return from RETURN_IF_PYERROR
-          break;
-        }
-        *out_values = PyObject_GetItem(numpy_array, slice.obj());
-
-        if (*out_values == nullptr) {
-          // Fall out of loop, will return from RETURN_IF_PYERROR
-          break;
-        }
-      }
-      ++out_values;
-    }
-    RETURN_IF_PYERROR();
+    RETURN_NOT_OK(WriteObjectsWithNulls(
+        *arr,
+        [&](int64_t i, PyObject** out) {
+          OwnedRef start(PyLong_FromLongLong(arr->value_offset(i) + chunk_offset));
+          OwnedRef end(PyLong_FromLongLong(arr->value_offset(i + 1) + chunk_offset));
+          OwnedRef slice(PySlice_New(start.obj(), end.obj(), nullptr));
+          RETURN_IF_PYERROR();
+          *out = PyObject_GetItem(numpy_array, slice.obj());
+          RETURN_IF_PYERROR();
+          return Status::OK();
+        },
+        out_values));
+    out_values += arr->length();
 
     chunk_offset += arr->values()->length();
   }
@@ -596,9 +617,9 @@ inline void ConvertNumericNullable(const ChunkedArray& data, T na_value, T* out_
     const T* in_values = GetPrimitiveValues<T>(arr);
 
     if (arr.null_count() > 0) {
-      for (int64_t i = 0; i < arr.length(); ++i) {
-        *out_values++ = arr.IsNull(i) ? na_value : in_values[i];
-      }
+      VisitValidity(arr, [&](int64_t i) { out_values[i] = in_values[i]; },
+                    [&](int64_t i) { out_values[i] = na_value; });
+      out_values += arr.length();
     } else {
       memcpy(out_values, in_values, sizeof(T) * arr.length());
       out_values += arr.length();
@@ -612,10 +633,10 @@ inline void ConvertNumericNullableCast(const ChunkedArray& data, OutType na_valu
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = *data.chunk(c);
     const InType* in_values = GetPrimitiveValues<InType>(arr);
-
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      *out_values++ = arr.IsNull(i) ? na_value : static_cast<OutType>(in_values[i]);
-    }
+    VisitValidity(arr,
+                  [&](int64_t i) { out_values[i] = static_cast<OutType>(in_values[i]); },
+                  [&](int64_t i) { out_values[i] = na_value; });
+    out_values += arr.length();
   }
 }
 
@@ -625,10 +646,12 @@ inline void ConvertDatetimeNanos(const ChunkedArray& data, int64_t* out_values)
     const auto& arr = *data.chunk(c);
     const T* in_values = GetPrimitiveValues<T>(arr);
 
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      *out_values++ = arr.IsNull(i) ? kPandasTimestampNull
-                                    : (static_cast<int64_t>(in_values[i]) * SHIFT);
-    }
+    VisitValidity(arr,
+                  [&](int64_t i) {
+                    out_values[i] = static_cast<int64_t>(in_values[i]) * SHIFT;
+                  },
+                  [&](int64_t i) { out_values[i] = kPandasTimestampNull; });
+    out_values += arr.length();
   }
 }
 
@@ -648,16 +671,15 @@ static Status ConvertTimes(PandasOptions options, const ChunkedArray& data,
     DCHECK(type);
 
     const TimeUnit::type unit = type->unit();
-
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      if (arr.IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values++ = Py_None;
-      } else {
-        RETURN_NOT_OK(PyTime_from_int(arr.Value(i), unit, out_values++));
-        RETURN_IF_PYERROR();
-      }
-    }
+    RETURN_NOT_OK(WriteObjectsWithNulls(arr,
+                                        [&](int64_t i, PyObject** out) {
+                                          RETURN_NOT_OK(
+                                              PyTime_from_int(arr.Value(i), unit, out));
+                                          RETURN_IF_PYERROR();
+                                          return Status::OK();
+                                        },
+                                        out_values));
+    out_values += arr.length();
   }
 
   return Status::OK();
@@ -674,17 +696,15 @@ static Status ConvertDecimals(PandasOptions options, const ChunkedArray& data,
 
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = checked_cast<const arrow::Decimal128Array&>(*data.chunk(c));
-
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      if (arr.IsNull(i)) {
-        Py_INCREF(Py_None);
-        *out_values++ = Py_None;
-      } else {
-        *out_values++ =
-            internal::DecimalFromString(decimal_constructor, arr.FormatValue(i));
-        RETURN_IF_PYERROR();
-      }
-    }
+    RETURN_NOT_OK(WriteObjectsWithNulls(
+        arr,
+        [&](int64_t i, PyObject** out) {
+          *out = internal::DecimalFromString(decimal_constructor, arr.FormatValue(i));
+          RETURN_IF_PYERROR();
+          return Status::OK();
+        },
+        out_values));
+    out_values += arr.length();
   }
 
   return Status::OK();
@@ -731,6 +751,10 @@ class ObjectBlock : public PandasBlock {
       RETURN_NOT_OK(ConvertBinaryLike<BinaryType>(options_, data, out_buffer));
     } else if (type == Type::STRING) {
       RETURN_NOT_OK(ConvertBinaryLike<StringType>(options_, data, out_buffer));
+    } else if (type == Type::LARGE_BINARY) {
+      RETURN_NOT_OK(ConvertBinaryLike<LargeBinaryType>(options_, data, out_buffer));
+    } else if (type == Type::LARGE_STRING) {
+      RETURN_NOT_OK(ConvertBinaryLike<LargeStringType>(options_, data, out_buffer));
     } else if (type == Type::FIXED_SIZE_BINARY) {
       RETURN_NOT_OK(ConvertFixedSizeBinary(options_, data, out_buffer));
     } else if (type == Type::TIME32) {
@@ -1060,12 +1084,20 @@ class CategoricalBlock : public PandasBlock {
 
     auto CheckIndices = [](const ArrayType& arr, int64_t dict_length) {
       const T* values = arr.raw_values();
-      for (int64_t i = 0; i < arr.length(); ++i) {
-        if (arr.IsValid(i) && (values[i] < 0 || values[i] >= dict_length)) {
-          std::stringstream ss;
-          ss << "Out of bounds dictionary index: " << static_cast<int64_t>(values[i]);
-          return Status::Invalid(ss.str());
-        }
+      int64_t out_of_bounds = -1;
+      VisitValidity(arr,
+                    [&](int64_t i) {
+                      const bool in_bounds = values[i] >= 0 && values[i] < dict_length;
+                      if (ARROW_PREDICT_FALSE(!in_bounds) && out_of_bounds < 0) {
+                        out_of_bounds = i;
+                      }
+                    },
+                    [](int64_t) {});
+      if (out_of_bounds >= 0) {
+        std::stringstream ss;
+        ss << "Out of bounds dictionary index: "
+           << static_cast<int64_t>(values[out_of_bounds]);
+        return Status::Invalid(ss.str());
       }
       return Status::OK();
     };
@@ -1100,9 +1132,9 @@ class CategoricalBlock : public PandasBlock {
 
         RETURN_NOT_OK(CheckIndices(indices, dict_arr.dictionary()->length()));
         // Null is -1 in CategoricalBlock
-        for (int i = 0; i < arr->length(); ++i) {
-          *out_values++ = indices.IsNull(i) ? -1 : in_values[i];
-        }
+        VisitValidity(indices, [&](int64_t i) { out_values[i] = in_values[i]; },
+                      [&](int64_t i) { out_values[i] = -1; });
+        out_values += arr->length();
       }
     }
 
@@ -1314,6 +1346,8 @@ static Status GetPandasBlockType(const Column& col, const PandasOptions& options
         break;
       }
     case Type::NA:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
     case Type::FIXED_SIZE_BINARY:
     case Type::STRUCT:
     case Type::TIME32:
@@ -1683,10 +1717,12 @@ class ArrowDeserializer {
     for (int c = 0; c < data_.num_chunks(); c++) {
       const auto& arr = *data_.chunk(c);
       const c_type* in_values = GetPrimitiveValues<c_type>(arr);
-
-      for (int64_t i = 0; i < arr.length(); ++i) {
-        *out_values++ = arr.IsNull(i) ? na_value : static_cast<T>(in_values[i]) / kShift;
-      }
+      VisitValidity(arr,
+                    [&](int64_t i) {
+                      out_values[i] = static_cast<T>(in_values[i]) / kShift;
+                    },
+                    [&](int64_t i) { out_values[i] = na_value; });
+      out_values += arr.length();
     }
     return Status::OK();
   }
@@ -1746,8 +1782,10 @@ class ArrowDeserializer {
 
   // UTF8 strings
   template <typename Type>
-  typename std::enable_if<std::is_base_of<BinaryType, Type>::value, Status>::type Visit(
-      const Type& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, Type>::value ||
+                              std::is_base_of<LargeBinaryType, Type>::value,
+                          Status>::type
+  Visit(const Type& type) {
     return VisitObjects(ConvertBinaryLike<Type>);
   }
 
@@ -1832,6 +1870,10 @@ class ArrowDeserializer {
     return Status::OK();
   }
 
+  Status Visit(const LargeListType& type) {
+    return Status::NotImplemented("large_list type");
+  }
+
   Status Visit(const UnionType& type) { return Status::NotImplemented("union type"); }
 
   Status Convert(PyObject** out) {
@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type_fwd.h"
@@ -222,6 +223,10 @@ class NumPyConverter {
 
   Status Visit(const StructType& type);
 
+  Status Visit(const LargeBinaryType& type) {
+    return TypeNotImplemented(type.ToString());
+  }
+
   Status Visit(const FixedSizeBinaryType& type);
 
   Status Visit(const Decimal128Type& type) { return TypeNotImplemented(type.ToString()); }
@@ -256,6 +261,15 @@ class NumPyConverter {
     return Status::OK();
   }
 
+  Status PushChunks(ChunkedArrayBuilder* builder) {
+    std::shared_ptr<ChunkedArray> out;
+    RETURN_NOT_OK(builder->Finish(&out));
+    for (const auto& chunk : out->chunks()) {
+      out_arrays_.emplace_back(chunk);
+    }
+    return Status::OK();
+  }
+
   template <typename ArrowType>
   Status VisitNative() {
     if (mask_ != nullptr) {
@@ -527,7 +541,9 @@ inline Status NumPyConverter::ConvertData<Date64Type>(std::shared_ptr<Buffer>* d
 }
 
 Status NumPyConverter::Visit(const BinaryType& type) {
-  BinaryBuilder builder(pool_);
+  // Values beyond the 2GB limit of a BinaryArray go to further chunks
+  ChunkedArrayBuilder chunked_builder(std::make_shared<BinaryBuilder>(pool_));
+  auto builder = checked_cast<BinaryBuilder*>(chunked_builder.builder());
 
   auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
 
@@ -536,7 +552,8 @@ Status NumPyConverter::Visit(const BinaryType& type) {
     Ndarray1DIndexer<uint8_t> mask_values(mask_);
     for (int64_t i = 0; i < length_; ++i) {
       if (mask_values[i]) {
-        RETURN_NOT_OK(builder.AppendNull());
+        RETURN_NOT_OK(chunked_builder.Reserve(1));
+        RETURN_NOT_OK(builder->AppendNull());
       } else {
         // This is annoying. NumPy allows strings to have nul-terminators, so
         // we must check for them here
@@ -545,7 +562,8 @@ Status NumPyConverter::Visit(const BinaryType& type) {
             break;
           }
         }
-        RETURN_NOT_OK(builder.Append(data, item_length));
+        RETURN_NOT_OK(chunked_builder.Reserve(1, item_length));
+        RETURN_NOT_OK(builder->Append(data, item_length));
       }
       data += stride_;
     }
@@ -557,14 +575,13 @@ Status NumPyConverter::Visit(const BinaryType& type) {
           break;
         }
       }
-      RETURN_NOT_OK(builder.Append(data, item_length));
+      RETURN_NOT_OK(chunked_builder.Reserve(1, item_length));
+      RETURN_NOT_OK(builder->Append(data, item_length));
       data += stride_;
     }
   }
 
-  std::shared_ptr<Array> result;
-  RETURN_NOT_OK(builder.Finish(&result));
-  return PushArray(result->data());
+  return PushChunks(&chunked_builder);
 }
 
 Status NumPyConverter::Visit(const FixedSizeBinaryType& type) {
@@ -597,7 +614,7 @@ namespace {
 constexpr int kNumPyUnicodeSize = 4;
 
 Status AppendUTF32(const char* data, int itemsize, int byteorder,
-                   StringBuilder* builder) {
+                   ChunkedArrayBuilder* chunked_builder) {
   // The binary \x00\x00\x00\x00 indicates a nul terminator in NumPy unicode,
   // so we need to detect that here to truncate if necessary. Yep.
   int actual_length = 0;
@@ -619,16 +636,16 @@ Status AppendUTF32(const char* data, int itemsize, int byteorder,
   }
 
   const int32_t length = static_cast<int32_t>(PyBytes_GET_SIZE(utf8_obj.obj()));
-  if (builder->value_data_length() + length > kBinaryMemoryLimit) {
-    return Status::CapacityError("Encoded string length exceeds maximum size (2GB)");
-  }
+  RETURN_NOT_OK(chunked_builder->Reserve(1, length));
+  auto builder = checked_cast<StringBuilder*>(chunked_builder->builder());
   return builder->Append(PyBytes_AS_STRING(utf8_obj.obj()), length);
 }
 
 }  // namespace
 
 Status NumPyConverter::Visit(const StringType& type) {
-  StringBuilder builder(pool_);
+  // Values beyond the 2GB limit of a StringArray go to further chunks
+  ChunkedArrayBuilder chunked_builder(std::make_shared<StringBuilder>(pool_));
 
   auto data = reinterpret_cast<const char*>(PyArray_DATA(arr_));
 
@@ -643,22 +660,22 @@ Status NumPyConverter::Visit(const StringType& type) {
     Ndarray1DIndexer<uint8_t> mask_values(mask_);
     for (int64_t i = 0; i < length_; ++i) {
       if (mask_values[i]) {
-        RETURN_NOT_OK(builder.AppendNull());
+        RETURN_NOT_OK(chunked_builder.Reserve(1));
+        auto builder = checked_cast<StringBuilder*>(chunked_builder.builder());
+        RETURN_NOT_OK(builder->AppendNull());
       } else {
-        RETURN_NOT_OK(AppendUTF32(data, itemsize_, byteorder, &builder));
+        RETURN_NOT_OK(AppendUTF32(data, itemsize_, byteorder, &chunked_builder));
       }
       data += stride_;
     }
   } else {
     for (int64_t i = 0; i < length_; ++i) {
-      RETURN_NOT_OK(AppendUTF32(data, itemsize_, byteorder, &builder));
+      RETURN_NOT_OK(AppendUTF32(data, itemsize_, byteorder, &chunked_builder));
       data += stride_;
     }
   }
 
-  std::shared_ptr<Array> result;
-  RETURN_NOT_OK(builder.Finish(&result));
-  return PushArray(result->data());
+  return PushChunks(&chunked_builder);
 }
 
 Status NumPyConverter::Visit(const StructType& type) {
@@ -61,6 +61,8 @@ Status GetConverter(const std::shared_ptr<DataType>& type, bool from_pandas,
 // Marshal Python sequence (list, tuple, etc.) to Arrow array
 class SeqConverter {
  public:
+  SeqConverter() : builder_(nullptr), chunked_builder_(nullptr) {}
+
   virtual ~SeqConverter() = default;
 
   // Initialize the sequence converter with an ArrayBuilder created
@@ -82,26 +84,38 @@ class SeqConverter {
   // virtual version
   virtual Status AppendMultipleMasked(PyObject* seq, PyObject* mask, int64_t size) = 0;
 
+  // Make this the top-level converter, whose builder is wrapped by the
+  // given ChunkedArrayBuilder. Values that do not fit in the builder then go
+  // to a new chunk
+  void set_chunked_builder(ChunkedArrayBuilder* chunked_builder) {
+    chunked_builder_ = chunked_builder;
+  }
+
   virtual Status GetResult(std::vector<std::shared_ptr<Array>>* chunks) {
-    *chunks = chunks_;
-
-    // Still some accumulated data in the builder. If there are no chunks, we
-    // always call Finish to deal with the edge case where a size-0 sequence
-    // was converted with a specific output type, like array([], type=t)
-    if (chunks_.size() == 0 || builder_->length() > 0) {
-      std::shared_ptr<Array> last_chunk;
-      RETURN_NOT_OK(builder_->Finish(&last_chunk));
-      chunks->emplace_back(std::move(last_chunk));
-    }
+    DCHECK_NE(chunked_builder_, nullptr);
+    // The ChunkedArrayBuilder always yields at least one chunk, to deal with
+    // the edge case where a size-0 sequence was converted with a specific
+    // output type, like array([], type=t)
+    std::shared_ptr<ChunkedArray> result;
+    RETURN_NOT_OK(chunked_builder_->Finish(&result));
+    *chunks = result->chunks();
     return Status::OK();
   }
 
   ArrayBuilder* builder() const { return builder_; }
 
  protected:
+  // Finish the current chunk because the builder is full
+  Status FinishChunk() {
+    if (ARROW_PREDICT_FALSE(chunked_builder_ == nullptr)) {
+      // The values of a child builder cannot be split across chunks
+      return Status::CapacityError("Nested binary data exceeds maximum size (2GB)");
+    }
+    return chunked_builder_->FinishChunk();
+  }
+
   ArrayBuilder* builder_;
-  bool unfinished_builder_;
-  std::vector<std::shared_ptr<Array>> chunks_;
+  ChunkedArrayBuilder* chunked_builder_;
 };
 
 enum class NullCoding : char { NONE_ONLY, PANDAS_SENTINELS };
@@ -433,9 +447,7 @@ class BinaryLikeConverter : public TypedConverter<Type, BinaryLikeConverter<Type
 
     // Exceeded capacity of builder
     if (ARROW_PREDICT_FALSE(is_full)) {
-      std::shared_ptr<Array> chunk;
-      RETURN_NOT_OK(this->typed_builder_->Finish(&chunk));
-      this->chunks_.emplace_back(std::move(chunk));
+      RETURN_NOT_OK(this->FinishChunk());
 
       // Append the item now that the builder has been reset
       return detail::BuilderAppend(this->typed_builder_, obj, &is_full);
@@ -488,9 +500,7 @@ class StringConverter : public TypedConverter<StringType, StringConverter<STRICT
 
     // Exceeded capacity of builder
     if (ARROW_PREDICT_FALSE(is_full)) {
-      std::shared_ptr<Array> chunk;
-      RETURN_NOT_OK(this->typed_builder_->Finish(&chunk));
-      this->chunks_.emplace_back(std::move(chunk));
+      RETURN_NOT_OK(this->FinishChunk());
 
       // Append the item now that the builder has been reset
       RETURN_NOT_OK(Append(obj, &is_full));
@@ -557,11 +567,6 @@ class ListConverter : public TypedConverter<ListType, ListConverter> {
     return value_converter_->AppendMultiple(obj, list_size);
   }
 
-  // virtual Status GetResult(std::vector<std::shared_ptr<Array>>* chunks) {
-  //   // TODO: Handle chunked children
-  //   return SeqConverter::GetResult(chunks);
-  // }
-
  protected:
   std::shared_ptr<DataType> value_type_;
   std::unique_ptr<SeqConverter> value_converter_;
@@ -945,7 +950,10 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
   // builders created by MakeBuilder)
   std::unique_ptr<ArrayBuilder> type_builder;
   RETURN_NOT_OK(MakeBuilder(options.pool, real_type, &type_builder));
-  RETURN_NOT_OK(converter->Init(type_builder.get()));
+  // Values beyond the capacity of one array are spread over several chunks
+  ChunkedArrayBuilder chunked_builder(std::move(type_builder));
+  RETURN_NOT_OK(converter->Init(chunked_builder.builder()));
+  converter->set_chunked_builder(&chunked_builder);
 
   // Convert values
   if (mask != nullptr && mask != Py_None) {
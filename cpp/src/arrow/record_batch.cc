@@ -223,6 +223,48 @@ std::shared_ptr<RecordBatch> RecordBatch::Slice(int64_t offset) const {
   return Slice(offset, this->num_rows() - offset);
 }
 
+// ----------------------------------------------------------------------
+// BatchView
+
+BatchView::BatchView(const RecordBatch& batch)
+    : batch_(&batch), offset_(0), length_(batch.num_rows()) {
+  auto columns = std::make_shared<std::vector<const ArrayData*>>(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    // The batch holds its column data, so the pointer remains valid after the
+    // returned reference is released
+    (*columns)[i] = batch.column_data(i).get();
+  }
+  columns_ = std::move(columns);
+}
+
+BatchView::BatchView(const RecordBatch& batch, int64_t offset, int64_t length)
+    : BatchView(batch) {
+  DCHECK_LE(offset, batch.num_rows());
+  offset_ = offset;
+  length_ = std::min(batch.num_rows() - offset, length);
+}
+
+BatchView BatchView::Slice(int64_t offset, int64_t length) const {
+  DCHECK_LE(offset, length_);
+  BatchView out;
+  out.batch_ = batch_;
+  out.columns_ = columns_;
+  out.offset_ = offset_ + offset;
+  out.length_ = std::min(length_ - offset, length);
+  return out;
+}
+
+ArraySpan BatchView::column(int i) const {
+  ArraySpan out(*(*columns_)[i]);
+  out.offset += offset_;
+  out.length = length_;
+  return out;
+}
+
+std::shared_ptr<RecordBatch> BatchView::ToRecordBatch() const {
+  return batch_->Slice(offset_, length_);
+}
+
 Status RecordBatch::Validate() const {
   for (int i = 0; i < num_columns(); ++i) {
     auto arr_shared = this->column_data(i);
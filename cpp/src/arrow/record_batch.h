@@ -92,6 +92,11 @@ class ARROW_EXPORT RecordBatch {
   virtual std::shared_ptr<Array> column(int i) const = 0;
 
   /// \brief Retrieve an array's internaldata from the record batch
+  ///
+  /// Implementations must hold the data of their columns for their own
+  /// lifetime, so that the ArrayData remains valid as long as the batch even
+  /// once the returned pointer is released (BatchView relies on this).
+  ///
   /// \param[in] i field index, does not boundscheck
   /// \return an internal ArrayData object
   virtual std::shared_ptr<ArrayData> column_data(int i) const = 0;
@@ -162,6 +167,69 @@ class ARROW_EXPORT RecordBatch {
   ARROW_DISALLOW_COPY_AND_ASSIGN(RecordBatch);
 };
 
+/// \class BatchView
+/// \brief A non-owning view of a range of rows of a RecordBatch
+///
+/// RecordBatch::Slice allocates a new batch with a new ArrayData for every
+/// column. A BatchView is a pointer to the batch and a row range, and its
+/// columns are ArraySpans into the batch's own column data, so a wide batch
+/// can be cut into many small windows without allocating. The batch must
+/// outlive its views; use ToRecordBatch to get an owning batch.
+///
+/// Constructing a view over a batch gathers raw pointers to the ArrayData of
+/// its columns once. Views obtained with Slice share them, so creating the
+/// windows of a batch by slicing one view costs no allocation or per-column
+/// virtual call.
+class ARROW_EXPORT BatchView {
+ public:
+  BatchView() : batch_(NULLPTR), offset_(0), length_(0) {}
+
+  /// \brief View all rows of the batch
+  explicit BatchView(const RecordBatch& batch);
+
+  /// \brief View a range of rows of the batch
+  ///
+  /// \param[in] batch the batch to view
+  /// \param[in] offset the first row
+  /// \param[in] length the number of rows, truncated to the end of the batch
+  BatchView(const RecordBatch& batch, int64_t offset, int64_t length);
+
+  /// \brief Narrow the view, offset being relative to the start of the view
+  BatchView Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Narrow the view from offset to the end of the view
+  BatchView Slice(int64_t offset) const { return Slice(offset, length_ - offset); }
+
+  /// \return the viewed batch
+  const RecordBatch& batch() const { return *batch_; }
+
+  std::shared_ptr<Schema> schema() const { return batch_->schema(); }
+
+  int num_columns() const { return batch_->num_columns(); }
+
+  /// \return the first viewed row of the batch
+  int64_t offset() const { return offset_; }
+
+  /// \return the number of viewed rows
+  int64_t num_rows() const { return length_; }
+
+  /// \brief Retrieve a view of a column over the viewed rows
+  /// \param[in] i field index, does not boundscheck
+  ArraySpan column(int i) const;
+
+  /// \brief Slice the viewed batch, as RecordBatch::Slice would
+  std::shared_ptr<RecordBatch> ToRecordBatch() const;
+
+ private:
+  const RecordBatch* batch_;
+
+  // The data of each column, owned by the batch
+  std::shared_ptr<const std::vector<const ArrayData*>> columns_;
+
+  int64_t offset_;
+  int64_t length_;
+};
+
 /// \brief Abstract interface for reading stream of record batches
 class ARROW_EXPORT RecordBatchReader {
  public:
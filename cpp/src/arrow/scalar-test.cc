@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+template <typename T>
+class TestNumericScalar : public ::testing::Test {};
+
+typedef ::testing::Types<UInt8Type, Int8Type, UInt16Type, Int16Type, UInt32Type,
+                         Int32Type, UInt64Type, Int64Type, FloatType, DoubleType,
+                         Date32Type, Date64Type>
+    NumericScalarTypes;
+
+TYPED_TEST_CASE(TestNumericScalar, NumericScalarTypes);
+
+TYPED_TEST(TestNumericScalar, Basics) {
+  using T = typename TypeParam::c_type;
+  using ScalarType = NumericScalar<TypeParam>;
+
+  ScalarType scalar(static_cast<T>(3));
+  ASSERT_TRUE(scalar.is_valid);
+  ASSERT_EQ(static_cast<T>(3), scalar.value);
+  ASSERT_TRUE(scalar.type->Equals(*TypeTraits<TypeParam>::type_singleton()));
+
+  ScalarType same(static_cast<T>(3));
+  ScalarType other(static_cast<T>(4));
+  ScalarType null(static_cast<T>(3), false);
+  ASSERT_TRUE(scalar.Equals(same));
+  ASSERT_FALSE(scalar.Equals(other));
+  ASSERT_FALSE(scalar.Equals(null));
+}
+
+TEST(TestScalar, ParametricTypes) {
+  TimestampScalar ts(1000, timestamp(TimeUnit::MILLI));
+  TimestampScalar ts_same(1000, timestamp(TimeUnit::MILLI));
+  TimestampScalar ts_other_unit(1000, timestamp(TimeUnit::SECOND));
+  ASSERT_TRUE(ts.Equals(ts_same));
+  ASSERT_FALSE(ts.Equals(ts_other_unit));
+
+  Time32Scalar t32(5, time32(TimeUnit::SECOND));
+  ASSERT_EQ(5, t32.value);
+  ASSERT_EQ(Type::TIME32, t32.type->id());
+}
+
+TEST(TestScalar, BooleanAndBinary) {
+  BooleanScalar t(true);
+  BooleanScalar f(false);
+  ASSERT_TRUE(t.Equals(BooleanScalar(true)));
+  ASSERT_FALSE(t.Equals(f));
+
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK(Buffer::FromString("foo", &buf));
+  StringScalar str(buf);
+  BinaryScalar bin(buf);
+  ASSERT_TRUE(str.type->Equals(*utf8()));
+  ASSERT_TRUE(bin.type->Equals(*binary()));
+  ASSERT_FALSE(str.Equals(bin));
+
+  std::shared_ptr<Buffer> buf2;
+  ASSERT_OK(Buffer::FromString("foo", &buf2));
+  ASSERT_TRUE(str.Equals(StringScalar(buf2)));
+}
+
+TEST(TestScalar, MakeNullScalar) {
+  std::shared_ptr<Scalar> scalar;
+  ASSERT_OK(MakeNullScalar(int32(), &scalar));
+  ASSERT_FALSE(scalar->is_valid);
+  ASSERT_TRUE(scalar->Equals(Int32Scalar(7, false)));
+
+  ASSERT_OK(MakeNullScalar(timestamp(TimeUnit::NANO), &scalar));
+  ASSERT_FALSE(scalar->is_valid);
+  ASSERT_TRUE(scalar->type->Equals(*timestamp(TimeUnit::NANO)));
+
+  ASSERT_OK(MakeNullScalar(utf8(), &scalar));
+  ASSERT_FALSE(scalar->is_valid);
+
+  ASSERT_OK(MakeNullScalar(null(), &scalar));
+  ASSERT_FALSE(scalar->is_valid);
+
+  ASSERT_RAISES(NotImplemented, MakeNullScalar(list(int32()), &scalar));
+}
+
+}  // namespace arrow
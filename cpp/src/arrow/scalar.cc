@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/scalar.h"
+
+#include <memory>
+#include <sstream>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+namespace {
+
+template <typename ScalarType>
+bool ValuesEqual(const Scalar& left, const Scalar& right) {
+  return checked_cast<const ScalarType&>(left).value ==
+         checked_cast<const ScalarType&>(right).value;
+}
+
+bool BinaryValuesEqual(const Scalar& left, const Scalar& right) {
+  const auto& left_value = checked_cast<const BinaryScalar&>(left).value;
+  const auto& right_value = checked_cast<const BinaryScalar&>(right).value;
+  if (left_value == nullptr || right_value == nullptr) {
+    return left_value == right_value;
+  }
+  return left_value->Equals(*right_value);
+}
+
+}  // namespace
+
+#define NUMERIC_SCALAR_CASES(FN) \
+  FN(UInt8Type);                 \
+  FN(Int8Type);                  \
+  FN(UInt16Type);                \
+  FN(Int16Type);                 \
+  FN(UInt32Type);                \
+  FN(Int32Type);                 \
+  FN(UInt64Type);                \
+  FN(Int64Type);                 \
+  FN(HalfFloatType);             \
+  FN(FloatType);                 \
+  FN(DoubleType);                \
+  FN(Date32Type);                \
+  FN(Date64Type);                \
+  FN(Time32Type);                \
+  FN(Time64Type);                \
+  FN(TimestampType)
+
+bool Scalar::Equals(const Scalar& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (!type->Equals(*other.type) || is_valid != other.is_valid) {
+    return false;
+  }
+  if (!is_valid) {
+    // Two nulls of the same type are equal
+    return true;
+  }
+
+#define EQUALS_CASE(TYPE) \
+  case TYPE::type_id:     \
+    return ValuesEqual<NumericScalar<TYPE>>(*this, other)
+
+  switch (type->id()) {
+    case Type::NA:
+      return true;
+    case Type::BOOL:
+      return ValuesEqual<BooleanScalar>(*this, other);
+    NUMERIC_SCALAR_CASES(EQUALS_CASE);
+    case Type::BINARY:
+    case Type::STRING:
+      return BinaryValuesEqual(*this, other);
+    default:
+      DCHECK(false) << "Scalar comparison not implemented for " << type->ToString();
+      return false;
+  }
+
+#undef EQUALS_CASE
+}
+
+Status MakeNullScalar(const std::shared_ptr<DataType>& type,
+                      std::shared_ptr<Scalar>* out) {
+#define NULL_SCALAR_CASE(TYPE)                                    \
+  case TYPE::type_id:                                             \
+    *out = std::make_shared<NumericScalar<TYPE>>(0, type, false); \
+    break
+
+  switch (type->id()) {
+    case Type::NA:
+      *out = std::make_shared<NullScalar>();
+      break;
+    case Type::BOOL:
+      *out = std::make_shared<BooleanScalar>(false, false);
+      break;
+    NUMERIC_SCALAR_CASES(NULL_SCALAR_CASE);
+    case Type::BINARY:
+      *out = std::make_shared<BinaryScalar>(nullptr, false);
+      break;
+    case Type::STRING:
+      *out = std::make_shared<StringScalar>(nullptr, false);
+      break;
+    default: {
+      std::stringstream ss;
+      ss << "Null scalar not implemented for " << type->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+
+#undef NULL_SCALAR_CASE
+  return Status::OK();
+}
+
+#undef NUMERIC_SCALAR_CASES
+
+}  // namespace arrow
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Object model for scalar (non-Array) values. Not intended for use with large
+// amounts of data
+
+#ifndef ARROW_SCALAR_H
+#define ARROW_SCALAR_H
+
+#include <memory>
+
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+/// \brief Base class for scalar values, representing a single value occupying
+/// an array "slot"
+struct ARROW_EXPORT Scalar {
+  virtual ~Scalar() = default;
+
+  /// \brief The type of the scalar value
+  std::shared_ptr<DataType> type;
+
+  /// \brief Whether the value is valid (not null) or not
+  bool is_valid;
+
+  /// \brief Return true if the scalars have the same type and value
+  bool Equals(const Scalar& other) const;
+
+ protected:
+  Scalar(const std::shared_ptr<DataType>& type, bool is_valid)
+      : type(type), is_valid(is_valid) {}
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Scalar);
+};
+
+/// \brief A scalar value for NullType. Never valid
+struct ARROW_EXPORT NullScalar : public Scalar {
+  NullScalar() : Scalar(null(), false) {}
+};
+
+struct ARROW_EXPORT BooleanScalar : public Scalar {
+  bool value;
+
+  explicit BooleanScalar(bool value, bool is_valid = true)
+      : Scalar(boolean(), is_valid), value(value) {}
+};
+
+/// \brief A scalar value for fixed-width numeric and temporal types, whose
+/// value is stored in the type's physical C type
+template <typename Type>
+struct NumericScalar : public Scalar {
+  using TypeClass = Type;
+  using c_type = typename Type::c_type;
+
+  c_type value;
+
+  /// \brief Construct a scalar for a parametric type such as timestamp
+  NumericScalar(c_type value, const std::shared_ptr<DataType>& type,
+                bool is_valid = true)
+      : Scalar(type, is_valid), value(value) {}
+
+  /// \brief Construct a scalar for a type with a singleton instance
+  explicit NumericScalar(c_type value, bool is_valid = true)
+      : NumericScalar(value, TypeTraits<Type>::type_singleton(), is_valid) {}
+};
+
+using UInt8Scalar = NumericScalar<UInt8Type>;
+using Int8Scalar = NumericScalar<Int8Type>;
+using UInt16Scalar = NumericScalar<UInt16Type>;
+using Int16Scalar = NumericScalar<Int16Type>;
+using UInt32Scalar = NumericScalar<UInt32Type>;
+using Int32Scalar = NumericScalar<Int32Type>;
+using UInt64Scalar = NumericScalar<UInt64Type>;
+using Int64Scalar = NumericScalar<Int64Type>;
+using HalfFloatScalar = NumericScalar<HalfFloatType>;
+using FloatScalar = NumericScalar<FloatType>;
+using DoubleScalar = NumericScalar<DoubleType>;
+
+using Date32Scalar = NumericScalar<Date32Type>;
+using Date64Scalar = NumericScalar<Date64Type>;
+using Time32Scalar = NumericScalar<Time32Type>;
+using Time64Scalar = NumericScalar<Time64Type>;
+using TimestampScalar = NumericScalar<TimestampType>;
+
+/// \brief A scalar value for variable-size binary data. The value buffer may
+/// be a slice of a larger buffer
+struct ARROW_EXPORT BinaryScalar : public Scalar {
+  std::shared_ptr<Buffer> value;
+
+  explicit BinaryScalar(const std::shared_ptr<Buffer>& value, bool is_valid = true)
+      : BinaryScalar(value, binary(), is_valid) {}
+
+ protected:
+  BinaryScalar(const std::shared_ptr<Buffer>& value,
+               const std::shared_ptr<DataType>& type, bool is_valid = true)
+      : Scalar(type, is_valid), value(value) {}
+};
+
+struct ARROW_EXPORT StringScalar : public BinaryScalar {
+  explicit StringScalar(const std::shared_ptr<Buffer>& value, bool is_valid = true)
+      : BinaryScalar(value, utf8(), is_valid) {}
+};
+
+/// \brief Create a null scalar of the given type
+///
+/// \param[in] type the scalar type
+/// \param[out] out the resulting scalar
+/// \return Status
+ARROW_EXPORT
+Status MakeNullScalar(const std::shared_ptr<DataType>& type,
+                      std::shared_ptr<Scalar>* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_SCALAR_H
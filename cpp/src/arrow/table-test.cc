@@ -639,6 +639,40 @@ TEST_F(TestRecordBatch, Slice) {
   }
 }
 
+TEST_F(TestRecordBatch, BatchView) {
+  const int length = 10;
+
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", uint8())});
+  auto a0 = MakeRandomArray<Int32Array>(length);
+  auto a1 = MakeRandomArray<UInt8Array>(length)->Slice(3, length - 3);
+  auto batch = RecordBatch::Make(schema, length - 3, {a0->Slice(2, length - 3), a1});
+
+  BatchView view(*batch);
+  ASSERT_EQ(batch->num_rows(), view.num_rows());
+  ASSERT_EQ(2, view.num_columns());
+  ASSERT_TRUE(view.schema()->Equals(*schema));
+
+  BatchView window = view.Slice(1, 5).Slice(2);
+  ASSERT_EQ(3, window.offset());
+  ASSERT_EQ(3, window.num_rows());
+  ASSERT_EQ(5, window.column(0).offset);
+  ASSERT_EQ(6, window.column(1).offset);
+
+  // Windows match RecordBatch::Slice, including a truncated last one
+  for (int64_t offset = 0; offset < view.num_rows(); offset += 3) {
+    auto expected = batch->Slice(offset, 3);
+    BatchView actual(*batch, offset, 3);
+    ASSERT_EQ(expected->num_rows(), actual.num_rows());
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      ArraySpan column = actual.column(i);
+      ASSERT_EQ(batch->column_data(i).get(), column.data);
+      ASSERT_EQ(expected->num_rows(), column.length);
+      AssertArraysEqual(*expected->column(i), *column.ToArray());
+    }
+    ASSERT_TRUE(expected->Equals(*actual.ToRecordBatch()));
+  }
+}
+
 TEST_F(TestRecordBatch, AddColumn) {
   const int length = 10;
 
@@ -286,6 +286,17 @@ TEST(TestStringType, ToString) {
   ASSERT_EQ(str.ToString(), std::string("string"));
 }
 
+TEST(TestLargeBinaryType, ToString) {
+  ASSERT_EQ(Type::LARGE_BINARY, large_binary()->id());
+  ASSERT_EQ(Type::LARGE_STRING, large_utf8()->id());
+  ASSERT_EQ("large_binary", large_binary()->ToString());
+  ASSERT_EQ("large_string", large_utf8()->ToString());
+  ASSERT_TRUE(large_utf8()->Equals(LargeStringType()));
+  ASSERT_FALSE(large_utf8()->Equals(large_binary()));
+  ASSERT_FALSE(large_utf8()->Equals(utf8()));
+  ASSERT_FALSE(large_binary()->Equals(binary()));
+}
+
 TEST(TestFixedSizeBinaryType, ToString) {
   auto t = fixed_size_binary(10);
   ASSERT_EQ(t->id(), Type::FIXED_SIZE_BINARY);
@@ -322,6 +333,16 @@ TEST(TestListType, Basics) {
   ASSERT_EQ("list<item: list<item: string>>", lt2.ToString());
 }
 
+TEST(TestLargeListType, Basics) {
+  auto type = large_list(utf8());
+  ASSERT_EQ(Type::LARGE_LIST, type->id());
+  ASSERT_EQ("large_list<item: string>", type->ToString());
+  ASSERT_TRUE(checked_cast<const LargeListType&>(*type).value_type()->Equals(utf8()));
+  ASSERT_TRUE(type->Equals(large_list(utf8())));
+  ASSERT_FALSE(type->Equals(large_list(binary())));
+  ASSERT_FALSE(type->Equals(list(utf8())));
+}
+
 TEST(TestDateTypes, Attrs) {
   auto t1 = date32();
   auto t2 = date64();
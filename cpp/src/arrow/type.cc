@@ -121,6 +121,16 @@ std::string ListType::ToString() const {
 
 std::string BinaryType::ToString() const { return std::string("binary"); }
 
+std::string LargeStringType::ToString() const { return std::string("large_string"); }
+
+std::string LargeListType::ToString() const {
+  std::stringstream s;
+  s << "large_list<" << value_field()->ToString() << ">";
+  return s.str();
+}
+
+std::string LargeBinaryType::ToString() const { return std::string("large_binary"); }
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 std::string FixedSizeBinaryType::ToString() const {
@@ -422,6 +432,9 @@ ACCEPT_VISITOR(BinaryType);
 ACCEPT_VISITOR(FixedSizeBinaryType);
 ACCEPT_VISITOR(StringType);
 ACCEPT_VISITOR(ListType);
+ACCEPT_VISITOR(LargeBinaryType);
+ACCEPT_VISITOR(LargeStringType);
+ACCEPT_VISITOR(LargeListType);
 ACCEPT_VISITOR(StructType);
 ACCEPT_VISITOR(Decimal128Type);
 ACCEPT_VISITOR(UnionType);
@@ -454,6 +467,8 @@ TYPE_FACTORY(float32, FloatType);
 TYPE_FACTORY(float64, DoubleType);
 TYPE_FACTORY(utf8, StringType);
 TYPE_FACTORY(binary, BinaryType);
+TYPE_FACTORY(large_utf8, LargeStringType);
+TYPE_FACTORY(large_binary, LargeBinaryType);
 TYPE_FACTORY(date64, Date64Type);
 TYPE_FACTORY(date32, Date32Type);
 
@@ -485,6 +500,14 @@ std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_field) {
   return std::make_shared<ListType>(value_field);
 }
 
+std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type) {
+  return std::make_shared<LargeListType>(value_type);
+}
+
+std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_field) {
+  return std::make_shared<LargeListType>(value_field);
+}
+
 std::shared_ptr<DataType> struct_(const std::vector<std::shared_ptr<Field>>& fields) {
   return std::make_shared<StructType>(fields);
 }
@@ -130,7 +130,16 @@ struct Type {
     DICTIONARY,
 
     /// Map, a repeated struct logical type
-    MAP
+    MAP,
+
+    /// UTF8 variable-length string, with 64-bit offsets
+    LARGE_STRING,
+
+    /// Variable-length bytes, with 64-bit offsets
+    LARGE_BINARY,
+
+    /// A list of some logical data type, with 64-bit offsets
+    LARGE_LIST
   };
 };
 
@@ -387,6 +396,7 @@ class ARROW_EXPORT DoubleType
 class ARROW_EXPORT ListType : public NestedType {
  public:
   static constexpr Type::type type_id = Type::LIST;
+  using offset_type = int32_t;
 
   // List can contain any other logical value type
   explicit ListType(const std::shared_ptr<DataType>& value_type)
@@ -406,6 +416,31 @@ class ARROW_EXPORT ListType : public NestedType {
   std::string name() const override { return "list"; }
 };
 
+/// \brief Like ListType, but with 64-bit offsets, for lists of more than
+/// 2^31 - 1 child values in total
+class ARROW_EXPORT LargeListType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_LIST;
+  using offset_type = int64_t;
+
+  explicit LargeListType(const std::shared_ptr<DataType>& value_type)
+      : LargeListType(std::make_shared<Field>("item", value_type)) {}
+
+  explicit LargeListType(const std::shared_ptr<Field>& value_field)
+      : NestedType(Type::LARGE_LIST) {
+    children_ = {value_field};
+  }
+
+  std::shared_ptr<Field> value_field() const { return children_[0]; }
+
+  std::shared_ptr<DataType> value_type() const { return children_[0]->type(); }
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+
+  std::string name() const override { return "large_list"; }
+};
+
 namespace meta {
 
 /// Additional ListType class that can be instantiated with only compile-time arguments.
@@ -423,6 +458,7 @@ class ARROW_EXPORT ListType : public ::arrow::ListType {
 class ARROW_EXPORT BinaryType : public DataType, public NoExtraMeta {
  public:
   static constexpr Type::type type_id = Type::BINARY;
+  using offset_type = int32_t;
 
   BinaryType() : BinaryType(Type::BINARY) {}
 
@@ -468,6 +504,36 @@ class ARROW_EXPORT StringType : public BinaryType {
   std::string name() const override { return "utf8"; }
 };
 
+/// \brief Like BinaryType, but with 64-bit offsets, for more than 2^31 - 1
+/// bytes of data in an array
+class ARROW_EXPORT LargeBinaryType : public DataType, public NoExtraMeta {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_BINARY;
+  using offset_type = int64_t;
+
+  LargeBinaryType() : LargeBinaryType(Type::LARGE_BINARY) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "large_binary"; }
+
+ protected:
+  // Allow subclasses to change the logical type.
+  explicit LargeBinaryType(Type::type logical_type) : DataType(logical_type) {}
+};
+
+/// \brief Like StringType, but with 64-bit offsets
+class ARROW_EXPORT LargeStringType : public LargeBinaryType {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_STRING;
+
+  LargeStringType() : LargeBinaryType(Type::LARGE_STRING) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "large_utf8"; }
+};
+
 class ARROW_EXPORT StructType : public NestedType {
  public:
   static constexpr Type::type type_id = Type::STRUCT;
@@ -823,6 +889,14 @@ std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_type);
 ARROW_EXPORT
 std::shared_ptr<DataType> list(const std::shared_ptr<DataType>& value_type);
 
+/// \brief Make an instance of LargeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_type);
+
+/// \brief Make an instance of LargeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type);
+
 /// \brief Make an instance of TimestampType
 ARROW_EXPORT
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit);
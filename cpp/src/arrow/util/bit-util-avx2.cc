@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compiled with -mavx2
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// Count the bits set 32 bytes at a time: the count of each nibble is looked
+// up with a byte shuffle, and the byte counts are summed into 64-bit lanes.
+int64_t CountSetBitsAvx2(const uint64_t* words, int64_t num_words) {
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                          0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0F);
+  const __m256i zero = _mm256_setzero_si256();
+
+  const int64_t num_blocks = num_words / 4;
+  __m256i total = zero;
+  int64_t block = 0;
+  while (block < num_blocks) {
+    // The byte counts reach at most 8 per block, so can add up 31 blocks
+    const int64_t end = std::min<int64_t>(num_blocks, block + 31);
+    __m256i counts = zero;
+    for (; block < end; ++block) {
+      const __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + block * 4));
+      const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low_mask));
+      const __m256i high = _mm256_shuffle_epi8(
+          lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+      counts = _mm256_add_epi8(counts, _mm256_add_epi8(low, high));
+    }
+    total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, zero));
+  }
+
+  int64_t count = _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+                  _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+  for (int64_t i = num_blocks * 4; i < num_words; ++i) {
+    count += __builtin_popcountll(words[i]);
+  }
+  return count;
+}
+
+}  // namespace internal
+}  // namespace arrow
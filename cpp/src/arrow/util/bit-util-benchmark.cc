@@ -24,6 +24,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/test-util.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/cpu-info.h"
 
 namespace arrow {
 namespace BitUtil {
@@ -228,6 +229,115 @@ static void BM_CopyBitmap(benchmark::State& state) {  // NOLINT non-const refere
   state.SetBytesProcessed(state.iterations() * kBufferSize * sizeof(int8_t));
 }
 
+// Sum the valid values of an array, testing one validity bit per value
+static void BM_SumValidReader(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  std::vector<bool> is_valid;
+  random_is_valid(length, static_cast<double>(state.range(1)) / 100, &is_valid);
+  std::shared_ptr<Buffer> bitmap;
+  ABORT_NOT_OK(GetBitmapFromVector(is_valid, &bitmap));
+  std::vector<int64_t> values;
+  randint<int64_t>(length, 0, 1000, &values);
+
+  while (state.KeepRunning()) {
+    internal::BitmapReader reader(bitmap->data(), 0, length);
+    int64_t total = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      if (reader.IsSet()) {
+        total += values[i];
+      }
+      reader.Next();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+// Sum the valid values of an array, densely in blocks with no nulls
+static void BM_SumValidBitBlocks(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  std::vector<bool> is_valid;
+  random_is_valid(length, static_cast<double>(state.range(1)) / 100, &is_valid);
+  std::shared_ptr<Buffer> bitmap;
+  ABORT_NOT_OK(GetBitmapFromVector(is_valid, &bitmap));
+  std::vector<int64_t> values;
+  randint<int64_t>(length, 0, 1000, &values);
+
+  while (state.KeepRunning()) {
+    int64_t total = 0;
+    internal::VisitBitBlocks(bitmap->data(), 0, length,
+                             [&](int64_t i) { total += values[i]; }, [](int64_t) {});
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void BM_CountSetBits(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(nbytes);
+
+  CpuInfo::Init();
+  const bool avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  if (state.range(1) != 0 && !avx2) {
+    state.SkipWithError("AVX2 not supported");
+    return;
+  }
+  CpuInfo::EnableFeature(CpuInfo::AVX2, state.range(1) != 0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(CountSetBits(buffer->data(), 0, nbytes * 8));
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+
+  CpuInfo::EnableFeature(CpuInfo::AVX2, avx2);
+}
+
+static void BM_BitmapAnd(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  std::shared_ptr<Buffer> left = CreateRandomBuffer(nbytes);
+  std::shared_ptr<Buffer> right = CreateRandomBuffer(nbytes);
+  const int64_t offset = state.range(1);
+  const int64_t length = (nbytes - 1) * 8;
+
+  std::shared_ptr<Buffer> out;
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(BitmapAnd(default_memory_pool(), left->data(), 0, right->data(), offset,
+                           length, 0, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+}
+
+// First argument: number of values; second: percentage of nulls
+BENCHMARK(BM_SumValidReader)
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->Args({100000, 50})
+    ->Args({100000, 99})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_SumValidBitBlocks)
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->Args({100000, 50})
+    ->Args({100000, 99})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// First argument: number of bytes; second: without or with AVX2
+BENCHMARK(BM_CountSetBits)
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// First argument: number of bytes; second: bit offset of the right bitmap
+BENCHMARK(BM_BitmapAnd)
+    ->Args({100000, 0})
+    ->Args({100000, 3})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK(BM_CopyBitmap)
     ->Args({100000, 0})
     ->Args({1000000, 0})
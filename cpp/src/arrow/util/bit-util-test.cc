@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <climits>
 #include <cstdint>
 #include <cstring>
@@ -464,6 +465,25 @@ TEST_F(BitmapOp, XorAligned) {
   TestUnaligned(op, left, right, result);
 }
 
+// Long enough for the bitmaps to be combined a word at a time
+TEST_F(BitmapOp, LongUnaligned) {
+  std::vector<bool> left_valid, right_valid;
+  random_is_valid(300, 0.5, &left_valid);
+  random_is_valid(300, 0.5, &right_valid);
+  std::vector<int> left(left_valid.begin(), left_valid.end());
+  std::vector<int> right(right_valid.begin(), right_valid.end());
+  std::vector<int> and_result, or_result, xor_result;
+  for (size_t i = 0; i < left.size(); ++i) {
+    and_result.push_back(left[i] & right[i]);
+    or_result.push_back(left[i] | right[i]);
+    xor_result.push_back(left[i] ^ right[i]);
+  }
+
+  TestUnaligned(BitmapAndOp(), left, right, and_result);
+  TestUnaligned(BitmapOrOp(), left, right, or_result);
+  TestUnaligned(BitmapXorOp(), left, right, xor_result);
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -493,6 +513,124 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestCountSetBitsScalar) {
+  CpuInfo::Init();
+  const bool avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  CpuInfo::EnableFeature(CpuInfo::AVX2, false);
+
+  const int kBufferSize = 1000;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+  for (int64_t offset : {0, 37}) {
+    ASSERT_EQ(SlowCountBits(buffer, offset, kBufferSize * 8 - offset),
+              CountSetBits(buffer, offset, kBufferSize * 8 - offset));
+  }
+
+  CpuInfo::EnableFeature(CpuInfo::AVX2, avx2);
+}
+
+TEST(BitUtilTests, TestBitmapEquals) {
+  const int kBufferSize = 100;
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateBuffer(kBufferSize, &buffer));
+  random_bytes(kBufferSize, 0, buffer->mutable_data());
+  const uint8_t* src = buffer->data();
+
+  for (int64_t length : {0, 1, 63, 64, 65, 300}) {
+    for (int64_t offset : {0, 3, 8, 37, 64}) {
+      for (int64_t other_offset : {0, 5, 8, 64}) {
+        std::vector<uint8_t> other(kBufferSize + 8, 0);
+        CopyBitmap(src, offset, length, other.data(), other_offset);
+        ASSERT_TRUE(BitmapEquals(src, offset, other.data(), other_offset, length));
+        if (length > 0) {
+          // Differing in the last bit
+          const int64_t last = other_offset + length - 1;
+          if (BitUtil::GetBit(other.data(), last)) {
+            BitUtil::ClearBit(other.data(), last);
+          } else {
+            BitUtil::SetBit(other.data(), last);
+          }
+          ASSERT_FALSE(BitmapEquals(src, offset, other.data(), other_offset, length));
+        }
+      }
+    }
+  }
+}
+
+TEST(BitBlockCounter, NextWord) {
+  const int kBufferSize = 100;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+  // All bits set then none set, from bit 256
+  memset(buffer + 32, 0xFF, 16);
+  memset(buffer + 48, 0x00, 16);
+
+  for (int64_t offset : {0, 3, 64, 256}) {
+    for (int64_t length : {0, 10, 64, 200, 500}) {
+      internal::BitBlockCounter counter(buffer, offset, length);
+      int64_t position = 0;
+      while (position < length) {
+        const internal::BitBlockCount block = counter.NextWord();
+        ASSERT_EQ(std::min<int64_t>(64, length - position), block.length);
+        ASSERT_EQ(SlowCountBits(buffer, offset + position, block.length),
+                  block.popcount);
+        position += block.length;
+      }
+      ASSERT_EQ(0, counter.NextWord().length);
+    }
+  }
+
+  internal::BitBlockCounter counter(buffer, 256, 192);
+  ASSERT_TRUE(counter.NextWord().AllSet());
+  ASSERT_TRUE(counter.NextWord().AllSet());
+  const internal::BitBlockCount none_set = counter.NextWord();
+  ASSERT_TRUE(none_set.NoneSet());
+  ASSERT_FALSE(none_set.AllSet());
+
+  // Without a bitmap, all bits are set
+  internal::BitBlockCounter no_bitmap(nullptr, 5, 100);
+  ASSERT_TRUE(no_bitmap.NextWord().AllSet());
+  const internal::BitBlockCount last = no_bitmap.NextWord();
+  ASSERT_EQ(36, last.length);
+  ASSERT_TRUE(last.AllSet());
+}
+
+TEST(BitBlockCounter, VisitBitBlocks) {
+  const int kBufferSize = 100;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+  memset(buffer + 32, 0xFF, 16);
+  memset(buffer + 48, 0x00, 16);
+
+  for (int64_t offset : {0, 3, 250}) {
+    const int64_t length = 500;
+    std::vector<int> visited(length, -1);
+    internal::VisitBitBlocks(buffer, offset, length,
+                             [&](int64_t i) { visited[i] = 1; },
+                             [&](int64_t i) { visited[i] = 0; });
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_EQ(BitUtil::GetBit(buffer, offset + i), visited[i] == 1) << i;
+      ASSERT_NE(-1, visited[i]);
+    }
+  }
+}
+
+TEST(BitUtilTests, ReadBitmapWord) {
+  const int kBufferSize = 20;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+
+  for (int64_t offset : {0, 3, 8, 61}) {
+    for (int64_t length : {0, 1, 37, 63, 64}) {
+      const uint64_t word = internal::ReadBitmapWord(buffer, offset, length);
+      for (int64_t i = 0; i < 64; ++i) {
+        const bool expected = i < length && BitUtil::GetBit(buffer, offset + i);
+        ASSERT_EQ(expected, ((word >> i) & 1) != 0) << offset << " " << length;
+      }
+    }
+  }
+}
+
 TEST(BitUtilTests, TestCopyBitmap) {
   const int kBufferSize = 1000;
 
@@ -519,6 +657,36 @@ TEST(BitUtilTests, TestCopyBitmap) {
   }
 }
 
+TEST(BitUtilTests, TestCopyBitmapInPlace) {
+  const int kBufferSize = 100;
+
+  std::shared_ptr<Buffer> buffer, dest;
+  ASSERT_OK(AllocateBuffer(kBufferSize, &buffer));
+  random_bytes(kBufferSize, 0, buffer->mutable_data());
+  ASSERT_OK(AllocateBuffer(kBufferSize, &dest));
+  random_bytes(kBufferSize, 1, dest->mutable_data());
+
+  const uint8_t* src = buffer->data();
+  std::vector<int64_t> lengths = {0, 1, 63, 64, 65, 300};
+  std::vector<int64_t> offsets = {0, 3, 8, 37, 64};
+  for (int64_t length : lengths) {
+    for (int64_t offset : offsets) {
+      for (int64_t dest_offset : offsets) {
+        std::vector<uint8_t> copy(dest->data(), dest->data() + kBufferSize);
+        CopyBitmap(src, offset, length, copy.data(), dest_offset);
+
+        // Bits outside of the copied range are kept
+        for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+          const bool expected = (i >= dest_offset && i < dest_offset + length)
+                                    ? BitUtil::GetBit(src, i - dest_offset + offset)
+                                    : BitUtil::GetBit(dest->data(), i);
+          ASSERT_EQ(expected, BitUtil::GetBit(copy.data(), i)) << i;
+        }
+      }
+    }
+  }
+}
+
 TEST(BitUtil, CeilDiv) {
   EXPECT_EQ(BitUtil::CeilDiv(0, 1), 0);
   EXPECT_EQ(BitUtil::CeilDiv(1, 1), 1);
@@ -642,6 +810,16 @@ TEST(BitUtil, CountLeadingZeros) {
   EXPECT_EQ(BitUtil::CountLeadingZeros(U64(ULLONG_MAX)), 0);
 }
 
+TEST(BitUtil, CountTrailingZeros) {
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(0)), 64);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(1)), 0);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(2)), 1);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(12)), 2);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(UINT_MAX) + 1), 32);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(ULLONG_MAX / 2 + 1)), 63);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U64(ULLONG_MAX)), 0);
+}
+
 #undef U32
 #undef U64
 
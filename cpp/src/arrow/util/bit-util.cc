@@ -32,10 +32,20 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 
+#ifdef ARROW_HAVE_AVX2
+namespace internal {
+
+// Defined in bit-util-avx2.cc, which is compiled with AVX2 enabled
+int64_t CountSetBitsAvx2(const uint64_t* words, int64_t num_words);
+
+}  // namespace internal
+#endif
+
 namespace BitUtil {
 
 namespace {
@@ -91,7 +101,20 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   const uint64_t* end = u64_data + fast_counts;
 
   // popcount as much as possible with the widest possible count
-  for (auto iter = u64_data; iter < end; ++iter) {
+  auto iter = u64_data;
+#ifdef ARROW_HAVE_AVX2
+  // Worth it from a few hundred bits
+  if (fast_counts >= 8) {
+    if (!CpuInfo::initialized()) {
+      CpuInfo::Init();
+    }
+    if (CpuInfo::IsSupported(CpuInfo::AVX2)) {
+      count += internal::CountSetBitsAvx2(u64_data, fast_counts);
+      iter = end;
+    }
+  }
+#endif
+  for (; iter < end; ++iter) {
     count += __builtin_popcountll(*iter);
   }
 
@@ -163,6 +186,85 @@ Status CopyBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset, int64_t
   return TransferBitmap<false>(pool, data, offset, length, out);
 }
 
+namespace {
+
+// The 64 bits of `bitmap` starting at bit `offset`
+inline uint64_t LoadWord(const uint8_t* bitmap, int64_t offset) {
+  const uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  uint64_t word;
+  memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  if (shift != 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
+// Store 64 bits to `bitmap` starting at bit `offset`, keeping the bits around them
+inline void StoreWord(uint8_t* bitmap, int64_t offset, uint64_t word) {
+  uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  const uint64_t kept_mask = (1ULL << shift) - 1;
+  uint64_t current;
+  memcpy(&current, bytes, sizeof(current));
+  current = (BitUtil::FromLittleEndian(current) & kept_mask) | (word << shift);
+  current = BitUtil::ToLittleEndian(current);
+  memcpy(bytes, &current, sizeof(current));
+  if (shift != 0) {
+    bytes[8] = static_cast<uint8_t>((bytes[8] & ~kept_mask) | (word >> (64 - shift)));
+  }
+}
+
+}  // namespace
+
+void CopyBitmap(const uint8_t* data, int64_t offset, int64_t length, uint8_t* dest,
+                int64_t dest_offset) {
+  // Neither loop touches bytes outside of the bit ranges
+  for (; length >= 64; length -= 64) {
+    StoreWord(dest, dest_offset, LoadWord(data, offset));
+    offset += 64;
+    dest_offset += 64;
+  }
+  for (int64_t i = 0; i < length; ++i) {
+    if (BitUtil::GetBit(data, offset + i)) {
+      BitUtil::SetBit(dest, dest_offset + i);
+    } else {
+      BitUtil::ClearBit(dest, dest_offset + i);
+    }
+  }
+}
+
+namespace internal {
+
+uint64_t ReadBitmapWord(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  if (length == 64) {
+    return LoadWord(bitmap, offset);
+  }
+  uint64_t word = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    word |= static_cast<uint64_t>(BitUtil::GetBit(bitmap, offset + i)) << i;
+  }
+  return word;
+}
+
+BitBlockCount BitBlockCounter::NextWord() {
+  const int64_t length = std::min<int64_t>(bits_remaining_, 64);
+  int64_t popcount;
+  if (bitmap_ == nullptr) {
+    popcount = length;
+  } else if (length == 64) {
+    popcount = __builtin_popcountll(LoadWord(bitmap_, offset_));
+  } else {
+    popcount = CountSetBits(bitmap_, offset_, length);
+  }
+  offset_ += length;
+  bits_remaining_ -= length;
+  return BitBlockCount{static_cast<int16_t>(length), static_cast<int16_t>(popcount)};
+}
+
+}  // namespace internal
+
 Status InvertBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset, int64_t length,
                     std::shared_ptr<Buffer>* out) {
   return TransferBitmap<true>(pool, data, offset, length, out);
@@ -186,8 +288,14 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
     return true;
   }
 
-  // Unaligned slow case
-  for (int64_t i = 0; i < bit_length; ++i) {
+  // Unaligned case, a word at a time
+  int64_t i = 0;
+  for (; i + 64 <= bit_length; i += 64) {
+    if (LoadWord(left, left_offset + i) != LoadWord(right, right_offset + i)) {
+      return false;
+    }
+  }
+  for (; i < bit_length; ++i) {
     if (BitUtil::GetBit(left, left_offset + i) !=
         BitUtil::GetBit(right, right_offset + i)) {
       return false;
@@ -198,11 +306,11 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
 
 namespace {
 
-template <typename Op>
+template <template <typename> class Op>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
                      int64_t length) {
-  Op op;
+  Op<uint8_t> op;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
@@ -215,26 +323,28 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
   }
 }
 
-template <typename Op>
+// The output bitmap must be zeroed
+template <template <typename> class Op>
 void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                        int64_t right_offset, uint8_t* out, int64_t out_offset,
                        int64_t length) {
-  Op op;
-  auto left_reader = internal::BitmapReader(left, left_offset, length);
-  auto right_reader = internal::BitmapReader(right, right_offset, length);
-  auto writer = internal::BitmapWriter(out, out_offset, length);
-  for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
-      writer.Set();
+  Op<uint64_t> word_op;
+  Op<bool> bit_op;
+  int64_t i = 0;
+  for (; i + 64 <= length; i += 64) {
+    const uint64_t word =
+        word_op(LoadWord(left, left_offset + i), LoadWord(right, right_offset + i));
+    StoreWord(out, out_offset + i, word);
+  }
+  for (; i < length; ++i) {
+    if (bit_op(BitUtil::GetBit(left, left_offset + i),
+               BitUtil::GetBit(right, right_offset + i))) {
+      BitUtil::SetBit(out, out_offset + i);
     }
-    left_reader.Next();
-    right_reader.Next();
-    writer.Next();
   }
-  writer.Finish();
 }
 
-template <typename BitOp, typename LogicalOp>
+template <template <typename> class Op>
 Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                 const uint8_t* right, int64_t right_offset, int64_t length,
                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
@@ -242,13 +352,13 @@ Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
     // Fast case: can use bytewise AND
     const int64_t phys_bits = length + out_offset;
     RETURN_NOT_OK(AllocateEmptyBitmap(pool, phys_bits, out_buffer));
-    AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset,
-                           (*out_buffer)->mutable_data(), out_offset, length);
+    AlignedBitmapOp<Op>(left, left_offset, right, right_offset,
+                        (*out_buffer)->mutable_data(), out_offset, length);
   } else {
     // Unaligned
     RETURN_NOT_OK(AllocateEmptyBitmap(pool, length + out_offset, out_buffer));
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset,
-                                 (*out_buffer)->mutable_data(), out_offset, length);
+    UnalignedBitmapOp<Op>(left, left_offset, right, right_offset,
+                          (*out_buffer)->mutable_data(), out_offset, length);
   }
   return Status::OK();
 }
@@ -258,22 +368,22 @@ Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
 Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
+  return BitmapOp<std::bit_and>(pool, left, left_offset, right, right_offset, length,
+                                out_offset, out_buffer);
 }
 
 Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                 const uint8_t* right, int64_t right_offset, int64_t length,
                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
+  return BitmapOp<std::bit_or>(pool, left, left_offset, right, right_offset, length,
+                               out_offset, out_buffer);
 }
 
 Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
+  return BitmapOp<std::bit_xor>(pool, left, left_offset, right, right_offset, length,
+                                out_offset, out_buffer);
 }
 
 }  // namespace arrow
@@ -188,6 +188,27 @@ static inline int CountLeadingZeros(uint64_t value) {
 #endif
 }
 
+/// \brief Count the number of trailing zeros in an unsigned integer.
+static inline int CountTrailingZeros(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  if (value == 0) return 64;
+  return static_cast<int>(__builtin_ctzll(value));
+#elif defined(_MSC_VER)
+  unsigned long index;                    // NOLINT
+  if (_BitScanForward64(&index, value)) {  // NOLINT
+    return static_cast<int>(index);
+  } else {
+    return 64;
+  }
+#else
+  int bitpos = 0;
+  while (bitpos < 64 && (value & (static_cast<uint64_t>(1) << bitpos)) == 0) {
+    ++bitpos;
+  }
+  return bitpos;
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
@@ -474,6 +495,75 @@ class FirstTimeBitmapWriter {
   int64_t byte_offset_;
 };
 
+/// \brief The number of bits set in a block of consecutive bits of a bitmap
+struct BitBlockCount {
+  int16_t length;
+  int16_t popcount;
+
+  bool NoneSet() const { return popcount == 0; }
+  bool AllSet() const { return popcount == length; }
+};
+
+/// \brief Walk a bitmap a word of 64 bits at a time, counting the bits set
+///
+/// The bitmap may start at any bit offset, and a null bitmap has all its bits
+/// set. Kernels walking a validity bitmap this way can process values densely
+/// in blocks where all are valid, skip blocks where all are null, and test
+/// single bits only in blocks mixing both.
+class ARROW_EXPORT BitBlockCounter {
+ public:
+  BitBlockCounter(const uint8_t* bitmap, int64_t start_offset, int64_t length)
+      : bitmap_(bitmap), offset_(start_offset), bits_remaining_(length) {}
+
+  /// \brief The next block of 64 bits, fewer at the end of the bitmap, or an
+  /// empty block once all bits have been counted
+  BitBlockCount NextWord();
+
+ private:
+  const uint8_t* bitmap_;
+  int64_t offset_;
+  int64_t bits_remaining_;
+};
+
+/// \brief Read up to 64 consecutive bits of a bitmap into a word, the first
+/// bit least significant and the bits past `length` cleared
+ARROW_EXPORT
+uint64_t ReadBitmapWord(const uint8_t* bitmap, int64_t offset, int64_t length);
+
+/// \brief Visit the positions of a bitmap, from 0 to length
+///
+/// visit_set(i) or visit_unset(i) is called for each position i, depending on
+/// its bit. Bits are only tested one at a time in blocks of 64 mixing set
+/// and unset bits.
+template <typename VisitSet, typename VisitUnset>
+void VisitBitBlocks(const uint8_t* bitmap, int64_t start_offset, int64_t length,
+                    VisitSet&& visit_set, VisitUnset&& visit_unset) {
+  BitBlockCounter counter(bitmap, start_offset, length);
+  for (int64_t position = 0; position < length;) {
+    const BitBlockCount block = counter.NextWord();
+    if (block.AllSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        visit_set(i);
+      }
+    } else if (block.NoneSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        visit_unset(i);
+      }
+    } else {
+      BitmapReader reader(bitmap, start_offset + position, block.length);
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (reader.IsSet()) {
+          visit_set(i);
+        } else {
+          visit_unset(i);
+        }
+        reader.Next();
+      }
+    }
+    position += block.length;
+  }
+}
+
 // A std::generate() like function to write sequential bits into a bitmap area.
 // Bits preceding the bitmap area are preserved, bits following the bitmap
 // area may be clobbered.
@@ -570,6 +660,20 @@ ARROW_EXPORT
 Status CopyBitmap(MemoryPool* pool, const uint8_t* bitmap, int64_t offset, int64_t length,
                   std::shared_ptr<Buffer>* out);
 
+/// Copy a bit range of an existing bitmap into an existing bitmap
+///
+/// Bits are moved 64 at a time. Bits of the destination outside of the
+/// copied range are left untouched.
+///
+/// \param[in] bitmap source data
+/// \param[in] offset bit offset into the source data
+/// \param[in] length number of bits to copy
+/// \param[out] dest destination data
+/// \param[in] dest_offset bit offset into the destination data
+ARROW_EXPORT
+void CopyBitmap(const uint8_t* bitmap, int64_t offset, int64_t length, uint8_t* dest,
+                int64_t dest_offset);
+
 /// Invert a bit range of an existing bitmap
 ///
 /// \param[in] pool memory pool to allocate memory from
@@ -593,10 +697,18 @@ Status InvertBitmap(MemoryPool* pool, const uint8_t* bitmap, int64_t offset,
 ARROW_EXPORT
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length);
 
+/// Compare bit ranges of two bitmaps
+///
+/// Ranges at different bit offsets are compared 64 bits at a time.
 ARROW_EXPORT
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t bit_length);
 
+/// \brief Bitwise AND of bit ranges of two bitmaps, into a new bitmap
+///
+/// When the offsets of the inputs and the output agree modulo 8 the bitmaps
+/// are combined a byte at a time, otherwise 64 bits at a time. The same holds
+/// for BitmapOr and BitmapXor.
 ARROW_EXPORT
 Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/block-reader.h"
+
+#include <cstring>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+Status ConcatenateBuffer(MemoryPool* pool, const Buffer& left, const uint8_t* right,
+                         int64_t right_size, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, left.size() + right_size, &result));
+  memcpy(result->mutable_data(), left.data(), static_cast<size_t>(left.size()));
+  memcpy(result->mutable_data() + left.size(), right, static_cast<size_t>(right_size));
+  *out = result;
+  return Status::OK();
+}
+
+}  // namespace
+
+BlockReader::BlockReader(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                         int64_t block_size, RowEndFinder find_last_end,
+                         RowEndFinder find_first_end, bool rescan_carried_over)
+    : pool_(pool),
+      input_(input),
+      block_size_(block_size),
+      find_last_end_(std::move(find_last_end)),
+      find_first_end_(std::move(find_first_end)),
+      rescan_carried_over_(rescan_carried_over),
+      eof_(false) {}
+
+Status BlockReader::ReadBlock(std::vector<std::shared_ptr<Buffer>>* out) {
+  out->clear();
+  while (!eof_) {
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(input_->Read(block_size_, &data));
+    if (data->size() == 0) {
+      eof_ = true;
+      break;
+    }
+    if (partial_ != nullptr && rescan_carried_over_) {
+      RETURN_NOT_OK(
+          ConcatenateBuffer(pool_, *partial_, data->data(), data->size(), &data));
+      partial_.reset();
+    }
+    const uint8_t* bytes = data->data();
+    const int64_t size = data->size();
+    const int64_t end = find_last_end_(bytes, size);
+    if (end == 0) {
+      // No row ends in this data: carry all of it over
+      if (partial_ == nullptr) {
+        partial_ = data;
+      } else {
+        RETURN_NOT_OK(ConcatenateBuffer(pool_, *partial_, bytes, size, &partial_));
+      }
+      continue;
+    }
+    int64_t begin = 0;
+    if (partial_ != nullptr) {
+      begin = find_first_end_(bytes, end);
+      std::shared_ptr<Buffer> row;
+      RETURN_NOT_OK(ConcatenateBuffer(pool_, *partial_, bytes, begin, &row));
+      out->push_back(row);
+      partial_.reset();
+    }
+    if (end > begin) {
+      out->push_back(SliceBuffer(data, begin, end - begin));
+    }
+    if (end < size) {
+      partial_ = SliceBuffer(data, end, size - end);
+    }
+    return Status::OK();
+  }
+  // The last row need not be terminated
+  if (partial_ != nullptr) {
+    out->push_back(partial_);
+    partial_.reset();
+  }
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Reading of row-delimited text input in blocks, shared by the CSV and JSON
+// readers
+
+#ifndef ARROW_UTIL_BLOCK_READER_H
+#define ARROW_UTIL_BLOCK_READER_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace internal {
+
+/// \brief Read an input stream in blocks of whole rows
+///
+/// Each read is cut after the last row end it holds. The row straddling two
+/// reads is copied into a buffer of its own, the other rows are kept as a
+/// slice of the data read. The last row of the input need not be terminated.
+class ARROW_EXPORT BlockReader {
+ public:
+  /// \brief Return a row end in data[0, size), as a position past its last
+  /// byte
+  using RowEndFinder = std::function<int64_t(const uint8_t* data, int64_t size)>;
+
+  /// \param[in] pool the pool for the rows straddling two reads
+  /// \param[in] input the stream to read from
+  /// \param[in] block_size the number of bytes read at a time
+  /// \param[in] find_last_end the end of the last row, or 0 if no row ends
+  /// \param[in] find_first_end the end of the first row, called on data
+  /// holding at least one row end
+  /// \param[in] rescan_carried_over whether the data carried over is scanned
+  /// again with the next read, for when the end of a row depends on the data
+  /// before it, e.g. with newlines in quoted values
+  BlockReader(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+              int64_t block_size, RowEndFinder find_last_end,
+              RowEndFinder find_first_end, bool rescan_carried_over = false);
+
+  /// \brief Read the next block of whole rows
+  ///
+  /// An empty block is returned at the end of input.
+  Status ReadBlock(std::vector<std::shared_ptr<Buffer>>* out);
+
+ private:
+  MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
+  int64_t block_size_;
+  RowEndFinder find_last_end_;
+  RowEndFinder find_first_end_;
+  bool rescan_carried_over_;
+
+  // Data following the last row end read
+  std::shared_ptr<Buffer> partial_;
+  bool eof_;
+};
+
+/// \brief Results computed on the CPU thread pool, a bounded number of them
+/// ahead of the consumer, and returned in submission order
+template <typename T>
+class ReadaheadQueue {
+ public:
+  explicit ReadaheadQueue(int readahead) : readahead_(readahead) {}
+
+  ~ReadaheadQueue() {
+    // Tasks write into the pending entries
+    for (const auto& task : pending_) {
+      task->status.wait();
+    }
+  }
+
+  /// \brief Whether as many tasks as the readahead are pending
+  bool full() const { return pending_.size() >= static_cast<size_t>(readahead_); }
+
+  bool empty() const { return pending_.empty(); }
+
+  /// \brief Submit a task computing a result into its argument
+  template <typename Function>
+  void Submit(Function&& func) {
+    std::unique_ptr<Task> task(new Task);
+    T* result = &task->result;
+    task->status = GetCpuThreadPool()->Submit(
+        [func, result]() -> Status { return func(result); });
+    pending_.push_back(std::move(task));
+  }
+
+  /// \brief Wait for the oldest task and return its result
+  Status Pop(T* out) {
+    std::unique_ptr<Task> task = std::move(pending_.front());
+    pending_.pop_front();
+    RETURN_NOT_OK(task->status.get());
+    *out = std::move(task->result);
+    return Status::OK();
+  }
+
+ private:
+  struct Task {
+    std::future<Status> status;
+    T result;
+  };
+
+  int readahead_;
+  std::deque<std::unique_ptr<Task>> pending_;
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BLOCK_READER_H
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compiled with -mavx2
+
+#include <immintrin.h>
+
+#include "arrow/util/bpacking-simd.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Unpack the 8 values of group GROUP of a block. Each lane picks the word its
+// value starts in and the next one, from two loads offset by one word, and
+// shifts them into place. The words of a group are never more than 8 apart.
+template <int BITS, int GROUP>
+inline void Unpack8(const uint32_t* in, uint32_t* out) {
+  constexpr int kFirst = GROUP * 8;
+  constexpr int kBase = UnpackWord(BITS, kFirst);
+  constexpr uint32_t kMask = BITS == 32 ? ~0U : (1U << BITS) - 1;
+
+  const __m256i words = _mm256_setr_epi32(
+      UnpackWord(BITS, kFirst) - kBase, UnpackWord(BITS, kFirst + 1) - kBase,
+      UnpackWord(BITS, kFirst + 2) - kBase, UnpackWord(BITS, kFirst + 3) - kBase,
+      UnpackWord(BITS, kFirst + 4) - kBase, UnpackWord(BITS, kFirst + 5) - kBase,
+      UnpackWord(BITS, kFirst + 6) - kBase, UnpackWord(BITS, kFirst + 7) - kBase);
+  const __m256i shifts = _mm256_setr_epi32(
+      UnpackShift(BITS, kFirst), UnpackShift(BITS, kFirst + 1),
+      UnpackShift(BITS, kFirst + 2), UnpackShift(BITS, kFirst + 3),
+      UnpackShift(BITS, kFirst + 4), UnpackShift(BITS, kFirst + 5),
+      UnpackShift(BITS, kFirst + 6), UnpackShift(BITS, kFirst + 7));
+  // Shifting by 32 gives zero, for values that do not straddle two words
+  const __m256i high_shifts = _mm256_sub_epi32(_mm256_set1_epi32(32), shifts);
+
+  const __m256i low =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + kBase));
+  const __m256i high =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + kBase + 1));
+  __m256i values =
+      _mm256_or_si256(_mm256_srlv_epi32(_mm256_permutevar8x32_epi32(low, words), shifts),
+                      _mm256_sllv_epi32(_mm256_permutevar8x32_epi32(high, words),
+                                        high_shifts));
+  values = _mm256_and_si256(values, _mm256_set1_epi32(static_cast<int>(kMask)));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + kFirst), values);
+}
+
+template <int BITS>
+const uint32_t* UnpackBlocks(const uint32_t* in, uint32_t* out, int num_blocks) {
+  for (int i = 0; i < num_blocks; ++i) {
+    Unpack8<BITS, 0>(in, out);
+    Unpack8<BITS, 1>(in, out);
+    Unpack8<BITS, 2>(in, out);
+    Unpack8<BITS, 3>(in, out);
+    in += BITS;
+    out += 32;
+  }
+  return in;
+}
+
+using UnpackBlocksFunc = const uint32_t* (*)(const uint32_t*, uint32_t*, int);
+
+const UnpackBlocksFunc kUnpackBlocks[] = {
+    UnpackBlocks<1>,  UnpackBlocks<2>,  UnpackBlocks<3>,  UnpackBlocks<4>,
+    UnpackBlocks<5>,  UnpackBlocks<6>,  UnpackBlocks<7>,  UnpackBlocks<8>,
+    UnpackBlocks<9>,  UnpackBlocks<10>, UnpackBlocks<11>, UnpackBlocks<12>,
+    UnpackBlocks<13>, UnpackBlocks<14>, UnpackBlocks<15>, UnpackBlocks<16>,
+    UnpackBlocks<17>, UnpackBlocks<18>, UnpackBlocks<19>, UnpackBlocks<20>,
+    UnpackBlocks<21>, UnpackBlocks<22>, UnpackBlocks<23>, UnpackBlocks<24>,
+    UnpackBlocks<25>, UnpackBlocks<26>, UnpackBlocks<27>, UnpackBlocks<28>,
+    UnpackBlocks<29>, UnpackBlocks<30>, UnpackBlocks<31>, UnpackBlocks<32>};
+
+}  // namespace
+
+const uint32_t* unpack32_avx2(const uint32_t* in, uint32_t* out, int num_blocks,
+                              int num_bits) {
+  DCHECK(num_bits >= 1 && num_bits <= 32) << "Unsupported num_bits";
+  return kUnpackBlocks[num_bits - 1](in, out, num_blocks);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/test-util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu-info.h"
+
+namespace arrow {
+namespace internal {
+
+constexpr int kNumValues = 64 * 1024;
+
+enum UnpackKernel { kScalar, kSse4, kAvx2 };
+
+// Unpack random bit-packed values with one kernel: the scalar one called
+// directly, or the dispatcher restricted to an instruction set
+static void BM_Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_bits = static_cast<int>(state.range(0));
+  const auto kernel = static_cast<UnpackKernel>(state.range(1));
+
+  CpuInfo::Init();
+  if ((kernel == kSse4 && !CpuInfo::IsSupported(CpuInfo::SSE4_1)) ||
+      (kernel == kAvx2 && !CpuInfo::IsSupported(CpuInfo::AVX2))) {
+    state.SkipWithError("Instruction set not supported");
+    return;
+  }
+  const bool avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  if (kernel == kSse4 && avx2) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, false);
+  }
+
+  std::vector<uint8_t> packed(kNumValues * num_bits / 8);
+  random_bytes(packed.size(), 0, packed.data());
+  std::vector<uint32_t> values(kNumValues);
+  const auto in = reinterpret_cast<const uint32_t*>(packed.data());
+
+  while (state.KeepRunning()) {
+    if (kernel == kScalar) {
+      benchmark::DoNotOptimize(unpack32_default(in, values.data(), kNumValues, num_bits));
+    } else {
+      benchmark::DoNotOptimize(unpack32(in, values.data(), kNumValues, num_bits));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+
+  if (kernel == kSse4 && avx2) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  }
+}
+
+static void UnpackArguments(benchmark::internal::Benchmark* b) {
+  for (int kernel : {kScalar, kSse4, kAvx2}) {
+    for (int num_bits = 1; num_bits <= 32; ++num_bits) {
+      b->Args({num_bits, kernel});
+    }
+  }
+}
+
+// First argument: bit width; second: scalar (0), SSE4 (1) or AVX2 (2) kernel
+BENCHMARK(BM_Unpack32)->Apply(UnpackArguments);
+
+}  // namespace internal
+}  // namespace arrow
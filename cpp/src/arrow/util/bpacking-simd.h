@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Bit unpacking kernels using SIMD instructions. Each is compiled with the
+// flags of its instruction set, so must only be called when CpuInfo reports
+// that the CPU supports it.
+
+#ifndef ARROW_UTIL_BPACKING_SIMD_H
+#define ARROW_UTIL_BPACKING_SIMD_H
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+/// The kernels may load up to this many bytes past the last block they unpack
+constexpr int kUnpack32SimdOverread = 32;
+
+// The position of value `i` of a block of 32 values of `bits` bits: the
+// 32-bit word it starts in, and its bit offset in that word
+constexpr int UnpackWord(int bits, int i) { return i * bits / 32; }
+constexpr int UnpackShift(int bits, int i) { return i * bits % 32; }
+
+/// \brief Unpack num_blocks blocks of 32 values of num_bits bits with AVX2
+///
+/// \return the input past the last block unpacked
+const uint32_t* unpack32_avx2(const uint32_t* in, uint32_t* out, int num_blocks,
+                              int num_bits);
+
+/// \brief Unpack num_blocks blocks of 32 values of num_bits bits with SSE4.1
+///
+/// \return the input past the last block unpacked, or null if num_bits is
+/// not supported: values of 27, 29, 30 and 31 bits can straddle 5 bytes
+const uint32_t* unpack32_sse4(const uint32_t* in, uint32_t* out, int num_blocks,
+                              int num_bits);
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BPACKING_SIMD_H
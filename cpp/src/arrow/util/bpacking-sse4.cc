@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compiled with -msse4.1
+
+#include <smmintrin.h>
+
+#include "arrow/util/bpacking-simd.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Whether each value of a block of values of `bits` bits lies within the 4
+// bytes starting at the byte it starts in
+constexpr bool FitsInFourBytes(int bits, int i = 0) {
+  return i == 32 ||
+         (UnpackShift(bits, i) % 8 + bits <= 32 && FitsInFourBytes(bits, i + 1));
+}
+
+// The source byte of byte `k` of lane `lane` of the group starting at value
+// `first`, relative to the byte the group starts in
+constexpr char ShuffleIndex(int bits, int first, int lane, int k) {
+  return static_cast<char>((first + lane) * bits / 8 - first * bits / 8 + k);
+}
+
+// Multiplying by this moves the top bit of value `i` to the top of its lane
+constexpr int LeftShiftFactor(int bits, int i) {
+  return static_cast<int>(1U << (32 - UnpackShift(bits, i) % 8 - bits));
+}
+
+// Unpack the 4 values of group GROUP of a block. Each lane gathers the 4
+// bytes its value starts in with a byte shuffle. SSE has no variable shifts,
+// so values are shifted left to the top of their lane by a multiplication,
+// then all right by the same amount.
+template <int BITS, int GROUP>
+inline void Unpack4(const uint8_t* in, uint32_t* out) {
+  constexpr int kFirst = GROUP * 4;
+  const __m128i shuffle = _mm_setr_epi8(
+      ShuffleIndex(BITS, kFirst, 0, 0), ShuffleIndex(BITS, kFirst, 0, 1),
+      ShuffleIndex(BITS, kFirst, 0, 2), ShuffleIndex(BITS, kFirst, 0, 3),
+      ShuffleIndex(BITS, kFirst, 1, 0), ShuffleIndex(BITS, kFirst, 1, 1),
+      ShuffleIndex(BITS, kFirst, 1, 2), ShuffleIndex(BITS, kFirst, 1, 3),
+      ShuffleIndex(BITS, kFirst, 2, 0), ShuffleIndex(BITS, kFirst, 2, 1),
+      ShuffleIndex(BITS, kFirst, 2, 2), ShuffleIndex(BITS, kFirst, 2, 3),
+      ShuffleIndex(BITS, kFirst, 3, 0), ShuffleIndex(BITS, kFirst, 3, 1),
+      ShuffleIndex(BITS, kFirst, 3, 2), ShuffleIndex(BITS, kFirst, 3, 3));
+  const __m128i factors = _mm_setr_epi32(
+      LeftShiftFactor(BITS, kFirst), LeftShiftFactor(BITS, kFirst + 1),
+      LeftShiftFactor(BITS, kFirst + 2), LeftShiftFactor(BITS, kFirst + 3));
+
+  const __m128i bytes =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + kFirst * BITS / 8));
+  __m128i values = _mm_mullo_epi32(_mm_shuffle_epi8(bytes, shuffle), factors);
+  values = _mm_srli_epi32(values, 32 - BITS);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + kFirst), values);
+}
+
+template <int BITS, bool SUPPORTED = FitsInFourBytes(BITS)>
+struct Unpacker {
+  static const uint32_t* UnpackBlocks(const uint32_t* in, uint32_t* out,
+                                      int num_blocks) {
+    for (int i = 0; i < num_blocks; ++i) {
+      const auto bytes = reinterpret_cast<const uint8_t*>(in);
+      Unpack4<BITS, 0>(bytes, out);
+      Unpack4<BITS, 1>(bytes, out);
+      Unpack4<BITS, 2>(bytes, out);
+      Unpack4<BITS, 3>(bytes, out);
+      Unpack4<BITS, 4>(bytes, out);
+      Unpack4<BITS, 5>(bytes, out);
+      Unpack4<BITS, 6>(bytes, out);
+      Unpack4<BITS, 7>(bytes, out);
+      in += BITS;
+      out += 32;
+    }
+    return in;
+  }
+};
+
+template <int BITS>
+struct Unpacker<BITS, false> {
+  static const uint32_t* UnpackBlocks(const uint32_t*, uint32_t*, int) {
+    return nullptr;
+  }
+};
+
+using UnpackBlocksFunc = const uint32_t* (*)(const uint32_t*, uint32_t*, int);
+
+const UnpackBlocksFunc kUnpackBlocks[] = {
+    Unpacker<1>::UnpackBlocks,  Unpacker<2>::UnpackBlocks,  Unpacker<3>::UnpackBlocks,
+    Unpacker<4>::UnpackBlocks,  Unpacker<5>::UnpackBlocks,  Unpacker<6>::UnpackBlocks,
+    Unpacker<7>::UnpackBlocks,  Unpacker<8>::UnpackBlocks,  Unpacker<9>::UnpackBlocks,
+    Unpacker<10>::UnpackBlocks, Unpacker<11>::UnpackBlocks, Unpacker<12>::UnpackBlocks,
+    Unpacker<13>::UnpackBlocks, Unpacker<14>::UnpackBlocks, Unpacker<15>::UnpackBlocks,
+    Unpacker<16>::UnpackBlocks, Unpacker<17>::UnpackBlocks, Unpacker<18>::UnpackBlocks,
+    Unpacker<19>::UnpackBlocks, Unpacker<20>::UnpackBlocks, Unpacker<21>::UnpackBlocks,
+    Unpacker<22>::UnpackBlocks, Unpacker<23>::UnpackBlocks, Unpacker<24>::UnpackBlocks,
+    Unpacker<25>::UnpackBlocks, Unpacker<26>::UnpackBlocks, Unpacker<27>::UnpackBlocks,
+    Unpacker<28>::UnpackBlocks, Unpacker<29>::UnpackBlocks, Unpacker<30>::UnpackBlocks,
+    Unpacker<31>::UnpackBlocks, Unpacker<32>::UnpackBlocks};
+
+}  // namespace
+
+const uint32_t* unpack32_sse4(const uint32_t* in, uint32_t* out, int num_blocks,
+                              int num_bits) {
+  DCHECK(num_bits >= 1 && num_bits <= 32) << "Unsupported num_bits";
+  return kUnpackBlocks[num_bits - 1](in, out, num_blocks);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+
+#include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking-simd.h"
+#include "arrow/util/cpu-info.h"
+
+namespace arrow {
+namespace internal {
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  if (num_bits == 0) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+
+  // The last blocks are left to the scalar kernels, so that the SIMD ones
+  // never load past the end of the input
+  const int num_tail_blocks =
+      static_cast<int>(BitUtil::CeilDiv(kUnpack32SimdOverread, 4 * num_bits));
+  const int num_simd_blocks = batch_size / 32 - num_tail_blocks;
+
+  const uint32_t* end = nullptr;
+  if (num_simd_blocks > 0) {
+    if (!CpuInfo::initialized()) {
+      CpuInfo::Init();
+    }
+#ifdef ARROW_HAVE_AVX2
+    if (CpuInfo::IsSupported(CpuInfo::AVX2)) {
+      end = unpack32_avx2(in, out, num_simd_blocks, num_bits);
+    }
+#endif
+#ifdef ARROW_HAVE_SSE4_1
+    if (end == nullptr && CpuInfo::IsSupported(CpuInfo::SSE4_1)) {
+      end = unpack32_sse4(in, out, num_simd_blocks, num_bits);
+    }
+#endif
+  }
+  if (end == nullptr) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+
+  const int num_unpacked = num_simd_blocks * 32;
+  return num_unpacked + unpack32_default(end, out + num_unpacked,
+                                         batch_size - num_unpacked, num_bits);
+}
+
+}  // namespace internal
+}  // namespace arrow
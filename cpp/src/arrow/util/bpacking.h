@@ -27,7 +27,10 @@
 #ifndef ARROW_UTIL_BPACKING_H
 #define ARROW_UTIL_BPACKING_H
 
+#include <cstdint>
+
 #include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
@@ -3191,7 +3194,8 @@ inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
-inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+inline int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size,
+                            int num_bits) {
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
@@ -3302,6 +3306,16 @@ inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_b
   return batch_size;
 }
 
+/// \brief Unpack values of num_bits bits each, 32 at a time
+///
+/// Dispatches at runtime to AVX2 or SSE4 kernels when the CPU supports them
+/// and to the scalar unpack32_default otherwise.
+///
+/// \return the number of values unpacked: batch_size rounded down to a
+/// multiple of 32
+ARROW_EXPORT
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+
 }  // namespace internal
 }  // namespace arrow
 
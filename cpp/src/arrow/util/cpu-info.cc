@@ -73,6 +73,7 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -177,6 +178,15 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // AVX2 needs the OS to save the AVX registers (OSXSAVE and XCR0)
+  const int register_EBX_id = 7;
+  if (highest_valid_id >= register_EBX_id && features_ECX[27] &&
+      (_xgetbv(0) & 0x6) == 0x6) {
+    __cpuidex(cpu_info.data(), register_EBX_id, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  }
   return true;
 }
 #endif
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "arrow/test-util.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+
+using internal::StringConverter;
+using internal::StringFormatter;
+
+template <typename FormatterType>
+void AssertFormatting(FormatterType& formatter,
+                      typename FormatterType::value_type value,
+                      const std::string& expected) {
+  const int max_size = FormatterType::kMaxSize;
+  char buffer[FormatterType::kMaxSize];
+  const int size = formatter(value, buffer);
+  ASSERT_LE(size, max_size);
+  ASSERT_EQ(expected, std::string(buffer, size));
+}
+
+TEST(Formatting, Boolean) {
+  StringFormatter<BooleanType> formatter;
+
+  AssertFormatting(formatter, true, "true");
+  AssertFormatting(formatter, false, "false");
+}
+
+TEST(Formatting, Integers) {
+  StringFormatter<Int8Type> formatter_int8;
+  AssertFormatting(formatter_int8, 0, "0");
+  AssertFormatting(formatter_int8, 127, "127");
+  AssertFormatting(formatter_int8, -128, "-128");
+
+  StringFormatter<UInt16Type> formatter_uint16;
+  AssertFormatting(formatter_uint16, 9, "9");
+  AssertFormatting(formatter_uint16, 10, "10");
+  AssertFormatting(formatter_uint16, 65535, "65535");
+
+  StringFormatter<Int32Type> formatter_int32;
+  AssertFormatting(formatter_int32, -100, "-100");
+  AssertFormatting(formatter_int32, 2147483647, "2147483647");
+  AssertFormatting(formatter_int32, -2147483647 - 1, "-2147483648");
+
+  StringFormatter<Int64Type> formatter_int64;
+  AssertFormatting(formatter_int64, 1000000007, "1000000007");
+  AssertFormatting(formatter_int64, -9223372036854775807LL - 1, "-9223372036854775808");
+
+  StringFormatter<UInt64Type> formatter_uint64;
+  AssertFormatting(formatter_uint64, 18446744073709551615ULL, "18446744073709551615");
+}
+
+TEST(Formatting, FloatingPoint) {
+  StringFormatter<FloatType> formatter_float;
+  AssertFormatting(formatter_float, 0.0f, "0");
+  AssertFormatting(formatter_float, -1.5f, "-1.5");
+  AssertFormatting(formatter_float, 0.1f, "0.1");
+  AssertFormatting(formatter_float, 1.17549435e-38f, "1.17549435e-38");
+
+  StringFormatter<DoubleType> formatter_double;
+  AssertFormatting(formatter_double, 0.1, "0.1");
+  AssertFormatting(formatter_double, 1e300, "1e+300");
+  AssertFormatting(formatter_double, 0.1 + 0.2, "0.30000000000000004");
+  AssertFormatting(formatter_double, -1.7976931348623157e308, "-1.7976931348623157e+308");
+}
+
+TEST(Formatting, Date32) {
+  StringFormatter<Date32Type> formatter;
+
+  AssertFormatting(formatter, 0, "1970-01-01");
+  AssertFormatting(formatter, -1, "1969-12-31");
+  AssertFormatting(formatter, 11016, "2000-02-29");
+  AssertFormatting(formatter, 2932897, "10000-01-01");
+  AssertFormatting(formatter, -719529, "-0001-12-31");
+}
+
+TEST(Formatting, Timestamp) {
+  StringFormatter<TimestampType> formatter_s(timestamp(TimeUnit::SECOND));
+  AssertFormatting(formatter_s, 0, "1970-01-01 00:00:00");
+  AssertFormatting(formatter_s, -1, "1969-12-31 23:59:59");
+  AssertFormatting(formatter_s, 1542129070, "2018-11-13 17:11:10");
+
+  StringFormatter<TimestampType> formatter_ms(timestamp(TimeUnit::MILLI));
+  AssertFormatting(formatter_ms, 1, "1970-01-01 00:00:00.001");
+  AssertFormatting(formatter_ms, -1, "1969-12-31 23:59:59.999");
+
+  StringFormatter<TimestampType> formatter_ns(timestamp(TimeUnit::NANO));
+  AssertFormatting(formatter_ns, 9223372036854775807LL, "2262-04-11 23:47:16.854775807");
+  AssertFormatting(formatter_ns, -9223372036854775807LL - 1,
+                   "1677-09-21 00:12:43.145224192");
+}
+
+TEST(Formatting, TimestampRoundTrip) {
+  auto type = timestamp(TimeUnit::MICRO);
+  StringFormatter<TimestampType> formatter(type);
+  StringConverter<TimestampType> converter(type);
+
+  char buffer[StringFormatter<TimestampType>::kMaxSize];
+  for (int64_t value = -100000000000LL; value < 100000000000LL; value += 12345678901LL) {
+    const int size = formatter(value, buffer);
+    int64_t parsed;
+    ASSERT_TRUE(converter(buffer, size, &parsed)) << std::string(buffer, size);
+    ASSERT_EQ(value, parsed);
+  }
+}
+
+}  // namespace arrow
@@ -0,0 +1,250 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_FORMATTING_H
+#define ARROW_UTIL_FORMATTING_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/calendar.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A class providing conversion from some Arrow data types to strings
+///
+/// Conversion is triggered by calling operator(), which writes at most
+/// kMaxSize characters (without a terminating NUL) to the given buffer and
+/// returns the number of characters written.  This allows callers to size
+/// an output buffer once for a whole array of values.
+template <typename ARROW_TYPE, typename Enable = void>
+class StringFormatter;
+
+namespace detail {
+
+static const char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Write the decimal digits of `value` so that they end just before `end`,
+// two at a time; return a pointer to the first digit
+inline char* FormatDigitsBackwards(uint64_t value, char* end) {
+  while (value >= 100) {
+    const char* pair = kDigitPairs + (value % 100) * 2;
+    value /= 100;
+    *--end = pair[1];
+    *--end = pair[0];
+  }
+  if (value >= 10) {
+    const char* pair = kDigitPairs + value * 2;
+    *--end = pair[1];
+    *--end = pair[0];
+  } else {
+    *--end = static_cast<char>('0' + value);
+  }
+  return end;
+}
+
+// Write exactly two digits
+inline char* FormatTwoDigits(int value, char* out) {
+  const char* pair = kDigitPairs + value * 2;
+  *out++ = pair[0];
+  *out++ = pair[1];
+  return out;
+}
+
+// Write exactly `num_digits` digits, zero-padded
+inline char* FormatFixedDigits(uint64_t value, int num_digits, char* out) {
+  for (int i = num_digits - 1; i >= 0; --i) {
+    out[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return out + num_digits;
+}
+
+// "YYYY-MM-DD"; years outside [0, 9999] are written with a sign or with
+// more than four digits, as in ISO-8601 expanded representation
+inline char* FormatYYYY_MM_DD(int64_t days_since_epoch, char* out) {
+  int64_t year;
+  int month, day;
+  CivilFromDays(days_since_epoch, &year, &month, &day);
+  if (year >= 0 && year <= 9999) {
+    out = FormatFixedDigits(static_cast<uint64_t>(year), 4, out);
+  } else {
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    char* begin = FormatDigitsBackwards(
+        year < 0 ? 0 - static_cast<uint64_t>(year) : static_cast<uint64_t>(year), end);
+    while (end - begin < 4) {
+      *--begin = '0';
+    }
+    if (year < 0) {
+      *out++ = '-';
+    }
+    memcpy(out, begin, end - begin);
+    out += end - begin;
+  }
+  *out++ = '-';
+  out = FormatTwoDigits(month, out);
+  *out++ = '-';
+  return FormatTwoDigits(day, out);
+}
+
+}  // namespace detail
+
+template <>
+class StringFormatter<BooleanType> {
+ public:
+  using value_type = bool;
+  static constexpr int kMaxSize = 5;
+
+  int operator()(bool value, char* out) {
+    if (value) {
+      memcpy(out, "true", 4);
+      return 4;
+    }
+    memcpy(out, "false", 5);
+    return 5;
+  }
+};
+
+template <class ARROW_TYPE>
+class StringFormatter<ARROW_TYPE, enable_if_integer<ARROW_TYPE>> {
+ public:
+  using value_type = typename ARROW_TYPE::c_type;
+  // Digits of the largest value, plus a sign
+  static constexpr int kMaxSize = std::numeric_limits<value_type>::digits10 + 2;
+
+  int operator()(value_type value, char* out) {
+    char digits[kMaxSize];
+    char* end = digits + kMaxSize;
+    char* begin;
+    if (std::is_signed<value_type>::value && value < 0) {
+      // Negate as unsigned so that the minimum value does not overflow
+      begin = detail::FormatDigitsBackwards(0 - static_cast<uint64_t>(value), end);
+      *--begin = '-';
+    } else {
+      begin = detail::FormatDigitsBackwards(static_cast<uint64_t>(value), end);
+    }
+    const int size = static_cast<int>(end - begin);
+    memcpy(out, begin, size);
+    return size;
+  }
+};
+
+// Values are written with the shortest of two precisions that parses back
+// to the same value.  Formatting goes through snprintf and therefore
+// assumes the "C" numeric locale.
+template <class ARROW_TYPE>
+class FloatToStringFormatterMixin {
+ public:
+  using value_type = typename ARROW_TYPE::c_type;
+  static constexpr int kMaxSize = 32;
+
+  int operator()(value_type value, char* out) {
+    static constexpr int kShortPrecision = std::numeric_limits<value_type>::digits10;
+    static constexpr int kExactPrecision = std::numeric_limits<value_type>::max_digits10;
+
+    char buffer[kMaxSize + 1];
+    int size = snprintf(buffer, sizeof(buffer), "%.*g", kShortPrecision,
+                        static_cast<double>(value));
+    if (static_cast<value_type>(strtod(buffer, nullptr)) != value) {
+      size = snprintf(buffer, sizeof(buffer), "%.*g", kExactPrecision,
+                      static_cast<double>(value));
+    }
+    memcpy(out, buffer, size);
+    return size;
+  }
+};
+
+template <>
+class StringFormatter<FloatType> : public FloatToStringFormatterMixin<FloatType> {};
+
+template <>
+class StringFormatter<DoubleType> : public FloatToStringFormatterMixin<DoubleType> {};
+
+/// \brief Formatting of days since the UNIX epoch as "YYYY-MM-DD"
+template <>
+class StringFormatter<Date32Type> {
+ public:
+  using value_type = int32_t;
+  static constexpr int kMaxSize = 20;
+
+  int operator()(value_type value, char* out) {
+    return static_cast<int>(detail::FormatYYYY_MM_DD(value, out) - out);
+  }
+};
+
+/// \brief Formatting of timestamps as "YYYY-MM-DD hh:mm:ss", followed by a
+/// fraction of 3, 6 or 9 digits for the milli, micro and nano units
+///
+/// The UTC wall clock time is written, without a UTC offset.
+template <>
+class StringFormatter<TimestampType> {
+ public:
+  using value_type = int64_t;
+  static constexpr int kMaxSize = 48;
+
+  explicit StringFormatter(const std::shared_ptr<DataType>& type)
+      : unit_(checked_cast<const TimestampType&>(*type).unit()) {}
+
+  int operator()(value_type value, char* out) {
+    static const int64_t kUnitsPerSecond[4] = {1, 1000, 1000000, 1000000000LL};
+    static const int kFractionDigits[4] = {0, 3, 6, 9};
+
+    const int unit = static_cast<int>(unit_);
+    const int64_t seconds = FloorDiv(value, kUnitsPerSecond[unit]);
+    int64_t fraction = value % kUnitsPerSecond[unit];
+    if (fraction < 0) {
+      fraction += kUnitsPerSecond[unit];
+    }
+    const int64_t days = FloorDiv(seconds, kSecondsInDay);
+    const int64_t time_of_day = seconds - days * kSecondsInDay;
+
+    char* cursor = detail::FormatYYYY_MM_DD(days, out);
+    *cursor++ = ' ';
+    cursor = detail::FormatTwoDigits(static_cast<int>(time_of_day / 3600), cursor);
+    *cursor++ = ':';
+    cursor = detail::FormatTwoDigits(static_cast<int>(time_of_day / 60 % 60), cursor);
+    *cursor++ = ':';
+    cursor = detail::FormatTwoDigits(static_cast<int>(time_of_day % 60), cursor);
+    if (kFractionDigits[unit] > 0) {
+      *cursor++ = '.';
+      cursor = detail::FormatFixedDigits(static_cast<uint64_t>(fraction),
+                                         kFractionDigits[unit], cursor);
+    }
+    return static_cast<int>(cursor - out);
+  }
+
+ protected:
+  TimeUnit::type unit_;
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_FORMATTING_H
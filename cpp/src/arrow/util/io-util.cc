@@ -66,7 +66,9 @@
 #undef Realloc
 #undef Free
 #else  // POSIX-like platforms
+#include <limits.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -313,6 +315,28 @@ Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
 #endif
 }
 
+Status MemoryAdviseWillNeed(const void* addr, int64_t nbytes) {
+#if defined(_WIN32) || !defined(MADV_WILLNEED)
+  // The hint is only an optimization
+  return Status::OK();
+#else
+  if (nbytes <= 0) {
+    return Status::OK();
+  }
+  // madvise requires a page-aligned address
+  static const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const uintptr_t address = reinterpret_cast<uintptr_t>(addr);
+  const uintptr_t aligned_address = address - address % page_size;
+  const size_t length = static_cast<size_t>(address - aligned_address + nbytes);
+  if (madvise(reinterpret_cast<void*>(aligned_address), length, MADV_WILLNEED) != 0) {
+    std::stringstream ss;
+    ss << "madvise failed: " << std::strerror(errno);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+#endif
+}
+
 //
 // Closing files
 //
@@ -493,6 +517,64 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+Status FileWriteV(int fd, const std::vector<io::IOVec>& iov) {
+#if defined(_WIN32)
+  for (const auto& region : iov) {
+    RETURN_NOT_OK(FileWrite(fd, reinterpret_cast<const uint8_t*>(region.data),
+                            region.nbytes));
+  }
+  return Status::OK();
+#else
+#ifdef IOV_MAX
+  const size_t max_iov_count = IOV_MAX;
+#else
+  const size_t max_iov_count = 1024;
+#endif
+  const int64_t max_chunksize = static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE);
+
+  // Regions larger than the maximum write size are split
+  std::vector<struct iovec> sys_iov;
+  sys_iov.reserve(iov.size());
+  for (const auto& region : iov) {
+    auto data = reinterpret_cast<uint8_t*>(const_cast<void*>(region.data));
+    for (int64_t offset = 0; offset < region.nbytes; offset += max_chunksize) {
+      const int64_t chunksize = std::min(max_chunksize, region.nbytes - offset);
+      sys_iov.push_back({data + offset, static_cast<size_t>(chunksize)});
+    }
+  }
+
+  size_t pos = 0;
+  while (pos < sys_iov.size()) {
+    // Each call writes at most max_iov_count regions and max_chunksize bytes
+    size_t count = 0;
+    int64_t total = 0;
+    while (pos + count < sys_iov.size() && count < max_iov_count &&
+           total + static_cast<int64_t>(sys_iov[pos + count].iov_len) <= max_chunksize) {
+      total += static_cast<int64_t>(sys_iov[pos + count].iov_len);
+      ++count;
+    }
+
+    ssize_t ret = writev(fd, sys_iov.data() + pos, static_cast<int>(count));
+    if (ret == -1) {
+      return Status::IOError(std::string("Error writing bytes to file: ") +
+                             std::string(strerror(errno)));
+    }
+
+    // Skip the fully written regions, and trim a partially written one
+    size_t written = static_cast<size_t>(ret);
+    while (pos < sys_iov.size() && written >= sys_iov[pos].iov_len) {
+      written -= sys_iov[pos].iov_len;
+      ++pos;
+    }
+    if (written > 0) {
+      sys_iov[pos].iov_base = reinterpret_cast<uint8_t*>(sys_iov[pos].iov_base) + written;
+      sys_iov[pos].iov_len -= written;
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
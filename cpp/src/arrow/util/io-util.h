@@ -21,6 +21,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
@@ -153,6 +154,8 @@ Status FileRead(int fd, uint8_t* buffer, const int64_t nbytes, int64_t* bytes_re
 Status FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
                   int64_t* bytes_read);
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
+// Write the regions in order, with as few system calls as possible
+Status FileWriteV(int fd, const std::vector<io::IOVec>& iov);
 Status FileTruncate(int fd, const int64_t size);
 
 Status FileTell(int fd, int64_t* pos);
@@ -166,6 +169,8 @@ Status CreatePipe(int fd[2]);
 
 Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
                       void** new_addr);
+// Advise that a range of mapped memory will be accessed soon
+Status MemoryAdviseWillNeed(const void* addr, int64_t nbytes);
 
 Status GetEnvVar(const char* name, std::string* out);
 Status GetEnvVar(const std::string& name, std::string* out);
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/test-util.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/parsing.h"
 
 namespace arrow {
@@ -57,6 +58,42 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   return base_strings;
 }
 
+static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"2018-11-13 17:11:10",
+                                           "2018-11-13 11:22:33",
+                                           "2016-02-29 11:22:33",
+                                           "2018-11-13T17:11:10Z",
+                                           "1900-02-28T12:34:56+01:00",
+                                           "2018-11-13",
+                                           "1970-01-01 00:00"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
+static std::vector<std::string> MakeDateStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"2018-11-13", "1970-01-01", "2016-02-29",
+                                           "1900-02-28", "9999-12-31"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
+template <typename C_TYPE>
+static std::vector<C_TYPE> MakeValues(int32_t num_items, C_TYPE step) {
+  std::vector<C_TYPE> values;
+  C_TYPE value = 0;
+  for (int32_t i = 0; i < num_items; ++i) {
+    values.push_back(value);
+    value = static_cast<C_TYPE>(value + step);
+  }
+  return values;
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void BM_IntegerParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeIntStrings<C_TYPE>(1000);
@@ -97,6 +134,85 @@ static void BM_FloatParsing(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <TimeUnit::type UNIT>
+static void BM_TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeTimestampStrings(1000);
+  StringConverter<TimestampType> converter(timestamp(UNIT));
+
+  while (state.KeepRunning()) {
+    int64_t total = 0;
+    for (const auto& s : strings) {
+      int64_t value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+static void BM_Date32Parsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeDateStrings(1000);
+  StringConverter<Date32Type> converter;
+
+  while (state.KeepRunning()) {
+    int32_t total = 0;
+    for (const auto& s : strings) {
+      int32_t value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+template <typename FORMATTER>
+static void BenchmarkFormatting(
+    benchmark::State& state,  // NOLINT non-const reference
+    FORMATTER* formatter, const std::vector<typename FORMATTER::value_type>& values) {
+  char buffer[FORMATTER::kMaxSize];
+  while (state.KeepRunning()) {
+    int64_t total = 0;
+    for (const auto value : values) {
+      total += (*formatter)(value, buffer);
+    }
+    benchmark::DoNotOptimize(total);
+    benchmark::DoNotOptimize(buffer);
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BM_IntegerFormatting(benchmark::State& state) {  // NOLINT non-const reference
+  // Spread values over the whole range, so that all digit counts are exercised
+  auto values = MakeValues<C_TYPE>(1000, std::numeric_limits<C_TYPE>::max() / 997);
+  StringFormatter<ARROW_TYPE> formatter;
+  BenchmarkFormatting(state, &formatter, values);
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BM_FloatFormatting(benchmark::State& state) {  // NOLINT non-const reference
+  auto values = MakeValues<C_TYPE>(1000, static_cast<C_TYPE>(1.2345e3));
+  StringFormatter<ARROW_TYPE> formatter;
+  BenchmarkFormatting(state, &formatter, values);
+}
+
+template <TimeUnit::type UNIT>
+static void BM_TimestampFormatting(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // Roughly one value per 13 days, starting at the UNIX epoch
+  auto values = MakeValues<int64_t>(1000, 1123456789LL);
+  StringFormatter<TimestampType> formatter(timestamp(UNIT));
+  BenchmarkFormatting(state, &formatter, values);
+}
+
 BENCHMARK_TEMPLATE(BM_IntegerParsing, Int8Type);
 BENCHMARK_TEMPLATE(BM_IntegerParsing, Int16Type);
 BENCHMARK_TEMPLATE(BM_IntegerParsing, Int32Type);
@@ -109,5 +225,28 @@ BENCHMARK_TEMPLATE(BM_IntegerParsing, UInt64Type);
 BENCHMARK_TEMPLATE(BM_FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(BM_FloatParsing, DoubleType);
 
+BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::SECOND);
+BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::MICRO);
+BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::NANO);
+BENCHMARK(BM_Date32Parsing);
+
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, Int8Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, Int16Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, Int32Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, Int64Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, UInt8Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, UInt16Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, UInt32Type);
+BENCHMARK_TEMPLATE(BM_IntegerFormatting, UInt64Type);
+
+BENCHMARK_TEMPLATE(BM_FloatFormatting, FloatType);
+BENCHMARK_TEMPLATE(BM_FloatFormatting, DoubleType);
+
+BENCHMARK_TEMPLATE(BM_TimestampFormatting, TimeUnit::SECOND);
+BENCHMARK_TEMPLATE(BM_TimestampFormatting, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(BM_TimestampFormatting, TimeUnit::MICRO);
+BENCHMARK_TEMPLATE(BM_TimestampFormatting, TimeUnit::NANO);
+
 }  // namespace internal
 }  // namespace arrow
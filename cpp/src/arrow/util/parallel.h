@@ -18,6 +18,7 @@
 #ifndef ARROW_UTIL_PARALLEL_H
 #define ARROW_UTIL_PARALLEL_H
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <thread>
@@ -46,6 +47,43 @@ Status ParallelFor(int num_tasks, FUNCTION&& func) {
   return st;
 }
 
+// A variant of ParallelFor() running at most `max_parallelism` tasks at a time
+// on the global CPU thread pool.  Task ids are handed out in increasing order,
+// and no further tasks are started once one of them has failed.
+
+template <class FUNCTION>
+Status BoundedParallelFor(int max_parallelism, int num_tasks, FUNCTION&& func) {
+  auto pool = internal::GetCpuThreadPool();
+  const int num_workers = std::max(1, std::min(max_parallelism, num_tasks));
+  std::atomic<int> task_counter(0);
+  std::atomic<bool> error_occurred(false);
+
+  auto worker = [&num_tasks, &task_counter, &error_occurred, &func]() {
+    while (!error_occurred.load()) {
+      const int task_id = task_counter.fetch_add(1);
+      if (task_id >= num_tasks) {
+        break;
+      }
+      Status s = func(task_id);
+      if (!s.ok()) {
+        error_occurred.store(true);
+        return s;
+      }
+    }
+    return Status::OK();
+  };
+
+  std::vector<std::future<Status>> futures(num_workers);
+  for (auto& fut : futures) {
+    fut = pool->Submit(worker);
+  }
+  auto st = Status::OK();
+  for (auto& fut : futures) {
+    st &= fut.get();
+  }
+  return st;
+}
+
 // A variant of ParallelFor() with an explicit number of dedicated threads.
 // In most cases it's more appropriate to use the 2-argument ParallelFor (above),
 // or directly the global CPU thread pool (arrow/util/thread-pool.h).
@@ -238,4 +238,70 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails(converter, "e");
 }
 
+
+TEST(StringConversion, ToTimestamp) {
+  StringConverter<TimestampType> converter(timestamp(TimeUnit::SECOND));
+
+  AssertConversion(converter, "1970-01-01", 0);
+  AssertConversion(converter, "1989-07-14", 616377600);
+  AssertConversion(converter, "2000-02-29", 951782400);
+  AssertConversion(converter, "1900-02-28", -2203977600LL);
+  AssertConversion(converter, "2018-11-13 17:11", 1542129060);
+  AssertConversion(converter, "2018-11-13T17:11:10", 1542129070);
+  AssertConversion(converter, "2018-11-13T17:11:10Z", 1542129070);
+  AssertConversion(converter, "2018-11-13T17:11:10.000", 1542129070);
+  AssertConversion(converter, "2018-11-13T18:11:10+01", 1542129070);
+  AssertConversion(converter, "2018-11-13T18:11:10+0100", 1542129070);
+  AssertConversion(converter, "2018-11-13T16:41:10-00:30", 1542129070);
+
+  AssertConversionFails(converter, "");
+  AssertConversionFails(converter, "1970");
+  AssertConversionFails(converter, "1970-01-01T");
+  AssertConversionFails(converter, "1970-01-01 17");
+  AssertConversionFails(converter, "1970-01-01 00:00:00 ");
+  AssertConversionFails(converter, "1970-00-01");
+  AssertConversionFails(converter, "1970-01-32");
+  AssertConversionFails(converter, "1900-02-29");
+  AssertConversionFails(converter, "1970-01-01 00:60");
+  AssertConversionFails(converter, "1970-01-01 00:00:60");
+  AssertConversionFails(converter, "1970-01-01 00:00.5");
+  AssertConversionFails(converter, "1970-01-01 00:00:00.");
+  AssertConversionFails(converter, "1970-01-01 00:00:00.1");
+  AssertConversionFails(converter, "1970-01-01 00:00:00+1");
+  AssertConversionFails(converter, "1970-01-01 00:00:00+24:00");
+  AssertConversionFails(converter, "1970-01-01 00:00:00z");
+
+  StringConverter<TimestampType> converter_ms(timestamp(TimeUnit::MILLI));
+  AssertConversion(converter_ms, "1970-01-01 00:00:00.1", 100);
+  AssertConversion(converter_ms, "1970-01-01 00:00:00.123000", 123);
+  AssertConversion(converter_ms, "1969-12-31 23:59:59.999Z", -1);
+  AssertConversionFails(converter_ms, "1970-01-01 00:00:00.1234");
+
+  StringConverter<TimestampType> converter_ns(timestamp(TimeUnit::NANO));
+  AssertConversion(converter_ns, "1970-01-01 00:00:00.000000001", 1);
+  AssertConversion(converter_ns, "2262-04-11 23:47:16.854775807",
+                   9223372036854775807LL);
+  AssertConversion(converter_ns, "1677-09-21 00:12:43.145224192",
+                   -9223372036854775807LL - 1);
+  AssertConversionFails(converter_ns, "1970-01-01 00:00:00.0000000001");
+  AssertConversionFails(converter_ns, "2262-04-11 23:47:16.854775808");
+  AssertConversionFails(converter_ns, "1677-09-21 00:12:43.145224191");
+}
+
+TEST(StringConversion, ToDate32) {
+  StringConverter<Date32Type> converter;
+
+  AssertConversion(converter, "1970-01-01", 0);
+  AssertConversion(converter, "1969-12-31", -1);
+  AssertConversion(converter, "2000-02-29", 11016);
+  AssertConversion(converter, "0000-01-01", -719528);
+  AssertConversion(converter, "9999-12-31", 2932896);
+
+  AssertConversionFails(converter, "");
+  AssertConversionFails(converter, "1970-1-01");
+  AssertConversionFails(converter, "1970-01-01Z");
+  AssertConversionFails(converter, "1970-01-01 00:00");
+  AssertConversionFails(converter, "2100-02-29");
+}
+
 }  // namespace arrow
@@ -18,13 +18,18 @@
 #ifndef ARROW_UTIL_PARSING_H
 #define ARROW_UTIL_PARSING_H
 
+#include <cstdint>
 #include <limits>
 #include <locale>
+#include <memory>
 #include <sstream>
 #include <string>
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/calendar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
 
 namespace arrow {
 namespace internal {
@@ -183,6 +188,230 @@ class StringConverter<ARROW_TYPE, enable_if_unsigned_integer<ARROW_TYPE>> {
   std::istringstream ibuf;
 };
 
+// ----------------------------------------------------------------------
+// ISO-8601 dates and timestamps
+//
+// Fields sit at fixed offsets, so they are parsed with straight-line digit
+// arithmetic rather than a general-purpose date parser.
+
+namespace detail {
+
+inline bool ParseDigits(const char* s, int num_digits, int* out) {
+  int value = 0;
+  for (int i = 0; i < num_digits; ++i) {
+    const unsigned digit = static_cast<unsigned char>(s[i]) - '0';
+    if (ARROW_PREDICT_FALSE(digit > 9)) {
+      return false;
+    }
+    value = value * 10 + static_cast<int>(digit);
+  }
+  *out = value;
+  return true;
+}
+
+// "YYYY-MM-DD"
+inline bool ParseYYYY_MM_DD(const char* s, int64_t* days_since_epoch) {
+  int year, month, day;
+  if (ARROW_PREDICT_FALSE(s[4] != '-' || s[7] != '-')) {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(!ParseDigits(s, 4, &year) || !ParseDigits(s + 5, 2, &month) ||
+                          !ParseDigits(s + 8, 2, &day))) {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(month < 1 || month > 12 || day < 1 ||
+                          day > DaysInMonth(year, month))) {
+    return false;
+  }
+  *days_since_epoch = DaysFromCivil(year, month, day);
+  return true;
+}
+
+// "hh:mm" or "hh:mm:ss"
+inline bool ParseTimeOfDay(const char* s, size_t length, int64_t* seconds) {
+  int hours, minutes, secs = 0;
+  if (ARROW_PREDICT_FALSE(length < 5 || s[2] != ':')) {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(!ParseDigits(s, 2, &hours) ||
+                          !ParseDigits(s + 3, 2, &minutes))) {
+    return false;
+  }
+  if (length == 8) {
+    if (ARROW_PREDICT_FALSE(s[5] != ':' || !ParseDigits(s + 6, 2, &secs))) {
+      return false;
+    }
+  } else if (ARROW_PREDICT_FALSE(length != 5)) {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(hours > 23 || minutes > 59 || secs > 59)) {
+    return false;
+  }
+  *seconds = hours * 3600 + minutes * 60 + secs;
+  return true;
+}
+
+// "Z", "+hh", "+hhmm" or "+hh:mm" (or with a '-' sign), as seconds east of UTC
+inline bool ParseUTCOffset(const char* s, size_t length, int64_t* seconds) {
+  if (length == 1 && s[0] == 'Z') {
+    *seconds = 0;
+    return true;
+  }
+  if (ARROW_PREDICT_FALSE(length < 3 || (s[0] != '+' && s[0] != '-'))) {
+    return false;
+  }
+  int hours, minutes = 0;
+  if (ARROW_PREDICT_FALSE(!ParseDigits(s + 1, 2, &hours))) {
+    return false;
+  }
+  if (length == 5) {
+    if (ARROW_PREDICT_FALSE(!ParseDigits(s + 3, 2, &minutes))) {
+      return false;
+    }
+  } else if (length == 6) {
+    if (ARROW_PREDICT_FALSE(s[3] != ':' || !ParseDigits(s + 4, 2, &minutes))) {
+      return false;
+    }
+  } else if (ARROW_PREDICT_FALSE(length != 3)) {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(hours > 23 || minutes > 59)) {
+    return false;
+  }
+  *seconds = (s[0] == '-' ? -1 : 1) * (hours * 3600 + minutes * 60);
+  return true;
+}
+
+}  // namespace detail
+
+/// \brief Conversion of ISO-8601 / RFC 3339 strings to timestamps
+///
+/// Accepted forms are "YYYY-MM-DD", optionally followed by 'T' or ' ' and
+/// "hh:mm" or "hh:mm:ss", an optional fraction of up to 9 digits after the
+/// seconds, and an optional UTC offset ("Z", "+hh", "+hhmm" or "+hh:mm").
+/// Times without an offset are taken as UTC.  Conversion fails if the
+/// fraction cannot be represented exactly in the timestamp unit, or if the
+/// result does not fit in 64 bits.
+template <>
+class StringConverter<TimestampType> {
+ public:
+  using value_type = int64_t;
+
+  explicit StringConverter(const std::shared_ptr<DataType>& type)
+      : unit_(checked_cast<const TimestampType&>(*type).unit()) {}
+
+  bool operator()(const char* s, size_t length, value_type* out) {
+    static const int64_t kUnitsPerSecond[4] = {1, 1000, 1000000, 1000000000LL};
+    static const int64_t kNanosPerUnit[4] = {1000000000LL, 1000000, 1000, 1};
+
+    if (ARROW_PREDICT_FALSE(length < 10)) {
+      return false;
+    }
+    int64_t days;
+    if (ARROW_PREDICT_FALSE(!detail::ParseYYYY_MM_DD(s, &days))) {
+      return false;
+    }
+    int64_t seconds = days * kSecondsInDay;
+    int64_t nanos = 0;
+
+    if (length > 10) {
+      if (ARROW_PREDICT_FALSE(s[10] != 'T' && s[10] != ' ')) {
+        return false;
+      }
+      // Find the end of the time of day: fraction or UTC offset follow
+      size_t pos = 11;
+      size_t time_end = pos;
+      while (time_end < length && (s[time_end] == ':' ||
+                                   (s[time_end] >= '0' && s[time_end] <= '9'))) {
+        ++time_end;
+      }
+      int64_t time_of_day;
+      if (ARROW_PREDICT_FALSE(
+              !detail::ParseTimeOfDay(s + pos, time_end - pos, &time_of_day))) {
+        return false;
+      }
+      seconds += time_of_day;
+      pos = time_end;
+
+      if (pos < length && s[pos] == '.') {
+        if (ARROW_PREDICT_FALSE(time_end - 11 != 8)) {
+          // Fraction is only allowed after seconds
+          return false;
+        }
+        ++pos;
+        int num_digits = 0;
+        while (pos < length && s[pos] >= '0' && s[pos] <= '9') {
+          if (ARROW_PREDICT_FALSE(++num_digits > 9)) {
+            return false;
+          }
+          nanos = nanos * 10 + (s[pos] - '0');
+          ++pos;
+        }
+        if (ARROW_PREDICT_FALSE(num_digits == 0)) {
+          return false;
+        }
+        for (int i = num_digits; i < 9; ++i) {
+          nanos *= 10;
+        }
+      }
+
+      if (pos < length) {
+        int64_t offset;
+        if (ARROW_PREDICT_FALSE(
+                !detail::ParseUTCOffset(s + pos, length - pos, &offset))) {
+          return false;
+        }
+        seconds -= offset;
+      }
+    }
+
+    const int unit = static_cast<int>(unit_);
+    if (ARROW_PREDICT_FALSE(nanos % kNanosPerUnit[unit] != 0)) {
+      return false;
+    }
+    const int64_t factor = kUnitsPerSecond[unit];
+    const int64_t fraction = nanos / kNanosPerUnit[unit];
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    constexpr int64_t kMin = std::numeric_limits<int64_t>::min();
+    if (seconds >= 0) {
+      if (ARROW_PREDICT_FALSE(seconds > kMax / factor ||
+                              seconds * factor > kMax - fraction)) {
+        return false;
+      }
+      *out = seconds * factor + fraction;
+    } else {
+      // Work from the next second up, so that no intermediate result goes
+      // below the final one
+      const int64_t remainder = fraction - factor;
+      if (ARROW_PREDICT_FALSE(seconds + 1 < kMin / factor ||
+                              (seconds + 1) * factor < kMin - remainder)) {
+        return false;
+      }
+      *out = (seconds + 1) * factor + remainder;
+    }
+    return true;
+  }
+
+ protected:
+  TimeUnit::type unit_;
+};
+
+/// \brief Conversion of "YYYY-MM-DD" strings to days since the UNIX epoch
+template <>
+class StringConverter<Date32Type> {
+ public:
+  using value_type = int32_t;
+
+  bool operator()(const char* s, size_t length, value_type* out) {
+    int64_t days;
+    if (ARROW_PREDICT_FALSE(length != 10 || !detail::ParseYYYY_MM_DD(s, &days))) {
+      return false;
+    }
+    *out = static_cast<value_type>(days);
+    return true;
+  }
+};
+
 }  // namespace internal
 }  // namespace arrow
 
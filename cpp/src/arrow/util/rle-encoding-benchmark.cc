@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "arrow/util/rle-encoding.h"
+
+namespace arrow {
+
+constexpr int kNumValues = 64 * 1024;
+
+// Random values of a bit width in runs of random lengths, 1 to max_run
+static std::vector<uint32_t> MakeRuns(int bit_width, int max_run) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> run_dist(1, max_run);
+  std::uniform_int_distribution<uint32_t> value_dist(
+      0, static_cast<uint32_t>((1ULL << bit_width) - 1));
+  std::vector<uint32_t> values;
+  while (values.size() < kNumValues) {
+    values.insert(values.end(), run_dist(gen), value_dist(gen));
+  }
+  values.resize(kNumValues);
+  return values;
+}
+
+// Encode values one at a time with Put(), or all at once with PutBatch()
+static void BM_RleEncode(benchmark::State& state) {  // NOLINT non-const reference
+  const int bit_width = static_cast<int>(state.range(0));
+  const auto values = MakeRuns(bit_width, static_cast<int>(state.range(1)));
+  const bool batch = state.range(2) != 0;
+
+  const int len = RleEncoder::MaxBufferSize(bit_width, kNumValues) +
+                  RleEncoder::MinBufferSize(bit_width);
+  std::vector<uint8_t> buffer(len);
+  while (state.KeepRunning()) {
+    RleEncoder encoder(buffer.data(), len, bit_width);
+    if (batch) {
+      encoder.PutBatch(values.data(), kNumValues);
+    } else {
+      for (uint32_t value : values) {
+        encoder.Put(value);
+      }
+    }
+    benchmark::DoNotOptimize(encoder.Flush());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void EncodeArguments(benchmark::internal::Benchmark* b) {
+  for (int batch : {0, 1}) {
+    for (int bit_width : {1, 4, 8, 12, 20, 32}) {
+      for (int max_run : {1, 8, 64, 1024}) {
+        b->Args({bit_width, max_run, batch});
+      }
+    }
+  }
+}
+
+// First argument: bit width; second: maximum run length; third: encoding
+// with Put (0) or PutBatch (1)
+BENCHMARK(BM_RleEncode)->Apply(EncodeArguments);
+
+}  // namespace arrow
@@ -17,8 +17,10 @@
 
 // From Apache Impala (incubating) as of 2016-01-29
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -27,7 +29,10 @@
 #include <boost/utility.hpp>  // IWYU pragma: export
 
 #include "arrow/util/bit-stream-utils.h"
+#include "arrow/test-util.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/rle-encoding.h"
 
 using std::vector;
@@ -134,6 +139,42 @@ TEST(BitArray, TestValues) {
   }
 }
 
+// Test that the SIMD unpack kernels match the scalar ones
+TEST(BitArray, TestUnpack32Kernels) {
+  CpuInfo::Init();
+  const bool avx2 = CpuInfo::IsSupported(CpuInfo::AVX2);
+  const bool sse4 = CpuInfo::IsSupported(CpuInfo::SSE4_1);
+
+  // Enough blocks for the SIMD kernels, and a partial one
+  const int num_values = 32 * 40 + 7;
+  std::vector<uint8_t> packed(num_values * 4);
+  random_bytes(packed.size(), 0, packed.data());
+  const auto in = reinterpret_cast<const uint32_t*>(packed.data());
+
+  // All kernels available, then without AVX2, then scalar only
+  for (int disabled = 0; disabled < 3; ++disabled) {
+    if (disabled >= 1 && avx2) {
+      CpuInfo::EnableFeature(CpuInfo::AVX2, false);
+    }
+    if (disabled >= 2 && sse4) {
+      CpuInfo::EnableFeature(CpuInfo::SSE4_1, false);
+    }
+    for (int width = 0; width <= MAX_WIDTH; ++width) {
+      vector<uint32_t> expected(num_values), values(num_values);
+      ASSERT_EQ(32 * 40, internal::unpack32_default(in, expected.data(), num_values,
+                                                    width));
+      ASSERT_EQ(32 * 40, internal::unpack32(in, values.data(), num_values, width));
+      ASSERT_EQ(expected, values) << "width " << width;
+    }
+  }
+  if (avx2) {
+    CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  }
+  if (sse4) {
+    CpuInfo::EnableFeature(CpuInfo::SSE4_1, true);
+  }
+}
+
 // Test some mixed values
 TEST(BitArray, TestMixed) {
   const int len = 1024;
@@ -195,6 +236,16 @@ void ValidateRle(const vector<int>& values, int bit_width, uint8_t* expected_enc
     EXPECT_EQ(memcmp(buffer, expected_encoding, expected_len), 0);
   }
 
+  // Verify batch write gives the same encoding
+  {
+    vector<uint8_t> batch_buffer(len);
+    RleEncoder batch_encoder(batch_buffer.data(), len, bit_width);
+    const int num_values = static_cast<int>(values.size());
+    EXPECT_EQ(num_values, batch_encoder.PutBatch(values.data(), num_values));
+    ASSERT_EQ(encoded_len, batch_encoder.Flush());
+    EXPECT_EQ(memcmp(buffer, batch_buffer.data(), encoded_len), 0);
+  }
+
   // Verify read
   {
     RleDecoder decoder(buffer, len, bit_width);
@@ -430,6 +481,125 @@ TEST(BitRle, RepeatedPattern) {
   ValidateRle(values, 1, NULL, -1);
 }
 
+// Test that PutBatch matches Put for runs of random lengths at all bit widths,
+// when the values are given in batches of random sizes
+TEST(BitRle, PutBatch) {
+  std::mt19937 gen(42);
+  for (int bit_width = 1; bit_width <= MAX_WIDTH; ++bit_width) {
+    for (int max_run : {1, 3, 8, 20, 200}) {
+      std::uniform_int_distribution<int> run_dist(1, max_run);
+      std::uniform_int_distribution<uint32_t> value_dist(
+          0, static_cast<uint32_t>((1ULL << bit_width) - 1));
+      vector<uint32_t> values;
+      while (values.size() < 2000) {
+        values.insert(values.end(), run_dist(gen), value_dist(gen));
+      }
+      const int num_values = static_cast<int>(values.size());
+
+      const int len = RleEncoder::MaxBufferSize(bit_width, num_values) +
+                      RleEncoder::MinBufferSize(bit_width);
+      vector<uint8_t> expected(len);
+      RleEncoder encoder(expected.data(), len, bit_width);
+      for (uint32_t value : values) {
+        ASSERT_TRUE(encoder.Put(value));
+      }
+      const int expected_len = encoder.Flush();
+
+      vector<uint8_t> buffer(len);
+      RleEncoder batch_encoder(buffer.data(), len, bit_width);
+      std::uniform_int_distribution<int> batch_dist(0, 50);
+      for (int i = 0; i < num_values;) {
+        const int batch_size = std::min(batch_dist(gen), num_values - i);
+        ASSERT_EQ(batch_size, batch_encoder.PutBatch(values.data() + i, batch_size));
+        i += batch_size;
+      }
+      ASSERT_EQ(expected_len, batch_encoder.Flush());
+      ASSERT_EQ(memcmp(expected.data(), buffer.data(), expected_len), 0)
+          << "bit_width " << bit_width << " max_run " << max_run;
+
+      RleDecoder decoder(buffer.data(), expected_len, bit_width);
+      vector<uint32_t> values_read(values.size());
+      ASSERT_EQ(num_values, decoder.GetBatch(values_read.data(), num_values));
+      ASSERT_EQ(values, values_read);
+    }
+  }
+}
+
+// Test that PutBatch stops where Put starts failing when the buffer is full
+TEST(BitRle, PutBatchOverflow) {
+  for (int bit_width = 1; bit_width < 32; bit_width += 3) {
+    vector<int64_t> values;
+    for (int i = 0; i < 5000; ++i) {
+      values.push_back(i % 3 == 0 ? 1 : (i / 13) % 2);
+    }
+    const int len = RleEncoder::MinBufferSize(bit_width) + 10;
+
+    vector<uint8_t> expected(len);
+    RleEncoder encoder(expected.data(), len, bit_width);
+    int num_added = 0;
+    while (encoder.Put(values[num_added])) {
+      ++num_added;
+    }
+    const int expected_len = encoder.Flush();
+
+    vector<uint8_t> buffer(len);
+    RleEncoder batch_encoder(buffer.data(), len, bit_width);
+    ASSERT_EQ(num_added,
+              batch_encoder.PutBatch(values.data(), static_cast<int>(values.size())));
+    ASSERT_EQ(expected_len, batch_encoder.Flush());
+    ASSERT_EQ(memcmp(expected.data(), buffer.data(), expected_len), 0);
+  }
+}
+
+// Test decoding values into the valid slots of a bitmap, in two batches
+TEST(BitRle, GetBatchSpaced) {
+  const int bit_width = 5;
+  const int num_slots = 1000;
+  const int64_t valid_bits_offset = 3;
+  vector<bool> is_valid;
+  random_is_valid(num_slots + valid_bits_offset, 0.3, &is_valid);
+  std::shared_ptr<Buffer> valid_bits;
+  ASSERT_OK(GetBitmapFromVector(is_valid, &valid_bits));
+
+  // Runs of both repeated and literal values
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> run_dist(1, 30);
+  std::uniform_int_distribution<int16_t> value_dist(0, (1 << bit_width) - 1);
+  vector<int16_t> values;
+  while (static_cast<int>(values.size()) < num_slots) {
+    values.insert(values.end(), run_dist(gen), value_dist(gen));
+  }
+
+  const int len = RleEncoder::MaxBufferSize(bit_width, num_slots) +
+                  RleEncoder::MinBufferSize(bit_width);
+  vector<uint8_t> buffer(len);
+  RleEncoder encoder(buffer.data(), len, bit_width);
+  ASSERT_EQ(num_slots, encoder.PutBatch(values.data(), num_slots));
+  const int encoded_len = encoder.Flush();
+
+  RleDecoder decoder(buffer.data(), encoded_len, bit_width);
+  vector<int16_t> slots(num_slots, -1);
+  int values_read = 0;
+  for (int batch_size : {num_slots / 3, num_slots - num_slots / 3}) {
+    int null_count = 0;
+    for (int i = values_read; i < values_read + batch_size; ++i) {
+      null_count += !is_valid[valid_bits_offset + i];
+    }
+    ASSERT_EQ(batch_size,
+              decoder.GetBatchSpaced(slots.data() + values_read, batch_size, null_count,
+                                     valid_bits->data(),
+                                     valid_bits_offset + values_read));
+    values_read += batch_size;
+  }
+
+  int value_index = 0;
+  for (int i = 0; i < num_slots; ++i) {
+    if (is_valid[valid_bits_offset + i]) {
+      ASSERT_EQ(values[value_index++], slots[i]) << "at slot " << i;
+    }
+  }
+}
+
 TEST(BitRle, Overflow) {
   for (int bit_width = 1; bit_width < 32; bit_width += 3) {
     int len = RleEncoder::MinBufferSize(bit_width);
@@ -23,6 +23,12 @@
 
 #include <math.h>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
@@ -115,6 +121,13 @@ class RleDecoder {
   template <typename T>
   int GetBatch(T* values, int batch_size);
 
+  /// Like GetBatch but add spacing for null entries: batch_size slots are filled,
+  /// of which the null_count unset in valid_bits are skipped without decoding a
+  /// value.  Returns the number of slots filled.
+  template <typename T>
+  int GetBatchSpaced(T* values, int batch_size, int null_count,
+                     const uint8_t* valid_bits, int64_t valid_bits_offset);
+
   /// Like GetBatch but the values are then decoded using the provided dictionary
   template <typename T>
   int GetBatchWithDict(const T* dictionary, T* values, int batch_size);
@@ -200,6 +213,13 @@ class RleEncoder {
   /// This value must be representable with bit_width_ bits.
   bool Put(uint64_t value);
 
+  /// Encode a batch of values, producing the same output as calling Put() for
+  /// each of them.  Continuations of repeated runs are counted in bulk and
+  /// values are moved into the buffer a group of 8 at a time.  Returns the
+  /// number of values encoded, less than num_values if the buffer is full.
+  template <typename T>
+  int PutBatch(const T* values, int num_values);
+
   /// Flushes any pending values to the underlying buffer.
   /// Returns the total number of bytes written
   int Flush();
@@ -229,6 +249,12 @@ class RleEncoder {
   /// Flushes a repeated run to the underlying buffer.
   void FlushRepeatedRun();
 
+  /// Completes the group of buffered values with the next
+  /// 8 - num_buffered_values_ values and flushes it.  Must not be called while
+  /// in a repeated run.
+  template <typename T>
+  void PutGroup(const T* values);
+
   /// Checks and sets buffer_full_. This must be called after flushing a run to
   /// make sure there are enough bytes remaining to encode the next run.
   void CheckBufferFull();
@@ -275,6 +301,77 @@ class RleEncoder {
   uint8_t* literal_indicator_byte_;
 };
 
+namespace detail {
+
+/// Returns the number of leading values equal to value
+template <typename T>
+inline int CountRepeats(const T* values, int num_values, T value) {
+  int i = 0;
+  while (i < num_values && values[i] == value) {
+    ++i;
+  }
+  return i;
+}
+
+#ifdef __SSE2__
+// Compare four 32-bit values at a time
+inline int CountRepeats32(const void* data, int num_values, uint32_t value) {
+  auto values = reinterpret_cast<const uint32_t*>(data);
+  const __m128i needle = _mm_set1_epi32(static_cast<int32_t>(value));
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+    const int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(chunk, needle));
+    if (mask != 0xFFFF) {
+      // Each unequal value clears 4 bits of the mask
+      int j = 0;
+      while ((mask >> (4 * j)) & 1) {
+        ++j;
+      }
+      return i + j;
+    }
+  }
+  for (; i < num_values && values[i] == value; ++i) {
+  }
+  return i;
+}
+
+template <>
+inline int CountRepeats<int32_t>(const int32_t* values, int num_values, int32_t value) {
+  return CountRepeats32(values, num_values, static_cast<uint32_t>(value));
+}
+
+template <>
+inline int CountRepeats<uint32_t>(const uint32_t* values, int num_values,
+                                  uint32_t value) {
+  return CountRepeats32(values, num_values, value);
+}
+#endif
+
+/// Bit-pack a group of 8 values of at most 32 bits into bit_width bytes, in
+/// the order BitWriter::PutValue() writes them
+inline void PackGroup(const int64_t* values, int bit_width, uint8_t* out) {
+  uint64_t words[4] = {0, 0, 0, 0};
+  int bit = 0;
+  for (int i = 0; i < 8; ++i, bit += bit_width) {
+    const auto value = static_cast<uint64_t>(values[i]);
+    const int word = bit / 64;
+    const int shift = bit % 64;
+    words[word] |= value << shift;
+    if (shift + bit_width > 64) {
+      words[word + 1] |= value >> (64 - shift);
+    }
+  }
+  // The packed bits are stored little-endian, whatever the host order
+  for (int i = 0; i < 4; ++i) {
+    words[i] = BitUtil::ToLittleEndian(words[i]);
+  }
+  memcpy(out, words, bit_width);
+}
+
+}  // namespace detail
+
 template <typename T>
 inline bool RleDecoder::Get(T* val) {
   return GetBatch(val, 1) == 1;
@@ -309,6 +406,80 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+template <typename T>
+inline int RleDecoder::GetBatchSpaced(T* values, int batch_size, int null_count,
+                                      const uint8_t* valid_bits,
+                                      int64_t valid_bits_offset) {
+  DCHECK_GE(bit_width_, 0);
+  int values_read = 0;
+  int remaining_nulls = null_count;
+
+  internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, batch_size);
+
+  while (values_read < batch_size) {
+    bool is_valid = bit_reader.IsSet();
+    bit_reader.Next();
+
+    if (is_valid) {
+      if ((repeat_count_ == 0) && (literal_count_ == 0)) {
+        if (!NextCounts<T>()) return values_read;
+      }
+      if (repeat_count_ > 0) {
+        // The current index is already valid, we don't need to check that again
+        int repeat_batch = 1;
+        repeat_count_--;
+
+        while (repeat_count_ > 0 && (values_read + repeat_batch) < batch_size) {
+          if (bit_reader.IsSet()) {
+            repeat_count_--;
+          } else {
+            remaining_nulls--;
+          }
+          repeat_batch++;
+
+          bit_reader.Next();
+        }
+        std::fill(values + values_read, values + values_read + repeat_batch,
+                  static_cast<T>(current_value_));
+        values_read += repeat_batch;
+      } else if (literal_count_ > 0) {
+        int literal_batch = std::min(batch_size - values_read - remaining_nulls,
+                                     static_cast<int>(literal_count_));
+
+        // Decode the literals, then spread them over the valid slots
+        constexpr int kBufferSize = 1024;
+        T literals[kBufferSize];
+        literal_batch = std::min(literal_batch, kBufferSize);
+        int actual_read = bit_reader_.GetBatch(bit_width_, &literals[0], literal_batch);
+        DCHECK_EQ(actual_read, literal_batch);
+
+        int skipped = 0;
+        int literals_read = 1;
+        values[values_read] = literals[0];
+
+        while (literals_read < literal_batch) {
+          if (bit_reader.IsSet()) {
+            values[values_read + literals_read + skipped] = literals[literals_read];
+            literals_read++;
+          } else {
+            skipped++;
+          }
+
+          bit_reader.Next();
+        }
+        literal_count_ -= literal_batch;
+        values_read += literal_batch + skipped;
+        remaining_nulls -= skipped;
+      }
+    } else {
+      values_read++;
+      remaining_nulls--;
+    }
+  }
+
+  return values_read;
+}
+
 template <typename T>
 inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batch_size) {
   DCHECK_GE(bit_width_, 0);
@@ -476,6 +647,56 @@ inline bool RleEncoder::Put(uint64_t value) {
   return true;
 }
 
+template <typename T>
+inline int RleEncoder::PutBatch(const T* values, int num_values) {
+  int values_put = 0;
+  while (values_put < num_values) {
+    if (ARROW_PREDICT_FALSE(buffer_full_)) break;
+    const int remaining = num_values - values_put;
+
+    if (repeat_count_ >= 8) {
+      // Fast path for long repeated runs: count the values continuing the run
+      DCHECK_EQ(num_buffered_values_, 0);
+      const int run = detail::CountRepeats(values + values_put, remaining,
+                                           static_cast<T>(current_value_));
+      repeat_count_ += run;
+      values_put += run;
+      if (run == remaining) break;
+      // The run has ended, let Put() flush it and start a new group
+      Put(static_cast<uint64_t>(values[values_put++]));
+    } else if (num_buffered_values_ + remaining >= 8) {
+      const int group_size = 8 - num_buffered_values_;
+      PutGroup(values + values_put);
+      values_put += group_size;
+    } else {
+      Put(static_cast<uint64_t>(values[values_put++]));
+    }
+  }
+  return values_put;
+}
+
+template <typename T>
+inline void RleEncoder::PutGroup(const T* values) {
+  DCHECK_LT(repeat_count_, 8);
+  const int group_size = 8 - num_buffered_values_;
+  // As with Put(), the group becomes a repeated run if all its values are equal
+  const T first =
+      num_buffered_values_ == 0 ? values[0] : static_cast<T>(current_value_);
+  const bool all_repeat =
+      repeat_count_ == num_buffered_values_ &&
+      detail::CountRepeats(values, group_size, first) == group_size;
+  for (int i = 0; i < group_size; ++i) {
+    DCHECK(bit_width_ == 64 || static_cast<uint64_t>(values[i]) < (1ULL << bit_width_));
+    buffered_values_[num_buffered_values_ + i] = static_cast<int64_t>(values[i]);
+  }
+  num_buffered_values_ = 8;
+  current_value_ = static_cast<uint64_t>(values[group_size - 1]);
+  // A literal group resets the count in FlushBufferedValues()
+  repeat_count_ = all_repeat ? 8 : 0;
+  DCHECK_EQ(literal_count_ % 8, 0);
+  FlushBufferedValues(false);
+}
+
 inline void RleEncoder::FlushLiteralRun(bool update_indicator_byte) {
   if (literal_indicator_byte_ == NULL) {
     // The literal indicator byte has not been reserved yet, get one now.
@@ -483,10 +704,17 @@ inline void RleEncoder::FlushLiteralRun(bool update_indicator_byte) {
     DCHECK(literal_indicator_byte_ != NULL);
   }
 
-  // Write all the buffered values as bit packed literals
-  for (int i = 0; i < num_buffered_values_; ++i) {
-    bool success = bit_writer_.PutValue(buffered_values_[i], bit_width_);
-    DCHECK(success) << "There is a bug in using CheckBufferFull()";
+  // Write all the buffered values as bit packed literals.  Literal groups are
+  // byte aligned, so a full group is packed straight into bit_width_ bytes.
+  if (num_buffered_values_ == 8 && bit_width_ <= 32) {
+    uint8_t* group = bit_writer_.GetNextBytePtr(bit_width_);
+    DCHECK(group != NULL) << "There is a bug in using CheckBufferFull()";
+    detail::PackGroup(buffered_values_, bit_width_, group);
+  } else {
+    for (int i = 0; i < num_buffered_values_; ++i) {
+      bool success = bit_writer_.PutValue(buffered_values_[i], bit_width_);
+      DCHECK(success) << "There is a bug in using CheckBufferFull()";
+    }
   }
   num_buffered_values_ = 0;
 
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <functional>
@@ -30,6 +31,7 @@
 #include "arrow/test-util.h"
 #include "arrow/util/io-util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/thread-pool.h"
 
 namespace arrow {
@@ -392,5 +394,48 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, IOCapacity) {
+  auto pool = GetIOThreadPool();
+  ASSERT_NE(pool, GetCpuThreadPool());
+  int capacity = pool->GetCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 1));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 1);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+}
+
+TEST(TestBoundedParallelFor, Basics) {
+  const int num_tasks = 100;
+  std::vector<int> results(num_tasks, 0);
+  std::atomic<int> running(0);
+  std::atomic<int> max_running(0);
+
+  ASSERT_OK(BoundedParallelFor(3, num_tasks, [&](int i) {
+    const int now = ++running;
+    int seen = max_running.load();
+    while (now > seen && !max_running.compare_exchange_weak(seen, now)) {
+    }
+    sleep_for(1e-4);
+    results[i] = i * 2;
+    --running;
+    return Status::OK();
+  }));
+  for (int i = 0; i < num_tasks; ++i) {
+    ASSERT_EQ(i * 2, results[i]);
+  }
+  ASSERT_LE(max_running.load(), 3);
+
+  // An error stops the remaining tasks from being started
+  std::atomic<int> started(0);
+  Status st = BoundedParallelFor(1, num_tasks, [&](int i) {
+    ++started;
+    return i == 10 ? Status::Invalid("xxx") : Status::OK();
+  });
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_EQ(11, started.load());
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -279,9 +279,9 @@ int ThreadPool::DefaultCapacity() {
 }
 
 // Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+std::shared_ptr<ThreadPool> ThreadPool::MakeGlobalThreadPool(int capacity) {
   std::shared_ptr<ThreadPool> pool;
-  DCHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  DCHECK_OK(ThreadPool::Make(capacity, &pool));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -292,11 +292,27 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return pool;
 }
 
+std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+  return MakeGlobalThreadPool(ThreadPool::DefaultCapacity());
+}
+
+// IO tasks mostly block, so their number is unrelated to the number of cores
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  return MakeGlobalThreadPool(kDefaultIOThreadPoolCapacity);
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
 }
 
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -305,4 +321,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
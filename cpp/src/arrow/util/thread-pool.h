@@ -46,6 +46,14 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 // for CPU-bound tasks.
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+// Get the number of worker threads used by the process-global thread pool
+// for IO-bound tasks, which mostly wait on reads.
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+// Set the number of worker threads used by the process-global thread pool
+// for IO-bound tasks.
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -128,6 +136,7 @@ class ARROW_EXPORT ThreadPool {
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   struct State;
 
@@ -151,6 +160,8 @@ class ARROW_EXPORT ThreadPool {
                          std::list<std::thread>::iterator it);
 
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
+  static std::shared_ptr<ThreadPool> MakeGlobalThreadPool(int capacity);
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -163,6 +174,11 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for IO-bound tasks.  Tasks running
+// on the CPU thread pool may wait on tasks submitted to this pool, but not
+// the other way around.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -58,7 +58,8 @@ from pyarrow.lib import (null, bool_,
                          time32, time64, timestamp, date32, date64,
                          float16, float32, float64,
                          binary, string, decimal128,
-                         list_, struct, union, dictionary, field,
+                         large_binary, large_string,
+                         list_, large_list, struct, union, dictionary, field,
                          type_for_alias,
                          DataType,
                          Field,
@@ -74,8 +75,9 @@ from pyarrow.lib import (null, bool_,
                          Int16Array, UInt16Array,
                          Int32Array, UInt32Array,
                          Int64Array, UInt64Array,
-                         ListArray, UnionArray,
+                         ListArray, LargeListArray, UnionArray,
                          BinaryArray, StringArray,
+                         LargeBinaryArray, LargeStringArray,
                          FixedSizeBinaryArray,
                          DictionaryArray,
                          Date32Array, Date64Array,
@@ -86,7 +88,9 @@ from pyarrow.lib import (null, bool_,
                          Int8Value, Int16Value, Int32Value, Int64Value,
                          UInt8Value, UInt16Value, UInt32Value, UInt64Value,
                          HalfFloatValue, FloatValue, DoubleValue, ListValue,
+                         LargeListValue,
                          BinaryValue, StringValue, FixedSizeBinaryValue,
+                         LargeBinaryValue, LargeStringValue,
                          DecimalValue, UnionValue, StructValue, DictionaryValue,
                          Date32Value, Date64Value,
                          Time32Value, Time64Value,
@@ -111,6 +115,7 @@ from pyarrow.lib import (ChunkedArray, Column, RecordBatch, Table,
                          concat_tables)
 
 from pyarrow.lib import (ArrowException,
+                         ArrowCapacityError,
                          ArrowKeyError,
                          ArrowInvalid,
                          ArrowIOError,
@@ -1027,6 +1027,18 @@ cdef class BinaryArray(Array):
     pass
 
 
+cdef class LargeListArray(Array):
+    pass
+
+
+cdef class LargeStringArray(Array):
+    pass
+
+
+cdef class LargeBinaryArray(Array):
+    pass
+
+
 cdef class DictionaryArray(Array):
 
     def dictionary_encode(self):
@@ -1220,9 +1232,12 @@ cdef dict _array_classes = {
     _Type_FLOAT: FloatArray,
     _Type_DOUBLE: DoubleArray,
     _Type_LIST: ListArray,
+    _Type_LARGE_LIST: LargeListArray,
     _Type_UNION: UnionArray,
     _Type_BINARY: BinaryArray,
     _Type_STRING: StringArray,
+    _Type_LARGE_BINARY: LargeBinaryArray,
+    _Type_LARGE_STRING: LargeStringArray,
     _Type_DICTIONARY: DictionaryArray,
     _Type_FIXED_SIZE_BINARY: FixedSizeBinaryArray,
     _Type_DECIMAL: Decimal128Array,
@@ -543,6 +543,37 @@ def test_sequence_utf8_to_unicode():
         pa.array([val], type=pa.string())
 
 
+@pytest.mark.large_memory
+def test_sequence_bytes_exceed_2gb():
+    v = b'x' * 2**30
+
+    # Values past the 2GB limit of a BinaryArray start a new chunk
+    arr = pa.array([v, None, v, b'y'])
+    assert isinstance(arr, pa.ChunkedArray)
+    assert arr.num_chunks == 2
+    assert [len(chunk) for chunk in arr.iterchunks()] == [2, 2]
+    assert arr.null_count == 1
+    assert arr.chunk(1)[1].as_py() == b'y'
+    arr = None
+
+    arr = pa.array([v, v], type=pa.string())
+    assert arr.num_chunks == 2
+    assert arr.type == pa.string()
+
+
+@pytest.mark.large_memory
+@pytest.mark.parametrize('data', [
+    lambda v: [[v], [b'y', v]],
+    lambda v: [{'a': v}, {'a': v}]
+], ids=['list', 'struct'])
+def test_nested_bytes_exceed_2gb(data):
+    v = b'x' * 2**30
+
+    # The values of a child array cannot be split across chunks
+    with pytest.raises(pa.ArrowCapacityError):
+        pa.array(data(v))
+
+
 def test_sequence_fixed_size_bytes():
     data = [b'foof', None, bytearray(b'barb'), b'2346']
     arr = pa.array(data, type=pa.binary(4))
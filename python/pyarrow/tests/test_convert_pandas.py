@@ -1195,6 +1195,30 @@ class TestConvertStringLikeTypes(object):
         table = pa.Table.from_pandas(df)
         assert table[0].data.num_chunks == 2
 
+    @pytest.mark.large_memory
+    @pytest.mark.parametrize('value', [b'x' * 2**24, u'x' * 2**24],
+                             ids=['bytes', 'unicode'])
+    def test_numpy_strings_exceed_2gb(self, value):
+        # A read-only view repeating one 16MB value, 2.1GB in total
+        values = np.broadcast_to(np.array([value]), (130,))
+        arr = pa.array(values)
+        assert isinstance(arr, pa.ChunkedArray)
+        assert arr.num_chunks == 2
+        assert len(arr) == 130
+        assert arr.chunk(1)[0].as_py() == value
+
+    def test_large_string_like_to_pandas(self):
+        cases = [(pa.string(), pa.large_string(), [u'foo', None, u'mañana']),
+                 (pa.binary(), pa.large_binary(), [b'foo', None, b'\x00'])]
+        for small_type, large_type, values in cases:
+            arr = pa.array(values, type=small_type).cast(large_type)
+            assert arr.type == large_type
+            assert arr.to_pandas().tolist() == values
+
+            table = pa.Table.from_arrays([arr], names=['strings'])
+            expected = pd.DataFrame({'strings': values})
+            tm.assert_frame_equal(table.to_pandas(), expected)
+
     def test_fixed_size_bytes(self):
         values = [b'foo', None, bytearray(b'bar'), None, None, b'hey']
         df = pd.DataFrame({'strings': values})
@@ -45,7 +45,10 @@ def get_many_types():
         pa.string(),
         pa.binary(),
         pa.binary(10),
+        pa.large_string(),
+        pa.large_binary(),
         pa.list_(pa.int32()),
+        pa.large_list(pa.int32()),
         pa.struct([pa.field('a', pa.int32()),
                    pa.field('b', pa.int8()),
                    pa.field('c', pa.string())]),
@@ -222,6 +225,13 @@ def test_list_type():
     assert ty.value_type == pa.int64()
 
 
+def test_large_list_type():
+    ty = pa.large_list(pa.string())
+    assert ty.value_type == pa.string()
+    assert ty != pa.list_(pa.string())
+    assert str(ty) == 'large_list<item: string>'
+
+
 def test_struct_type():
     fields = [pa.field('a', pa.int64()),
               pa.field('a', pa.int32()),
@@ -40,6 +40,8 @@ cdef dict _pandas_type_map = {
     _Type_BINARY: np.object_,
     _Type_FIXED_SIZE_BINARY: np.object_,
     _Type_STRING: np.object_,
+    _Type_LARGE_BINARY: np.object_,
+    _Type_LARGE_STRING: np.object_,
     _Type_LIST: np.object_,
     _Type_DECIMAL: np.object_,
 }
@@ -203,6 +205,20 @@ cdef class ListType(DataType):
         return pyarrow_wrap_data_type(self.list_type.value_type())
 
 
+cdef class LargeListType(DataType):
+
+    cdef void init(self, const shared_ptr[CDataType]& type):
+        DataType.init(self, type)
+        self.list_type = <const CLargeListType*> type.get()
+
+    def __reduce__(self):
+        return large_list, (self.value_type,)
+
+    @property
+    def value_type(self):
+        return pyarrow_wrap_data_type(self.list_type.value_type())
+
+
 cdef class StructType(DataType):
 
     cdef void init(self, const shared_ptr[CDataType]& type):
@@ -1181,6 +1197,22 @@ def binary(int length=-1):
     return pyarrow_wrap_data_type(fixed_size_binary_type)
 
 
+def large_string():
+    """
+    Create UTF8 variable-length string type with 64-bit offsets, for
+    columns holding more than 2GB of character data
+    """
+    return primitive_type(_Type_LARGE_STRING)
+
+
+def large_binary():
+    """
+    Create variable-length binary type with 64-bit offsets, for columns
+    holding more than 2GB of data
+    """
+    return primitive_type(_Type_LARGE_BINARY)
+
+
 cpdef ListType list_(value_type):
     """
     Create ListType instance from child data type or field
@@ -1210,6 +1242,34 @@ cpdef ListType list_(value_type):
     return out
 
 
+cpdef LargeListType large_list(value_type):
+    """
+    Create LargeListType instance from child data type or field. Like
+    list_, but with 64-bit offsets
+
+    Parameters
+    ----------
+    value_type : DataType or Field
+
+    Returns
+    -------
+    list_type : DataType
+    """
+    cdef:
+        shared_ptr[CDataType] list_type
+        LargeListType out = LargeListType.__new__(LargeListType)
+
+    if isinstance(value_type, DataType):
+        list_type.reset(new CLargeListType((<DataType> value_type).sp_type))
+    elif isinstance(value_type, Field):
+        list_type.reset(new CLargeListType((<Field> value_type).sp_field))
+    else:
+        raise ValueError('LargeList requires DataType or Field')
+
+    out.init(list_type)
+    return out
+
+
 cpdef DictionaryType dictionary(DataType index_type, Array dict_values,
                                 bint ordered=False):
     """
@@ -1360,6 +1420,9 @@ cdef dict _type_aliases = {
     'str': string,
     'utf8': string,
     'binary': binary,
+    'large_string': large_string,
+    'large_utf8': large_string,
+    'large_binary': large_binary,
     'date32': date32,
     'date64': date64,
     'date32[day]': date32,